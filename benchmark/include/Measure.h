@@ -0,0 +1,78 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+/*
+*	------- Measure -------
+*	Register runs operation(inputs...) once per benchmark iteration.
+*
+*	Inputs are copied into the benchmark & passed through DoNotOptimize
+*	every iteration so the compiler can neither hoist nor constant fold
+*	the operation. Each iteration counts as one item, the JSON output
+*	reports real_time / cpu_time in ns per operation & items_per_second.
+*
+*	Benchmarks are named "Type/Operation/Library" so the LibMath & glm
+*	versions of an operation sort next to each other.
+*/
+
+template<typename Operation, typename... Inputs>
+inline void Measure(benchmark::State& state, Operation operation, Inputs... inputs)
+{
+	for (auto _ : state)
+	{
+		(benchmark::DoNotOptimize(inputs), ...);
+
+		auto result = operation(inputs...);
+		benchmark::DoNotOptimize(result);
+	}
+
+	state.SetItemsProcessed(state.iterations());
+}
+
+template<typename Operation, typename... Inputs>
+inline void Register(std::string const& name, Operation operation, Inputs const&... inputs)
+{
+	benchmark::RegisterBenchmark(name, [=](benchmark::State& state)
+	{
+		Measure(state, operation, inputs...);
+	})->Unit(benchmark::kNanosecond);
+}
+
+// Also reports the sum of the values returned by operation per second as the given counter (e.g. pairs found)
+template<typename Operation, typename... Inputs>
+inline void RegisterRate(std::string const& name, std::string const& counter, Operation operation, Inputs const&... inputs)
+{
+	benchmark::RegisterBenchmark(name, [=](benchmark::State& state)
+	{
+		double total = 0.0;
+
+		for (auto _ : state)
+		{
+			(benchmark::DoNotOptimize(inputs), ...);
+
+			auto result = operation(inputs...);
+			benchmark::DoNotOptimize(result);
+
+			total += static_cast<double>(result);
+		}
+
+		state.SetItemsProcessed(state.iterations());
+		state.counters[counter] = benchmark::Counter(total, benchmark::Counter::kIsRate);
+	})->Unit(benchmark::kNanosecond);
+}
+
+void RegisterArithmeticBenchmarks(void);
+void RegisterTrigonometryBenchmarks(void);
+void RegisterVectorBenchmarks(void);
+void RegisterMatrixBenchmarks(void);
+void RegisterQuaternionBenchmarks(void);
+void RegisterTransformHierarchyBenchmarks(void);
+void RegisterGeometryBenchmarks(void);
+void RegisterBVHBenchmarks(void);
+void RegisterSweepAndPruneBenchmarks(void);
+void RegisterExpressionBenchmarks(void);
+void RegisterPackedBenchmarks(void);
+void RegisterFixedBenchmarks(void);
+void RegisterDeterministicBenchmarks(void);
@@ -0,0 +1,50 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "Measure.h"
+
+#include "LibMath/Arithmetic.h"
+
+#include <glm/common.hpp>
+#include <glm/exponential.hpp>
+#include <glm/gtx/integer.hpp>
+
+void RegisterArithmeticBenchmarks(void)
+{
+	const float value = -12.75f;
+	const float min = -5.0f;
+	const float max = 5.0f;
+	const unsigned int integer = 1521u;
+	const float positive = 1521.5f;
+	const unsigned int power = 7u;
+	const int factorial = 12;
+
+	Register("Arithmetic/Abs/LibMath", [](float val) { return math::Abs(val); }, value);
+	Register("Arithmetic/Abs/glm", [](float val) { return glm::abs(val); }, value);
+
+	Register("Arithmetic/Min/LibMath", [](float val1, float val2) { return math::Min(val1, val2); }, value, min);
+	Register("Arithmetic/Min/glm", [](float val1, float val2) { return glm::min(val1, val2); }, value, min);
+
+	Register("Arithmetic/Max/LibMath", [](float val1, float val2) { return math::Max(val1, val2); }, value, max);
+	Register("Arithmetic/Max/glm", [](float val1, float val2) { return glm::max(val1, val2); }, value, max);
+
+	Register("Arithmetic/Clamp/LibMath", [](float val, float low, float high) { return math::Clamp(val, low, high); }, value, min, max);
+	Register("Arithmetic/Clamp/glm", [](float val, float low, float high) { return glm::clamp(val, low, high); }, value, min, max);
+
+	Register("Arithmetic/Floor/LibMath", [](float val) { return math::Floor(val); }, value);
+	Register("Arithmetic/Floor/glm", [](float val) { return glm::floor(val); }, value);
+
+	Register("Arithmetic/Ceiling/LibMath", [](float val) { return math::Ceiling(val); }, value);
+	Register("Arithmetic/Ceiling/glm", [](float val) { return glm::ceil(val); }, value);
+
+	Register("Arithmetic/Power/LibMath", [](unsigned int val, unsigned int exponent) { return math::Power(val, exponent); }, integer, power);
+	Register("Arithmetic/Power/glm", [](unsigned int val, unsigned int exponent) { return glm::pow(val, exponent); }, integer, power);
+
+	Register("Arithmetic/Sqrt/LibMath", [](unsigned int val) { return math::Sqrt(val); }, integer);
+	Register("Arithmetic/Sqrt/glm", [](unsigned int val) { return glm::sqrt(val); }, integer);
+
+	Register("Arithmetic/RSqrt/LibMath", [](float val) { return math::RSqrt(val); }, positive);
+	Register("Arithmetic/RSqrtFast/LibMath", [](float val) { return math::RSqrt(val, math::Precision::Fast); }, positive);
+	Register("Arithmetic/RSqrt/glm", [](float val) { return glm::inversesqrt(val); }, positive);
+
+	Register("Arithmetic/Factorial/LibMath", [](int val) { return math::Factorial(val); }, factorial);
+	Register("Arithmetic/Factorial/glm", [](int val) { return glm::factorial(val); }, factorial);
+}
@@ -0,0 +1,95 @@
+#include "Measure.h"
+
+#include "LibMath/Geometry.h"
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+void RegisterBVHBenchmarks(void)
+{
+	// 200k small boxes spread over a 200 x 100 x 400 scene
+	constexpr size_t primitiveCount = 200000;
+	constexpr size_t rayCount = 1024;
+
+	std::vector<LibMath::AABB<float>> boxes;
+	std::vector<LibMath::Vector3<float>> mins;
+	std::vector<LibMath::Vector3<float>> maxs;
+
+	for (size_t i = 0; i < primitiveCount; ++i)
+	{
+		const float value = static_cast<float>(i);
+		const LibMath::Vector3<float> center(std::fmod(value * 7.31f, 200.0f) - 100.0f, std::fmod(value * 3.17f, 100.0f) - 50.0f, std::fmod(value * 1.93f, 400.0f) - 300.0f);
+		const LibMath::Vector3<float> extents(std::fmod(value * 0.37f, 3.0f) * 0.2f + 0.01f, std::fmod(value * 0.71f, 2.0f) * 0.2f + 0.01f, std::fmod(value * 0.13f, 4.0f) * 0.2f + 0.01f);
+
+		boxes.emplace_back(center - extents, center + extents);
+		mins.push_back(boxes.back().Min());
+		maxs.push_back(boxes.back().Max());
+	}
+
+	std::vector<LibMath::Ray<float>> rays;
+
+	for (size_t i = 0; i < rayCount; ++i)
+	{
+		const float value = static_cast<float>(i);
+
+		rays.emplace_back(
+			LibMath::Vector3<float>(std::fmod(value * 13.1f, 200.0f) - 100.0f, std::fmod(value * 7.7f, 100.0f) - 50.0f, 50.0f),
+			LibMath::Vector3<float>(std::fmod(value * 0.013f, 0.2f) - 0.1f, std::fmod(value * 0.029f, 0.2f) - 0.1f, -1.0f)
+		);
+	}
+
+	const auto bvh = std::make_shared<LibMath::BVH<float>>();
+	bvh->Build(boxes);
+
+	const auto minStream = std::make_shared<LibMath::Vector3Stream<float>>(mins.data(), primitiveCount);
+	const auto maxStream = std::make_shared<LibMath::Vector3Stream<float>>(maxs.data(), primitiveCount);
+	const auto distances = std::make_shared<std::vector<float>>(primitiveCount);
+
+	Register("BVH/Build200k/LibMath", [=](std::vector<LibMath::AABB<float>> const& bounds)
+	{
+		LibMath::BVH<float> tree;
+		tree.Build(bounds);
+
+		return tree.NodeCount();
+	}, boxes);
+
+	Register("BVH/Refit200k/LibMath", [=](std::vector<LibMath::AABB<float>> const& bounds)
+	{
+		bvh->Refit(bounds);
+		return bvh->NodeCount();
+	}, boxes);
+
+	// Closest hit of 1024 rays
+	Register("BVH/Raycast1024/LibMath", [=](std::vector<LibMath::Ray<float>> const& queries)
+	{
+		size_t hitCount = 0;
+
+		for (LibMath::Ray<float> const& ray : queries)
+		{
+			float distance;
+			uint32_t primitive;
+
+			hitCount += bvh->Raycast(ray, distance, primitive) ? 1 : 0;
+		}
+
+		return hitCount;
+	}, rays);
+
+	Register("BVH/Query1024/LibMath", [=](std::vector<LibMath::Ray<float>> const& queries)
+	{
+		size_t overlapCount = 0;
+
+		for (LibMath::Ray<float> const& ray : queries)
+			overlapCount += bvh->Query(LibMath::AABB<float>::FromCenter(ray.PointAt(100.0f), LibMath::Vector3<float>(2.0f)), [](uint32_t) {});
+
+		return overlapCount;
+	}, rays);
+
+	// One ray against every box with the batched SIMD test, no hierarchy
+	Register("BVH/Raycast1/BruteForce", [=](std::vector<LibMath::Ray<float>> const& queries)
+	{
+		return queries[0].IntersectBoxes(*minStream, *maxStream, *distances);
+	}, rays);
+}
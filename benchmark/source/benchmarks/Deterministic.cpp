@@ -0,0 +1,49 @@
+#include "Measure.h"
+
+#include "LibMath/Arithmetic.h"
+#include "LibMath/Deterministic.h"
+
+#include <cmath>
+#include <string>
+
+namespace
+{
+	// <cmath> (the default runtime path) next to math::deterministic (LIBMATH_DETERMINISTIC builds),
+	// named "Type/Operation/Cmath" & "Type/Operation/Deterministic"
+	template<typename T>
+	void RegisterType(std::string const& type)
+	{
+		const T angle = static_cast<T>(1.75);
+		const T value = static_cast<T>(-0.375);
+
+		Register(type + "/Sin/Cmath", [](T val) { return std::sin(val); }, angle);
+		Register(type + "/Sin/Deterministic", [](T val) { return static_cast<T>(math::deterministic::Sin(val)); }, angle);
+
+		Register(type + "/Cos/Cmath", [](T val) { return std::cos(val); }, angle);
+		Register(type + "/Cos/Deterministic", [](T val) { return static_cast<T>(math::deterministic::Cos(val)); }, angle);
+
+		Register(type + "/Tan/Cmath", [](T val) { return std::tan(val); }, angle);
+		Register(type + "/Tan/Deterministic", [](T val) { return static_cast<T>(math::deterministic::Tan(val)); }, angle);
+
+		Register(type + "/Asin/Cmath", [](T val) { return std::asin(val); }, value);
+		Register(type + "/Asin/Deterministic", [](T val) { return static_cast<T>(math::deterministic::Asin(val)); }, value);
+
+		Register(type + "/Acos/Cmath", [](T val) { return std::acos(val); }, value);
+		Register(type + "/Acos/Deterministic", [](T val) { return static_cast<T>(math::deterministic::Acos(val)); }, value);
+
+		Register(type + "/Atan/Cmath", [](T val) { return std::atan(val); }, angle);
+		Register(type + "/Atan/Deterministic", [](T val) { return static_cast<T>(math::deterministic::Atan(val)); }, angle);
+
+		Register(type + "/Cbrt/Cmath", [](T val) { return std::cbrt(val); }, angle);
+		Register(type + "/Cbrt/Deterministic", [](T val) { return static_cast<T>(math::deterministic::Root(val, 3)); }, angle);
+	}
+}
+
+void RegisterDeterministicBenchmarks(void)
+{
+	RegisterType<float>("Float");
+	RegisterType<double>("Double");
+
+	// Precision::Fast sqrt, the rsqrt estimate or the exact division of deterministic builds
+	Register("Float/SqrtFast/LibMath", [](float val) { return math::Sqrt(val, math::Precision::Fast); }, 1.75f);
+}
@@ -0,0 +1,100 @@
+#include "Measure.h"
+
+#include "LibMath/Expression.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// position + velocity * step - drag over every element
+	struct Particles
+	{
+		explicit Particles(size_t count)
+			: m_positions(count), m_velocities(count), m_drags(count), m_result(count),
+			m_positionArray(count), m_velocityArray(count), m_dragArray(count), m_scaled(count), m_moved(count), m_resultArray(count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float value = static_cast<float>(i);
+
+				m_positions.Set(i, LibMath::Vector3<float>(value, value * 0.5f, -value));
+				m_velocities.Set(i, LibMath::Vector3<float>(1.0f, value * 0.01f, 2.0f));
+				m_drags.Set(i, LibMath::Vector3<float>(0.001f, 0.002f, value * 0.0001f));
+			}
+
+			m_positions.Store(m_positionArray.data());
+			m_velocities.Store(m_velocityArray.data());
+			m_drags.Store(m_dragArray.data());
+		}
+
+		LibMath::Vector3Stream<float>			m_positions;
+		LibMath::Vector3Stream<float>			m_velocities;
+		LibMath::Vector3Stream<float>			m_drags;
+		LibMath::Vector3Stream<float>			m_result;
+
+		std::vector<LibMath::Vector3<float>>	m_positionArray;
+		std::vector<LibMath::Vector3<float>>	m_velocityArray;
+		std::vector<LibMath::Vector3<float>>	m_dragArray;
+		std::vector<LibMath::Vector3<float>>	m_scaled;
+		std::vector<LibMath::Vector3<float>>	m_moved;
+		std::vector<LibMath::Vector3<float>>	m_resultArray;
+	};
+
+	constexpr float g_step = 0.016f;
+}
+
+void RegisterExpressionBenchmarks(void)
+{
+	using namespace LibMath::expr;
+
+	// Vectors
+	const LibMath::Vector3<float> vec3A(1.5f, -2.0f, 3.25f);
+	const LibMath::Vector3<float> vec3B(-0.25f, 4.0f, 0.5f);
+	const LibMath::Vector4<float> vec4A(1.5f, -2.0f, 3.25f, 1.0f);
+	const LibMath::Vector4<float> vec4B(-0.25f, 4.0f, 0.5f, 2.0f);
+
+	Register("Vector3/AddScaled/LibMath", [](auto vec1, auto vec2, float step) { return vec1 + vec2 * step - vec1; }, vec3A, vec3B, g_step);
+	Register("Vector3/AddScaled/Expression", [](auto vec1, auto vec2, float step) { return Evaluate(Lazy(vec1) + Lazy(vec2) * step - vec1); }, vec3A, vec3B, g_step);
+	Register("Vector4/AddScaled/LibMath", [](auto vec1, auto vec2, float step) { return vec1 + vec2 * step - vec1; }, vec4A, vec4B, g_step);
+	Register("Vector4/AddScaled/Expression", [](auto vec1, auto vec2, float step) { return Evaluate(Lazy(vec1) + Lazy(vec2) * step - vec1); }, vec4A, vec4B, g_step);
+
+	// Streams in cache & streams large enough to leave the caches
+	for (size_t count : { static_cast<size_t>(4096), static_cast<size_t>(1 << 20) })
+	{
+		const auto particles = std::make_shared<Particles>(count);
+		const std::string name = "Vector3Stream/AddScaled" + ((count >= (1 << 20)) ? std::to_string(count >> 20) + "M" : std::to_string(count >> 10) + "k");
+
+		// One temporary array per operator, 3 passes over memory
+		Register(name + "/Temporaries", [=]()
+		{
+			for (size_t i = 0; i < count; ++i)
+				particles->m_scaled[i] = particles->m_velocityArray[i] * g_step;
+
+			for (size_t i = 0; i < count; ++i)
+				particles->m_moved[i] = particles->m_positionArray[i] + particles->m_scaled[i];
+
+			for (size_t i = 0; i < count; ++i)
+				particles->m_resultArray[i] = particles->m_moved[i] - particles->m_dragArray[i];
+
+			return particles->m_resultArray[count - 1][0];
+		});
+
+		// Vector3 operators per element
+		Register(name + "/Loop", [=]()
+		{
+			for (size_t i = 0; i < count; ++i)
+				particles->m_resultArray[i] = particles->m_positionArray[i] + particles->m_velocityArray[i] * g_step - particles->m_dragArray[i];
+
+			return particles->m_resultArray[count - 1][0];
+		});
+
+		Register(name + "/Expression", [=]()
+		{
+			Evaluate(Lazy(particles->m_positions) + Lazy(particles->m_velocities) * g_step - particles->m_drags, particles->m_result);
+
+			return particles->m_result.X()[count - 1];
+		});
+	}
+}
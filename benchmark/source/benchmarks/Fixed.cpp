@@ -0,0 +1,52 @@
+#include "Measure.h"
+
+#include "LibMath/Fixed.h"
+#include "LibMath/Matrix.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Vector.h"
+
+#include <string>
+
+namespace
+{
+	// Same operations on float & Fixed<16, 16>, named "Type/Operation/Float" & "Type/Operation/Fixed16_16"
+	template<typename T>
+	void RegisterType(std::string const& library)
+	{
+		const T value1 = T(1.75f);
+		const T value2 = T(-0.375f);
+
+		Register("Scalar/Multiply/" + library, [](T val1, T val2) { return val1 * val2; }, value1, value2);
+		Register("Scalar/Divide/" + library, [](T val1, T val2) { return val1 / val2; }, value1, value2);
+		Register("Scalar/Sqrt/" + library, [](T val) { return LibMath::Sqrt(val); }, value1);
+		Register("Scalar/Sin/" + library, [](T val) { return LibMath::Sin(val); }, value1);
+		Register("Scalar/Atan/" + library, [](T val) { return LibMath::Atan(val); }, value1);
+
+		const LibMath::Vector3<T> vec3A(T(1.5f), T(-2.0f), T(3.25f));
+		const LibMath::Vector3<T> vec3B(T(-0.25f), T(4.0f), T(0.5f));
+
+		Register("Vector3/Dot/" + library, [](auto vec1, auto vec2) { return vec1.Dot(vec2); }, vec3A, vec3B);
+		Register("Vector3/Cross/" + library, [](auto vec1, auto vec2) { return vec1.Cross(vec2); }, vec3A, vec3B);
+		Register("Vector3/Normalize/" + library, [](auto vec) { return vec.Normalize(); }, vec3A);
+
+		LibMath::Matrix4<T> matrix = LibMath::Matrix4<T>::Identity();
+		matrix.Translate(vec3A);
+		matrix.Scale(T(0.5f));
+
+		Register("Matrix4/Multiply/" + library, [](auto mat1, auto mat2) { return mat1 * mat2; }, matrix, matrix);
+		Register("Matrix4/Inverse/" + library, [](auto mat) { return mat.Inverse(); }, matrix);
+
+		const LibMath::Quaternion<T> quatA = LibMath::Quaternion<T>::AngleAxis(T(0.7f), vec3A);
+		const LibMath::Quaternion<T> quatB = LibMath::Quaternion<T>::AngleAxis(T(-1.2f), vec3B);
+
+		Register("Quaternion/Multiply/" + library, [](auto quat1, auto quat2) { return quat1 * quat2; }, quatA, quatB);
+		Register("Quaternion/RotateVector/" + library, [](auto quat, auto vec) { return quat.RotateVector(vec); }, quatA, vec3B);
+		Register("Quaternion/Slerp/" + library, [](auto quat1, auto quat2) { return LibMath::Slerp(quat1, quat2, T(0.3f)); }, quatA, quatB);
+	}
+}
+
+void RegisterFixedBenchmarks(void)
+{
+	RegisterType<float>("Float");
+	RegisterType<LibMath::Fixed16_16>("Fixed16_16");
+}
@@ -0,0 +1,141 @@
+#include "Measure.h"
+
+#include "LibMath/Geometry.h"
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+void RegisterGeometryBenchmarks(void)
+{
+	// One frame of 500k objects spread around an orthographic frustum
+	constexpr size_t objectCount = 500000;
+
+	LibMath::Matrix4<float> view = LibMath::Matrix4<float>::Perspective(LibMath::Vector3<float>(0.0f, 2.0f, 10.0f), LibMath::Vector3<float>(0.0f), LibMath::Vector3<float>(0.0f, 1.0f, 0.0f));
+	LibMath::Matrix4<float> projection = LibMath::Matrix4<float>::Ortho(-40.0f, 40.0f, -25.0f, 25.0f, 0.1f, 300.0f);
+
+	const LibMath::Frustum<float> frustum(projection * view);
+
+	std::vector<LibMath::Vector3<float>> centers;
+	std::vector<LibMath::Vector3<float>> extents;
+	std::vector<float> radii;
+
+	for (size_t i = 0; i < objectCount; ++i)
+	{
+		const float value = static_cast<float>(i);
+
+		centers.emplace_back(std::fmod(value * 7.31f, 200.0f) - 100.0f, std::fmod(value * 3.17f, 100.0f) - 50.0f, std::fmod(value * 1.93f, 400.0f) - 300.0f);
+		extents.emplace_back(std::fmod(value * 0.37f, 3.0f), std::fmod(value * 0.71f, 2.0f), std::fmod(value * 0.13f, 4.0f));
+		radii.push_back(std::fmod(value * 0.29f, 5.0f));
+	}
+
+	// Benchmarks run after registration, the bounds & visible list are shared by the copies of each lambda
+	const auto centerStream = std::make_shared<LibMath::Vector3Stream<float>>(centers.data(), objectCount);
+	const auto extentStream = std::make_shared<LibMath::Vector3Stream<float>>(extents.data(), objectCount);
+	const auto visible = std::make_shared<std::vector<uint32_t>>(objectCount);
+
+	Register("Frustum/CullSpheres500k/LibMath", [=](std::vector<float> const& radius)
+	{
+		return frustum.CullSpheres(*centerStream, radius, *visible);
+	}, radii);
+
+	Register("Frustum/CullBoxes500k/LibMath", [=]()
+	{
+		return frustum.CullBoxes(*centerStream, *extentStream, *visible);
+	});
+
+	// One object at a time over the same arrays
+	Register("Frustum/CullSpheres500k/Loop", [=](std::vector<LibMath::Vector3<float>> const& center, std::vector<float> const& radius)
+	{
+		std::vector<uint32_t>& result = *visible;
+		size_t visibleCount = 0;
+
+		for (size_t i = 0; i < objectCount; ++i)
+		{
+			if (frustum.IsSphereVisible(center[i], radius[i]))
+				result[visibleCount++] = static_cast<uint32_t>(i);
+		}
+
+		return visibleCount;
+	}, centers, radii);
+
+	Register("Frustum/CullBoxes500k/Loop", [=](std::vector<LibMath::Vector3<float>> const& center, std::vector<LibMath::Vector3<float>> const& extent)
+	{
+		std::vector<uint32_t>& result = *visible;
+		size_t visibleCount = 0;
+
+		for (size_t i = 0; i < objectCount; ++i)
+		{
+			if (frustum.IsBoxVisible(center[i], extent[i]))
+				result[visibleCount++] = static_cast<uint32_t>(i);
+		}
+
+		return visibleCount;
+	}, centers, extents);
+
+	// One ray against 4096 boxes & triangles, the usual size of a BVH leaf range or a mesh section
+	constexpr size_t shapeCount = 4096;
+
+	const LibMath::Ray<float> ray(LibMath::Vector3<float>(0.25f, 0.5f, 20.0f), LibMath::Vector3<float>(0.01f, -0.02f, -1.0f));
+
+	std::vector<LibMath::Vector3<float>> mins;
+	std::vector<LibMath::Vector3<float>> maxs;
+	std::vector<LibMath::Vector3<float>> vertices0;
+	std::vector<LibMath::Vector3<float>> vertices1;
+	std::vector<LibMath::Vector3<float>> vertices2;
+
+	for (size_t i = 0; i < shapeCount; ++i)
+	{
+		mins.push_back(centers[i] * 0.05f - extents[i] * 0.5f);
+		maxs.push_back(centers[i] * 0.05f + extents[i] * 0.5f);
+		vertices0.push_back(mins.back());
+		vertices1.push_back(mins.back() + LibMath::Vector3<float>(extents[i][0], 0.0f, extents[i][2]));
+		vertices2.push_back(mins.back() + LibMath::Vector3<float>(0.0f, extents[i][1], 0.5f));
+	}
+
+	const auto minStream = std::make_shared<LibMath::Vector3Stream<float>>(mins.data(), shapeCount);
+	const auto maxStream = std::make_shared<LibMath::Vector3Stream<float>>(maxs.data(), shapeCount);
+	const auto vertex0Stream = std::make_shared<LibMath::Vector3Stream<float>>(vertices0.data(), shapeCount);
+	const auto vertex1Stream = std::make_shared<LibMath::Vector3Stream<float>>(vertices1.data(), shapeCount);
+	const auto vertex2Stream = std::make_shared<LibMath::Vector3Stream<float>>(vertices2.data(), shapeCount);
+	const auto distances = std::make_shared<std::vector<float>>(shapeCount);
+
+	Register("Ray/IntersectBoxes4096/LibMath", [=]()
+	{
+		return ray.IntersectBoxes(*minStream, *maxStream, *distances);
+	});
+
+	Register("Ray/IntersectTriangles4096/LibMath", [=]()
+	{
+		return ray.IntersectTriangles(*vertex0Stream, *vertex1Stream, *vertex2Stream, *distances);
+	});
+
+	Register("Ray/IntersectBoxes4096/Loop", [=](std::vector<LibMath::Vector3<float>> const& boxMin, std::vector<LibMath::Vector3<float>> const& boxMax)
+	{
+		std::vector<float>& result = *distances;
+		size_t hitCount = 0;
+
+		for (size_t i = 0; i < shapeCount; ++i)
+		{
+			if (ray.Intersect(LibMath::AABB<float>(boxMin[i], boxMax[i]), result[i]))
+				++hitCount;
+		}
+
+		return hitCount;
+	}, mins, maxs);
+
+	Register("Ray/IntersectTriangles4096/Loop", [=](std::vector<LibMath::Vector3<float>> const& vertex0, std::vector<LibMath::Vector3<float>> const& vertex1, std::vector<LibMath::Vector3<float>> const& vertex2)
+	{
+		std::vector<float>& result = *distances;
+		size_t hitCount = 0;
+
+		for (size_t i = 0; i < shapeCount; ++i)
+		{
+			if (ray.Intersect(LibMath::Triangle<float>(vertex0[i], vertex1[i], vertex2[i]), result[i]))
+				++hitCount;
+		}
+
+		return hitCount;
+	}, vertices0, vertices1, vertices2);
+}
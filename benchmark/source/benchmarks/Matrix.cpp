@@ -0,0 +1,287 @@
+#define GLM_ENABLE_EXPERIMENTAL
+
+#include "Measure.h"
+
+#include "LibMath/Matrix.h"
+#include "LibMath/Matrix4Vector4Operation.h"
+
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <glm/gtx/matrix_decompose.hpp>
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+	auto const multiply = [](auto mat1, auto mat2) { return mat1 * mat2; };
+	auto const multiplyChain = [](auto const& mat1, auto const& mat2, auto const& mat3, auto const& mat4) { return mat1 * mat2 * mat3 * mat4; };
+	auto const minorMatrix = [](auto mat) { return mat.Minor(); };
+	auto const inverse = [](auto mat) { return mat.Inverse(); };
+	auto const inverseGlm = [](auto mat) { return glm::inverse(mat); };
+	auto const determinant = [](auto mat) { return mat.Determinant(); };
+	auto const determinantGlm = [](auto mat) { return glm::determinant(mat); };
+	auto const transpose = [](auto mat) { return mat.Transpose(); };
+	auto const transposeGlm = [](auto mat) { return glm::transpose(mat); };
+	auto const transformPoint = [](auto mat, auto vec) { return mat.TransformPoint(vec); };
+	auto const multiplyRow = [](auto vec, auto mat) { return vec * mat; };
+
+	auto const composeTRS = [](LibMath::Vector3<float> const& translation, LibMath::Quaternion<float> const& rotation, LibMath::Vector3<float> const& scale)
+	{
+		return LibMath::Matrix4<float>::ComposeTRS(translation, rotation, scale);
+	};
+
+	// Translation * rotation * scale with 2 matrix products
+	auto const composeProduct = [](LibMath::Vector3<float> const& translation, LibMath::Quaternion<float> const& rotation, LibMath::Vector3<float> const& scale)
+	{
+		LibMath::Matrix4<float> translationMatrix;
+		translationMatrix.Translate(translation);
+
+		LibMath::Matrix4<float> scaleMatrix;
+		scaleMatrix.m_matrix[0][0] = scale[0];
+		scaleMatrix.m_matrix[1][1] = scale[1];
+		scaleMatrix.m_matrix[2][2] = scale[2];
+
+		return translationMatrix * LibMath::Matrix4<float>().Transform(rotation) * scaleMatrix;
+	};
+
+	auto const composeGlm = [](glm::vec3 const& translation, glm::quat const& rotation, glm::vec3 const& scale)
+	{
+		return glm::translate(glm::mat4(1.0f), translation) * glm::mat4_cast(rotation) * glm::scale(glm::mat4(1.0f), scale);
+	};
+
+	auto const decompose = [](LibMath::Matrix4<float> const& mat)
+	{
+		LibMath::Vector3<float> translation;
+		LibMath::Quaternion<float> rotation;
+		LibMath::Vector3<float> scale;
+
+		mat.Decompose(translation, rotation, scale);
+
+		return rotation;
+	};
+
+	auto const decomposeGlm = [](glm::mat4 const& mat)
+	{
+		glm::vec3 scale;
+		glm::quat rotation;
+		glm::vec3 translation;
+		glm::vec3 skew;
+		glm::vec4 perspective;
+
+		glm::decompose(mat, scale, rotation, translation, skew, perspective);
+
+		return rotation;
+	};
+
+	// Invertible values, column major
+	constexpr float g_values[16] =
+	{
+		2.0f, 0.5f, -1.0f, 0.25f,
+		1.0f, 3.0f, 0.75f, -0.5f,
+		-0.5f, 1.25f, 4.0f, 1.0f,
+		0.3f, -2.0f, 1.5f, 5.0f
+	};
+
+	// Translations, rotations & scales with their matrices, 1M elements leave the caches
+	struct TRSData
+	{
+		explicit TRSData(size_t count)
+			: m_translations(count), m_rotations(count), m_scales(count), m_matrices(count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float value = static_cast<float>(i) * 0.001f;
+
+				m_translations[i] = LibMath::Vector3<float>(value, -value * 0.5f, 2.0f);
+				m_rotations[i] = LibMath::Quaternion<float>(std::cos(value), std::sin(value), value * 0.25f, -0.5f).Normalize();
+				m_scales[i] = LibMath::Vector3<float>(1.0f + value, 2.0f, 0.5f);
+			}
+
+			LibMath::Matrix4<float>::ComposeTRS(m_translations, m_rotations, m_scales, m_matrices);
+		}
+
+		std::vector<LibMath::Vector3<float>>	m_translations;
+		std::vector<LibMath::Quaternion<float>>	m_rotations;
+		std::vector<LibMath::Vector3<float>>	m_scales;
+		std::vector<LibMath::Matrix4<float>>	m_matrices;
+	};
+}
+
+void RegisterMatrixBenchmarks(void)
+{
+	// Matrix2
+	const LibMath::Matrix2<float> mat2(g_values[0], g_values[1], g_values[2], g_values[3]);
+	const glm::mat2 mat2Glm = glm::make_mat2(g_values);
+
+	Register("Matrix2/Multiply/LibMath", multiply, mat2, mat2);
+	Register("Matrix2/Multiply/glm", multiply, mat2Glm, mat2Glm);
+	Register("Matrix2/MultiplyChain/LibMath", multiplyChain, mat2, mat2, mat2, mat2);
+	Register("Matrix2/MultiplyChain/glm", multiplyChain, mat2Glm, mat2Glm, mat2Glm, mat2Glm);
+	Register("Matrix2/Inverse/LibMath", inverse, mat2);
+	Register("Matrix2/Inverse/glm", inverseGlm, mat2Glm);
+	Register("Matrix2/Determinant/LibMath", determinant, mat2);
+	Register("Matrix2/Determinant/glm", determinantGlm, mat2Glm);
+	Register("Matrix2/Transpose/LibMath", transpose, mat2);
+	Register("Matrix2/Transpose/glm", transposeGlm, mat2Glm);
+	Register("Matrix2/Minor/LibMath", minorMatrix, mat2);
+
+	// Matrix3
+	const LibMath::Matrix3<float> mat3(g_values);
+	const glm::mat3 mat3Glm = glm::make_mat3(g_values);
+
+	Register("Matrix3/Multiply/LibMath", multiply, mat3, mat3);
+	Register("Matrix3/Multiply/glm", multiply, mat3Glm, mat3Glm);
+	Register("Matrix3/MultiplyChain/LibMath", multiplyChain, mat3, mat3, mat3, mat3);
+	Register("Matrix3/MultiplyChain/glm", multiplyChain, mat3Glm, mat3Glm, mat3Glm, mat3Glm);
+	Register("Matrix3/Inverse/LibMath", inverse, mat3);
+	Register("Matrix3/Inverse/glm", inverseGlm, mat3Glm);
+	Register("Matrix3/Determinant/LibMath", determinant, mat3);
+	Register("Matrix3/Determinant/glm", determinantGlm, mat3Glm);
+	Register("Matrix3/Transpose/LibMath", transpose, mat3);
+	Register("Matrix3/Transpose/glm", transposeGlm, mat3Glm);
+	Register("Matrix3/Minor/LibMath", minorMatrix, mat3);
+
+	// Matrix4
+	const LibMath::Matrix4<float> mat4(g_values);
+	const glm::mat4 mat4Glm = glm::make_mat4(g_values);
+	const LibMath::Vector4<float> vec4(1.5f, -2.0f, 3.25f, 1.0f);
+	const glm::vec4 vec4Glm(1.5f, -2.0f, 3.25f, 1.0f);
+
+	Register("Matrix4/Multiply/LibMath", multiply, mat4, mat4);
+	Register("Matrix4/Multiply/glm", multiply, mat4Glm, mat4Glm);
+	Register("Matrix4/MultiplyChain/LibMath", multiplyChain, mat4, mat4, mat4, mat4);
+	Register("Matrix4/MultiplyChain/glm", multiplyChain, mat4Glm, mat4Glm, mat4Glm, mat4Glm);
+	Register("Matrix4/MultiplyVector4/LibMath", multiply, mat4, vec4);
+	Register("Matrix4/MultiplyVector4/glm", multiply, mat4Glm, vec4Glm);
+	Register("Matrix4/Inverse/LibMath", inverse, mat4);
+	Register("Matrix4/Inverse/glm", inverseGlm, mat4Glm);
+	Register("Matrix4/Determinant/LibMath", determinant, mat4);
+	Register("Matrix4/Determinant/glm", determinantGlm, mat4Glm);
+	Register("Matrix4/Transpose/LibMath", transpose, mat4);
+	Register("Matrix4/Transpose/glm", transposeGlm, mat4Glm);
+	Register("Matrix4/Minor/LibMath", minorMatrix, mat4);
+
+	// Double products have no SIMD kernel, each product of a chain is written to the temporary on its left
+	LibMath::Matrix4<double> mat4Double;
+
+	for (int i = 0; i < 16; ++i)
+		mat4Double.m_matrix[i / 4][i % 4] = static_cast<double>(g_values[i]);
+
+	const glm::dmat4 mat4DoubleGlm(mat4Glm);
+
+	Register("Matrix4<double>/MultiplyChain/LibMath", multiplyChain, mat4Double, mat4Double, mat4Double, mat4Double);
+	Register("Matrix4<double>/MultiplyChain/glm", multiplyChain, mat4DoubleGlm, mat4DoubleGlm, mat4DoubleGlm, mat4DoubleGlm);
+
+	// TRS
+	const LibMath::Vector3<float> translation(1.5f, -2.0f, 3.25f);
+	const LibMath::Quaternion<float> rotation = LibMath::Quaternion<float>::AngleAxis(1.2f, LibMath::Vector3<float>(0.48f, 0.6f, 0.64f));
+	const LibMath::Vector3<float> scale(2.0f, 0.5f, 3.0f);
+	const LibMath::Matrix4<float> trs = LibMath::Matrix4<float>::ComposeTRS(translation, rotation, scale);
+
+	const glm::vec3 translationGlm(1.5f, -2.0f, 3.25f);
+	const glm::quat rotationGlm(rotation[0], rotation[1], rotation[2], rotation[3]);
+	const glm::vec3 scaleGlm(2.0f, 0.5f, 3.0f);
+	const glm::mat4 trsGlm = glm::make_mat4(&trs.m_matrix[0][0]);
+
+	Register("Matrix4/ComposeTRS/LibMath", composeTRS, translation, rotation, scale);
+	Register("Matrix4/ComposeTRS/LibMathProduct", composeProduct, translation, rotation, scale);
+	Register("Matrix4/ComposeTRS/glm", composeGlm, translationGlm, rotationGlm, scaleGlm);
+	Register("Matrix4/Decompose/LibMath", decompose, trs);
+	Register("Matrix4/Decompose/glm", decomposeGlm, trsGlm);
+
+	// One matrix at a time against the batch versions
+	for (size_t count : { static_cast<size_t>(4096), static_cast<size_t>(1 << 20) })
+	{
+		const auto data = std::make_shared<TRSData>(count);
+		const std::string size = (count >= (1 << 20)) ? std::to_string(count >> 20) + "M" : std::to_string(count >> 10) + "k";
+
+		Register("Matrix4/ComposeTRS" + size + "/Loop", [=]()
+		{
+			for (size_t i = 0; i < data->m_matrices.size(); ++i)
+				data->m_matrices[i] = LibMath::Matrix4<float>::ComposeTRS(data->m_translations[i], data->m_rotations[i], data->m_scales[i]);
+
+			return data->m_matrices.back().m_matrix[0][0];
+		});
+
+		Register("Matrix4/ComposeTRS" + size + "/Batch", [=]()
+		{
+			LibMath::Matrix4<float>::ComposeTRS(data->m_translations, data->m_rotations, data->m_scales, data->m_matrices);
+
+			return data->m_matrices.back().m_matrix[0][0];
+		});
+
+		Register("Matrix4/Decompose" + size + "/Loop", [=]()
+		{
+			size_t failures = 0;
+
+			for (size_t i = 0; i < data->m_matrices.size(); ++i)
+			{
+				if (!data->m_matrices[i].Decompose(data->m_translations[i], data->m_rotations[i], data->m_scales[i]))
+					++failures;
+			}
+
+			return failures;
+		});
+
+		Register("Matrix4/Decompose" + size + "/Batch", [=]()
+		{
+			return LibMath::Matrix4<float>::Decompose(data->m_matrices, data->m_translations, data->m_rotations, data->m_scales);
+		});
+	}
+
+	// One million vectors one at a time against TransformPoints
+	const LibMath::Matrix4<float> translationMatrix = LibMath::Matrix4<float>().Translate(translation);
+	const auto points = std::make_shared<std::vector<LibMath::Vector3<float>>>(1000000, LibMath::Vector3<float>(1.0f, 2.0f, 3.0f));
+	const auto points4 = std::make_shared<std::vector<LibMath::Vector4<float>>>(1000000, LibMath::Vector4<float>(1.0f, 2.0f, 3.0f, 1.0f));
+	const auto result = std::make_shared<std::vector<LibMath::Vector3<float>>>(points->size());
+	const auto result4 = std::make_shared<std::vector<LibMath::Vector4<float>>>(points4->size());
+
+	Register("Matrix4/TransformPoints1M/Loop", [=]()
+	{
+		for (size_t i = 0; i < points4->size(); ++i)
+			(*result4)[i] = translationMatrix * (*points4)[i];
+
+		return (*result4)[0][0];
+	});
+
+	Register("Matrix4/TransformPoints1M/Vector4", [=]()
+	{
+		LibMath::TransformPoints(translationMatrix, *points4, *result4);
+		return (*result4)[0][0];
+	});
+
+	Register("Matrix4/TransformPoints1M/Vector3", [=]()
+	{
+		LibMath::TransformPoints(translationMatrix, *points, *result);
+		return (*result)[0][0];
+	});
+
+	// Matrix<R, C>
+	const LibMath::Matrix<4, 4, float> matrix4x4(mat4);
+	LibMath::Matrix3x4<float> affine;
+
+	for (size_t i = 0; i < 12; ++i)
+		affine.m_matrix[i / 3][i % 3] = g_values[i];
+
+	const LibMath::Matrix4x3<float> skinning = affine.Transposed();
+	const glm::mat4x3 affineGlm = glm::make_mat4x3(g_values);
+	const glm::mat3x4 skinningGlm = glm::transpose(affineGlm);
+	const LibMath::Vector<3, float> point(1.5f, -2.0f, 3.25f);
+	const LibMath::Vector<4, float> point4(point, 1.0f);
+	const glm::vec3 pointGlm(1.5f, -2.0f, 3.25f);
+
+	Register("Matrix<4, 4>/Multiply/LibMath", multiply, matrix4x4, matrix4x4);
+	Register("Matrix<4, 4>/MultiplyChain/LibMath", multiplyChain, matrix4x4, matrix4x4, matrix4x4, matrix4x4);
+	Register("Matrix<4, 4>/MultiplyVector4/LibMath", multiply, matrix4x4, point4);
+	Register("Matrix3x4/TransformPoint/LibMath", transformPoint, affine, point);
+	Register("Matrix3x4/TransformPoint/glm", multiply, affineGlm, glm::vec4(pointGlm, 1.0f));
+	Register("Matrix3x4/Multiply4x4/LibMath", multiply, affine, matrix4x4);
+	Register("Matrix3x4/Multiply4x4/glm", multiply, affineGlm, mat4Glm);
+	Register("Matrix4x3/MultiplyRow/LibMath", multiplyRow, point4, skinning);
+	Register("Matrix4x3/MultiplyRow/glm", multiplyRow, glm::vec4(pointGlm, 1.0f), skinningGlm);
+}
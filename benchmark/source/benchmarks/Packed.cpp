@@ -0,0 +1,108 @@
+#include "Measure.h"
+
+#include "LibMath/Packed.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// Unit vectors & quaternions with their packed forms, 1M elements leave the caches
+	struct PackedData
+	{
+		explicit PackedData(size_t count)
+			: m_values(count * 4), m_vectors(count), m_quaternions(count), m_decodedValues(count * 4), m_decodedVectors(count), m_decodedQuaternions(count),
+			m_halves(count * 4), m_snorms(count * 4), m_octahedrals(count), m_quaternions32(count), m_quaternions48(count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float value = static_cast<float>(i) * 0.001f;
+
+				m_vectors[i] = LibMath::Vector3<float>(std::sin(value), std::cos(value * 3.0f), value - 0.5f).Normalize();
+				m_quaternions[i] = LibMath::Quaternion<float>(std::cos(value), std::sin(value), value * 0.25f, -0.5f).Normalize();
+
+				for (size_t j = 0; j < 4; ++j)
+					m_values[i * 4 + j] = m_quaternions[i][static_cast<unsigned int>(j)];
+			}
+		}
+
+		std::vector<float>							m_values;
+		std::vector<LibMath::Vector3<float>>		m_vectors;
+		std::vector<LibMath::Quaternion<float>>		m_quaternions;
+		std::vector<float>							m_decodedValues;
+		std::vector<LibMath::Vector3<float>>		m_decodedVectors;
+		std::vector<LibMath::Quaternion<float>>		m_decodedQuaternions;
+
+		std::vector<LibMath::Half>					m_halves;
+		std::vector<LibMath::Snorm16>				m_snorms;
+		std::vector<LibMath::Octahedral32>			m_octahedrals;
+		std::vector<LibMath::Quaternion32>			m_quaternions32;
+		std::vector<LibMath::Quaternion48>			m_quaternions48;
+	};
+
+	// Scalar conversion one element at a time against the batch Pack / Unpack
+	template<typename Packed, typename Unpacked>
+	void RegisterFormat(std::string const& type, std::string const& size, std::shared_ptr<PackedData> data, std::vector<Unpacked> PackedData::* input,
+						std::vector<Packed> PackedData::* packed, std::vector<Unpacked> PackedData::* output)
+	{
+		Register(type + "/Pack" + size + "/Loop", [=]()
+		{
+			std::vector<Unpacked> const& values = (*data).*input;
+			std::vector<Packed>& result = (*data).*packed;
+
+			for (size_t i = 0; i < values.size(); ++i)
+				result[i] = Packed(values[i]);
+
+			return result.back();
+		});
+
+		Register(type + "/Pack" + size + "/Batch", [=]()
+		{
+			LibMath::Pack(std::span<Unpacked const>((*data).*input), std::span<Packed>((*data).*packed));
+
+			return ((*data).*packed).back();
+		});
+
+		Register(type + "/Unpack" + size + "/Loop", [=]()
+		{
+			std::vector<Packed> const& values = (*data).*packed;
+			std::vector<Unpacked>& result = (*data).*output;
+
+			for (size_t i = 0; i < values.size(); ++i)
+				result[i] = static_cast<Unpacked>(values[i]);
+
+			return result.back();
+		});
+
+		Register(type + "/Unpack" + size + "/Batch", [=]()
+		{
+			LibMath::Unpack(std::span<Packed const>((*data).*packed), std::span<Unpacked>((*data).*output));
+
+			return ((*data).*output).back();
+		});
+	}
+}
+
+void RegisterPackedBenchmarks(void)
+{
+	for (size_t count : { static_cast<size_t>(4096), static_cast<size_t>(1 << 20) })
+	{
+		const auto data = std::make_shared<PackedData>(count);
+		const std::string size = (count >= (1 << 20)) ? std::to_string(count >> 20) + "M" : std::to_string(count >> 10) + "k";
+
+		// Pack the sources once so the Unpack benchmarks decode real values
+		LibMath::Pack(std::span<float const>(data->m_values), std::span<LibMath::Half>(data->m_halves));
+		LibMath::Pack(std::span<float const>(data->m_values), std::span<LibMath::Snorm16>(data->m_snorms));
+		LibMath::Pack(std::span<LibMath::Vector3<float> const>(data->m_vectors), std::span<LibMath::Octahedral32>(data->m_octahedrals));
+		LibMath::Pack(std::span<LibMath::Quaternion<float> const>(data->m_quaternions), std::span<LibMath::Quaternion32>(data->m_quaternions32));
+		LibMath::Pack(std::span<LibMath::Quaternion<float> const>(data->m_quaternions), std::span<LibMath::Quaternion48>(data->m_quaternions48));
+
+		RegisterFormat("Half", size, data, &PackedData::m_values, &PackedData::m_halves, &PackedData::m_decodedValues);
+		RegisterFormat("Snorm16", size, data, &PackedData::m_values, &PackedData::m_snorms, &PackedData::m_decodedValues);
+		RegisterFormat("Octahedral32", size, data, &PackedData::m_vectors, &PackedData::m_octahedrals, &PackedData::m_decodedVectors);
+		RegisterFormat("Quaternion32", size, data, &PackedData::m_quaternions, &PackedData::m_quaternions32, &PackedData::m_decodedQuaternions);
+		RegisterFormat("Quaternion48", size, data, &PackedData::m_quaternions, &PackedData::m_quaternions48, &PackedData::m_decodedQuaternions);
+	}
+}
@@ -0,0 +1,210 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include "Measure.h"
+
+#include "LibMath/Matrix.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/QuaternionStream.h"
+
+#include <glm/gtc/type_ptr.hpp>
+#include <glm/gtx/quaternion.hpp>
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// Content import: matrices & Euler angles to quaternions & back, 1M elements leave the caches
+	struct ConversionData
+	{
+		explicit ConversionData(size_t count)
+			: m_matrices(count), m_angles(count), m_rotations(count), m_result(count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float value = static_cast<float>(i) * 0.001f;
+
+				m_rotations[i] = LibMath::Quaternion<float>(std::cos(value), std::sin(value), value * 0.25f, -0.5f).Normalize();
+				m_matrices[i] = LibMath::Matrix4<float>::ComposeTRS(LibMath::Vector3<float>(value), m_rotations[i], LibMath::Vector3<float>(1.0f + value, 2.0f, 0.5f));
+				m_angles[i] = LibMath::Vector3<float>(std::sin(value) * 3.0f, std::cos(value) * 1.5f, value - 3.0f);
+			}
+		}
+
+		std::vector<LibMath::Matrix4<float>>	m_matrices;
+		std::vector<LibMath::Vector3<float>>	m_angles;
+		std::vector<LibMath::Quaternion<float>>	m_rotations;
+		std::vector<LibMath::Quaternion<float>>	m_result;
+	};
+}
+
+void RegisterQuaternionBenchmarks(void)
+{
+	const LibMath::Quaternion<float> quat1(1.0f, 2.0f, 3.0f, 4.0f);
+	const LibMath::Quaternion<float> quat2(2.5f, -5.0f, 1.0f, -3.2f);
+	const LibMath::Vector3<float> axis(0.0f, 1.0f, 1.0f);
+	const glm::quat quat1Glm(1.0f, 2.0f, 3.0f, 4.0f);
+	const glm::quat quat2Glm(2.5f, -5.0f, 1.0f, -3.2f);
+	const glm::vec3 axisGlm(0.0f, 1.0f, 1.0f);
+	const float angle = 0.75f;
+
+	Register("Quaternion/Multiply/LibMath", [](auto quat1, auto quat2) { return quat1 * quat2; }, quat1, quat2);
+	Register("Quaternion/Multiply/glm", [](auto quat1, auto quat2) { return quat1 * quat2; }, quat1Glm, quat2Glm);
+
+	Register("Quaternion/Normalize/LibMath", [](auto quat) { return quat.Normalize(); }, quat1);
+	Register("Quaternion/Normalize/glm", [](auto quat) { return glm::normalize(quat); }, quat1Glm);
+
+	Register("Quaternion/Inverse/LibMath", [](auto quat) { return quat.Inverse(); }, quat1);
+	Register("Quaternion/Inverse/glm", [](auto quat) { return glm::inverse(quat); }, quat1Glm);
+
+	Register("Quaternion/Rotate/LibMath", [](auto quat, float theta, auto vec3) { return quat.Rotate(theta, vec3); }, quat1, angle, axis);
+	Register("Quaternion/Rotate/glm", [](auto quat, float theta, auto vec3) { return glm::rotate(quat, theta, vec3); }, quat1Glm, angle, axisGlm);
+
+	const LibMath::Quaternion<float> rotation = LibMath::Quaternion<float>::AngleAxis(angle, LibMath::Vector3<float>(0.0f, 0.6f, 0.8f));
+	const glm::quat rotationGlm(rotation[0], rotation[1], rotation[2], rotation[3]);
+	const LibMath::Vector3<float> point(1.5f, -2.0f, 3.25f);
+	const glm::vec3 pointGlm(1.5f, -2.0f, 3.25f);
+
+	Register("Quaternion/RotateVector/LibMath", [](auto quat, auto vec3) { return quat.RotateVector(vec3); }, rotation, point);
+	Register("Quaternion/RotateVector/glm", [](auto quat, auto vec3) { return quat * vec3; }, rotationGlm, pointGlm);
+
+	const LibMath::Quaternion<float> from = LibMath::Quaternion<float>::AngleAxis(0.3f, LibMath::Vector3<float>(1.0f, 0.0f, 0.0f));
+	const LibMath::Quaternion<float> to = LibMath::Quaternion<float>::AngleAxis(2.1f, LibMath::Vector3<float>(0.0f, 0.6f, 0.8f));
+	const glm::quat fromGlm(from[0], from[1], from[2], from[3]);
+	const glm::quat toGlm(to[0], to[1], to[2], to[3]);
+	const float weight = 0.35f;
+
+	Register("Quaternion/Slerp/LibMath", [](auto quat1, auto quat2, float t) { return LibMath::Slerp(quat1, quat2, t); }, from, to, weight);
+	Register("Quaternion/SlerpFast/LibMath", [](auto quat1, auto quat2, float t) { return LibMath::Slerp(quat1, quat2, t, LibMath::Precision::Fast); }, from, to, weight);
+	Register("Quaternion/Slerp/glm", [](auto quat1, auto quat2, float t) { return glm::slerp(quat1, quat2, t); }, fromGlm, toGlm, weight);
+
+	Register("Quaternion/Nlerp/LibMath", [](auto quat1, auto quat2, float t) { return LibMath::Nlerp(quat1, quat2, t); }, from, to, weight);
+
+	// Blend a 1024 bone pose per iteration towards the keyframes in reverse order
+	constexpr size_t boneCount = 1024;
+
+	std::vector<LibMath::Quaternion<float>> keyframes;
+	std::vector<glm::quat> keyframesGlm;
+	std::vector<float> weights;
+
+	for (size_t i = 0; i < boneCount; ++i)
+	{
+		const LibMath::Quaternion<float> keyframe = LibMath::Quaternion<float>::AngleAxis(static_cast<float>(i) * 0.01f, LibMath::Vector3<float>(0.0f, 0.6f, 0.8f));
+
+		keyframes.push_back(keyframe);
+		keyframesGlm.emplace_back(keyframe[0], keyframe[1], keyframe[2], keyframe[3]);
+		weights.push_back(static_cast<float>(i % 16) / 15.0f);
+	}
+
+	const std::vector<LibMath::Quaternion<float>> targets(keyframes.rbegin(), keyframes.rend());
+
+	// Benchmarks run after registration, the streams are shared by the copies of each lambda
+	const auto fromStream = std::make_shared<LibMath::QuaternionStream<float>>(keyframes.data(), boneCount);
+	const auto toStream = std::make_shared<LibMath::QuaternionStream<float>>(targets.data(), boneCount);
+	const auto resultStream = std::make_shared<LibMath::QuaternionStream<float>>(boneCount);
+	const auto resultGlm = std::make_shared<std::vector<glm::quat>>(keyframesGlm);
+
+	const auto blend = [=](LibMath::Precision precision, bool spherical)
+	{
+		return [=](std::vector<float> const& t)
+		{
+			if (spherical)
+				LibMath::Slerp<float>(*fromStream, *toStream, t, *resultStream, precision);
+			else
+				LibMath::Nlerp<float>(*fromStream, *toStream, t, *resultStream, precision);
+
+			return resultStream->W()[0];
+		};
+	};
+
+	Register("QuaternionStream/Slerp1024/LibMath", blend(LibMath::Precision::Exact, true), weights);
+	Register("QuaternionStream/SlerpFast1024/LibMath", blend(LibMath::Precision::Fast, true), weights);
+	Register("QuaternionStream/Nlerp1024/LibMath", blend(LibMath::Precision::Exact, false), weights);
+	Register("QuaternionStream/Slerp1024/glm", [=](std::vector<float> const& t)
+	{
+		std::vector<glm::quat>& result = *resultGlm;
+
+		for (size_t i = 0; i < boneCount; ++i)
+			result[i] = glm::slerp(keyframesGlm[i], keyframesGlm[boneCount - 1 - i], t[i]);
+
+		return result[0].w;
+	}, weights);
+
+	// Conversions
+	const LibMath::Matrix4<float> matrix = LibMath::Matrix4<float>::ComposeTRS(LibMath::Vector3<float>(1.5f, -2.0f, 3.25f), rotation, LibMath::Vector3<float>(2.0f, 0.5f, 3.0f));
+	const glm::mat4 matrixGlm = glm::make_mat4(&matrix.m_matrix[0][0]);
+	const LibMath::Radian<float> pitch(0.3f);
+	const LibMath::Radian<float> yaw(-1.2f);
+	const LibMath::Radian<float> roll(2.5f);
+	const glm::vec3 anglesGlm(0.3f, -1.2f, 2.5f);
+
+	Register("Quaternion/FromMatrix4/LibMath", [](auto mat4) { return LibMath::Quaternion<float>::FromMatrix4(mat4); }, matrix);
+	Register("Quaternion/FromMatrix4/glm", [](auto mat4) { return glm::quat_cast(mat4); }, matrixGlm);
+
+	// glm::quat(vec3) is the XYZ order
+	Register("Quaternion/FromEuler/LibMath", [](auto x, auto y, auto z) { return LibMath::Quaternion<float>::FromEuler(x, y, z); }, pitch, yaw, roll);
+	Register("Quaternion/FromEulerFast/LibMath", [](auto x, auto y, auto z) { return LibMath::Quaternion<float>::FromEuler(x, y, z, LibMath::EulerOrder::XYZ, LibMath::Precision::Fast); }, pitch, yaw, roll);
+	Register("Quaternion/FromEuler/glm", [](auto angles) { return glm::quat(angles); }, anglesGlm);
+
+	Register("Quaternion/ToEuler/LibMath", [](auto quat)
+	{
+		LibMath::Radian<float> x, y, z;
+		quat.ToEuler(x, y, z);
+
+		return x.Value() + y.Value() + z.Value();
+	}, rotation);
+	Register("Quaternion/ToEuler/glm", [](auto quat) { return glm::eulerAngles(quat); }, rotationGlm);
+
+	// One conversion at a time against the batch versions
+	for (size_t count : { static_cast<size_t>(4096), static_cast<size_t>(1 << 20) })
+	{
+		const auto data = std::make_shared<ConversionData>(count);
+		const std::string size = (count >= (1 << 20)) ? std::to_string(count >> 20) + "M" : std::to_string(count >> 10) + "k";
+
+		Register("Quaternion/FromMatrix4" + size + "/Loop", [=]()
+		{
+			for (size_t i = 0; i < data->m_matrices.size(); ++i)
+				data->m_result[i] = LibMath::Quaternion<float>::FromMatrix4(data->m_matrices[i]);
+
+			return data->m_result.back()[0];
+		});
+
+		Register("Quaternion/FromMatrix4" + size + "/Batch", [=]()
+		{
+			LibMath::Quaternion<float>::FromMatrix4(data->m_matrices, data->m_result);
+
+			return data->m_result.back()[0];
+		});
+
+		for (LibMath::Precision precision : { LibMath::Precision::Exact, LibMath::Precision::Fast })
+		{
+			const std::string name = "Quaternion/FromEuler" + std::string((precision == LibMath::Precision::Fast) ? "Fast" : "") + size;
+
+			Register(name + "/Loop", [=]()
+			{
+				for (size_t i = 0; i < data->m_angles.size(); ++i)
+				{
+					LibMath::Vector3<float> const& angles = data->m_angles[i];
+
+					data->m_result[i] = LibMath::Quaternion<float>::FromEuler(LibMath::Radian<float>(angles[0]), LibMath::Radian<float>(angles[1]), LibMath::Radian<float>(angles[2]), LibMath::EulerOrder::XYZ, precision);
+				}
+
+				return data->m_result.back()[0];
+			});
+
+			Register(name + "/Batch", [=]()
+			{
+				LibMath::Quaternion<float>::FromEuler(data->m_angles, data->m_result, LibMath::EulerOrder::XYZ, precision);
+
+				return data->m_result.back()[0];
+			});
+		}
+
+		Register("Quaternion/ToEuler" + size + "/Batch", [=]()
+		{
+			LibMath::Quaternion<float>::ToEuler(data->m_rotations, data->m_angles);
+
+			return data->m_angles.back()[0];
+		});
+	}
+}
@@ -0,0 +1,90 @@
+#include "Measure.h"
+
+#include "LibMath/Geometry.h"
+
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// Two ticks of boxes drifting through a 600 x 60 x 60 volume, updates alternate between them
+	struct Scene
+	{
+		explicit Scene(size_t boxCount)
+			: m_mins{ LibMath::Vector3Stream<float>(boxCount), LibMath::Vector3Stream<float>(boxCount) },
+			m_maxs{ LibMath::Vector3Stream<float>(boxCount), LibMath::Vector3Stream<float>(boxCount) },
+			m_pairs(boxCount * 8)
+		{
+			const float length = static_cast<float>(boxCount) * 0.012f;
+
+			for (int tick = 0; tick < 2; ++tick)
+			{
+				for (size_t i = 0; i < boxCount; ++i)
+				{
+					const float value = static_cast<float>(i);
+					const float time = static_cast<float>(tick) * 0.016f;
+
+					const LibMath::Vector3<float> center(std::fmod(value * 7.31f, length) + std::sin(value) * time, std::fmod(value * 3.17f, 60.0f), std::fmod(value * 1.93f, 60.0f) + std::cos(value) * time);
+					const LibMath::Vector3<float> extents(std::fmod(value * 0.37f, 1.0f) + 0.2f, std::fmod(value * 0.71f, 1.0f) + 0.2f, std::fmod(value * 0.13f, 1.0f) + 0.2f);
+
+					m_mins[tick].Set(i, center - extents);
+					m_maxs[tick].Set(i, center + extents);
+				}
+			}
+		}
+
+		LibMath::Vector3Stream<float>						m_mins[2];
+		LibMath::Vector3Stream<float>						m_maxs[2];
+		LibMath::SweepAndPrune<float>						m_broadphase;
+		std::vector<LibMath::SweepAndPrune<float>::Pair>	m_pairs;
+		int													m_tick = 0;
+	};
+}
+
+void RegisterSweepAndPruneBenchmarks(void)
+{
+	// Every tick moves the boxes a little, the sort order is reused
+	for (size_t boxCount : { static_cast<size_t>(10000), static_cast<size_t>(50000) })
+	{
+		const auto scene = std::make_shared<Scene>(boxCount);
+		const std::string name = "SweepAndPrune/Update" + std::to_string(boxCount / 1000) + "k";
+
+		RegisterRate(name + "/LibMath", "pairs", [=]()
+		{
+			scene->m_tick ^= 1;
+			return scene->m_broadphase.Update(scene->m_mins[scene->m_tick], scene->m_maxs[scene->m_tick], scene->m_pairs);
+		});
+	}
+
+	// Every pair of boxes tested, O(n^2)
+	const auto naiveScene = std::make_shared<Scene>(10000);
+
+	RegisterRate("SweepAndPrune/Update10k/Naive", "pairs", [=]()
+	{
+		LibMath::Vector3Stream<float> const& mins = naiveScene->m_mins[0];
+		LibMath::Vector3Stream<float> const& maxs = naiveScene->m_maxs[0];
+		const size_t boxCount = mins.Size();
+		size_t pairCount = 0;
+
+		for (size_t i = 0; i < boxCount; ++i)
+		{
+			for (size_t j = i + 1; j < boxCount; ++j)
+			{
+				if (mins.X()[j] <= maxs.X()[i] && maxs.X()[j] >= mins.X()[i] &&
+					mins.Y()[j] <= maxs.Y()[i] && maxs.Y()[j] >= mins.Y()[i] &&
+					mins.Z()[j] <= maxs.Z()[i] && maxs.Z()[j] >= mins.Z()[i])
+				{
+					if (pairCount < naiveScene->m_pairs.size())
+						naiveScene->m_pairs[pairCount] = { static_cast<uint32_t>(i), static_cast<uint32_t>(j) };
+
+					++pairCount;
+				}
+			}
+		}
+
+		return pairCount;
+	});
+}
@@ -0,0 +1,70 @@
+#include "Measure.h"
+
+#include "LibMath/TransformHierarchy.h"
+
+#include <memory>
+#include <vector>
+
+void RegisterTransformHierarchyBenchmarks(void)
+{
+	// 100k nodes, 4 children per node, 9 levels deep
+	constexpr size_t nodeCount = 100000;
+
+	const auto hierarchy = std::make_shared<LibMath::TransformHierarchy<float>>();
+	hierarchy->Reserve(nodeCount);
+
+	for (size_t i = 0; i < nodeCount; ++i)
+	{
+		const size_t parent = (i == 0) ? LibMath::TransformHierarchy<float>::NoParent : (i - 1) / 4;
+		const float value = static_cast<float>(i % 64) * 0.01f;
+
+		hierarchy->AddNode(
+			parent,
+			LibMath::Vector3<float>(value, 1.0f, -value),
+			LibMath::Quaternion<float>::AngleAxis(value, LibMath::Vector3<float>(0.0f, 0.6f, 0.8f)),
+			LibMath::Vector3<float>(1.0f + value * 0.1f)
+		);
+	}
+
+	hierarchy->Update();
+
+	// Node 21 is at depth 2, its subtree holds about 1/16 of the nodes
+	constexpr size_t subtreeRoot = 21;
+
+	const auto naiveWorld = std::make_shared<std::vector<LibMath::Matrix4<float>>>(nodeCount);
+
+	Register("TransformHierarchy/Full100k/LibMath", [=]()
+	{
+		hierarchy->MarkDirty(0);
+		return hierarchy->Update();
+	});
+
+	Register("TransformHierarchy/Subtree100k/LibMath", [=]()
+	{
+		hierarchy->MarkDirty(subtreeRoot);
+		return hierarchy->Update();
+	});
+
+	Register("TransformHierarchy/Clean100k/LibMath", [=]()
+	{
+		return hierarchy->Update();
+	});
+
+	// Every node in index order on one thread, no dirty tracking
+	Register("TransformHierarchy/Full100k/Naive", [=]()
+	{
+		std::vector<LibMath::Matrix4<float>>& world = *naiveWorld;
+
+		for (size_t i = 0; i < nodeCount; ++i)
+		{
+			const size_t parent = hierarchy->Parent(i);
+
+			if (parent == LibMath::TransformHierarchy<float>::NoParent)
+				world[i] = hierarchy->LocalMatrix(i);
+			else
+				world[i] = world[parent] * hierarchy->LocalMatrix(i);
+		}
+
+		return world[nodeCount - 1].m_matrix[3][0];
+	});
+}
@@ -0,0 +1,76 @@
+#include "Measure.h"
+
+#include "LibMath/Trigonometry.h"
+
+#include <cmath>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+	// One million angles over several turns with their sine & cosine
+	struct SinCosData
+	{
+		explicit SinCosData(size_t count)
+			: m_sin(count), m_cos(count)
+		{
+			m_angles.reserve(count);
+
+			for (size_t i = 0; i < count; ++i)
+				m_angles.emplace_back(static_cast<float>(i % 4096) * 0.01f - 20.0f);
+		}
+
+		std::vector<math::Radian<float>>	m_angles;
+		std::vector<float>					m_sin;
+		std::vector<float>					m_cos;
+	};
+}
+
+void RegisterTrigonometryBenchmarks(void)
+{
+	// Single angle
+	const float angle = 1.75f;
+
+	Register("SinCos/Single/Cmath", [](float val) { return std::sin(val) + std::cos(val); }, angle);
+
+	for (math::Precision precision : { math::Precision::Exact, math::Precision::Medium, math::Precision::Fast })
+	{
+		const std::string name = (precision == math::Precision::Exact) ? "Exact" : (precision == math::Precision::Medium) ? "Medium" : "Fast";
+
+		Register("SinCos/Single/" + name, [precision](float val)
+		{
+			float sin = 0.0f;
+			float cos = 0.0f;
+
+			math::SinCos(val, sin, cos, precision);
+
+			return sin + cos;
+		}, angle);
+	}
+
+	// std::sin & std::cos loop against the batch tiers
+	const auto data = std::make_shared<SinCosData>(1000000);
+
+	Register("SinCos/Batch1M/Cmath", [=]()
+	{
+		for (size_t i = 0; i < data->m_angles.size(); ++i)
+		{
+			data->m_sin[i] = std::sin(data->m_angles[i].Value());
+			data->m_cos[i] = std::cos(data->m_angles[i].Value());
+		}
+
+		return data->m_sin[0];
+	});
+
+	for (math::Precision precision : { math::Precision::Exact, math::Precision::Medium, math::Precision::Fast })
+	{
+		const std::string name = (precision == math::Precision::Exact) ? "Exact" : (precision == math::Precision::Medium) ? "Medium" : "Fast";
+
+		Register("SinCos/Batch1M/" + name, [=]()
+		{
+			math::SinCos<float>(data->m_angles, data->m_sin, data->m_cos, precision);
+			return data->m_sin[0];
+		});
+	}
+}
@@ -0,0 +1,140 @@
+#include "Measure.h"
+
+#include "LibMath/Vector.h"
+
+#include <glm/glm.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+	// The same generic operation is registered for both libraries
+	auto const add = [](auto vec1, auto vec2) { return vec1 + vec2; };
+	auto const multiply = [](auto vec1, auto vec2) { return vec1 * vec2; };
+	auto const dot = [](auto vec1, auto vec2) { return vec1.Dot(vec2); };
+	auto const dotGlm = [](auto vec1, auto vec2) { return glm::dot(vec1, vec2); };
+	auto const magnitude = [](auto vec) { return vec.Magnitude(); };
+	auto const magnitudeGlm = [](auto vec) { return glm::length(vec); };
+	auto const normalize = [](auto vec) { return vec.Normalize(); };
+	auto const normalizeGlm = [](auto vec) { return glm::normalize(vec); };
+
+	// The same one million vectors as an array of Vector3, a stream & a view over a second array
+	struct StreamData
+	{
+		explicit StreamData(size_t count)
+			: m_result(count)
+		{
+			m_vectors.reserve(count);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const float value = static_cast<float>(i % 1024);
+				m_vectors.emplace_back(value + 1.0f, 2.0f - value, value * 0.5f);
+			}
+
+			m_array = m_vectors;
+			m_stream = LibMath::Vector3Stream<float>(m_vectors.data(), count);
+			m_view = LibMath::Vector3StreamView<float>(m_array.data(), count);
+		}
+
+		std::vector<LibMath::Vector3<float>>	m_vectors;
+		std::vector<LibMath::Vector3<float>>	m_array;
+		LibMath::Vector3Stream<float>			m_stream;
+		LibMath::Vector3StreamView<float>		m_view;
+		std::vector<float>						m_result;
+	};
+}
+
+void RegisterVectorBenchmarks(void)
+{
+	// Vector2
+	const LibMath::Vector2<float> vec2A(1.5f, -2.0f);
+	const LibMath::Vector2<float> vec2B(-0.25f, 4.0f);
+	const glm::vec2 vec2AGlm(1.5f, -2.0f);
+	const glm::vec2 vec2BGlm(-0.25f, 4.0f);
+
+	Register("Vector2/Add/LibMath", add, vec2A, vec2B);
+	Register("Vector2/Add/glm", add, vec2AGlm, vec2BGlm);
+	Register("Vector2/Multiply/LibMath", multiply, vec2A, vec2B);
+	Register("Vector2/Multiply/glm", multiply, vec2AGlm, vec2BGlm);
+	Register("Vector2/Dot/LibMath", dot, vec2A, vec2B);
+	Register("Vector2/Dot/glm", dotGlm, vec2AGlm, vec2BGlm);
+	Register("Vector2/Magnitude/LibMath", magnitude, vec2A);
+	Register("Vector2/Magnitude/glm", magnitudeGlm, vec2AGlm);
+	Register("Vector2/Normalize/LibMath", normalize, vec2A);
+	Register("Vector2/Normalize/glm", normalizeGlm, vec2AGlm);
+
+	// Vector3
+	const LibMath::Vector3<float> vec3A(1.5f, -2.0f, 3.25f);
+	const LibMath::Vector3<float> vec3B(-0.25f, 4.0f, 0.5f);
+	const glm::vec3 vec3AGlm(1.5f, -2.0f, 3.25f);
+	const glm::vec3 vec3BGlm(-0.25f, 4.0f, 0.5f);
+
+	Register("Vector3/Add/LibMath", add, vec3A, vec3B);
+	Register("Vector3/Add/glm", add, vec3AGlm, vec3BGlm);
+	Register("Vector3/Multiply/LibMath", multiply, vec3A, vec3B);
+	Register("Vector3/Multiply/glm", multiply, vec3AGlm, vec3BGlm);
+	Register("Vector3/Dot/LibMath", dot, vec3A, vec3B);
+	Register("Vector3/Dot/glm", dotGlm, vec3AGlm, vec3BGlm);
+	Register("Vector3/Cross/LibMath", [](auto vec1, auto vec2) { return vec1.Cross(vec2); }, vec3A, vec3B);
+	Register("Vector3/Cross/glm", [](auto vec1, auto vec2) { return glm::cross(vec1, vec2); }, vec3AGlm, vec3BGlm);
+	Register("Vector3/Magnitude/LibMath", magnitude, vec3A);
+	Register("Vector3/Magnitude/glm", magnitudeGlm, vec3AGlm);
+	Register("Vector3/Normalize/LibMath", normalize, vec3A);
+	Register("Vector3/Normalize/glm", normalizeGlm, vec3AGlm);
+
+	// Vector4
+	const LibMath::Vector4<float> vec4A(1.5f, -2.0f, 3.25f, 1.0f);
+	const LibMath::Vector4<float> vec4B(-0.25f, 4.0f, 0.5f, -2.0f);
+	const glm::vec4 vec4AGlm(1.5f, -2.0f, 3.25f, 1.0f);
+	const glm::vec4 vec4BGlm(-0.25f, 4.0f, 0.5f, -2.0f);
+
+	Register("Vector4/Add/LibMath", add, vec4A, vec4B);
+	Register("Vector4/Add/glm", add, vec4AGlm, vec4BGlm);
+	Register("Vector4/Multiply/LibMath", multiply, vec4A, vec4B);
+	Register("Vector4/Multiply/glm", multiply, vec4AGlm, vec4BGlm);
+	Register("Vector4/Dot/LibMath", dot, vec4A, vec4B);
+	Register("Vector4/Dot/glm", dotGlm, vec4AGlm, vec4BGlm);
+	Register("Vector4/Magnitude/LibMath", magnitude, vec4A);
+	Register("Vector4/Magnitude/glm", magnitudeGlm, vec4AGlm);
+	Register("Vector4/Normalize/LibMath", normalize, vec4A);
+	Register("Vector4/Normalize/glm", normalizeGlm, vec4AGlm);
+
+	// Vector3Stream
+	const auto data = std::make_shared<StreamData>(1000000);
+
+	Register("Vector3Stream/Normalize1M/Loop", [=]()
+	{
+		for (LibMath::Vector3<float>& vector : data->m_vectors)
+			vector.Normalize();
+
+		return data->m_vectors[0][0];
+	});
+
+	Register("Vector3Stream/Normalize1M/Stream", [=]()
+	{
+		data->m_stream.Normalize();
+		return data->m_stream.X()[0];
+	});
+
+	Register("Vector3Stream/Normalize1M/View", [=]()
+	{
+		data->m_view.Normalize();
+		return data->m_array[0][0];
+	});
+
+	Register("Vector3Stream/Dot1M/Loop", [=]()
+	{
+		for (size_t i = 0; i < data->m_vectors.size(); ++i)
+			data->m_result[i] = data->m_vectors[i].Dot(data->m_vectors[i]);
+
+		return data->m_result[0];
+	});
+
+	Register("Vector3Stream/Dot1M/Stream", [=]()
+	{
+		data->m_stream.Dot(data->m_stream, data->m_result.data());
+		return data->m_result[0];
+	});
+}
@@ -0,0 +1,34 @@
+#include "Measure.h"
+
+/*
+*	Run with --benchmark_out=<file> --benchmark_out_format=json for
+*	machine readable results, any Google Benchmark flag is supported
+*	(e.g. --benchmark_filter=Matrix4).
+*/
+
+int main(int argc, char* argv[])
+{
+	RegisterArithmeticBenchmarks();
+	RegisterTrigonometryBenchmarks();
+	RegisterVectorBenchmarks();
+	RegisterMatrixBenchmarks();
+	RegisterQuaternionBenchmarks();
+	RegisterTransformHierarchyBenchmarks();
+	RegisterGeometryBenchmarks();
+	RegisterBVHBenchmarks();
+	RegisterSweepAndPruneBenchmarks();
+	RegisterExpressionBenchmarks();
+	RegisterPackedBenchmarks();
+	RegisterFixedBenchmarks();
+	RegisterDeterministicBenchmarks();
+
+	benchmark::Initialize(&argc, argv);
+
+	if (benchmark::ReportUnrecognizedArguments(argc, argv))
+		return 1;
+
+	benchmark::RunSpecifiedBenchmarks();
+	benchmark::Shutdown();
+
+	return 0;
+}
@@ -1,9 +1,15 @@
 #pragma once
 
 #include "VariableType.hpp"
+#include "Deterministic.h"
+#include "simd/Simd.h"
+#include "simd/Float4.h"
 
+#include <bit>
 #include <cmath>
 #include <limits>
+#include <span>
+#include <type_traits>
 #include <exception>
 #include <assert.h>
 
@@ -20,25 +26,71 @@
 *	Max (2 numbers & array)		DONE
 *	Clamp						DONE
 *	Wrap						DONE
+*	Modulo						DONE
 *	Floor						DONE
 *	Ceiling						DONE
 *	Power						DONE
-*	Sqrt						
-*	Root						
+*	Sqrt (floating point)		DONE
+*	Sqrt (unsigned)				DONE
+*	Sqrt (fast)					DONE
+*	Sqrt (batch)				DONE
+*	Reciprocal sqrt				DONE
+*	Reciprocal sqrt (batch)		DONE
+*	Root						DONE
 *	Factorial					DONE
 *	Epsilon						DONE
+*	Sin, Cos, Tan				DONE
+*	Asin, Acos, Atan			DONE
+*	Atan2						DONE
+*
+*	Every function is constexpr. Sqrt & the trigonometric functions
+*	call the <cmath> version at runtime, inside a constant expression
+*	they use a series evaluated in long double instead, the result is
+*	within 1 ulp of the <cmath> value for float & double.
+*
+*	With 'LIBMATH_DETERMINISTIC' floating point Sqrt, Modulo, Root &
+*	the trigonometric functions use math::deterministic instead (see
+*	Deterministic.h), bit-for-bit identical on every platform & at
+*	compile time, & Precision::Fast uses an exact reciprocal sqrt.
+*
+*	Atan2 calls std::atan2 at runtime, constant expressions, custom
+*	types & deterministic builds take the Atan of the ratio below 1 &
+*	add the quadrant instead. Atan2(0, 0) is 0.
+*
+*	Unsigned Sqrt & integer Root return the floor of the exact root.
+*
+*	Custom numeric types (math_type::CustomNumericType, e.g. Fixed)
+*	use their own static Sqrt & trigonometric functions at runtime &
+*	in constant expressions, Modulo uses their % operator.
+*
+*	Precision::Fast uses the SSE rsqrt estimate (12 bits) refined with
+*	one Newton-Raphson step for float, measured over every positive
+*	normal float the reciprocal sqrt is within 5 ulp (relative error
+*	below 2^-21.7) & x * rsqrt(x) is within 4 ulp of the exact sqrt.
+*	The estimate is implementation defined, fast results can differ
+*	between CPU vendors (deterministic builds divide by the exact sqrt
+*	instead). Other types & builds without SSE2 always use the exact
+*	path.
 */
 
 namespace math
 {
+	// Sqrt & RSqrt have no medium tier, Medium uses the exact path
+	enum class Precision
+	{
+		Exact,	// Correctly rounded sqrt, 1 / sqrt rounds twice
+		Medium,	// See SinCos in Trigonometry.h
+		Fast	// Estimate + 1 Newton-Raphson step, see above
+	};
+
 	template<math::math_type::NumericType T>
 	inline constexpr T Abs(T val) noexcept;
 
 	template<math::math_type::NumericType T>
-	bool AlmostEqual(T val1, T val2);
+	inline constexpr bool AlmostEqual(T val1, T val2);
 
 	template<math::math_type::NumericType T>
-	bool AlmostEqual(T val1, T val2, T epsilon);
+	inline constexpr bool AlmostEqual(T val1, T val2, T epsilon);
 
 	template<math_type::NumericType T>
 	inline constexpr T Min(T const& val1, T const& val2) noexcept;
@@ -52,6 +104,9 @@ namespace math
 	template<math_type::NumericType T>
 	constexpr T Wrap(T const& val, T const& min, T const& max);
 
+	template<math_type::NumericType T>
+	inline constexpr T Modulo(T const& val, T const& divisor);
+
 	template<math::math_type::NumericType T>
 	inline constexpr int Floor(T const& val) noexcept;
 
@@ -61,14 +116,50 @@ namespace math
 	template<math::math_type::NumericType T>
 	inline constexpr T Power(T const& val, unsigned int const power);
 
+	template<math::math_type::NumericType T>
+	inline constexpr T Sqrt(T const& val) noexcept;
+
 	template<math::math_type::UnsignedType T>
 	inline constexpr T Sqrt(T const& val) noexcept;
 
-	template<math::math_type::UnsignedType T, math::math_type::NumericType Tindex>
+	template<math::math_type::NumericType T>
+	inline constexpr T Sqrt(T const& val, Precision precision) noexcept;
+
+	template<math::math_type::NumericType T>
+	inline void Sqrt(std::span<T const> values, std::span<T> result, Precision precision = Precision::Exact);
+
+	template<math::math_type::NumericType T>
+	inline constexpr T RSqrt(T const& val, Precision precision = Precision::Exact) noexcept;
+
+	template<math::math_type::NumericType T>
+	inline void RSqrt(std::span<T const> values, std::span<T> result, Precision precision = Precision::Exact);
+
+	template<math::math_type::NumericType T, math::math_type::NumericType Tindex>
 	inline constexpr T Root(T const& val, Tindex const& index) noexcept;
 
 	template<math::math_type::NumericType T>
 	inline constexpr T Factorial(T const& val);
+
+	template<math::math_type::NumericType T>
+	inline constexpr T Sin(T const& rad) noexcept;
+
+	template<math::math_type::NumericType T>
+	inline constexpr T Cos(T const& rad) noexcept;
+
+	template<math::math_type::NumericType T>
+	inline constexpr T Tan(T const& rad) noexcept;
+
+	template<math::math_type::NumericType T>
+	inline constexpr T Asin(T const& val) noexcept;
+
+	template<math::math_type::NumericType T>
+	inline constexpr T Acos(T const& val) noexcept;
+
+	template<math::math_type::NumericType T>
+	inline constexpr T Atan(T const& val) noexcept;
+
+	template<math::math_type::NumericType T>
+	inline constexpr T Atan2(T const& y, T const& x) noexcept;
 }
 
 template<math::math_type::NumericType T>
@@ -78,7 +169,7 @@ constexpr T math::Abs(T const val) noexcept
 }
 
 template<math::math_type::NumericType T>
-bool math::AlmostEqual(T val1, T val2)
+constexpr bool math::AlmostEqual(T val1, T val2)
 {
 	// Calculate difference
 	T delta = val2 - val1;
@@ -87,7 +178,7 @@ bool math::AlmostEqual(T val1, T val2)
 }
 
 template<math::math_type::NumericType T>
-bool math::AlmostEqual(T val1, T val2, T epsilon)
+constexpr bool math::AlmostEqual(T val1, T val2, T epsilon)
 {
 	// Calculate difference
 	T delta = val2 - val1;
@@ -142,7 +233,7 @@ constexpr T math::Wrap(T const& val, T const& min, T const& max)
 		if (offsetRange < range)
 			return max - math::Abs(val);
 		else
-			return max - std::fmodf(offsetRange, range);
+			return max - math::Modulo(offsetRange, range);
 	}
 	// If number is larger than maximum
 	else
@@ -154,7 +245,32 @@ constexpr T math::Wrap(T const& val, T const& min, T const& max)
 		if (offsetRange < range)
 			return min + math::Abs(offsetRange);
 		else
-			return min + std::fmodf(offsetRange, range);
+			return min + math::Modulo(offsetRange, range);
+	}
+}
+
+template<math::math_type::NumericType T>
+constexpr T math::Modulo(T const& val, T const& divisor)
+{
+	_ASSERT(divisor != 0);
+
+	if constexpr (std::is_integral_v<T> || math_type::CustomNumericType<T>)
+		return val % divisor;
+	else
+	{
+#ifdef LIBMATH_DETERMINISTIC
+		if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+			return deterministic::Modulo(val, divisor);
+#endif
+
+		if (!std::is_constant_evaluated())
+			return std::fmod(val, divisor);
+
+		// Truncated quotient, the result has the sign of val like std::fmod
+		const long double quotient = static_cast<long double>(val) / static_cast<long double>(divisor);
+		const long double truncated = static_cast<long double>(static_cast<long long>(quotient));
+
+		return static_cast<T>(static_cast<long double>(val) - truncated * static_cast<long double>(divisor));
 	}
 }
 
@@ -200,22 +316,225 @@ constexpr T math::Power(T const& val, unsigned int const power)
 	return result;
 }
 
+template<math::math_type::NumericType T>
+constexpr T math::Sqrt(T const& val) noexcept
+{
+	if constexpr (math_type::CustomNumericType<T>)
+		return T::Sqrt(val);
+	else if (!std::is_constant_evaluated())
+		return static_cast<T>(std::sqrt(val));
+
+#ifdef LIBMATH_DETERMINISTIC
+	// The long double series below depends on the size of long double
+	if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+		return static_cast<T>(deterministic::Sqrt(static_cast<double>(val)));
+#endif
+
+	const long double value = static_cast<long double>(val);
+
+	if (value < 0.0L || value != value)
+		return std::numeric_limits<T>::quiet_NaN();
+
+	if (value == 0.0L || value == std::numeric_limits<long double>::infinity())
+		return val;
+
+	// Newton-Raphson starting above the root, the estimate decreases until it converges
+	long double estimate = (value > 1.0L) ? value : 1.0L;
+
+	while (true)
+	{
+		const long double next = 0.5L * (estimate + value / estimate);
+
+		if (next >= estimate)
+			break;
+
+		estimate = next;
+	}
+
+	return static_cast<T>(estimate);
+}
+
 template<math::math_type::UnsignedType T>
 constexpr T math::Sqrt(T const& val) noexcept
 {
-	// TODO: finish sqrt function
-	__debugbreak();
+	if (val < 2)
+		return val;
+
+	// Integer Newton-Raphson from a power of 2 above the root, stops at floor(sqrt(val))
+	T estimate = static_cast<T>(T(1) << ((std::bit_width(val) + 1) / 2));
+
+	while (true)
+	{
+		const T next = static_cast<T>((estimate + val / estimate) / 2);
+
+		if (next >= estimate)
+			return estimate;
+
+		estimate = next;
+	}
+}
+
+template<math::math_type::NumericType T>
+constexpr T math::Sqrt(T const& val, Precision precision) noexcept
+{
+	// x * rsqrt(x) is NaN for 0 & infinity, both are their own root
+	if (precision == Precision::Fast && val != 0 && val != std::numeric_limits<T>::infinity())
+	{
+#if LIBMATH_SIMD_SSE2
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (!std::is_constant_evaluated())
+				return val * math::RSqrt(val, Precision::Fast);
+		}
+#endif
+	}
+
+	return math::Sqrt(val);
+}
+
+template<math::math_type::NumericType T>
+void math::Sqrt(std::span<T const> values, std::span<T> result, Precision precision)
+{
+	_ASSERT(result.size() >= values.size());
+
+#if LIBMATH_SIMD_SSE2
+	if constexpr (std::is_same_v<T, float>)
+	{
+		if (precision == Precision::Fast)
+			simd::SqrtFast(result.data(), values.data(), values.size());
+		else
+			simd::Sqrt(result.data(), values.data(), values.size());
+
+		return;
+	}
+#endif
+
+	for (size_t i = 0; i < values.size(); ++i)
+		result[i] = math::Sqrt(values[i], precision);
+}
+
+template<math::math_type::NumericType T>
+constexpr T math::RSqrt(T const& val, [[maybe_unused]] Precision precision) noexcept
+{
+#if LIBMATH_SIMD_SSE2
+	if constexpr (std::is_same_v<T, float>)
+	{
+		if (precision == Precision::Fast && !std::is_constant_evaluated())
+			return _mm_cvtss_f32(simd::RSqrt4(_mm_set_ss(val)));
+	}
+#endif
 
-	return 0;
+	return static_cast<T>(1) / math::Sqrt(val);
 }
 
-template<math::math_type::UnsignedType T, math::math_type::NumericType Tindex>
+template<math::math_type::NumericType T>
+void math::RSqrt(std::span<T const> values, std::span<T> result, Precision precision)
+{
+	_ASSERT(result.size() >= values.size());
+
+#if LIBMATH_SIMD_SSE2
+	if constexpr (std::is_same_v<T, float>)
+	{
+		if (precision == Precision::Fast)
+			simd::RSqrtFast(result.data(), values.data(), values.size());
+		else
+			simd::RSqrt(result.data(), values.data(), values.size());
+
+		return;
+	}
+#endif
+
+	for (size_t i = 0; i < values.size(); ++i)
+		result[i] = math::RSqrt(values[i], precision);
+}
+
+template<math::math_type::NumericType T, math::math_type::NumericType Tindex>
 constexpr T math::Root(T const& val, Tindex const& index) noexcept
 {
-	// TODO: finish root function
-	__debugbreak();
+	// The index is a positive integer, an odd root of a negative value is negative
+	_ASSERT(index >= 1);
+
+	const unsigned int degree = static_cast<unsigned int>(index);
+
+	if constexpr (std::is_signed_v<T>)
+	{
+		if (val < 0)
+		{
+			_ASSERT(degree % 2 == 1);
+
+			return static_cast<T>(-math::Root(static_cast<T>(-val), degree));
+		}
+	}
+
+	if (degree == 1)
+		return val;
+
+	if constexpr (std::is_integral_v<T>)
+	{
+		using Unsigned = std::make_unsigned_t<T>;
+
+		const Unsigned value = static_cast<Unsigned>(val);
+
+		if (value < 2)
+			return val;
+
+		// Integer Newton-Raphson from a power of 2 above the root, stops at floor(root)
+		const unsigned int shift = (static_cast<unsigned int>(std::bit_width(value)) + degree - 1) / degree;
+		Unsigned estimate = static_cast<Unsigned>(Unsigned(1) << shift);
+
+		while (true)
+		{
+			// val / estimate^(degree - 1) without overflow
+			Unsigned quotient = value;
+
+			for (unsigned int i = 1; i < degree && quotient != 0; ++i)
+				quotient /= estimate;
+
+			const Unsigned next = static_cast<Unsigned>(((degree - 1) * estimate + quotient) / degree);
+
+			if (next >= estimate)
+				return static_cast<T>(estimate);
+
+			estimate = next;
+		}
+	}
+	else
+	{
+#ifdef LIBMATH_DETERMINISTIC
+		return static_cast<T>(deterministic::Root(static_cast<double>(val), degree));
+#else
+		if (!std::is_constant_evaluated())
+		{
+			if (degree == 2)
+				return std::sqrt(val);
 
-	return 0;
+			if (degree == 3)
+				return std::cbrt(val);
+
+			return std::pow(val, static_cast<T>(1) / static_cast<T>(degree));
+		}
+
+		const long double value = static_cast<long double>(val);
+
+		if (value == 0.0L || value != value || value == std::numeric_limits<long double>::infinity())
+			return val;
+
+		// Newton-Raphson starting above the root, x = ((n - 1) * x + val / x^(n - 1)) / n
+		long double estimate = (value > 1.0L) ? value : 1.0L;
+
+		while (true)
+		{
+			const long double next = (static_cast<long double>(degree - 1) * estimate + value / math::Power(estimate, degree - 1)) / static_cast<long double>(degree);
+
+			if (next >= estimate)
+				break;
+
+			estimate = next;
+		}
+
+		return static_cast<T>(estimate);
+#endif
+	}
 }
 
 template<math::math_type::NumericType T>
@@ -229,4 +548,212 @@ constexpr T math::Factorial(T const& val)
 	return (val < 0) ? -result : result;
 }
 
+template<math::math_type::NumericType T>
+constexpr T math::Sin(T const& rad) noexcept
+{
+	if constexpr (math_type::CustomNumericType<T>)
+		return T::Sin(rad);
+#ifdef LIBMATH_DETERMINISTIC
+	else if constexpr (std::is_arithmetic_v<T>)
+		return static_cast<T>(deterministic::Sin(static_cast<double>(rad)));
+#endif
+	else if (!std::is_constant_evaluated())
+		return static_cast<T>(std::sin(rad));
+
+	constexpr long double pi = 3.141592653589793238462643383279502884L;
+
+	// Bring the angle back to [-pi, pi]
+	long double x = static_cast<long double>(rad);
+	x -= 2.0L * pi * static_cast<long double>(static_cast<long long>(x / (2.0L * pi) + ((x < 0.0L) ? -0.5L : 0.5L)));
+
+	// Taylor series, x - x^3 / 3! + x^5 / 5! ...
+	long double term = x;
+	long double sum = x;
+
+	for (int n = 1; sum + term != sum; ++n)
+	{
+		term *= -x * x / static_cast<long double>((2 * n) * (2 * n + 1));
+		sum += term;
+	}
+
+	return static_cast<T>(sum);
+}
+
+template<math::math_type::NumericType T>
+constexpr T math::Cos(T const& rad) noexcept
+{
+	if constexpr (math_type::CustomNumericType<T>)
+		return T::Cos(rad);
+#ifdef LIBMATH_DETERMINISTIC
+	else if constexpr (std::is_arithmetic_v<T>)
+		return static_cast<T>(deterministic::Cos(static_cast<double>(rad)));
+#endif
+	else if (!std::is_constant_evaluated())
+		return static_cast<T>(std::cos(rad));
+
+	constexpr long double pi = 3.141592653589793238462643383279502884L;
+
+	long double x = static_cast<long double>(rad);
+	x -= 2.0L * pi * static_cast<long double>(static_cast<long long>(x / (2.0L * pi) + ((x < 0.0L) ? -0.5L : 0.5L)));
+
+	// Taylor series, 1 - x^2 / 2! + x^4 / 4! ...
+	long double term = 1.0L;
+	long double sum = 1.0L;
+
+	for (int n = 1; sum + term != sum; ++n)
+	{
+		term *= -x * x / static_cast<long double>((2 * n - 1) * (2 * n));
+		sum += term;
+	}
+
+	return static_cast<T>(sum);
+}
+
+template<math::math_type::NumericType T>
+constexpr T math::Tan(T const& rad) noexcept
+{
+	if constexpr (math_type::CustomNumericType<T>)
+		return T::Tan(rad);
+#ifdef LIBMATH_DETERMINISTIC
+	else if constexpr (std::is_arithmetic_v<T>)
+		return static_cast<T>(deterministic::Tan(static_cast<double>(rad)));
+#endif
+	else if (!std::is_constant_evaluated())
+		return static_cast<T>(std::tan(rad));
+
+	return static_cast<T>(math::Sin(static_cast<long double>(rad)) / math::Cos(static_cast<long double>(rad)));
+}
+
+template<math::math_type::NumericType T>
+constexpr T math::Asin(T const& val) noexcept
+{
+	if constexpr (math_type::CustomNumericType<T>)
+		return T::Asin(val);
+#ifdef LIBMATH_DETERMINISTIC
+	else if constexpr (std::is_arithmetic_v<T>)
+		return static_cast<T>(deterministic::Asin(static_cast<double>(val)));
+#endif
+	else if (!std::is_constant_evaluated())
+		return static_cast<T>(std::asin(val));
+
+	const long double x = static_cast<long double>(val);
+
+	if (x < -1.0L || x > 1.0L)
+		return std::numeric_limits<T>::quiet_NaN();
+
+	constexpr long double halfPi = 1.570796326794896619231321691639751442L;
+
+	if (x == 1.0L || x == -1.0L)
+		return static_cast<T>(x * halfPi);
+
+	// asin(x) = atan(x / sqrt(1 - x^2))
+	return static_cast<T>(math::Atan(x / math::Sqrt((1.0L - x) * (1.0L + x))));
+}
+
+template<math::math_type::NumericType T>
+constexpr T math::Acos(T const& val) noexcept
+{
+	if constexpr (math_type::CustomNumericType<T>)
+		return T::Acos(val);
+#ifdef LIBMATH_DETERMINISTIC
+	else if constexpr (std::is_arithmetic_v<T>)
+		return static_cast<T>(deterministic::Acos(static_cast<double>(val)));
+#endif
+	else if (!std::is_constant_evaluated())
+		return static_cast<T>(std::acos(val));
+
+	constexpr long double halfPi = 1.570796326794896619231321691639751442L;
+
+	return static_cast<T>(halfPi - math::Asin(static_cast<long double>(val)));
+}
+
+template<math::math_type::NumericType T>
+constexpr T math::Atan(T const& val) noexcept
+{
+	if constexpr (math_type::CustomNumericType<T>)
+		return T::Atan(val);
+#ifdef LIBMATH_DETERMINISTIC
+	else if constexpr (std::is_arithmetic_v<T>)
+		return static_cast<T>(deterministic::Atan(static_cast<double>(val)));
+#endif
+	else if (!std::is_constant_evaluated())
+		return static_cast<T>(std::atan(val));
+
+	constexpr long double halfPi = 1.570796326794896619231321691639751442L;
+
+	long double x = static_cast<long double>(val);
+
+	if (x != x)
+		return static_cast<T>(x);
+
+	const long double sign = (x < 0.0L) ? -1.0L : 1.0L;
+	x *= sign;
+
+	// atan(x) = pi / 2 - atan(1 / x)
+	const bool inverted = x > 1.0L;
+
+	if (inverted)
+		x = 1.0L / x;
+
+	// Halve the angle twice, atan(x) = 2 * atan(x / (1 + sqrt(1 + x^2))), |x| <= tan(pi / 16)
+	for (int i = 0; i < 2; ++i)
+		x = x / (1.0L + math::Sqrt(1.0L + x * x));
+
+	// Taylor series, x - x^3 / 3 + x^5 / 5 ...
+	long double power = x;
+	long double sum = x;
+
+	for (int n = 1; ; ++n)
+	{
+		power *= -x * x;
+
+		const long double term = power / static_cast<long double>(2 * n + 1);
+
+		if (sum + term == sum)
+			break;
+
+		sum += term;
+	}
+
+	sum *= 4.0L;
+
+	if (inverted)
+		sum = halfPi - sum;
+
+	return static_cast<T>(sign * sum);
+}
+
+template<math::math_type::NumericType T>
+constexpr T math::Atan2(T const& y, T const& x) noexcept
+{
+#ifndef LIBMATH_DETERMINISTIC
+	if constexpr (std::is_arithmetic_v<T>)
+	{
+		if (!std::is_constant_evaluated())
+			return static_cast<T>(std::atan2(y, x));
+	}
+#endif
+
+	const T zero = static_cast<T>(0);
+	const T halfPi = static_cast<T>(1.570796326794896619231321691639751442L);
+	const T pi = static_cast<T>(3.141592653589793238462643383279502884L);
+
+	if (x == zero && y == zero)
+		return zero;
+
+	// atan(y / x) in [-pi / 4, pi / 4], shifted by pi for a negative x
+	if (math::Abs(y) <= math::Abs(x))
+	{
+		const T angle = math::Atan(static_cast<T>(y / x));
+
+		if (x < zero)
+			return (y < zero) ? angle - pi : angle + pi;
+
+		return angle;
+	}
+
+	// atan(y / x) = +-pi / 2 - atan(x / y)
+	return ((y < zero) ? -halfPi : halfPi) - math::Atan(static_cast<T>(x / y));
+}
+
 namespace LibMath = math;
\ No newline at end of file
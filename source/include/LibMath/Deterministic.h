@@ -0,0 +1,512 @@
+#pragma once
+
+#include <bit>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/*
+*	------- Deterministic -------
+*	Sqrt, Modulo, Root & the trigonometric functions written with
+*	+ - * / & sqrt only, in a fixed order, evaluated in double. Every
+*	step is a correctly rounded IEEE operation so the result only
+*	depends on the input, not on the platform libm, the compiler or
+*	the CPU vendor. Results are the same at compile time & at runtime.
+*
+*	Arithmetic.h calls these for floating point types when the library
+*	is built with 'LIBMATH_DETERMINISTIC' (cmake option of the same
+*	name). float results are computed in double & rounded once, long
+*	double goes through double. The functions are always available
+*	under math::deterministic.
+*
+*	The guarantee needs strict IEEE double evaluation: no x87
+*	(FLT_EVAL_METHOD 0), no fast-math & no contraction of a * b + c
+*	into fused multiply-adds. The cmake option adds -ffp-contract=off
+*	(/fp:precise on MSVC) to the library & its users & keeps the FMA
+*	kernels disabled.
+*
+*	Accuracy (double, measured against a long double reference):
+*	- Sqrt			correctly rounded (std::sqrt at runtime, integer root at compile time)
+*	- Modulo		exact (std::fmod at runtime)
+*	- Sin, Cos		within 2 ulp for |x| < 2^30, larger angles are first reduced
+*					modulo the double nearest 2 * pi, the result stays deterministic
+*					but loses accuracy as the angle grows
+*	- Tan			within 4 ulp (sin / cos)
+*	- Atan, Root	within 2 ulp
+*	- Asin, Acos	within 4 ulp
+*	float results are correctly rounded for every input tested.
+*
+*	Functions
+*	- Sqrt			DONE
+*	- Modulo		DONE
+*	- Root			DONE
+*	- SinCos		DONE
+*	- Sin, Cos, Tan	DONE
+*	- Asin, Acos	DONE
+*	- Atan			DONE
+*/
+
+#ifdef LIBMATH_DETERMINISTIC
+	#if defined(__FAST_MATH__)
+		#error "LIBMATH_DETERMINISTIC needs IEEE arithmetic, disable -ffast-math"
+	#endif
+
+	#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD != 0
+		#error "LIBMATH_DETERMINISTIC needs float & double evaluated in their own precision (SSE2, not x87)"
+	#endif
+#endif
+
+namespace math
+{
+	namespace trigonometry
+	{
+		// Reduction limit, pi / 2 split in 3 parts & polynomial coefficients for r in [-pi / 4, pi / 4]
+		template<typename T>
+		struct SinCosConstants;
+
+		template<>
+		struct SinCosConstants<float>
+		{
+			static constexpr float limit = 8192.0f;
+			static constexpr float twoOverPi = 0.636619772367581343076f;
+			static constexpr float halfPi1 = 1.5703125f;
+			static constexpr float halfPi2 = 4.837512969970703125e-4f;
+			static constexpr float halfPi3 = 7.54978995489188216e-8f;
+
+			// sin(r) = r + r^3 * P(r^2), cos(r) = 1 - r^2 / 2 + r^4 * Q(r^2)
+			static constexpr float sinMedium[3] = { -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f };
+			static constexpr float cosMedium[3] = { 4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f };
+
+			// sin(r) = r + r^3 * P(r^2), cos(r) = 1 + r^2 * Q(r^2)
+			static constexpr float sinFast[2] = { -0.16664794607744643f, 0.008181636484741744f };
+			static constexpr float cosFast[2] = { -0.4998696865858084f, 0.04060804675356882f };
+		};
+
+		template<>
+		struct SinCosConstants<double>
+		{
+			static constexpr double limit = 1073741824.0;
+			static constexpr double twoOverPi = 0.636619772367581343076;
+			static constexpr double halfPi1 = 1.57079625129699707031;
+			static constexpr double halfPi2 = 7.54978941586159635335e-8;
+			static constexpr double halfPi3 = 5.39030285815811905290e-15;
+
+			static constexpr double sinMedium[6] =
+			{
+				-1.66666666666666307295e-1, 8.33333333332211858878e-3, -1.98412698295895385996e-4,
+				2.75573136213857245213e-6, -2.50507477628578072866e-8, 1.58962301576546568060e-10
+			};
+
+			static constexpr double cosMedium[6] =
+			{
+				4.16666666666665929218e-2, -1.38888888888730564116e-3, 2.48015872888517045348e-5,
+				-2.75573141792967388112e-7, 2.08757008419747316778e-9, -1.13585365213876817300e-11
+			};
+
+			static constexpr double sinFast[2] = { -0.16664794607744643, 0.008181636484741744 };
+			static constexpr double cosFast[2] = { -0.4998696865858084, 0.04060804675356882 };
+		};
+
+		// c[0] + z * (c[1] + z * (... + z * c[N - 1]))
+		template<typename T, size_t N>
+		inline constexpr T Horner(T z, T const (&c)[N]) noexcept
+		{
+			T result = c[N - 1];
+
+			for (size_t i = N - 1; i > 0; --i)
+				result = c[i - 1] + z * result;
+
+			return result;
+		}
+
+		// Nearest quadrant, rad = quadrant * pi / 2 + r with r in [-pi / 4, pi / 4]. |rad| must be below the limit
+		template<typename T>
+		inline constexpr T ReduceQuadrant(T rad, int& quadrant) noexcept
+		{
+			using Constants = SinCosConstants<T>;
+
+			quadrant = static_cast<int>(rad * Constants::twoOverPi + ((rad < 0) ? static_cast<T>(-0.5) : static_cast<T>(0.5)));
+
+			const T quadrantValue = static_cast<T>(quadrant);
+
+			return ((rad - quadrantValue * Constants::halfPi1) - quadrantValue * Constants::halfPi2) - quadrantValue * Constants::halfPi3;
+		}
+
+		// Odd quadrants swap sin & cos, quadrants 2 & 3 negate sin, 1 & 2 negate cos
+		template<typename T>
+		inline constexpr void ApplyQuadrant(int quadrant, T sinR, T cosR, T& sin, T& cos) noexcept
+		{
+			sin = (quadrant & 1) ? cosR : sinR;
+			cos = (quadrant & 1) ? sinR : cosR;
+
+			if (quadrant & 2)
+				sin = -sin;
+
+			if ((quadrant + 1) & 2)
+				cos = -cos;
+		}
+	}
+
+	namespace deterministic
+	{
+		template<typename T>
+		inline constexpr T Modulo(T val, T divisor) noexcept;
+
+		inline constexpr double Sqrt(double val) noexcept;
+		inline constexpr double Root(double val, unsigned int degree) noexcept;
+
+		inline constexpr void SinCos(double rad, double& sin, double& cos) noexcept;
+		inline constexpr double Sin(double rad) noexcept;
+		inline constexpr double Cos(double rad) noexcept;
+		inline constexpr double Tan(double rad) noexcept;
+
+		inline constexpr double Asin(double val) noexcept;
+		inline constexpr double Acos(double val) noexcept;
+		inline constexpr double Atan(double val) noexcept;
+
+		// pi & pi / 2 as a double plus the rounding error of that double
+		constexpr double piHigh = 3.141592653589793;
+		constexpr double piLow = 1.2246467991473532e-16;
+		constexpr double halfPiHigh = 1.5707963267948966;
+		constexpr double halfPiLow = 6.123233995736766e-17;
+		constexpr double twoPi = 6.283185307179586;
+
+		// atan(k / 8) for k = 0 ... 8, high & low part
+		constexpr double atanHigh[9] =
+		{
+			0.0, 0.12435499454676144, 0.24497866312686414, 0.35877067027057225, 0.4636476090008061,
+			0.5585993153435624, 0.6435011087932844, 0.7188299996216245, 0.7853981633974483
+		};
+
+		constexpr double atanLow[9] =
+		{
+			0.0, -3.1253241424539383e-18, 1.0698755618734451e-17, -2.4623815582638635e-17, 2.2698777452961687e-17,
+			-5.4556305485916264e-18, 1.5834785051444286e-17, -2.1478388444456983e-17, 3.061616997868383e-17
+		};
+
+		// atan(t) = t + t^3 * P(t^2), Taylor series, |t| <= 1 / 16 so the first omitted term is below 2^-60 * t
+		constexpr double atanSeries[6] =
+		{
+			-0.3333333333333333, 0.2, -0.14285714285714285, 0.1111111111111111, -0.09090909090909091, 0.07692307692307693
+		};
+
+		// Exact 64 x 64 bit product as 2 words
+		inline constexpr void Multiply128(uint64_t lhs, uint64_t rhs, uint64_t& high, uint64_t& low) noexcept
+		{
+			const uint64_t lhsLow = lhs & 0xFFFFFFFFu;
+			const uint64_t lhsHigh = lhs >> 32;
+			const uint64_t rhsLow = rhs & 0xFFFFFFFFu;
+			const uint64_t rhsHigh = rhs >> 32;
+
+			const uint64_t lowLow = lhsLow * rhsLow;
+			const uint64_t highLow = lhsHigh * rhsLow;
+			const uint64_t lowHigh = lhsLow * rhsHigh;
+			const uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFu) + (lowHigh & 0xFFFFFFFFu);
+
+			low = (middle << 32) | (lowLow & 0xFFFFFFFFu);
+			high = lhsHigh * rhsHigh + (highLow >> 32) + (lowHigh >> 32) + (middle >> 32);
+		}
+
+		// root^2 <= value, value given as 2 words
+		inline constexpr bool SquareNotAbove(uint64_t root, uint64_t valueHigh, uint64_t valueLow) noexcept
+		{
+			uint64_t high = 0;
+			uint64_t low = 0;
+
+			Multiply128(root, root, high, low);
+
+			return high < valueHigh || (high == valueHigh && low <= valueLow);
+		}
+
+		// atan of |val| <= 1, atan(a) = atan(k / 8) + atan((a - k / 8) / (1 + a * k / 8))
+		inline constexpr double AtanReduced(double val) noexcept
+		{
+			const int index = static_cast<int>(val * 8.0 + 0.5);
+			const double center = static_cast<double>(index) * 0.125;
+
+			// val - center is exact, both are within a factor 2 or center is 0
+			const double t = (val - center) / (1.0 + center * val);
+			const double z = t * t;
+
+			return atanHigh[index] + (atanLow[index] + (t + (t * z) * trigonometry::Horner(z, atanSeries)));
+		}
+
+		// Reduces angles beyond the polynomial range modulo 2 * pi, false for infinity & NaN
+		inline constexpr bool ReduceLarge(double& rad) noexcept
+		{
+			using Constants = trigonometry::SinCosConstants<double>;
+
+			if (rad >= -Constants::limit && rad <= Constants::limit)
+				return true;
+
+			if (rad != rad || rad == std::numeric_limits<double>::infinity() || rad == -std::numeric_limits<double>::infinity())
+				return false;
+
+			rad = Modulo(rad, twoPi);
+
+			return true;
+		}
+
+		// Sine (offset 0) or cosine (offset 1) with a single polynomial, cos(x) = sin(x + pi / 2) moves x one quadrant.
+		// Same operations as SinCos, the results are identical
+		inline constexpr double SinQuadrant(double rad, int offset) noexcept
+		{
+			using Constants = trigonometry::SinCosConstants<double>;
+
+			if (!ReduceLarge(rad))
+				return std::numeric_limits<double>::quiet_NaN();
+
+			// Keeps the sign of zero
+			if (rad == 0.0)
+				return (offset == 0) ? rad : 1.0;
+
+			int quadrant = 0;
+
+			const double r = trigonometry::ReduceQuadrant(rad, quadrant);
+			const double z = r * r;
+
+			quadrant += offset;
+
+			const double result = (quadrant & 1) ?
+				((z * z) * trigonometry::Horner(z, Constants::cosMedium) - 0.5 * z) + 1.0 :
+				r + (r * z) * trigonometry::Horner(z, Constants::sinMedium);
+
+			return (quadrant & 2) ? -result : result;
+		}
+
+		// asin(val) = atan(val / sqrt(1 - val^2)) for |val| <= 0.5
+		inline constexpr double AsinReduced(double val) noexcept
+		{
+			return Atan(val / Sqrt((1.0 - val) * (1.0 + val)));
+		}
+	}
+}
+
+template<typename T>
+constexpr T math::deterministic::Modulo(T val, T divisor) noexcept
+{
+	static_assert(std::is_floating_point_v<T>);
+
+	// std::fmod is exact, it only depends on its operands
+	if (!std::is_constant_evaluated())
+		return std::fmod(val, divisor);
+
+	const T infinity = std::numeric_limits<T>::infinity();
+
+	if (val != val || divisor != divisor || val == infinity || val == -infinity || divisor == 0)
+		return std::numeric_limits<T>::quiet_NaN();
+
+	T remainder = (val < 0) ? -val : val;
+	const T step = (divisor < 0) ? -divisor : divisor;
+
+	// Subtract the largest step * 2^k below the remainder, each subtraction is exact (Sterbenz)
+	while (remainder >= step)
+	{
+		T multiple = step;
+
+		while (multiple * 2 <= remainder)
+			multiple *= 2;
+
+		remainder -= multiple;
+	}
+
+	return (val < 0) ? -remainder : remainder;
+}
+
+constexpr double math::deterministic::Sqrt(double val) noexcept
+{
+	// The sqrt instruction is correctly rounded
+	if (!std::is_constant_evaluated())
+		return std::sqrt(val);
+
+	if (val < 0.0 || val != val)
+		return std::numeric_limits<double>::quiet_NaN();
+
+	if (val == 0.0 || val == std::numeric_limits<double>::infinity())
+		return val;
+
+	// val = x * 4^exponent with x in [1, 4), sqrt(val) = sqrt(x) * 2^exponent
+	double x = val;
+	double scale = 1.0;
+
+	while (x >= 4.0)
+	{
+		x *= 0.25;
+		scale *= 2.0;
+	}
+
+	while (x < 1.0)
+	{
+		x *= 4.0;
+		scale *= 0.5;
+	}
+
+	// Newton-Raphson, a few ulp from the root
+	double estimate = 1.5;
+
+	for (int i = 0; i < 6; ++i)
+		estimate = 0.5 * (estimate + x / estimate);
+
+	// Integer root of x * 2^104, the result has 53 bits
+	const uint64_t mantissa = static_cast<uint64_t>(x * 4503599627370496.0);
+	const uint64_t valueHigh = mantissa >> 12;
+	const uint64_t valueLow = mantissa << 52;
+
+	uint64_t root = static_cast<uint64_t>(estimate * 4503599627370496.0);
+
+	while (!SquareNotAbove(root, valueHigh, valueLow))
+		--root;
+
+	while (SquareNotAbove(root + 1, valueHigh, valueLow))
+		++root;
+
+	// Round up when value >= root^2 + root + 1, the root of an integer is never halfway
+	uint64_t high = 0;
+	uint64_t low = 0;
+
+	Multiply128(root, root, high, low);
+
+	const uint64_t remainderLow = valueLow - low;
+	const uint64_t remainderHigh = valueHigh - high - ((valueLow < low) ? 1u : 0u);
+
+	if (remainderHigh != 0 || remainderLow > root)
+		++root;
+
+	return static_cast<double>(root) / 4503599627370496.0 * scale;
+}
+
+constexpr double math::deterministic::Root(double val, unsigned int degree) noexcept
+{
+	if (degree == 2)
+		return Sqrt(val);
+
+	if (degree == 1 || val == 0.0 || val != val || val == std::numeric_limits<double>::infinity())
+		return val;
+
+	if (val < 0.0)
+		return -Root(-val, degree);
+
+	// val < 2^exponent, start Newton-Raphson at the power of 2 ceil(exponent / degree)
+	const int exponent = static_cast<int>((std::bit_cast<uint64_t>(val) >> 52) & 0x7FF) - 1022;
+	const int degreeValue = static_cast<int>(degree);
+	const int shift = (exponent >= 0) ? (exponent + degreeValue - 1) / degreeValue : -(-exponent / degreeValue);
+
+	double estimate = std::bit_cast<double>(static_cast<uint64_t>(shift + 1023) << 52);
+
+	// x = ((n - 1) * x + val / x^(n - 1)) / n decreases until it converges
+	while (true)
+	{
+		double power = estimate;
+
+		for (unsigned int i = 2; i < degree; ++i)
+			power *= estimate;
+
+		const double next = (static_cast<double>(degree - 1) * estimate + val / power) / static_cast<double>(degree);
+
+		if (next >= estimate)
+			return estimate;
+
+		estimate = next;
+	}
+}
+
+constexpr void math::deterministic::SinCos(double rad, double& sin, double& cos) noexcept
+{
+	using Constants = trigonometry::SinCosConstants<double>;
+
+	if (!ReduceLarge(rad))
+	{
+		sin = std::numeric_limits<double>::quiet_NaN();
+		cos = sin;
+
+		return;
+	}
+
+	// Keeps the sign of zero
+	if (rad == 0.0)
+	{
+		sin = rad;
+		cos = 1.0;
+
+		return;
+	}
+
+	int quadrant = 0;
+
+	const double r = trigonometry::ReduceQuadrant(rad, quadrant);
+	const double z = r * r;
+
+	const double sinR = r + (r * z) * trigonometry::Horner(z, Constants::sinMedium);
+	const double cosR = ((z * z) * trigonometry::Horner(z, Constants::cosMedium) - 0.5 * z) + 1.0;
+
+	trigonometry::ApplyQuadrant(quadrant, sinR, cosR, sin, cos);
+}
+
+constexpr double math::deterministic::Sin(double rad) noexcept
+{
+	return SinQuadrant(rad, 0);
+}
+
+constexpr double math::deterministic::Cos(double rad) noexcept
+{
+	return SinQuadrant(rad, 1);
+}
+
+constexpr double math::deterministic::Tan(double rad) noexcept
+{
+	double sin = 0.0;
+	double cos = 0.0;
+
+	SinCos(rad, sin, cos);
+
+	return sin / cos;
+}
+
+constexpr double math::deterministic::Asin(double val) noexcept
+{
+	const double magnitude = (val < 0.0) ? -val : val;
+
+	// NaN fails the range check
+	if (!(magnitude <= 1.0))
+		return std::numeric_limits<double>::quiet_NaN();
+
+	if (magnitude <= 0.5)
+		return AsinReduced(val);
+
+	// asin(a) = pi / 2 - 2 * asin(sqrt((1 - a) / 2)), 1 - a is exact
+	const double result = halfPiHigh - (2.0 * AsinReduced(Sqrt((1.0 - magnitude) * 0.5)) - halfPiLow);
+
+	return (val < 0.0) ? -result : result;
+}
+
+constexpr double math::deterministic::Acos(double val) noexcept
+{
+	if (!(val >= -1.0 && val <= 1.0))
+		return std::numeric_limits<double>::quiet_NaN();
+
+	if (val > 0.5)
+		return 2.0 * AsinReduced(Sqrt((1.0 - val) * 0.5));
+
+	if (val < -0.5)
+		return piHigh - (2.0 * AsinReduced(Sqrt((1.0 + val) * 0.5)) - piLow);
+
+	return halfPiHigh - (AsinReduced(val) - halfPiLow);
+}
+
+constexpr double math::deterministic::Atan(double val) noexcept
+{
+	// NaN & signed zero
+	if (val != val || val == 0.0)
+		return val;
+
+	const double magnitude = (val < 0.0) ? -val : val;
+
+	// atan(a) = pi / 2 - atan(1 / a)
+	const double result = (magnitude > 1.0) ? halfPiHigh - (AtanReduced(1.0 / magnitude) - halfPiLow) : AtanReduced(magnitude);
+
+	return (val < 0.0) ? -result : result;
+}
+
+namespace LibMath = math;
@@ -0,0 +1,397 @@
+#pragma once
+
+#include "VariableType.hpp"
+#include "simd/Simd.h"
+#include "vector/Vector2.h"
+#include "vector/Vector3.h"
+#include "vector/Vector4.h"
+#include "vector/Vector3Stream.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/*
+*	------- Expression -------
+*	Opt-in expression templates for element-wise vector arithmetic,
+*	nothing is computed until the expression is evaluated:
+*
+*		using namespace math::expr;
+*		Vector3<float> position = Evaluate(Lazy(a) + Lazy(b) * step - c);
+*		Evaluate(Lazy(positions) + Lazy(velocities) * step, positions);
+*
+*	An operator builds a node when one of its operands already is an
+*	expression, b * step above would otherwise be computed first by the
+*	Vector3 operators (& does not exist for streams).
+*
+*	Operands are vectors (Vector2, Vector3, Vector4), Vector3 streams
+*	& scalars of the same type. Vectors & scalars are captured by
+*	value, streams by view so they must outlive the expression. A
+*	vector or scalar operand of a stream expression applies to every
+*	element of the stream, like Vector3StreamView::Translate.
+*
+*	Evaluating writes each component of the result once, no
+*	temporary vector or stream is built. Stream expressions run in one
+*	pass per lane, float streams with contiguous lanes compute 4
+*	elements per iteration with SSE2. Vector4<float> expressions are
+*	evaluated in one register.
+*
+*	Every component is computed in the same order as the chained
+*	vector operators, results match them bit for bit. The result
+*	stream may be one of the operands, other overlaps are not allowed.
+*
+*	Functions:
+*	- Lazy			DONE
+*	- Evaluate		DONE	(vector & stream result)
+*	- operator+		DONE
+*	- operator-		DONE	(binary & negate)
+*	- operator*		DONE	(component wise)
+*	- operator/		DONE	(component wise)
+*/
+
+namespace math
+{
+	namespace expr
+	{
+		// Marks the nodes of an expression, only they enable the operators below
+		struct Node {};
+
+		template<typename E>
+		concept Expression = std::is_base_of_v<Node, std::remove_cvref_t<E>>;
+
+		template<typename E>
+		concept VectorExpression = Expression<E> && !E::IsStream && E::Components != 0;
+
+		template<typename E>
+		concept StreamExpression = Expression<E> && E::IsStream;
+
+		struct Add
+		{
+			template<typename T>
+			static constexpr T			Apply(T lhs, T rhs) noexcept { return lhs + rhs; }
+		};
+
+		struct Subtract
+		{
+			template<typename T>
+			static constexpr T			Apply(T lhs, T rhs) noexcept { return lhs - rhs; }
+		};
+
+		struct Multiply
+		{
+			template<typename T>
+			static constexpr T			Apply(T lhs, T rhs) noexcept { return lhs * rhs; }
+		};
+
+		struct Divide
+		{
+			template<typename T>
+			static constexpr T			Apply(T lhs, T rhs) noexcept { return lhs / rhs; }
+		};
+
+#if LIBMATH_SIMD_SSE2
+		inline __m128 Apply(Add, __m128 lhs, __m128 rhs) noexcept { return _mm_add_ps(lhs, rhs); }
+		inline __m128 Apply(Subtract, __m128 lhs, __m128 rhs) noexcept { return _mm_sub_ps(lhs, rhs); }
+		inline __m128 Apply(Multiply, __m128 lhs, __m128 rhs) noexcept { return _mm_mul_ps(lhs, rhs); }
+		inline __m128 Apply(Divide, __m128 lhs, __m128 rhs) noexcept { return _mm_div_ps(lhs, rhs); }
+#endif
+
+		/*
+		*	Every node gives:
+		*	- Components	vector size, 0 for a scalar applied to every component
+		*	- IsStream		true when the value changes with the stream index
+		*	- At			component of the element at index
+		*	- Size			stream size, 0 without stream operand
+		*	- IsContiguous	true when every stream operand has contiguous lanes
+		*	- At4			(SSE2, float) component of the 4 elements from index
+		*	- Packed		(SSE2, float, 4 components) the whole vector in one register
+		*/
+
+		template<math::math_type::NumericType T>
+		class Scalar : public Node
+		{
+		public:
+			using ValueType = T;
+
+			static constexpr int		Components = 0;
+			static constexpr bool		IsStream = false;
+
+			constexpr explicit			Scalar(T value) noexcept : m_value(value) {}
+
+			constexpr T					At(size_t, int) const noexcept { return m_value; }
+			constexpr size_t			Size(void) const noexcept { return 0; }
+			constexpr bool				IsContiguous(void) const noexcept { return true; }
+
+#if LIBMATH_SIMD_SSE2
+			__m128						At4(size_t, int) const noexcept { return _mm_set1_ps(m_value); }
+			__m128						Packed(void) const noexcept { return _mm_set1_ps(m_value); }
+#endif
+
+		private:
+			T	m_value;
+		};
+
+		template<math::math_type::NumericType T, int N>
+		class Vector : public Node
+		{
+		public:
+			using ValueType = T;
+
+			static constexpr int		Components = N;
+			static constexpr bool		IsStream = false;
+
+			constexpr explicit			Vector(Vector2<T> const& vec2) noexcept requires (N == 2) : m_values{ vec2[0], vec2[1] } {}
+			constexpr explicit			Vector(Vector3<T> const& vec3) noexcept requires (N == 3) : m_values{ vec3[0], vec3[1], vec3[2] } {}
+			constexpr explicit			Vector(Vector4<T> const& vec4) noexcept requires (N == 4) : m_values{ vec4[0], vec4[1], vec4[2], vec4[3] } {}
+
+			constexpr T					At(size_t, int component) const noexcept { return m_values[component]; }
+			constexpr size_t			Size(void) const noexcept { return 0; }
+			constexpr bool				IsContiguous(void) const noexcept { return true; }
+
+#if LIBMATH_SIMD_SSE2
+			__m128						At4(size_t, int component) const noexcept { return _mm_set1_ps(m_values[component]); }
+			__m128						Packed(void) const noexcept requires (N == 4) { return _mm_loadu_ps(m_values); }
+#endif
+
+		private:
+			T	m_values[N];
+		};
+
+		template<math::math_type::NumericType T>
+		class Stream : public Node
+		{
+		public:
+			using ValueType = T;
+
+			static constexpr int		Components = 3;
+			static constexpr bool		IsStream = true;
+
+			explicit					Stream(Vector3StreamView<T> const& stream) noexcept : m_lanes{ stream.X(), stream.Y(), stream.Z() }, m_size(stream.Size()), m_stride(stream.Stride()) {}
+
+			T							At(size_t index, int component) const noexcept { return m_lanes[component][index * m_stride]; }
+			size_t						Size(void) const noexcept { return m_size; }
+			bool						IsContiguous(void) const noexcept { return m_stride == 1; }
+
+#if LIBMATH_SIMD_SSE2
+			__m128						At4(size_t index, int component) const noexcept { return _mm_loadu_ps(m_lanes[component] + index); }
+#endif
+
+		private:
+			T const*	m_lanes[3];
+			size_t		m_size;
+			size_t		m_stride;
+		};
+
+		template<typename Operation, Expression L, Expression R>
+		class Binary : public Node
+		{
+			static_assert(std::is_same_v<typename L::ValueType, typename R::ValueType>, "Expression operands must have the same type");
+			static_assert(L::Components == 0 || R::Components == 0 || L::Components == R::Components, "Expression operands must have the same size");
+
+		public:
+			using ValueType = typename L::ValueType;
+
+			static constexpr int		Components = (L::Components != 0) ? L::Components : R::Components;
+			static constexpr bool		IsStream = L::IsStream || R::IsStream;
+
+			constexpr					Binary(L const& lhs, R const& rhs) noexcept : m_lhs(lhs), m_rhs(rhs)
+			{
+				_ASSERT(lhs.Size() == 0 || rhs.Size() == 0 || lhs.Size() == rhs.Size());
+			}
+
+			constexpr ValueType			At(size_t index, int component) const noexcept
+			{
+				return Operation::Apply(m_lhs.At(index, component), m_rhs.At(index, component));
+			}
+
+			constexpr size_t			Size(void) const noexcept
+			{
+				return (m_lhs.Size() != 0) ? m_lhs.Size() : m_rhs.Size();
+			}
+
+			constexpr bool				IsContiguous(void) const noexcept
+			{
+				return m_lhs.IsContiguous() && m_rhs.IsContiguous();
+			}
+
+#if LIBMATH_SIMD_SSE2
+			__m128						At4(size_t index, int component) const noexcept
+			{
+				return Apply(Operation(), m_lhs.At4(index, component), m_rhs.At4(index, component));
+			}
+
+			__m128						Packed(void) const noexcept
+			{
+				return Apply(Operation(), m_lhs.Packed(), m_rhs.Packed());
+			}
+#endif
+
+		private:
+			L	m_lhs;
+			R	m_rhs;
+		};
+
+		template<Expression E>
+		class Negate : public Node
+		{
+		public:
+			using ValueType = typename E::ValueType;
+
+			static constexpr int		Components = E::Components;
+			static constexpr bool		IsStream = E::IsStream;
+
+			constexpr explicit			Negate(E const& operand) noexcept : m_operand(operand) {}
+
+			constexpr ValueType			At(size_t index, int component) const noexcept { return -m_operand.At(index, component); }
+			constexpr size_t			Size(void) const noexcept { return m_operand.Size(); }
+			constexpr bool				IsContiguous(void) const noexcept { return m_operand.IsContiguous(); }
+
+#if LIBMATH_SIMD_SSE2
+			// Flips the sign bit like the scalar negation
+			__m128						At4(size_t index, int component) const noexcept { return _mm_xor_ps(m_operand.At4(index, component), _mm_set1_ps(-0.0f)); }
+			__m128						Packed(void) const noexcept { return _mm_xor_ps(m_operand.Packed(), _mm_set1_ps(-0.0f)); }
+#endif
+
+		private:
+			E	m_operand;
+		};
+
+		// Expression wrapping a vector or a stream, the start of every expression
+		template<math::math_type::NumericType T>
+		constexpr Vector<T, 2>			Lazy(Vector2<T> const& vec2) noexcept { return Vector<T, 2>(vec2); }
+
+		template<math::math_type::NumericType T>
+		constexpr Vector<T, 3>			Lazy(Vector3<T> const& vec3) noexcept { return Vector<T, 3>(vec3); }
+
+		template<math::math_type::NumericType T>
+		constexpr Vector<T, 4>			Lazy(Vector4<T> const& vec4) noexcept { return Vector<T, 4>(vec4); }
+
+		template<math::math_type::NumericType T>
+		Stream<T>						Lazy(Vector3StreamView<T> const& stream) noexcept { return Stream<T>(stream); }
+
+		template<Expression E>
+		constexpr E const&				Lazy(E const& expression) noexcept { return expression; }
+
+		template<typename Operand>
+		concept Lazyable = requires(Operand const& operand) { { Lazy(operand) } -> Expression; };
+
+		// Vectors & streams mixed with an expression are wrapped, scalars are given their own node
+		template<typename Operand, typename T>
+		struct OperandNodeType
+		{
+			using Type = std::remove_cvref_t<decltype(Lazy(std::declval<Operand const&>()))>;
+		};
+
+		template<typename Operand, typename T> requires std::is_arithmetic_v<Operand>
+		struct OperandNodeType<Operand, T>
+		{
+			using Type = Scalar<T>;
+		};
+
+		template<typename Operand, typename T>
+		using OperandNode = typename OperandNodeType<Operand, T>::Type;
+
+		template<typename Operand, math::math_type::NumericType T>
+		constexpr OperandNode<Operand, T> MakeNode(Operand const& operand) noexcept
+		{
+			if constexpr (std::is_arithmetic_v<Operand>)
+				return Scalar<T>(static_cast<T>(operand));
+			else
+				return Lazy(operand);
+		}
+
+		template<typename L, typename R>
+		concept Operands = (Expression<L> || Expression<R>) && (Lazyable<L> || std::is_arithmetic_v<L>) && (Lazyable<R> || std::is_arithmetic_v<R>);
+
+		template<typename L, typename R>
+		using OperandType = typename std::conditional_t<Expression<L>, L, R>::ValueType;
+
+		template<typename Operation, typename L, typename R>
+		constexpr auto MakeBinary(L const& lhs, R const& rhs) noexcept
+		{
+			using T = OperandType<L, R>;
+
+			return Binary<Operation, OperandNode<L, T>, OperandNode<R, T>>(MakeNode<L, T>(lhs), MakeNode<R, T>(rhs));
+		}
+
+		template<typename L, typename R> requires Operands<L, R>
+		constexpr auto					operator+(L const& lhs, R const& rhs) noexcept { return MakeBinary<Add>(lhs, rhs); }
+
+		template<typename L, typename R> requires Operands<L, R>
+		constexpr auto					operator-(L const& lhs, R const& rhs) noexcept { return MakeBinary<Subtract>(lhs, rhs); }
+
+		template<typename L, typename R> requires Operands<L, R>
+		constexpr auto					operator*(L const& lhs, R const& rhs) noexcept { return MakeBinary<Multiply>(lhs, rhs); }
+
+		template<typename L, typename R> requires Operands<L, R>
+		constexpr auto					operator/(L const& lhs, R const& rhs) noexcept { return MakeBinary<Divide>(lhs, rhs); }
+
+		template<Expression E>
+		constexpr Negate<E>				operator-(E const& operand) noexcept { return Negate<E>(operand); }
+
+		// Computes a vector expression, each component once
+		template<VectorExpression E>
+		constexpr auto Evaluate(E const& expression) noexcept
+		{
+			using T = typename E::ValueType;
+
+			if constexpr (E::Components == 2)
+			{
+				return Vector2<T>(expression.At(0, 0), expression.At(0, 1));
+			}
+			else if constexpr (E::Components == 3)
+			{
+				return Vector3<T>(expression.At(0, 0), expression.At(0, 1), expression.At(0, 2));
+			}
+			else
+			{
+#if LIBMATH_SIMD_SSE2
+				if constexpr (std::is_same_v<T, float>)
+				{
+					if (!std::is_constant_evaluated())
+						return Vector4<float>(expression.Packed());
+				}
+#endif
+
+				return Vector4<T>(expression.At(0, 0), expression.At(0, 1), expression.At(0, 2), expression.At(0, 3));
+			}
+		}
+
+		// Writes every element of a stream expression to result, one pass per lane
+		template<StreamExpression E>
+		void Evaluate(E const& expression, Vector3StreamView<typename E::ValueType> const& result)
+		{
+			using T = typename E::ValueType;
+
+			static_assert(E::Components == 3, "Stream expressions give Vector3 elements");
+			_ASSERT(expression.Size() == result.Size());
+
+			const size_t size = result.Size();
+			const size_t stride = result.Stride();
+			T* const lanes[3] = { result.X(), result.Y(), result.Z() };
+
+			for (int lane = 0; lane < 3; ++lane)
+			{
+				T* values = lanes[lane];
+				size_t i = 0;
+
+#if LIBMATH_SIMD_SSE2
+				if constexpr (std::is_same_v<T, float>)
+				{
+					if (result.IsContiguous() && expression.IsContiguous())
+					{
+						for (; i + 4 <= size; i += 4)
+							_mm_storeu_ps(values + i, expression.At4(i, lane));
+					}
+				}
+#endif
+
+				// Element i only reads element i of each operand, result may be one of them
+				for (; i < size; ++i)
+					values[i * stride] = expression.At(i, lane);
+			}
+		}
+	}
+}
+
+namespace LibMath = math;
@@ -0,0 +1,589 @@
+#pragma once
+
+#include "VariableType.hpp"
+#include "Arithmetic.h"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/*
+*	------- Fixed<IntBits, FracBits> -------
+*	Signed fixed point number, value = raw / 2^FracBits with the raw
+*	value in an int32_t. IntBits counts the sign bit, IntBits + FracBits
+*	is at most 32 (Fixed<16, 16> covers [-32768, 32768) in steps of
+*	1.5e-5). Every operation is integer arithmetic, results are bit
+*	identical on every CPU & compiler (lockstep simulation, replays).
+*
+*	Overflow (results outside the range)
+*	- Saturate	clamp to the lowest / highest value (default)
+*	- Wrap		keep the low IntBits + FracBits bits, two's complement
+*
+*	Rounding (conversions, products, quotients & functions)
+*	- Nearest	to nearest, ties towards +infinity (default)
+*	- Truncate	towards -infinity, the low bits are dropped
+*
+*	Products & quotients use a 64 bit intermediate, a product is one
+*	multiply & one shift. Division by zero returns the highest value
+*	(lowest for a negative dividend, 0 for 0 / 0), % has the sign of
+*	the dividend like std::fmod & x % 0 is 0.
+*
+*	Sqrt is the integer square root of raw * 2^FracBits, negative
+*	values return 0. Sin, Cos & Tan reduce the angle by pi / 2 in
+*	64 bit & evaluate Taylor polynomials in 2.30 fixed point, Asin,
+*	Acos & Atan reduce the argument to [0, tan(pi / 8)] first. For
+*	FracBits <= 24 the functions are within 0.6 LSB of the exact value
+*	rounding to nearest & within 1 LSB truncating.
+*
+*	Arithmetic types convert implicitly (constants like 0.5f in the
+*	templates are rounded the same way everywhere), the conversions
+*	back are explicit. math_type::NumericType accepts Fixed, the
+*	templates work as Vector3<Fixed<16, 16>>, Matrix4<Fixed<16, 16>>,
+*	Quaternion<Fixed<16, 16>>... with math::Sqrt, math::Sin... calling
+*	the static functions below.
+*
+*	Constructor
+*	- Void				DONE	(0)
+*	- Arithmetic		DONE	(implicit, rounded & overflow handled)
+*
+*	Functions
+*	- FromRaw			DONE
+*	- Raw				DONE
+*	- Sqrt				DONE
+*	- Sin, Cos, Tan		DONE
+*	- Asin, Acos, Atan	DONE
+*
+*	Operators
+*	- Arithmetic		DONE	(explicit)
+*	- Negate			DONE
+*	- Add		(+, +=)	DONE
+*	- Subtract	(-, -=)	DONE
+*	- Multiply	(*, *=)	DONE
+*	- Divide	(/, /=)	DONE
+*	- Modulo	(%, %=)	DONE
+*	- Compare			DONE	(==, !=, <, >, <=, >=)
+*/
+
+namespace math
+{
+	enum class FixedOverflow
+	{
+		Saturate,
+		Wrap
+	};
+
+	enum class FixedRounding
+	{
+		Nearest,
+		Truncate
+	};
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow = FixedOverflow::Saturate, FixedRounding Rounding = FixedRounding::Nearest>
+	class Fixed
+	{
+		static_assert(IntBits >= 1 && IntBits + FracBits <= 32, "Fixed needs a sign bit & at most 32 bits");
+
+	public:
+		static constexpr int32_t	RawMax = static_cast<int32_t>((uint64_t(1) << (IntBits + FracBits - 1)) - 1);
+		static constexpr int32_t	RawMin = -RawMax - 1;
+
+		constexpr					Fixed(void);
+		template<typename U> requires std::is_arithmetic_v<U>
+		constexpr					Fixed(U value) noexcept;
+
+									~Fixed(void) = default;
+
+		static constexpr Fixed		FromRaw(int32_t raw) noexcept;
+		constexpr int32_t			Raw(void) const noexcept;
+
+		static constexpr Fixed		Sqrt(Fixed value) noexcept;
+		static constexpr Fixed		Sin(Fixed rad) noexcept;
+		static constexpr Fixed		Cos(Fixed rad) noexcept;
+		static constexpr Fixed		Tan(Fixed rad) noexcept;
+		static constexpr Fixed		Asin(Fixed value) noexcept;
+		static constexpr Fixed		Acos(Fixed value) noexcept;
+		static constexpr Fixed		Atan(Fixed value) noexcept;
+
+		template<typename U> requires std::is_arithmetic_v<U>
+		constexpr explicit			operator U(void) const noexcept;
+
+		constexpr Fixed				operator-(void) const noexcept;
+		constexpr Fixed&			operator+=(Fixed value) noexcept;
+		constexpr Fixed&			operator-=(Fixed value) noexcept;
+		constexpr Fixed&			operator*=(Fixed value) noexcept;
+		constexpr Fixed&			operator/=(Fixed value) noexcept;
+		constexpr Fixed&			operator%=(Fixed value) noexcept;
+
+		// Non member so an arithmetic value converts on either side (1.0f / fixed)
+		friend constexpr Fixed		operator+(Fixed value1, Fixed value2) noexcept { return value1 += value2; }
+		friend constexpr Fixed		operator-(Fixed value1, Fixed value2) noexcept { return value1 -= value2; }
+		friend constexpr Fixed		operator*(Fixed value1, Fixed value2) noexcept { return value1 *= value2; }
+		friend constexpr Fixed		operator/(Fixed value1, Fixed value2) noexcept { return value1 /= value2; }
+		friend constexpr Fixed		operator%(Fixed value1, Fixed value2) noexcept { return value1 %= value2; }
+		friend constexpr bool		operator<(Fixed value1, Fixed value2) noexcept { return value1.m_raw < value2.m_raw; }
+		friend constexpr bool		operator>(Fixed value1, Fixed value2) noexcept { return value1.m_raw > value2.m_raw; }
+		friend constexpr bool		operator<=(Fixed value1, Fixed value2) noexcept { return value1.m_raw <= value2.m_raw; }
+		friend constexpr bool		operator>=(Fixed value1, Fixed value2) noexcept { return value1.m_raw >= value2.m_raw; }
+
+		constexpr bool				operator==(Fixed const& value) const noexcept;
+		constexpr bool				operator!=(Fixed const& value) const noexcept;
+
+	private:
+		// 2.30 fixed point used by the functions
+		static constexpr int64_t	One30 = int64_t(1) << 30;
+		static constexpr int64_t	HalfPi30 = 1686629713;
+		static constexpr int64_t	QuarterPi30 = 843314857;
+
+		static constexpr int32_t	Normalize(int64_t raw) noexcept;
+		static constexpr int64_t	Shift(int64_t value, unsigned int shift) noexcept;
+		static constexpr int64_t	Divide(int64_t numerator, int64_t denominator) noexcept;
+		static constexpr Fixed		FromFixed30(int64_t value) noexcept;
+		static constexpr int64_t	ToFixed30(int32_t raw) noexcept;
+		static constexpr int64_t	Multiply30(int64_t value1, int64_t value2) noexcept;
+		static constexpr void		SinCos30(int32_t raw, int64_t& sin, int64_t& cos) noexcept;
+		static constexpr int64_t	AtanRatio30(int64_t numerator, int64_t denominator) noexcept;
+
+		int32_t	m_raw;
+	};
+
+	using Fixed16_16 = Fixed<16, 16>;
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding>::Fixed(void)
+		: m_raw(0)
+	{
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	template<typename U> requires std::is_arithmetic_v<U>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding>::Fixed(U value) noexcept
+	{
+		if constexpr (std::is_integral_v<U>)
+		{
+			if constexpr (Overflow == FixedOverflow::Wrap)
+				m_raw = Normalize(static_cast<int64_t>(static_cast<uint64_t>(value) << FracBits));
+			else
+			{
+				// Beyond +-2^IntBits the value saturates anyway, clamping first keeps the shift in range
+				constexpr int64_t limit = int64_t(1) << IntBits;
+
+				int64_t integer = limit;
+
+				if constexpr (std::is_signed_v<U>)
+				{
+					if (value < 0)
+						integer = (static_cast<int64_t>(value) < -limit) ? -limit : static_cast<int64_t>(value);
+					else if (static_cast<uint64_t>(value) < static_cast<uint64_t>(limit))
+						integer = static_cast<int64_t>(value);
+				}
+				else if (static_cast<uint64_t>(value) < static_cast<uint64_t>(limit))
+					integer = static_cast<int64_t>(value);
+
+				m_raw = Normalize(integer * (int64_t(1) << FracBits));
+			}
+		}
+		else
+		{
+			// Scaling by a power of 2 is exact, rounding is done on the integer part & the exact remainder
+			const double scaled = static_cast<double>(value) * static_cast<double>(uint64_t(1) << FracBits);
+
+			if (scaled != scaled)
+			{
+				m_raw = 0;
+				return;
+			}
+
+			constexpr double limit = 4611686018427387904.0;	// 2^62
+			const double clamped = (scaled < -limit) ? -limit : (scaled > limit) ? limit : scaled;
+
+			int64_t integer = static_cast<int64_t>(clamped);
+
+			if (static_cast<double>(integer) > clamped)
+				--integer;
+
+			if constexpr (Rounding == FixedRounding::Nearest)
+			{
+				if (clamped - static_cast<double>(integer) >= 0.5)
+					++integer;
+			}
+
+			m_raw = Normalize(integer);
+		}
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding> Fixed<IntBits, FracBits, Overflow, Rounding>::FromRaw(int32_t raw) noexcept
+	{
+		Fixed result;
+		result.m_raw = Normalize(raw);
+
+		return result;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr int32_t Fixed<IntBits, FracBits, Overflow, Rounding>::Raw(void) const noexcept
+	{
+		return m_raw;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding> Fixed<IntBits, FracBits, Overflow, Rounding>::Sqrt(Fixed value) noexcept
+	{
+		if (value.m_raw <= 0)
+			return Fixed();
+
+		// sqrt(raw / 2^F) * 2^F = sqrt(raw * 2^F), the unsigned Sqrt returns the floor
+		const uint64_t scaled = static_cast<uint64_t>(value.m_raw) << FracBits;
+		uint64_t root = math::Sqrt(scaled);
+
+		// (root + 0.5)^2 = root^2 + root + 0.25, the remainder is an integer so there is no tie
+		if constexpr (Rounding == FixedRounding::Nearest)
+		{
+			if (scaled - root * root > root)
+				++root;
+		}
+
+		return FromRaw(Normalize(static_cast<int64_t>(root)));
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding> Fixed<IntBits, FracBits, Overflow, Rounding>::Sin(Fixed rad) noexcept
+	{
+		int64_t sin = 0;
+		int64_t cos = 0;
+		SinCos30(rad.m_raw, sin, cos);
+
+		return FromFixed30(sin);
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding> Fixed<IntBits, FracBits, Overflow, Rounding>::Cos(Fixed rad) noexcept
+	{
+		int64_t sin = 0;
+		int64_t cos = 0;
+		SinCos30(rad.m_raw, sin, cos);
+
+		return FromFixed30(cos);
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding> Fixed<IntBits, FracBits, Overflow, Rounding>::Tan(Fixed rad) noexcept
+	{
+		int64_t sin = 0;
+		int64_t cos = 0;
+		SinCos30(rad.m_raw, sin, cos);
+
+		if (cos == 0)
+			return FromRaw((sin > 0) ? RawMax : RawMin);
+
+		return FromFixed30(Divide(sin * One30, cos));
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding> Fixed<IntBits, FracBits, Overflow, Rounding>::Asin(Fixed value) noexcept
+	{
+		const int64_t x = ToFixed30(value.m_raw);
+		const int64_t magnitude = (x < 0) ? -x : x;
+
+		if (magnitude >= One30)
+			return FromFixed30((x < 0) ? -HalfPi30 : HalfPi30);
+
+		// asin(x) = atan(x / sqrt(1 - x^2))
+		const int64_t cos = static_cast<int64_t>(math::Sqrt(static_cast<uint64_t>(One30 - Multiply30(magnitude, magnitude)) << 30));
+		const int64_t angle = AtanRatio30(magnitude, cos);
+
+		return FromFixed30((x < 0) ? -angle : angle);
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding> Fixed<IntBits, FracBits, Overflow, Rounding>::Acos(Fixed value) noexcept
+	{
+		const int64_t x = ToFixed30(value.m_raw);
+		const int64_t magnitude = (x < 0) ? -x : x;
+
+		int64_t angle = HalfPi30;
+
+		if (magnitude < One30)
+		{
+			const int64_t sin = static_cast<int64_t>(math::Sqrt(static_cast<uint64_t>(One30 - Multiply30(magnitude, magnitude)) << 30));
+
+			angle = AtanRatio30(magnitude, sin);
+		}
+
+		// acos(x) = pi / 2 - asin(x)
+		return FromFixed30((x < 0) ? HalfPi30 + angle : HalfPi30 - angle);
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding> Fixed<IntBits, FracBits, Overflow, Rounding>::Atan(Fixed value) noexcept
+	{
+		const int64_t magnitude = (value.m_raw < 0) ? -static_cast<int64_t>(value.m_raw) : value.m_raw;
+		const int64_t angle = AtanRatio30(magnitude, int64_t(1) << FracBits);
+
+		return FromFixed30((value.m_raw < 0) ? -angle : angle);
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	template<typename U> requires std::is_arithmetic_v<U>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding>::operator U(void) const noexcept
+	{
+		if constexpr (std::is_floating_point_v<U>)
+			return static_cast<U>(static_cast<double>(m_raw) / static_cast<double>(uint64_t(1) << FracBits));
+		else if constexpr (std::is_same_v<U, bool>)
+			return m_raw != 0;
+		else
+		{
+			// Towards 0 like a float to integer conversion
+			const int64_t magnitude = ((m_raw < 0) ? -static_cast<int64_t>(m_raw) : m_raw) >> FracBits;
+
+			return static_cast<U>((m_raw < 0) ? -magnitude : magnitude);
+		}
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding> Fixed<IntBits, FracBits, Overflow, Rounding>::operator-(void) const noexcept
+	{
+		return FromRaw(Normalize(-static_cast<int64_t>(m_raw)));
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding>& Fixed<IntBits, FracBits, Overflow, Rounding>::operator+=(Fixed value) noexcept
+	{
+		m_raw = Normalize(static_cast<int64_t>(m_raw) + value.m_raw);
+
+		return *this;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding>& Fixed<IntBits, FracBits, Overflow, Rounding>::operator-=(Fixed value) noexcept
+	{
+		m_raw = Normalize(static_cast<int64_t>(m_raw) - value.m_raw);
+
+		return *this;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding>& Fixed<IntBits, FracBits, Overflow, Rounding>::operator*=(Fixed value) noexcept
+	{
+		m_raw = Normalize(Shift(static_cast<int64_t>(m_raw) * value.m_raw, FracBits));
+
+		return *this;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding>& Fixed<IntBits, FracBits, Overflow, Rounding>::operator/=(Fixed value) noexcept
+	{
+		if (value.m_raw == 0)
+			m_raw = (m_raw > 0) ? RawMax : (m_raw < 0) ? RawMin : 0;
+		else
+			m_raw = Normalize(Divide(static_cast<int64_t>(m_raw) * (int64_t(1) << FracBits), value.m_raw));
+
+		return *this;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding>& Fixed<IntBits, FracBits, Overflow, Rounding>::operator%=(Fixed value) noexcept
+	{
+		// int64_t so RawMin % -1 does not overflow
+		m_raw = (value.m_raw == 0) ? 0 : static_cast<int32_t>(static_cast<int64_t>(m_raw) % value.m_raw);
+
+		return *this;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr bool Fixed<IntBits, FracBits, Overflow, Rounding>::operator==(Fixed const& value) const noexcept
+	{
+		return m_raw == value.m_raw;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr bool Fixed<IntBits, FracBits, Overflow, Rounding>::operator!=(Fixed const& value) const noexcept
+	{
+		return m_raw != value.m_raw;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr int32_t Fixed<IntBits, FracBits, Overflow, Rounding>::Normalize(int64_t raw) noexcept
+	{
+		if constexpr (Overflow == FixedOverflow::Saturate)
+			return static_cast<int32_t>((raw < RawMin) ? RawMin : (raw > RawMax) ? RawMax : raw);
+		else
+		{
+			// Sign extend the low IntBits + FracBits bits
+			constexpr unsigned int unused = 64 - (IntBits + FracBits);
+
+			return static_cast<int32_t>(static_cast<int64_t>(static_cast<uint64_t>(raw) << unused) >> unused);
+		}
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr int64_t Fixed<IntBits, FracBits, Overflow, Rounding>::Shift(int64_t value, unsigned int shift) noexcept
+	{
+		if (shift == 0)
+			return value;
+
+		// Arithmetic shift rounds towards -infinity, adding half first rounds to nearest
+		if constexpr (Rounding == FixedRounding::Nearest)
+			value += int64_t(1) << (shift - 1);
+
+		return value >> shift;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr int64_t Fixed<IntBits, FracBits, Overflow, Rounding>::Divide(int64_t numerator, int64_t denominator) noexcept
+	{
+		int64_t quotient = numerator / denominator;
+		int64_t remainder = numerator % denominator;
+
+		// Floor division, the remainder then has the sign of the denominator
+		if (remainder != 0 && ((remainder < 0) != (denominator < 0)))
+		{
+			--quotient;
+			remainder += denominator;
+		}
+
+		if constexpr (Rounding == FixedRounding::Nearest)
+		{
+			// remainder / denominator is in [0, 1), round up from one half
+			if ((denominator > 0) ? (2 * remainder >= denominator) : (2 * remainder <= denominator))
+				++quotient;
+		}
+
+		return quotient;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr Fixed<IntBits, FracBits, Overflow, Rounding> Fixed<IntBits, FracBits, Overflow, Rounding>::FromFixed30(int64_t value) noexcept
+	{
+		if constexpr (FracBits > 30)
+			return FromRaw(Normalize(value * (int64_t(1) << (FracBits - 30))));
+		else
+			return FromRaw(Normalize(Shift(value, 30 - FracBits)));
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr int64_t Fixed<IntBits, FracBits, Overflow, Rounding>::ToFixed30(int32_t raw) noexcept
+	{
+		if constexpr (FracBits > 30)
+			return Shift(raw, FracBits - 30);
+		else
+			return static_cast<int64_t>(raw) * (int64_t(1) << (30 - FracBits));
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr int64_t Fixed<IntBits, FracBits, Overflow, Rounding>::Multiply30(int64_t value1, int64_t value2) noexcept
+	{
+		// Always rounded to nearest, the rounding mode applies to the final result only
+		return (value1 * value2 + (int64_t(1) << 29)) >> 30;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr void Fixed<IntBits, FracBits, Overflow, Rounding>::SinCos30(int32_t raw, int64_t& sin, int64_t& cos) noexcept
+	{
+		// Nearest quadrant from 2 / pi in 0.32, raw * 2 / pi stays below 2^63
+		constexpr int64_t twoOverPi32 = 2734261102;
+		const int64_t quadrant = ((static_cast<int64_t>(raw) * twoOverPi32 >> (31 + FracBits)) + 1) >> 1;
+
+		// r = x - quadrant * pi / 2 with FracBits + 30 fractional bits, pi / 2 rounded from 2.61
+		constexpr int64_t halfPi61 = 3622009729038561421;
+		constexpr int64_t halfPi = (halfPi61 + (int64_t(1) << 30 >> FracBits)) >> (31 - FracBits);
+
+		const int64_t reduced = static_cast<int64_t>(raw) * One30 - quadrant * halfPi;
+		const int64_t r = (reduced + (int64_t(1) << FracBits >> 1)) >> FracBits;
+		const int64_t z = Multiply30(r, r);
+
+		// Taylor series in r^2 for |r| <= pi / 4, the first omitted terms are below 2^-30
+		constexpr int64_t sinTerms[5] = { -178956971, 8947849, -213044, 2959, -27 };
+		constexpr int64_t cosTerms[6] = { -536870912, 44739243, -1491308, 26631, -296, 2 };
+
+		int64_t sinPolynomial = sinTerms[4];
+		int64_t cosPolynomial = cosTerms[5];
+
+		for (int i = 3; i >= 0; --i)
+			sinPolynomial = sinTerms[i] + Multiply30(z, sinPolynomial);
+
+		for (int i = 4; i >= 0; --i)
+			cosPolynomial = cosTerms[i] + Multiply30(z, cosPolynomial);
+
+		const int64_t sinR = r + Multiply30(Multiply30(r, z), sinPolynomial);
+		const int64_t cosR = One30 + Multiply30(z, cosPolynomial);
+
+		// Odd quadrants swap sin & cos, quadrants 2 & 3 negate sin, 1 & 2 negate cos
+		sin = (quadrant & 1) ? cosR : sinR;
+		cos = (quadrant & 1) ? sinR : cosR;
+
+		if (quadrant & 2)
+			sin = -sin;
+
+		if ((quadrant + 1) & 2)
+			cos = -cos;
+	}
+
+	template<unsigned int IntBits, unsigned int FracBits, FixedOverflow Overflow, FixedRounding Rounding>
+	inline constexpr int64_t Fixed<IntBits, FracBits, Overflow, Rounding>::AtanRatio30(int64_t numerator, int64_t denominator) noexcept
+	{
+		// atan(n / d) for n, d >= 0 in [0, pi / 2], above 1 atan(n / d) = pi / 2 - atan(d / n)
+		if (numerator > denominator)
+			return HalfPi30 - AtanRatio30(denominator, numerator);
+
+		if (numerator == 0)
+			return 0;
+
+		int64_t t = (numerator * One30 + denominator / 2) / denominator;
+		int64_t offset = 0;
+
+		// Above tan(pi / 8), atan(t) = pi / 4 + atan((t - 1) / (t + 1)) with |(t - 1) / (t + 1)| <= tan(pi / 8)
+		if (t > 444758426)
+		{
+			t = -(((One30 - t) * One30 + (t + One30) / 2) / (t + One30));
+			offset = QuarterPi30;
+		}
+
+		// t - t^3 / 3 + t^5 / 5 ..., the first omitted term is below 2^-30 for |t| <= tan(pi / 8)
+		constexpr int64_t terms[10] = { -357913941, 214748365, -153391689, 119304647, -97612893, 82595525, -71582788, 63161284, -56512728, 51130563 };
+
+		const int64_t z = Multiply30(t, t);
+
+		int64_t polynomial = terms[9];
+
+		for (int i = 8; i >= 0; --i)
+			polynomial = terms[i] + Multiply30(z, polynomial);
+
+		return offset + t + Multiply30(Multiply30(t, z), polynomial);
+	}
+}
+
+namespace std
+{
+	// Fixed is exact & has no infinity or NaN, epsilon is one step
+	template<unsigned int IntBits, unsigned int FracBits, math::FixedOverflow Overflow, math::FixedRounding Rounding>
+	class numeric_limits<math::Fixed<IntBits, FracBits, Overflow, Rounding>>
+	{
+		using Type = math::Fixed<IntBits, FracBits, Overflow, Rounding>;
+
+	public:
+		static constexpr bool	is_specialized = true;
+		static constexpr bool	is_signed = true;
+		static constexpr bool	is_integer = false;
+		static constexpr bool	is_exact = true;
+		static constexpr bool	has_infinity = false;
+		static constexpr bool	has_quiet_NaN = false;
+		static constexpr bool	has_signaling_NaN = false;
+		static constexpr bool	is_bounded = true;
+		static constexpr bool	is_modulo = Overflow == math::FixedOverflow::Wrap;
+		static constexpr int	digits = static_cast<int>(IntBits + FracBits) - 1;
+		static constexpr int	radix = 2;
+
+		static constexpr Type	min(void) noexcept { return Type::FromRaw(Type::RawMin); }
+		static constexpr Type	lowest(void) noexcept { return Type::FromRaw(Type::RawMin); }
+		static constexpr Type	max(void) noexcept { return Type::FromRaw(Type::RawMax); }
+		static constexpr Type	epsilon(void) noexcept { return Type::FromRaw(1); }
+		static constexpr Type	round_error(void) noexcept { return Type(0.5f); }
+		static constexpr Type	infinity(void) noexcept { return Type(); }
+		static constexpr Type	quiet_NaN(void) noexcept { return Type(); }
+		static constexpr Type	signaling_NaN(void) noexcept { return Type(); }
+		static constexpr Type	denorm_min(void) noexcept { return Type::FromRaw(1); }
+	};
+}
+
+namespace LibMath = math;
@@ -0,0 +1,10 @@
+#pragma once
+
+#include "geometry/AABB.h"
+#include "geometry/Sphere.h"
+#include "geometry/Plane.h"
+#include "geometry/Triangle.h"
+#include "geometry/Ray.h"
+#include "geometry/Frustum.h"
+#include "geometry/BVH.h"
+#include "geometry/SweepAndPrune.h"
\ No newline at end of file
@@ -1,3 +1,5 @@
 #include "matrix/Matrix2.h"
 #include "matrix/Matrix3.h"
-#include "matrix/Matrix4.h"
\ No newline at end of file
+#include "matrix/Matrix4.h"
+#include "matrix/AffineMatrix4.h"
+#include "matrix/MatrixRxC.h"
\ No newline at end of file
@@ -1,24 +1,133 @@
 #pragma once
 
 #include "VariableType.hpp"
+#include "Parallel.h"
+#include "simd/Simd.h"
+#include "vector/Vector3.h"
 #include "vector/Vector4.h"
 #include "matrix/Matrix4.h"
 
+#include <span>
+#include <type_traits>
+
+/*
+*	------- Matrix4 x Vector -------
+*	Matrices are column major, a vector is transformed as
+*	column 0 * x + column 1 * y + column 2 * z + column 3 * w
+*
+*	Batch functions write to a result span at least as large as
+*	the input, the result may be the input span. Float batches use
+*	the SIMD kernels & large batches are split across threads.
+*
+*	- Multiply				DONE
+*	- TransformPoints		DONE	(w = 1, no perspective divide)
+*	- TransformDirections	DONE	(w = 0)
+*/
+
 namespace math
 {
 	template<math::math_type::NumericType T>
-	Vector4<T> operator*(Matrix4<T> const& mat4, Vector4<T> const& vec4)
+	inline constexpr Vector4<T> operator*(Matrix4<T> const& mat4, Vector4<T> const& vec4)
 	{
 		LibMath::Vector4<T> result;
 
-		// Multiply & add x,y,z,w element of vector with corresponding matrix row
-		for (int i = 0; i < 3; ++i)
+		// Multiply & add each matrix column with the corresponding x,y,z,w element of vector
+		for (int i = 0; i < 4; ++i)
 		{
-			result[i] = mat4.m_matrix[i][0] * vec4[0] + mat4.m_matrix[i][1] * vec4[1] + mat4.m_matrix[i][2] * vec4[2] + mat4.m_matrix[i][3] * vec4[3];
+			result[i] = mat4.m_matrix[0][i] * vec4[0] + mat4.m_matrix[1][i] * vec4[1] + mat4.m_matrix[2][i] * vec4[2] + mat4.m_matrix[3][i] * vec4[3];
 		}
 
 		return result;
 	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformVectors(Matrix4<T> const& mat4, Vector3<T> const* vectors, Vector3<T>* result, size_t count, T w)
+	{
+#if LIBMATH_SIMD_SSE2
+		if constexpr (std::is_same_v<T, float>)
+		{
+			static_assert(sizeof(Vector3<float>) == 3 * sizeof(float));
+
+			simd::Matrix4TransformVector3(reinterpret_cast<float*>(result), reinterpret_cast<float const*>(vectors), count, &mat4.m_matrix[0][0], w);
+			return;
+		}
+#endif
+
+		for (size_t n = 0; n < count; ++n)
+		{
+			const Vector3<T> vec3 = vectors[n];
+
+			for (int i = 0; i < 3; ++i)
+				result[n][i] = mat4.m_matrix[0][i] * vec3[0] + mat4.m_matrix[1][i] * vec3[1] + mat4.m_matrix[2][i] * vec3[2] + mat4.m_matrix[3][i] * w;
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformVectors(Matrix4<T> const& mat4, Vector4<T> const* vectors, Vector4<T>* result, size_t count)
+	{
+#if LIBMATH_SIMD_SSE2
+		if constexpr (std::is_same_v<T, float>)
+		{
+			static_assert(sizeof(Vector4<float>) == 4 * sizeof(float));
+
+			simd::Matrix4TransformVector4(reinterpret_cast<float*>(result), reinterpret_cast<float const*>(vectors), count, &mat4.m_matrix[0][0]);
+			return;
+		}
+#endif
+
+		for (size_t n = 0; n < count; ++n)
+			result[n] = mat4 * vectors[n];
+	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformPoints(Matrix4<T> const& mat4, std::type_identity_t<std::span<Vector3<T> const>> points, std::type_identity_t<std::span<Vector3<T>>> result)
+	{
+		_ASSERT(result.size() >= points.size());
+
+		ParallelFor(points.size(), [&](size_t begin, size_t end)
+		{
+			TransformVectors(mat4, points.data() + begin, result.data() + begin, end - begin, static_cast<T>(1));
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformPoints(Matrix4<T> const& mat4, std::type_identity_t<std::span<Vector4<T> const>> points, std::type_identity_t<std::span<Vector4<T>>> result)
+	{
+		_ASSERT(result.size() >= points.size());
+
+		ParallelFor(points.size(), [&](size_t begin, size_t end)
+		{
+			TransformVectors(mat4, points.data() + begin, result.data() + begin, end - begin);
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformDirections(Matrix4<T> const& mat4, std::type_identity_t<std::span<Vector3<T> const>> directions, std::type_identity_t<std::span<Vector3<T>>> result)
+	{
+		_ASSERT(result.size() >= directions.size());
+
+		ParallelFor(directions.size(), [&](size_t begin, size_t end)
+		{
+			TransformVectors(mat4, directions.data() + begin, result.data() + begin, end - begin, static_cast<T>(0));
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformDirections(Matrix4<T> const& mat4, std::type_identity_t<std::span<Vector4<T> const>> directions, std::type_identity_t<std::span<Vector4<T>>> result)
+	{
+		_ASSERT(result.size() >= directions.size());
+
+		// Drop the translation column, w is treated as 0
+		Matrix4<T> linear(mat4);
+
+		for (int i = 0; i < 4; ++i)
+			linear.m_matrix[3][i] = static_cast<T>(0);
+
+		ParallelFor(directions.size(), [&](size_t begin, size_t end)
+		{
+			TransformVectors(linear, directions.data() + begin, result.data() + begin, end - begin);
+		});
+	}
 }
 
-namespace LibMath = math;
\ No newline at end of file
+namespace LibMath = math;
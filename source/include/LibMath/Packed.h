@@ -0,0 +1,6 @@
+#pragma once
+
+#include "packed/Half.h"
+#include "packed/Snorm16.h"
+#include "packed/Octahedral.h"
+#include "packed/PackedQuaternion.h"
\ No newline at end of file
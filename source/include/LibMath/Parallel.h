@@ -0,0 +1,74 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+/*
+*	------- Parallel -------
+*	ParallelFor splits [0, count) into contiguous ranges & runs
+*	function(begin, end) for each range, one range per hardware thread.
+*	Ranges run on a pool of worker threads started on first use & kept
+*	for the lifetime of the program, the calling thread takes ranges too.
+*
+*	Ranges smaller than minBatchSize are not worth a thread, small
+*	counts run on the calling thread only.
+*
+*	SetParallelThreadCount caps the threads ParallelFor uses (0 is
+*	every hardware thread), e.g. to leave cores to a job system.
+*/
+
+#define PARALLEL_MIN_BATCH_SIZE 65536
+
+namespace math
+{
+	namespace parallel
+	{
+		inline std::atomic<size_t> g_threadCount = 0;
+
+		using RangeFunction = void (*)(void* function, size_t begin, size_t end);
+
+		// Runs the rangeCount ranges of batchSize elements on the pool & the calling thread, returns once all are done
+		void Run(RangeFunction rangeFunction, void* function, size_t count, size_t batchSize, size_t rangeCount);
+	}
+
+	inline void SetParallelThreadCount(size_t threadCount) noexcept
+	{
+		parallel::g_threadCount.store(threadCount, std::memory_order_relaxed);
+	}
+
+	inline size_t ParallelThreadCount(void) noexcept
+	{
+		const size_t threadCount = parallel::g_threadCount.load(std::memory_order_relaxed);
+
+		return (threadCount != 0) ? threadCount : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+	}
+
+	template<typename Function>
+	inline void ParallelFor(size_t count, Function&& function, size_t minBatchSize = PARALLEL_MIN_BATCH_SIZE)
+	{
+		size_t threadCount = std::min(ParallelThreadCount(), count / std::max<size_t>(minBatchSize, 1));
+
+		if (threadCount <= 1)
+		{
+			function(static_cast<size_t>(0), count);
+			return;
+		}
+
+		// Rounding the batch size up can leave fewer non empty ranges than threads, e.g. 9 elements on 8 threads are 5 ranges of 2
+		const size_t batchSize = (count + threadCount - 1) / threadCount;
+		threadCount = (count + batchSize - 1) / batchSize;
+
+		using FunctionType = std::remove_reference_t<Function>;
+
+		parallel::Run([](void* function, size_t begin, size_t end)
+		{
+			(*static_cast<FunctionType*>(function))(begin, end);
+		}, const_cast<void*>(static_cast<void const*>(std::addressof(function))), count, batchSize, threadCount);
+	}
+}
+
+namespace LibMath = math;
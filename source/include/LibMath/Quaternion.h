@@ -2,8 +2,14 @@
 
 #include "VariableType.hpp"
 #include "Arithmetic.h"
+#include "Parallel.h"
+#include "Trigonometry.h"
+#include "matrix/Matrix3.h"
 #include "vector/Vector3.h"
 
+#include <limits>
+#include <span>
+
 /*
 *	-------- Quaternion --------
 *	Order:
@@ -25,6 +31,12 @@
 *	- Dot					DONE
 *	- Normalize				DONE
 *	- Inverse				DONE
+*	- RotateVector			DONE	(unit quaternion, span batch)
+*	- Nlerp					DONE
+*	- Slerp					DONE	(Fast: corrected nlerp)
+*	- FromBasis				DONE	(quaternion namespace, Shepperd's method)
+*	- FromMatrix3/4			DONE	(scaled columns, span batch)
+*	- FromEuler, ToEuler	DONE	(12 orders, Radian & Degree, span batch)
 *
 *	Operators
 *	- Add		(+, +=)		DONE
@@ -39,97 +51,246 @@ namespace math
 	template <math::math_type::NumericType T>
 	class Vector3;
 
+	template <math::math_type::NumericType T>
+	class Matrix4;
+
+	// Axes in the order the rotations are applied around the fixed (world) axes: XYZ turns around x, then y & z, so
+	// q = qz * qy * qx. Turning around the rotated (local) axes x, y then z is ZYX with the angles (z, y, x)
+	enum class EulerOrder
+	{
+		XYZ,
+		XZY,
+		YXZ,
+		YZX,
+		ZXY,
+		ZYX,
+		XYX,
+		XZX,
+		YXY,
+		YZY,
+		ZXZ,
+		ZYZ
+	};
+
 	template <math::math_type::NumericType T>
 	class Quaternion
 	{
 	public:
-								Quaternion(void);
-								Quaternion(T value);
-								Quaternion(T w, T x, T y, T z);
-								Quaternion(T w, Vector3<T> const& imaginary);
-
-								~Quaternion(void) = default;
-
-		static Quaternion<T>	AngleAxis(T angleRad, math::Vector3<T> axis);
-
-		bool					IsPure(void) const;
-		bool					IsUnit(void) const;
-		Quaternion<T>&			Conjugate(void);
-		Quaternion<T>			Rotate(T angle, Vector3<T> const& axis) const;
-		T						Magnitude(void) const;
-		T						Dot(void) const;
-		T						Dot(Quaternion<T> const& quat) const;
-		Quaternion<T>&			Normalize(void);
-		Quaternion<T>			Inverse(void) const;
-
-		Quaternion<T>			operator+(Quaternion<T> const& quat) const;
-		Quaternion<T>			operator-(Quaternion<T> const& quat) const;
-		Quaternion<T>			operator*(Quaternion<T> const& quat) const;
-		Quaternion<T>			operator/(Quaternion<T> const& quat) const;
-		Quaternion<T>			operator*(T value) const;
-		Quaternion<T>			operator/(T value) const;
-		Quaternion<T>&			operator+=(Quaternion<T> const& quat);
-		Quaternion<T>&			operator-=(Quaternion<T> const& quat);
-		Quaternion<T>&			operator*=(Quaternion<T> const& quat);
-		Quaternion<T>&			operator*=(T value);
-		Quaternion<T>&			operator/=(T value);
-		bool					operator==(Quaternion<T> const& quat) const;
-		bool					operator!=(Quaternion<T> const& quat) const;
-		T						operator[](unsigned int index) const;
-		T&						operator[](unsigned int index);
+		constexpr						Quaternion(void);
+		constexpr						Quaternion(T value);
+		constexpr						Quaternion(T w, T x, T y, T z);
+		constexpr						Quaternion(T w, Vector3<T> const& imaginary);
+
+										~Quaternion(void) = default;
+
+		static constexpr Quaternion<T>	AngleAxis(T angleRad, math::Vector3<T> axis, Precision precision = Precision::Exact);
+		static constexpr Quaternion<T>	FromMatrix3(Matrix3<T> const& matrix);
+		static constexpr Quaternion<T>	FromMatrix4(Matrix4<T> const& matrix);
+		static constexpr Quaternion<T>	FromEuler(Radian<T> const& first, Radian<T> const& second, Radian<T> const& third, EulerOrder order = EulerOrder::XYZ, Precision precision = Precision::Exact);
+		static constexpr Quaternion<T>	FromEuler(Degree<T> const& first, Degree<T> const& second, Degree<T> const& third, EulerOrder order = EulerOrder::XYZ, Precision precision = Precision::Exact);
+		static void						FromMatrix3(std::span<Matrix3<T> const> matrices, std::span<Quaternion<T>> result);
+		static void						FromMatrix4(std::span<Matrix4<T> const> matrices, std::span<Quaternion<T>> result);
+		static void						FromEuler(std::span<Vector3<T> const> angles, std::span<Quaternion<T>> result, EulerOrder order = EulerOrder::XYZ, Precision precision = Precision::Exact);
+		static void						ToEuler(std::span<Quaternion<T> const> quaternions, std::span<Vector3<T>> angles, EulerOrder order = EulerOrder::XYZ);
+
+		constexpr bool					IsPure(void) const;
+		constexpr bool					IsUnit(void) const;
+		constexpr Quaternion<T>&		Conjugate(void);
+		constexpr Quaternion<T>			Rotate(T angle, Vector3<T> const& axis, Precision precision = Precision::Exact) const;
+		constexpr T						Magnitude(Precision precision = Precision::Exact) const;
+		constexpr T						Dot(void) const;
+		constexpr T						Dot(Quaternion<T> const& quat) const;
+		constexpr Quaternion<T>&		Normalize(Precision precision = Precision::Exact);
+		constexpr Quaternion<T>			Inverse(void) const;
+		constexpr Vector3<T>			RotateVector(Vector3<T> const& vec3) const;
+		void							RotateVector(std::span<Vector3<T> const> vectors, std::span<Vector3<T>> result) const;
+		constexpr void					ToEuler(Radian<T>& first, Radian<T>& second, Radian<T>& third, EulerOrder order = EulerOrder::XYZ) const;
+		constexpr void					ToEuler(Degree<T>& first, Degree<T>& second, Degree<T>& third, EulerOrder order = EulerOrder::XYZ) const;
+
+		constexpr Quaternion<T>			operator+(Quaternion<T> const& quat) const noexcept;
+		constexpr Quaternion<T>			operator-(Quaternion<T> const& quat) const noexcept;
+		constexpr Quaternion<T>			operator*(Quaternion<T> const& quat) const noexcept;
+		constexpr Quaternion<T>			operator/(Quaternion<T> const& quat) const noexcept;
+		constexpr Quaternion<T>			operator*(T value) const noexcept;
+		constexpr Quaternion<T>			operator/(T value) const noexcept;
+		constexpr Quaternion<T>&		operator+=(Quaternion<T> const& quat) noexcept;
+		constexpr Quaternion<T>&		operator-=(Quaternion<T> const& quat) noexcept;
+		constexpr Quaternion<T>&		operator*=(Quaternion<T> const& quat) noexcept;
+		constexpr Quaternion<T>&		operator*=(T value) noexcept;
+		constexpr Quaternion<T>&		operator/=(T value) noexcept;
+		constexpr bool					operator==(Quaternion<T> const& quat) const noexcept;
+		constexpr bool					operator!=(Quaternion<T> const& quat) const noexcept;
+		constexpr T						operator[](unsigned int index) const;
+		constexpr T&					operator[](unsigned int index);
 
 	private:
 		Vector3<T>				m_imaginary;
 		T						m_w;
 	};
 
+	// Shortest path (q & -q are the same rotation, the target is negated when the dot product is negative), normalised.
+	// Batch versions over QuaternionStream are in QuaternionStream.h
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T>		Nlerp(Quaternion<T> const& from, Quaternion<T> const& to, T t, Precision precision = Precision::Exact);
+
+	// Exact & Medium: acos & sin, nlerp when the quaternions are parallel. Fast: nlerp with t corrected by a polynomial in the
+	// dot product ("Approximating slerp", A. Kapoulkine), within 1e-3 radians of the exact rotation & normalised
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T>		Slerp(Quaternion<T> const& from, Quaternion<T> const& to, T t, Precision precision = Precision::Exact);
+
+	namespace quaternion
+	{
+		// Fast slerp, nlerp weight giving the slerp angle at t for |dot(from, to)| = cosTheta
+		template<math::math_type::NumericType T>
+		inline constexpr T SlerpFastWeight(T t, T cosTheta) noexcept
+		{
+			const T a = static_cast<T>(1.0904) + cosTheta * (static_cast<T>(-3.2452) + cosTheta * (static_cast<T>(3.55645) - cosTheta * static_cast<T>(1.43519)));
+			const T b = static_cast<T>(0.848013) + cosTheta * (static_cast<T>(-1.06021) + cosTheta * static_cast<T>(0.215638));
+			const T k = a * (t - static_cast<T>(0.5)) * (t - static_cast<T>(0.5)) + b;
+
+			return t + t * (t - static_cast<T>(0.5)) * (t - static_cast<T>(1)) * k;
+		}
+
+		// Rotation of an orthonormal basis (the columns of a rotation matrix), see FromBasis below
+		template<math::math_type::NumericType T>
+		inline constexpr Quaternion<T> FromBasis(Vector3<T> const& column0, Vector3<T> const& column1, Vector3<T> const& column2);
+
+		// Rotation of 3 scaled columns, the steps of Matrix4::Decompose
+		template<math::math_type::NumericType T>
+		inline constexpr Quaternion<T> FromScaledBasis(Vector3<T> const& column0, Vector3<T> const& column1, Vector3<T> const& column2);
+
+		// Columns divided by their lengths, a mirror negates the first column & a zero scale gives the identity: the rotation
+		// of Matrix4::Decompose. FromMatrix4 & Quaternion::FromMatrix4 are defined in Matrix4.h, which includes this header
+		template<math::math_type::NumericType T>
+		inline constexpr Quaternion<T> FromMatrix3(Matrix3<T> const& matrix);
+
+		// SSE2 kernel for float, the same bits as the single matrix version
+		template<math::math_type::NumericType T>
+		inline void FromMatrix3(std::span<Matrix3<T> const> matrices, std::span<Quaternion<T>> result);
+
+		// Axes of an order (0 = x), k is the axis a proper Euler order does not use. odd: (i, j, k) is an odd permutation
+		struct EulerAxes
+		{
+			unsigned int	i;
+			unsigned int	j;
+			unsigned int	k;
+			bool			proper;
+			bool			odd;
+		};
+
+		inline constexpr EulerAxes GetEulerAxes(EulerOrder order) noexcept;
+
+		// Sines & cosines of the 3 half angles to the rotation, q3 * q2 * q1
+		template<math::math_type::NumericType T>
+		inline constexpr Quaternion<T> FromEulerHalfAngles(T const* sin, T const* cos, EulerOrder order) noexcept;
+
+		template<math::math_type::NumericType T>
+		inline constexpr Quaternion<T> FromEuler(T first, T second, T third, EulerOrder order, Precision precision);
+
+		// First & third angles in [-pi, pi], the second in [-pi / 2, pi / 2] for Tait-Bryan orders & [0, pi] for proper Euler
+		// orders (XYX...). Within sqrt(epsilon) of gimbal lock the third angle is 0. Atan2 only method of "Quaternion to Euler
+		// angles conversion: A direct, general and computationally efficient method" (E. Bernardes, S. Viollet)
+		template<math::math_type::NumericType T>
+		inline constexpr void ToEuler(Quaternion<T> const& quat, T& first, T& second, T& third, EulerOrder order);
+
+		// Radians stored as (first, second, third), the half angles go through the batch SinCos
+		template<math::math_type::NumericType T>
+		inline void FromEuler(std::span<Vector3<T> const> angles, std::span<Quaternion<T>> result, EulerOrder order, Precision precision);
+
+		template<math::math_type::NumericType T>
+		inline void ToEuler(std::span<Quaternion<T> const> quaternions, std::span<Vector3<T>> angles, EulerOrder order);
+	}
+
 	template<math::math_type::NumericType T>
-	inline math::Quaternion<T>::Quaternion(void)
+	inline constexpr math::Quaternion<T>::Quaternion(void)
 		: m_imaginary((T) 0), m_w((T) 0)
 	{
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T>::Quaternion(T value)
+	inline constexpr Quaternion<T>::Quaternion(T value)
 		: m_imaginary(value), m_w(value)
 	{
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T>::Quaternion(T w,T x, T y, T z)
+	inline constexpr Quaternion<T>::Quaternion(T w,T x, T y, T z)
 		: m_imaginary(x, y, z), m_w(w)
 	{
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T>::Quaternion(T w, Vector3<T> const& imaginary)
+	inline constexpr Quaternion<T>::Quaternion(T w, Vector3<T> const& imaginary)
 		: m_imaginary(imaginary), m_w(w)
 	{
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T> Quaternion<T>::AngleAxis(T angleRad, math::Vector3<T> axis)
+	inline constexpr Quaternion<T> Quaternion<T>::AngleAxis(T angleRad, math::Vector3<T> axis, Precision precision)
 	{
+		T sinHalfAngle;
+		T cosHalfAngle;
+		math::SinCos(static_cast<T>(angleRad * 0.5f), sinHalfAngle, cosHalfAngle, precision);
+
 		return math::Quaternion<T>(
-			cosf((float) angleRad * 0.5f),
-			axis * sinf((float) angleRad * 0.5f)
+			cosHalfAngle,
+			axis * sinHalfAngle
 		);
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Quaternion<T>::IsPure(void) const
+	inline constexpr Quaternion<T> Quaternion<T>::FromMatrix3(Matrix3<T> const& matrix)
+	{
+		return quaternion::FromMatrix3(matrix);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T> Quaternion<T>::FromEuler(Radian<T> const& first, Radian<T> const& second, Radian<T> const& third, EulerOrder order, Precision precision)
+	{
+		return quaternion::FromEuler(first.Value(), second.Value(), third.Value(), order, precision);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T> Quaternion<T>::FromEuler(Degree<T> const& first, Degree<T> const& second, Degree<T> const& third, EulerOrder order, Precision precision)
+	{
+		// π / 180 rounded to T, DEG2RAD is a float
+		constexpr T degToRad = static_cast<T>(0.0174532925199432957692369076848861271L);
+
+		return quaternion::FromEuler(static_cast<T>(first.Value() * degToRad), static_cast<T>(second.Value() * degToRad), static_cast<T>(third.Value() * degToRad), order, precision);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Quaternion<T>::FromMatrix3(std::span<Matrix3<T> const> matrices, std::span<Quaternion<T>> result)
+	{
+		quaternion::FromMatrix3(matrices, result);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Quaternion<T>::FromEuler(std::span<Vector3<T> const> angles, std::span<Quaternion<T>> result, EulerOrder order, Precision precision)
+	{
+		quaternion::FromEuler(angles, result, order, precision);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Quaternion<T>::ToEuler(std::span<Quaternion<T> const> quaternions, std::span<Vector3<T>> angles, EulerOrder order)
+	{
+		quaternion::ToEuler(quaternions, angles, order);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Quaternion<T>::IsPure(void) const
 	{
 		return m_w == (T) 0.0f;
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Quaternion<T>::IsUnit(void) const
+	inline constexpr bool Quaternion<T>::IsUnit(void) const
 	{
 		return Magnitude() == 1.0f;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T>& Quaternion<T>::Conjugate(void)
+	inline constexpr Quaternion<T>& Quaternion<T>::Conjugate(void)
 	{
 		m_imaginary = -m_imaginary;
 
@@ -137,7 +298,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T> Quaternion<T>::Rotate(T angle, Vector3<T> const& axis) const
+	inline constexpr Quaternion<T> Quaternion<T>::Rotate(T angle, Vector3<T> const& axis, Precision precision) const
 	{
 		/*
 			Rotation Quaternion
@@ -154,9 +315,11 @@ namespace math
 			result *= denom;
 		}
 		
-		const T sinAngle = sinf((angle * DEG2RAD) * 0.5f);
-		
-		result.m_w = Magnitude() * cosf((angle * DEG2RAD) * 0.5f);
+		T sinAngle;
+		T cosAngle;
+		math::SinCos(Degree<T>(static_cast<T>(angle * 0.5f)), sinAngle, cosAngle, precision);
+
+		result.m_w = Magnitude() * cosAngle;
 		result.m_imaginary[0] = axis[0] * sinAngle;
 		result.m_imaginary[1] = axis[1] * sinAngle;
 		result.m_imaginary[2] = axis[2] * sinAngle;
@@ -165,16 +328,17 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Quaternion<T>::Magnitude(void) const
+	inline constexpr T Quaternion<T>::Magnitude(Precision precision) const
 	{
-		return (T) std::sqrtf(
+		return math::Sqrt<T>(
 				m_imaginary.Dot(m_imaginary) +
-				m_w * m_w
+				m_w * m_w,
+				precision
 			);
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Quaternion<T>::Dot(void) const
+	inline constexpr T Quaternion<T>::Dot(void) const
 	{
 		return T(
 			m_imaginary.Dot(m_imaginary) +
@@ -183,7 +347,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Quaternion<T>::Dot(Quaternion<T> const& quat) const
+	inline constexpr T Quaternion<T>::Dot(Quaternion<T> const& quat) const
 	{
 		return T(
 			m_imaginary.Dot(quat.m_imaginary) +
@@ -192,9 +356,9 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T>& Quaternion<T>::Normalize(void)
+	inline constexpr Quaternion<T>& Quaternion<T>::Normalize(Precision precision)
 	{
-		const T denom = 1.0f / Magnitude();
+		const T denom = (precision == Precision::Fast) ? math::RSqrt(Dot(), precision) : 1.0f / Magnitude();
 
 		m_imaginary *= denom;
 		m_w *= denom;
@@ -203,17 +367,64 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T> Quaternion<T>::Inverse(void) const
+	inline constexpr Quaternion<T> Quaternion<T>::Inverse(void) const
 	{
 		Quaternion<T> result(*this);
 		const T denom = 1.0f / (m_imaginary.Dot(m_imaginary) + m_w * m_w);
-		result = result.Conjugate() * denom;
+
+		result.Conjugate() *= denom;
 
 		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T> Quaternion<T>::operator+(Quaternion<T> const& quat) const
+	inline constexpr Vector3<T> Quaternion<T>::RotateVector(Vector3<T> const& vec3) const
+	{
+		/*
+			Rotate by a unit quaternion without building a matrix
+
+			v + 2w (u x v) + 2u x (u x v), with t = 2 (u x v):
+			v + w * t + u x t
+		*/
+
+		const Vector3<T> t = m_imaginary.Cross(vec3) * static_cast<T>(2);
+
+		return vec3 + t * m_w + m_imaginary.Cross(t);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Quaternion<T>::RotateVector(std::span<Vector3<T> const> vectors, std::span<Vector3<T>> result) const
+	{
+		_ASSERT(result.size() >= vectors.size());
+
+		ParallelFor(vectors.size(), [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+				result[i] = RotateVector(vectors[i]);
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr void Quaternion<T>::ToEuler(Radian<T>& first, Radian<T>& second, Radian<T>& third, EulerOrder order) const
+	{
+		quaternion::ToEuler(*this, first.Value(), second.Value(), third.Value(), order);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr void Quaternion<T>::ToEuler(Degree<T>& first, Degree<T>& second, Degree<T>& third, EulerOrder order) const
+	{
+		// 180 / π rounded to T, RAD2DEG is a float
+		constexpr T radToDeg = static_cast<T>(57.2957795130823208767981548141051703L);
+
+		quaternion::ToEuler(*this, first.Value(), second.Value(), third.Value(), order);
+
+		first.Value() *= radToDeg;
+		second.Value() *= radToDeg;
+		third.Value() *= radToDeg;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T> Quaternion<T>::operator+(Quaternion<T> const& quat) const noexcept
 	{
 		return Quaternion<T>(
 			m_w + quat.m_w,
@@ -222,7 +433,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T> Quaternion<T>::operator-(Quaternion<T> const& quat) const
+	inline constexpr Quaternion<T> Quaternion<T>::operator-(Quaternion<T> const& quat) const noexcept
 	{
 		return Quaternion<T>(
 			m_w - quat.m_w,
@@ -231,7 +442,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T> Quaternion<T>::operator*(Quaternion<T> const& quat) const
+	inline constexpr Quaternion<T> Quaternion<T>::operator*(Quaternion<T> const& quat) const noexcept
 	{
 		/*
 		*	Quaternion multiplication formula:
@@ -247,19 +458,19 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T> Quaternion<T>::operator/(Quaternion<T> const& quat) const
+	inline constexpr Quaternion<T> Quaternion<T>::operator/(Quaternion<T> const& quat) const noexcept
 	{
 		return Quaternion<T>(*this * quat.Inverse());
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T> Quaternion<T>::operator*(T value) const
+	inline constexpr Quaternion<T> Quaternion<T>::operator*(T value) const noexcept
 	{
 		return Quaternion<T>(m_w * value, m_imaginary * value);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T> Quaternion<T>::operator/(T value) const
+	inline constexpr Quaternion<T> Quaternion<T>::operator/(T value) const noexcept
 	{
 		_ASSERT(value != 0);
 
@@ -267,43 +478,57 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T>& Quaternion<T>::operator+=(Quaternion<T> const& quat)
+	inline constexpr Quaternion<T>& Quaternion<T>::operator+=(Quaternion<T> const& quat) noexcept
 	{
-		*this = *this + quat;
+		m_imaginary += quat.m_imaginary;
+		m_w += quat.m_w;
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T>& Quaternion<T>::operator-=(Quaternion<T> const& quat)
+	inline constexpr Quaternion<T>& Quaternion<T>::operator-=(Quaternion<T> const& quat) noexcept
 	{
-		*this = *this - quat;
+		m_imaginary -= quat.m_imaginary;
+		m_w -= quat.m_w;
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T>& Quaternion<T>::operator*=(Quaternion<T> const& quat)
+	inline constexpr Quaternion<T>& Quaternion<T>::operator*=(Quaternion<T> const& quat) noexcept
 	{
-		*this = *this * quat;
+		// Both parts read the old w & imaginary part, quat may be *this
+		const T w = (m_w * quat.m_w) - m_imaginary.Dot(quat.m_imaginary);
+
+		m_imaginary = quat.m_imaginary * m_w + m_imaginary * quat.m_w + m_imaginary.Cross(quat.m_imaginary);
+		m_w = w;
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T>& Quaternion<T>::operator*=(T value)
+	inline constexpr Quaternion<T>& Quaternion<T>::operator*=(T value) noexcept
 	{
-		return *this = *this * value;
+		m_imaginary = m_imaginary * value;
+		m_w *= value;
+
+		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Quaternion<T>& Quaternion<T>::operator/=(T value)
+	inline constexpr Quaternion<T>& Quaternion<T>::operator/=(T value) noexcept
 	{
-		return *this = *this / value;
+		_ASSERT(value != 0);
+
+		m_imaginary = m_imaginary / value;
+		m_w /= value;
+
+		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Quaternion<T>::operator==(Quaternion<T> const& quat) const
+	inline constexpr bool Quaternion<T>::operator==(Quaternion<T> const& quat) const noexcept
 	{
 		return
 			m_imaginary == quat.m_imaginary &&
@@ -311,13 +536,13 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Quaternion<T>::operator!=(Quaternion<T> const& quat) const
+	inline constexpr bool Quaternion<T>::operator!=(Quaternion<T> const& quat) const noexcept
 	{
 		return !(*this == quat);
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Quaternion<T>::operator[](unsigned int index) const
+	inline constexpr T Quaternion<T>::operator[](unsigned int index) const
 	{
 		_ASSERT(index < 4);
 
@@ -325,12 +550,381 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline T& Quaternion<T>::operator[](unsigned int index)
+	inline constexpr T& Quaternion<T>::operator[](unsigned int index)
 	{
 		_ASSERT(index < 4);
 
 		return index > 0 ? m_imaginary[index - 1] : m_w;
 	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T> Nlerp(Quaternion<T> const& from, Quaternion<T> const& to, T t, Precision precision)
+	{
+		// Negative weight on a negative dot product takes the shortest path
+		const T weight = (from.Dot(to) < static_cast<T>(0)) ? -t : t;
+
+		Quaternion<T> result = from * (static_cast<T>(1) - t) + to * weight;
+
+		return result.Normalize(precision);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T> Slerp(Quaternion<T> const& from, Quaternion<T> const& to, T t, Precision precision)
+	{
+		const T dot = from.Dot(to);
+		const T cosTheta = math::Abs(dot);
+
+		if (precision == Precision::Fast)
+		{
+			const T fastT = quaternion::SlerpFastWeight(t, cosTheta);
+			const T weight = (dot < static_cast<T>(0)) ? -fastT : fastT;
+
+			Quaternion<T> result = from * (static_cast<T>(1) - fastT) + to * weight;
+
+			return result.Normalize(precision);
+		}
+
+		// sin(theta) tends to 0, nlerp is exact at this precision
+		if (cosTheta > static_cast<T>(1) - std::numeric_limits<T>::epsilon())
+			return Nlerp(from, to, t);
+
+		/*
+			Slerp
+
+			(sin((1 - t) * theta) * from + sin(t * theta) * to) / sin(theta)
+		*/
+
+		const T theta = math::Acos(cosTheta);
+		const T denom = static_cast<T>(1) / math::Sin(theta);
+		const T fromWeight = math::Sin((static_cast<T>(1) - t) * theta) * denom;
+		const T toWeight = math::Sin(t * theta) * denom;
+
+		return from * fromWeight + to * ((dot < static_cast<T>(0)) ? -toWeight : toWeight);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T> quaternion::FromBasis(Vector3<T> const& column0, Vector3<T> const& column1, Vector3<T> const& column2)
+	{
+		/*
+			Shepperd's method
+
+			4w^2 = 1 + m00 + m11 + m22		4x^2 = 1 + m00 - m11 - m22
+			4y^2 = 1 - m00 + m11 - m22		4z^2 = 1 - m00 - m11 + m22
+
+			The largest component q comes from the diagonal, the other 3 from
+			the off diagonal sums & differences (4wx, 4xy...) divided by 4q, so
+			the divisor is never small. The result is normalised & w >= 0.
+		*/
+
+		const T one = static_cast<T>(1);
+
+		// Element (row, column) is column[row]
+		const T m00 = column0[0];
+		const T m11 = column1[1];
+		const T m22 = column2[2];
+
+		const T wx = column1[2] - column2[1];
+		const T wy = column2[0] - column0[2];
+		const T wz = column0[1] - column1[0];
+		const T xy = column1[0] + column0[1];
+		const T xz = column2[0] + column0[2];
+		const T yz = column2[1] + column1[2];
+
+		T w, x, y, z;
+
+		if (m00 + m11 + m22 > static_cast<T>(0))
+		{
+			const T fourQ = math::Sqrt(one + m00 + m11 + m22) * static_cast<T>(2);
+
+			w = fourQ * static_cast<T>(0.25);
+			x = wx / fourQ;
+			y = wy / fourQ;
+			z = wz / fourQ;
+		}
+		else if (m00 > m11 && m00 > m22)
+		{
+			const T fourQ = math::Sqrt(one + m00 - m11 - m22) * static_cast<T>(2);
+
+			w = wx / fourQ;
+			x = fourQ * static_cast<T>(0.25);
+			y = xy / fourQ;
+			z = xz / fourQ;
+		}
+		else if (m11 > m22)
+		{
+			const T fourQ = math::Sqrt(one - m00 + m11 - m22) * static_cast<T>(2);
+
+			w = wy / fourQ;
+			x = xy / fourQ;
+			y = fourQ * static_cast<T>(0.25);
+			z = yz / fourQ;
+		}
+		else
+		{
+			const T fourQ = math::Sqrt(one - m00 - m11 + m22) * static_cast<T>(2);
+
+			w = wz / fourQ;
+			x = xz / fourQ;
+			y = yz / fourQ;
+			z = fourQ * static_cast<T>(0.25);
+		}
+
+		T inverseLength = one / math::Sqrt(w * w + x * x + y * y + z * z);
+
+		if (w < static_cast<T>(0))
+			inverseLength = -inverseLength;
+
+		return Quaternion<T>(w * inverseLength, x * inverseLength, y * inverseLength, z * inverseLength);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T> quaternion::FromScaledBasis(Vector3<T> const& column0, Vector3<T> const& column1, Vector3<T> const& column2)
+	{
+		// Same operations as Matrix4::Decompose, a negative determinant (mirror) negates the first scale
+		T scale0 = column0.Magnitude();
+		const T scale1 = column1.Magnitude();
+		const T scale2 = column2.Magnitude();
+
+		if (column0.Dot(column1.Cross(column2)) < static_cast<T>(0))
+			scale0 = -scale0;
+
+		if (scale0 == static_cast<T>(0) || scale1 == static_cast<T>(0) || scale2 == static_cast<T>(0))
+			return Quaternion<T>(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+
+		return FromBasis(column0 / scale0, column1 / scale1, column2 / scale2);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T> quaternion::FromMatrix3(Matrix3<T> const& matrix)
+	{
+		return FromScaledBasis(
+			Vector3<T>(matrix.m_matrix[0][0], matrix.m_matrix[0][1], matrix.m_matrix[0][2]),
+			Vector3<T>(matrix.m_matrix[1][0], matrix.m_matrix[1][1], matrix.m_matrix[1][2]),
+			Vector3<T>(matrix.m_matrix[2][0], matrix.m_matrix[2][1], matrix.m_matrix[2][2])
+		);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void quaternion::FromMatrix3(std::span<Matrix3<T> const> matrices, std::span<Quaternion<T>> result)
+	{
+		_ASSERT(result.size() >= matrices.size());
+
+		ParallelFor(matrices.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			if constexpr (std::is_same_v<T, float>)
+			{
+				// Quaternion<float> is specialised below, T keeps the check dependent
+				static_assert(sizeof(Matrix3<T>) == 9 * sizeof(float));
+				static_assert(sizeof(Quaternion<T>) == 4 * sizeof(float));
+
+				simd::Matrix3ToQuaternion(reinterpret_cast<float*>(result.data() + begin), reinterpret_cast<float const*>(matrices.data() + begin), end - begin);
+				return;
+			}
+#endif
+
+			for (size_t i = begin; i < end; ++i)
+				result[i] = FromMatrix3(matrices[i]);
+		});
+	}
+
+	inline constexpr quaternion::EulerAxes quaternion::GetEulerAxes(EulerOrder order) noexcept
+	{
+		// Indexed by EulerOrder
+		constexpr EulerAxes axes[] =
+		{
+			{ 0, 1, 2, false, false },
+			{ 0, 2, 1, false, true },
+			{ 1, 0, 2, false, true },
+			{ 1, 2, 0, false, false },
+			{ 2, 0, 1, false, false },
+			{ 2, 1, 0, false, true },
+			{ 0, 1, 2, true, false },
+			{ 0, 2, 1, true, true },
+			{ 1, 0, 2, true, true },
+			{ 1, 2, 0, true, false },
+			{ 2, 0, 1, true, false },
+			{ 2, 1, 0, true, true }
+		};
+
+		return axes[static_cast<int>(order)];
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T> quaternion::FromEulerHalfAngles(T const* sin, T const* cos, EulerOrder order) noexcept
+	{
+		/*
+			q = q3 * q2 * q1, qn = (cos(an / 2), sin(an / 2) * axis n)
+
+			Expanded with ei x ej = sign * ek, sign = -1 for an odd (i, j, k).
+			q3 turns around axis i for the proper Euler orders, k otherwise.
+		*/
+
+		const EulerAxes axes = GetEulerAxes(order);
+		const T sign = axes.odd ? static_cast<T>(-1) : static_cast<T>(1);
+
+		// w, x, y, z
+		T components[4];
+
+		if (axes.proper)
+		{
+			components[0] = cos[2] * cos[1] * cos[0] - sin[2] * cos[1] * sin[0];
+			components[1 + axes.i] = cos[2] * cos[1] * sin[0] + sin[2] * cos[1] * cos[0];
+			components[1 + axes.j] = cos[2] * sin[1] * cos[0] + sin[2] * sin[1] * sin[0];
+			components[1 + axes.k] = (sin[2] * sin[1] * cos[0] - cos[2] * sin[1] * sin[0]) * sign;
+		}
+		else
+		{
+			components[0] = cos[2] * cos[1] * cos[0] + sin[2] * sin[1] * sin[0] * sign;
+			components[1 + axes.i] = cos[2] * cos[1] * sin[0] - sin[2] * sin[1] * cos[0] * sign;
+			components[1 + axes.j] = cos[2] * sin[1] * cos[0] + sin[2] * cos[1] * sin[0] * sign;
+			components[1 + axes.k] = sin[2] * cos[1] * cos[0] - cos[2] * sin[1] * sin[0] * sign;
+		}
+
+		return Quaternion<T>(components[0], components[1], components[2], components[3]);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T> quaternion::FromEuler(T first, T second, T third, EulerOrder order, Precision precision)
+	{
+		const T half = static_cast<T>(0.5);
+
+		T sin[3];
+		T cos[3];
+
+		math::SinCos(static_cast<T>(first * half), sin[0], cos[0], precision);
+		math::SinCos(static_cast<T>(second * half), sin[1], cos[1], precision);
+		math::SinCos(static_cast<T>(third * half), sin[2], cos[2], precision);
+
+		return FromEulerHalfAngles<T>(sin, cos, order);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr void quaternion::ToEuler(Quaternion<T> const& quat, T& first, T& second, T& third, EulerOrder order)
+	{
+		/*
+			"Quaternion to Euler angles conversion: A direct, general and
+			computationally efficient method", E. Bernardes & S. Viollet
+
+			The components are permuted (& for a Tait-Bryan order rotated by
+			pi / 2 around the second axis) into (a, b, c, d) so every order
+			uses the proper Euler formulas:
+
+			second = 2 * atan2(|(c, d)|, |(a, b)|)
+			first = atan2(b, a) - atan2(d, c)
+			third = atan2(b, a) + atan2(d, c)
+
+			The unit length is not needed, only ratios are used.
+		*/
+
+		const EulerAxes axes = GetEulerAxes(order);
+		const T sign = axes.odd ? static_cast<T>(-1) : static_cast<T>(1);
+
+		const T zero = static_cast<T>(0);
+		const T two = static_cast<T>(2);
+		const T halfPi = static_cast<T>(1.570796326794896619231321691639751442L);
+		const T pi = static_cast<T>(3.141592653589793238462643383279502884L);
+		const T twoPi = static_cast<T>(6.283185307179586476925286766559005768L);
+		const T tolerance = math::Sqrt(std::numeric_limits<T>::epsilon());
+
+		const T w = quat[0];
+		const T i = quat[1 + axes.i];
+		const T j = quat[1 + axes.j];
+		const T k = quat[1 + axes.k] * sign;
+
+		const T a = axes.proper ? w : w - j;
+		const T b = axes.proper ? i : i + k;
+		const T c = axes.proper ? j : j + w;
+		const T d = axes.proper ? k : k - i;
+
+		second = two * math::Atan2(math::Sqrt(c * c + d * d), math::Sqrt(a * a + b * b));
+
+		const T halfSum = math::Atan2(b, a);
+		const T halfDifference = math::Atan2(d, c);
+
+		// Gimbal lock, the first angle takes the whole rotation around the shared axis
+		if (second <= tolerance)
+		{
+			first = two * halfSum;
+			third = zero;
+		}
+		else if (second >= pi - tolerance)
+		{
+			first = -two * halfDifference;
+			third = zero;
+		}
+		else
+		{
+			first = halfSum - halfDifference;
+			third = halfSum + halfDifference;
+		}
+
+		if (!axes.proper)
+		{
+			third *= sign;
+			second -= halfPi;
+		}
+
+		if (first < -pi)
+			first += twoPi;
+		else if (first > pi)
+			first -= twoPi;
+
+		if (third < -pi)
+			third += twoPi;
+		else if (third > pi)
+			third -= twoPi;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void quaternion::FromEuler(std::span<Vector3<T> const> angles, std::span<Quaternion<T>> result, EulerOrder order, Precision precision)
+	{
+		_ASSERT(result.size() >= angles.size());
+
+		// The half angles of a block go through the batch SinCos (SIMD for float, same results as the single angle version)
+		constexpr size_t blockSize = 256;
+
+		ParallelFor(angles.size(), [&](size_t begin, size_t end)
+		{
+			const T half = static_cast<T>(0.5);
+
+			Radian<T> halfAngles[blockSize * 3];
+			T sin[blockSize * 3];
+			T cos[blockSize * 3];
+
+			for (size_t block = begin; block < end; block += blockSize)
+			{
+				const size_t count = std::min(blockSize, end - block);
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					halfAngles[i * 3] = Radian<T>(static_cast<T>(angles[block + i][0] * half));
+					halfAngles[i * 3 + 1] = Radian<T>(static_cast<T>(angles[block + i][1] * half));
+					halfAngles[i * 3 + 2] = Radian<T>(static_cast<T>(angles[block + i][2] * half));
+				}
+
+				math::SinCos(std::span<Radian<T> const>(halfAngles, count * 3), std::span<T>(sin, count * 3), std::span<T>(cos, count * 3), precision);
+
+				for (size_t i = 0; i < count; ++i)
+					result[block + i] = FromEulerHalfAngles<T>(sin + i * 3, cos + i * 3, order);
+			}
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	inline void quaternion::ToEuler(std::span<Quaternion<T> const> quaternions, std::span<Vector3<T>> angles, EulerOrder order)
+	{
+		_ASSERT(angles.size() >= quaternions.size());
+
+		ParallelFor(quaternions.size(), [&](size_t begin, size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+				ToEuler(quaternions[i], angles[i][0], angles[i][1], angles[i][2], order);
+		});
+	}
 }
 
+// SSE2 specialisation for float
+#include "simd/QuaternionFloat.h"
+
 namespace LibMath = math;
\ No newline at end of file
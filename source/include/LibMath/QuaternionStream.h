@@ -0,0 +1,500 @@
+#pragma once
+
+#include "VariableType.hpp"
+#include "Quaternion.h"
+#include "simd/Simd.h"
+#include "simd/Float4.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/*
+*	------- QuaternionStream -------
+*	Structure of arrays storage for N Quaternion, one lane per
+*	component (w, x, y, z), e.g. one keyframe rotation per bone.
+*
+*	QuaternionStreamView does not own its lanes.
+*	QuaternionStream owns its lanes, each lane is 64 byte aligned.
+*
+*	Float streams use SSE2, 4 quaternions per iteration (the exact
+*	Slerp still evaluates acos & sin per element). Results are
+*	identical to calling the Quaternion function on each element.
+*
+*	Functions:
+*	- Size			DONE
+*	- Get			DONE
+*	- Set			DONE
+*	- Load			DONE
+*	- Store			DONE
+*	- Dot			DONE
+*	- Normalize		DONE
+*	- Nlerp			DONE	(per element weight)
+*	- Slerp			DONE	(per element weight)
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class QuaternionStreamView
+	{
+	public:
+									QuaternionStreamView(void) = default;
+									QuaternionStreamView(T* w, T* x, T* y, T* z, size_t size);
+
+									~QuaternionStreamView(void) = default;
+
+		size_t						Size(void) const noexcept;
+		T*							W(void) const noexcept;
+		T*							X(void) const noexcept;
+		T*							Y(void) const noexcept;
+		T*							Z(void) const noexcept;
+
+		Quaternion<T>				Get(size_t index) const;
+		void						Set(size_t index, Quaternion<T> const& quat);
+		void						Load(Quaternion<T> const* quaternions);
+		void						Store(Quaternion<T>* quaternions) const;
+
+		void						Dot(QuaternionStreamView<T> const& stream, T* result) const;
+		QuaternionStreamView<T>&	Normalize(Precision precision = Precision::Exact);
+
+	protected:
+		T*		m_w = nullptr;
+		T*		m_x = nullptr;
+		T*		m_y = nullptr;
+		T*		m_z = nullptr;
+		size_t	m_size = 0;
+	};
+
+	template<math::math_type::NumericType T>
+	class QuaternionStream : public QuaternionStreamView<T>
+	{
+	public:
+		static constexpr size_t		Alignment = 64;
+
+									QuaternionStream(void) = default;
+		explicit					QuaternionStream(size_t size);
+									QuaternionStream(Quaternion<T> const* quaternions, size_t size);
+									QuaternionStream(QuaternionStream<T> const& stream);
+									QuaternionStream(QuaternionStream<T>&& stream) noexcept;
+
+									~QuaternionStream(void);
+
+		QuaternionStreamView<T>		View(void) const noexcept;
+
+		QuaternionStream<T>&		operator=(QuaternionStream<T> const& stream);
+		QuaternionStream<T>&		operator=(QuaternionStream<T>&& stream) noexcept;
+
+	private:
+		void						Allocate(size_t size);
+		void						Release(void) noexcept;
+
+		T* m_data = nullptr;
+	};
+
+	// Blend from[i] towards to[i] by weights[i], result may alias either input
+	template<math::math_type::NumericType T>
+	inline void Nlerp(QuaternionStreamView<T> const& from, QuaternionStreamView<T> const& to, std::type_identity_t<std::span<T const>> weights, QuaternionStreamView<T> result, Precision precision = Precision::Exact);
+
+	template<math::math_type::NumericType T>
+	inline void Slerp(QuaternionStreamView<T> const& from, QuaternionStreamView<T> const& to, std::type_identity_t<std::span<T const>> weights, QuaternionStreamView<T> result, Precision precision = Precision::Exact);
+
+	template<math::math_type::NumericType T>
+	inline QuaternionStreamView<T>::QuaternionStreamView(T* w, T* x, T* y, T* z, size_t size)
+		: m_w(w), m_x(x), m_y(y), m_z(z), m_size(size)
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t QuaternionStreamView<T>::Size(void) const noexcept
+	{
+		return m_size;
+	}
+
+	template<math::math_type::NumericType T>
+	inline T* QuaternionStreamView<T>::W(void) const noexcept
+	{
+		return m_w;
+	}
+
+	template<math::math_type::NumericType T>
+	inline T* QuaternionStreamView<T>::X(void) const noexcept
+	{
+		return m_x;
+	}
+
+	template<math::math_type::NumericType T>
+	inline T* QuaternionStreamView<T>::Y(void) const noexcept
+	{
+		return m_y;
+	}
+
+	template<math::math_type::NumericType T>
+	inline T* QuaternionStreamView<T>::Z(void) const noexcept
+	{
+		return m_z;
+	}
+
+	template<math::math_type::NumericType T>
+	inline Quaternion<T> QuaternionStreamView<T>::Get(size_t index) const
+	{
+		_ASSERT(index < m_size);
+
+		return Quaternion<T>(m_w[index], m_x[index], m_y[index], m_z[index]);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void QuaternionStreamView<T>::Set(size_t index, Quaternion<T> const& quat)
+	{
+		_ASSERT(index < m_size);
+
+		m_w[index] = quat[0];
+		m_x[index] = quat[1];
+		m_y[index] = quat[2];
+		m_z[index] = quat[3];
+	}
+
+	template<math::math_type::NumericType T>
+	inline void QuaternionStreamView<T>::Load(Quaternion<T> const* quaternions)
+	{
+		for (size_t i = 0; i < m_size; ++i)
+			Set(i, quaternions[i]);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void QuaternionStreamView<T>::Store(Quaternion<T>* quaternions) const
+	{
+		for (size_t i = 0; i < m_size; ++i)
+			quaternions[i] = Get(i);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void QuaternionStreamView<T>::Dot(QuaternionStreamView<T> const& stream, T* result) const
+	{
+		_ASSERT(stream.m_size == m_size);
+
+		size_t i = 0;
+
+#if LIBMATH_SIMD_SSE2
+		if constexpr (std::is_same_v<T, float>)
+		{
+			// Same order as Quaternion::Dot, ((x + y) + z) + w
+			for (; i + 4 <= m_size; i += 4)
+			{
+				const __m128 x = _mm_mul_ps(_mm_loadu_ps(m_x + i), _mm_loadu_ps(stream.m_x + i));
+				const __m128 y = _mm_mul_ps(_mm_loadu_ps(m_y + i), _mm_loadu_ps(stream.m_y + i));
+				const __m128 z = _mm_mul_ps(_mm_loadu_ps(m_z + i), _mm_loadu_ps(stream.m_z + i));
+				const __m128 w = _mm_mul_ps(_mm_loadu_ps(m_w + i), _mm_loadu_ps(stream.m_w + i));
+
+				_mm_storeu_ps(result + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(x, y), z), w));
+			}
+		}
+#endif
+
+		for (; i < m_size; ++i)
+			result[i] = Get(i).Dot(stream.Get(i));
+	}
+
+	template<math::math_type::NumericType T>
+	inline QuaternionStreamView<T>& QuaternionStreamView<T>::Normalize(Precision precision)
+	{
+		size_t i = 0;
+
+#if LIBMATH_SIMD_SSE2
+		if constexpr (std::is_same_v<T, float>)
+		{
+			const __m128 one = _mm_set1_ps(1.0f);
+
+			for (; i + 4 <= m_size; i += 4)
+			{
+				const __m128 w = _mm_loadu_ps(m_w + i);
+				const __m128 x = _mm_loadu_ps(m_x + i);
+				const __m128 y = _mm_loadu_ps(m_y + i);
+				const __m128 z = _mm_loadu_ps(m_z + i);
+
+				const __m128 magnitudeSquared = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)), _mm_mul_ps(w, w));
+				const __m128 denom = (precision == Precision::Fast) ? simd::RSqrt4(magnitudeSquared) : _mm_div_ps(one, _mm_sqrt_ps(magnitudeSquared));
+
+				_mm_storeu_ps(m_w + i, _mm_mul_ps(w, denom));
+				_mm_storeu_ps(m_x + i, _mm_mul_ps(x, denom));
+				_mm_storeu_ps(m_y + i, _mm_mul_ps(y, denom));
+				_mm_storeu_ps(m_z + i, _mm_mul_ps(z, denom));
+			}
+		}
+#endif
+
+		for (; i < m_size; ++i)
+			Set(i, Get(i).Normalize(precision));
+
+		return *this;
+	}
+
+#if LIBMATH_SIMD_SSE2
+	namespace quaternion
+	{
+		enum class BlendMode
+		{
+			Nlerp,
+			Slerp,
+			SlerpFast
+		};
+
+		/*
+			4 blends per call, from * fromWeight + to * (+-toWeight), the operations
+			& their order match Nlerp & Slerp on Quaternion<float>.
+
+			Slerp computes acos & sin per lane, its result is not normalised.
+			Returns false without writing when a lane is parallel (the scalar
+			Slerp falls back to Nlerp for those).
+		*/
+		template<BlendMode Mode>
+		inline bool Blend4(QuaternionStreamView<float> const& from, QuaternionStreamView<float> const& to, float const* weights, QuaternionStreamView<float> const& result, size_t i, Precision precision) noexcept
+		{
+			const __m128 one = _mm_set1_ps(1.0f);
+			const __m128 signMask = _mm_set1_ps(-0.0f);
+
+			const __m128 fromW = _mm_loadu_ps(from.W() + i);
+			const __m128 fromX = _mm_loadu_ps(from.X() + i);
+			const __m128 fromY = _mm_loadu_ps(from.Y() + i);
+			const __m128 fromZ = _mm_loadu_ps(from.Z() + i);
+			const __m128 toW = _mm_loadu_ps(to.W() + i);
+			const __m128 toX = _mm_loadu_ps(to.X() + i);
+			const __m128 toY = _mm_loadu_ps(to.Y() + i);
+			const __m128 toZ = _mm_loadu_ps(to.Z() + i);
+
+			const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(fromX, toX), _mm_mul_ps(fromY, toY)), _mm_mul_ps(fromZ, toZ)), _mm_mul_ps(fromW, toW));
+			const __m128 cosTheta = simd::Abs4(dot);
+
+			__m128 t = _mm_loadu_ps(weights + i);
+			__m128 fromWeight;
+			__m128 toWeight;
+
+			if constexpr (Mode == BlendMode::Slerp)
+			{
+				if (_mm_movemask_ps(_mm_cmpgt_ps(cosTheta, _mm_set1_ps(1.0f - std::numeric_limits<float>::epsilon()))) != 0)
+					return false;
+
+				alignas(16) float cosValues[4];
+				alignas(16) float tValues[4];
+				alignas(16) float fromValues[4];
+				alignas(16) float toValues[4];
+
+				_mm_store_ps(cosValues, cosTheta);
+				_mm_store_ps(tValues, t);
+
+				for (int lane = 0; lane < 4; ++lane)
+				{
+					const float theta = math::Acos(cosValues[lane]);
+					const float denom = 1.0f / math::Sin(theta);
+
+					fromValues[lane] = math::Sin((1.0f - tValues[lane]) * theta) * denom;
+					toValues[lane] = math::Sin(tValues[lane] * theta) * denom;
+				}
+
+				fromWeight = _mm_load_ps(fromValues);
+				toWeight = _mm_load_ps(toValues);
+			}
+			else
+			{
+				if constexpr (Mode == BlendMode::SlerpFast)
+				{
+					const __m128 centered = _mm_sub_ps(t, _mm_set1_ps(0.5f));
+
+					const __m128 a = _mm_add_ps(_mm_set1_ps(1.0904f), _mm_mul_ps(cosTheta, _mm_add_ps(_mm_set1_ps(-3.2452f), _mm_mul_ps(cosTheta, _mm_sub_ps(_mm_set1_ps(3.55645f), _mm_mul_ps(cosTheta, _mm_set1_ps(1.43519f)))))));
+					const __m128 b = _mm_add_ps(_mm_set1_ps(0.848013f), _mm_mul_ps(cosTheta, _mm_add_ps(_mm_set1_ps(-1.06021f), _mm_mul_ps(cosTheta, _mm_set1_ps(0.215638f)))));
+					const __m128 k = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(a, centered), centered), b);
+
+					t = _mm_add_ps(t, _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, centered), _mm_sub_ps(t, one)), k));
+				}
+
+				fromWeight = _mm_sub_ps(one, t);
+				toWeight = t;
+			}
+
+			// Negative dot products flip the sign of the target weight, shortest path
+			toWeight = _mm_xor_ps(toWeight, _mm_and_ps(_mm_cmplt_ps(dot, _mm_setzero_ps()), signMask));
+
+			__m128 w = _mm_add_ps(_mm_mul_ps(fromW, fromWeight), _mm_mul_ps(toW, toWeight));
+			__m128 x = _mm_add_ps(_mm_mul_ps(fromX, fromWeight), _mm_mul_ps(toX, toWeight));
+			__m128 y = _mm_add_ps(_mm_mul_ps(fromY, fromWeight), _mm_mul_ps(toY, toWeight));
+			__m128 z = _mm_add_ps(_mm_mul_ps(fromZ, fromWeight), _mm_mul_ps(toZ, toWeight));
+
+			if constexpr (Mode != BlendMode::Slerp)
+			{
+				const __m128 magnitudeSquared = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)), _mm_mul_ps(w, w));
+				const __m128 denom = (precision == Precision::Fast) ? simd::RSqrt4(magnitudeSquared) : _mm_div_ps(one, _mm_sqrt_ps(magnitudeSquared));
+
+				w = _mm_mul_ps(w, denom);
+				x = _mm_mul_ps(x, denom);
+				y = _mm_mul_ps(y, denom);
+				z = _mm_mul_ps(z, denom);
+			}
+
+			_mm_storeu_ps(result.W() + i, w);
+			_mm_storeu_ps(result.X() + i, x);
+			_mm_storeu_ps(result.Y() + i, y);
+			_mm_storeu_ps(result.Z() + i, z);
+
+			return true;
+		}
+	}
+#endif
+
+	template<math::math_type::NumericType T>
+	inline void Nlerp(QuaternionStreamView<T> const& from, QuaternionStreamView<T> const& to, std::type_identity_t<std::span<T const>> weights, QuaternionStreamView<T> result, Precision precision)
+	{
+		_ASSERT(to.Size() == from.Size() && weights.size() >= from.Size() && result.Size() == from.Size());
+
+		size_t i = 0;
+
+#if LIBMATH_SIMD_SSE2
+		if constexpr (std::is_same_v<T, float>)
+		{
+			for (; i + 4 <= from.Size(); i += 4)
+				quaternion::Blend4<quaternion::BlendMode::Nlerp>(from, to, weights.data(), result, i, precision);
+		}
+#endif
+
+		for (; i < from.Size(); ++i)
+			result.Set(i, math::Nlerp(from.Get(i), to.Get(i), weights[i], precision));
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Slerp(QuaternionStreamView<T> const& from, QuaternionStreamView<T> const& to, std::type_identity_t<std::span<T const>> weights, QuaternionStreamView<T> result, Precision precision)
+	{
+		_ASSERT(to.Size() == from.Size() && weights.size() >= from.Size() && result.Size() == from.Size());
+
+		size_t i = 0;
+
+#if LIBMATH_SIMD_SSE2
+		if constexpr (std::is_same_v<T, float>)
+		{
+			for (; i + 4 <= from.Size(); i += 4)
+			{
+				if (precision == Precision::Fast)
+				{
+					quaternion::Blend4<quaternion::BlendMode::SlerpFast>(from, to, weights.data(), result, i, precision);
+					continue;
+				}
+
+				if (quaternion::Blend4<quaternion::BlendMode::Slerp>(from, to, weights.data(), result, i, precision))
+					continue;
+
+				for (size_t j = i; j < i + 4; ++j)
+					result.Set(j, math::Slerp(from.Get(j), to.Get(j), weights[j], precision));
+			}
+		}
+#endif
+
+		for (; i < from.Size(); ++i)
+			result.Set(i, math::Slerp(from.Get(i), to.Get(i), weights[i], precision));
+	}
+
+	template<math::math_type::NumericType T>
+	inline QuaternionStream<T>::QuaternionStream(size_t size)
+	{
+		Allocate(size);
+	}
+
+	template<math::math_type::NumericType T>
+	inline QuaternionStream<T>::QuaternionStream(Quaternion<T> const* quaternions, size_t size)
+	{
+		Allocate(size);
+		this->Load(quaternions);
+	}
+
+	template<math::math_type::NumericType T>
+	inline QuaternionStream<T>::QuaternionStream(QuaternionStream<T> const& stream)
+		: QuaternionStreamView<T>()
+	{
+		*this = stream;
+	}
+
+	template<math::math_type::NumericType T>
+	inline QuaternionStream<T>::QuaternionStream(QuaternionStream<T>&& stream) noexcept
+	{
+		*this = std::move(stream);
+	}
+
+	template<math::math_type::NumericType T>
+	inline QuaternionStream<T>::~QuaternionStream(void)
+	{
+		Release();
+	}
+
+	template<math::math_type::NumericType T>
+	inline QuaternionStreamView<T> QuaternionStream<T>::View(void) const noexcept
+	{
+		return QuaternionStreamView<T>(this->m_w, this->m_x, this->m_y, this->m_z, this->m_size);
+	}
+
+	template<math::math_type::NumericType T>
+	inline QuaternionStream<T>& QuaternionStream<T>::operator=(QuaternionStream<T> const& stream)
+	{
+		if (this == &stream)
+			return *this;
+
+		Release();
+		Allocate(stream.m_size);
+
+		std::copy_n(stream.m_w, stream.m_size, this->m_w);
+		std::copy_n(stream.m_x, stream.m_size, this->m_x);
+		std::copy_n(stream.m_y, stream.m_size, this->m_y);
+		std::copy_n(stream.m_z, stream.m_size, this->m_z);
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline QuaternionStream<T>& QuaternionStream<T>::operator=(QuaternionStream<T>&& stream) noexcept
+	{
+		if (this == &stream)
+			return *this;
+
+		Release();
+
+		static_cast<QuaternionStreamView<T>&>(*this) = stream;
+		m_data = stream.m_data;
+
+		static_cast<QuaternionStreamView<T>&>(stream) = QuaternionStreamView<T>();
+		stream.m_data = nullptr;
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void QuaternionStream<T>::Allocate(size_t size)
+	{
+		// Pad each lane to a multiple of the alignment so every lane starts aligned
+		constexpr size_t laneElements = Alignment / sizeof(T);
+		const size_t laneSize = (size + laneElements - 1) / laneElements * laneElements;
+
+		if (laneSize != 0)
+		{
+			m_data = static_cast<T*>(::operator new(4 * laneSize * sizeof(T), std::align_val_t(Alignment)));
+			std::fill_n(m_data, 4 * laneSize, static_cast<T>(0));
+		}
+
+		this->m_w = m_data;
+		this->m_x = m_data + laneSize;
+		this->m_y = m_data + 2 * laneSize;
+		this->m_z = m_data + 3 * laneSize;
+		this->m_size = size;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void QuaternionStream<T>::Release(void) noexcept
+	{
+		if (m_data != nullptr)
+			::operator delete(m_data, std::align_val_t(Alignment));
+
+		static_cast<QuaternionStreamView<T>&>(*this) = QuaternionStreamView<T>();
+		m_data = nullptr;
+	}
+}
+
+namespace LibMath = math;
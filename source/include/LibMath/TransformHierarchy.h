@@ -0,0 +1,363 @@
+#pragma once
+
+#include "VariableType.hpp"
+#include "Parallel.h"
+#include "Quaternion.h"
+#include "vector/Vector3.h"
+#include "matrix/Matrix4.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/*
+*	------- TransformHierarchy -------
+*	Flat scene graph, node i stores the index of its parent & its
+*	local translation, rotation & scale. Each local component lives
+*	in its own array (structure of arrays).
+*
+*	Nodes are topologically sorted, a parent is always added before
+*	its children (parent index < child index), world matrices are
+*	parent world * local with local = translation * rotation * scale.
+*
+*	Setters mark the node dirty, Update recomputes the world matrix
+*	of dirty nodes & their descendants only. Dirty nodes are grouped
+*	by depth, nodes of the same depth are independent & each depth
+*	is split across threads when it is large enough.
+*
+*	Functions
+*	- AddNode			DONE
+*	- Size				DONE
+*	- Parent			DONE
+*	- Depth				DONE
+*	- Set (T, R, S)		DONE
+*	- MarkDirty			DONE
+*	- IsDirty			DONE
+*	- LocalMatrix		DONE
+*	- WorldMatrix		DONE
+*	- Update			DONE
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class TransformHierarchy
+	{
+	public:
+		// Parent index of root nodes
+		static constexpr size_t			NoParent = static_cast<size_t>(-1);
+
+		// Nodes of one depth per thread, below this a depth is updated on the calling thread
+		static constexpr size_t			ParallelBatchSize = 4096;
+
+										TransformHierarchy(void) = default;
+										~TransformHierarchy(void) = default;
+
+		size_t							AddNode(size_t parent, Vector3<T> const& translation = Vector3<T>(static_cast<T>(0)), Quaternion<T> const& rotation = Quaternion<T>(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)), Vector3<T> const& scale = Vector3<T>(static_cast<T>(1)));
+		void							Reserve(size_t size);
+
+		size_t							Size(void) const noexcept;
+		size_t							Parent(size_t index) const;
+		size_t							Depth(size_t index) const;
+
+		Vector3<T> const&				Translation(size_t index) const;
+		Quaternion<T> const&			Rotation(size_t index) const;
+		Vector3<T> const&				Scale(size_t index) const;
+
+		void							SetTranslation(size_t index, Vector3<T> const& translation);
+		void							SetRotation(size_t index, Quaternion<T> const& rotation);
+		void							SetScale(size_t index, Vector3<T> const& scale);
+		void							SetLocal(size_t index, Vector3<T> const& translation, Quaternion<T> const& rotation, Vector3<T> const& scale);
+
+		void							MarkDirty(size_t index);
+		bool							IsDirty(size_t index) const;
+
+		Matrix4<T>						LocalMatrix(size_t index) const;
+		Matrix4<T> const&				WorldMatrix(size_t index) const;
+		std::span<Matrix4<T> const>		WorldMatrices(void) const noexcept;
+
+		size_t							Update(void);
+
+	private:
+		void							UpdateNode(size_t index);
+
+		std::vector<size_t>			m_parents;
+		std::vector<size_t>			m_depths;
+		std::vector<Vector3<T>>		m_translations;
+		std::vector<Quaternion<T>>	m_rotations;
+		std::vector<Vector3<T>>		m_scales;
+		std::vector<Matrix4<T>>		m_world;
+		std::vector<uint8_t>		m_dirty;
+
+		// Update scratch, kept between updates to avoid reallocating
+		std::vector<size_t>			m_dirtyNodes;
+		std::vector<size_t>			m_levelOffsets;
+		std::vector<size_t>			m_levelNodes;
+		std::vector<size_t>			m_levelCursors;
+		size_t						m_maxDepth = 0;
+	};
+
+	template<math::math_type::NumericType T>
+	inline size_t TransformHierarchy<T>::AddNode(size_t parent, Vector3<T> const& translation, Quaternion<T> const& rotation, Vector3<T> const& scale)
+	{
+		// Children are added after their parent, one pass in index order visits parents first
+		_ASSERT(parent == NoParent || parent < m_parents.size());
+
+		const size_t depth = (parent == NoParent) ? 0 : m_depths[parent] + 1;
+
+		m_parents.push_back(parent);
+		m_depths.push_back(depth);
+		m_translations.push_back(translation);
+		m_rotations.push_back(rotation);
+		m_scales.push_back(scale);
+		m_world.emplace_back();
+		m_dirty.push_back(1);
+
+		m_maxDepth = (depth > m_maxDepth) ? depth : m_maxDepth;
+
+		return m_parents.size() - 1;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformHierarchy<T>::Reserve(size_t size)
+	{
+		m_parents.reserve(size);
+		m_depths.reserve(size);
+		m_translations.reserve(size);
+		m_rotations.reserve(size);
+		m_scales.reserve(size);
+		m_world.reserve(size);
+		m_dirty.reserve(size);
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t TransformHierarchy<T>::Size(void) const noexcept
+	{
+		return m_parents.size();
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t TransformHierarchy<T>::Parent(size_t index) const
+	{
+		_ASSERT(index < Size());
+
+		return m_parents[index];
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t TransformHierarchy<T>::Depth(size_t index) const
+	{
+		_ASSERT(index < Size());
+
+		return m_depths[index];
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3<T> const& TransformHierarchy<T>::Translation(size_t index) const
+	{
+		_ASSERT(index < Size());
+
+		return m_translations[index];
+	}
+
+	template<math::math_type::NumericType T>
+	inline Quaternion<T> const& TransformHierarchy<T>::Rotation(size_t index) const
+	{
+		_ASSERT(index < Size());
+
+		return m_rotations[index];
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3<T> const& TransformHierarchy<T>::Scale(size_t index) const
+	{
+		_ASSERT(index < Size());
+
+		return m_scales[index];
+	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformHierarchy<T>::SetTranslation(size_t index, Vector3<T> const& translation)
+	{
+		_ASSERT(index < Size());
+
+		m_translations[index] = translation;
+		m_dirty[index] = 1;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformHierarchy<T>::SetRotation(size_t index, Quaternion<T> const& rotation)
+	{
+		_ASSERT(index < Size());
+
+		m_rotations[index] = rotation;
+		m_dirty[index] = 1;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformHierarchy<T>::SetScale(size_t index, Vector3<T> const& scale)
+	{
+		_ASSERT(index < Size());
+
+		m_scales[index] = scale;
+		m_dirty[index] = 1;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformHierarchy<T>::SetLocal(size_t index, Vector3<T> const& translation, Quaternion<T> const& rotation, Vector3<T> const& scale)
+	{
+		_ASSERT(index < Size());
+
+		m_translations[index] = translation;
+		m_rotations[index] = rotation;
+		m_scales[index] = scale;
+		m_dirty[index] = 1;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformHierarchy<T>::MarkDirty(size_t index)
+	{
+		_ASSERT(index < Size());
+
+		m_dirty[index] = 1;
+	}
+
+	template<math::math_type::NumericType T>
+	inline bool TransformHierarchy<T>::IsDirty(size_t index) const
+	{
+		_ASSERT(index < Size());
+
+		return m_dirty[index] != 0;
+	}
+
+	template<math::math_type::NumericType T>
+	inline Matrix4<T> TransformHierarchy<T>::LocalMatrix(size_t index) const
+	{
+		_ASSERT(index < Size());
+
+		// Rotation columns scaled by x, y & z, translation in the last column (column major)
+		Matrix4<T> local = Matrix4<T>().Transform(m_rotations[index]);
+
+		for (int column = 0; column < 3; ++column)
+		{
+			for (int row = 0; row < 3; ++row)
+				local.m_matrix[column][row] *= m_scales[index][column];
+		}
+
+		local.m_matrix[3][0] = m_translations[index][0];
+		local.m_matrix[3][1] = m_translations[index][1];
+		local.m_matrix[3][2] = m_translations[index][2];
+
+		return local;
+	}
+
+	template<math::math_type::NumericType T>
+	inline Matrix4<T> const& TransformHierarchy<T>::WorldMatrix(size_t index) const
+	{
+		_ASSERT(index < Size());
+
+		return m_world[index];
+	}
+
+	template<math::math_type::NumericType T>
+	inline std::span<Matrix4<T> const> TransformHierarchy<T>::WorldMatrices(void) const noexcept
+	{
+		return std::span<Matrix4<T> const>(m_world.data(), m_world.size());
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t TransformHierarchy<T>::Update(void)
+	{
+		// A dirty parent makes its children dirty, parents come first so a single pass covers whole subtrees
+		const size_t threadCount = ParallelThreadCount();
+
+		if (threadCount == 1 || Size() < 2 * ParallelBatchSize)
+		{
+			// Index order is valid on a single thread, update while propagating
+			size_t updated = 0;
+
+			for (size_t i = 0; i < Size(); ++i)
+			{
+				const size_t parent = m_parents[i];
+
+				if (parent != NoParent && m_dirty[parent])
+					m_dirty[i] = 1;
+
+				if (m_dirty[i])
+				{
+					UpdateNode(i);
+					++updated;
+				}
+			}
+
+			if (updated != 0)
+				std::fill(m_dirty.begin(), m_dirty.end(), static_cast<uint8_t>(0));
+
+			return updated;
+		}
+
+		m_dirtyNodes.clear();
+
+		for (size_t i = 0; i < Size(); ++i)
+		{
+			const size_t parent = m_parents[i];
+
+			if (parent != NoParent && m_dirty[parent])
+				m_dirty[i] = 1;
+
+			if (m_dirty[i])
+				m_dirtyNodes.push_back(i);
+		}
+
+		if (m_dirtyNodes.empty())
+			return 0;
+
+		// Counting sort by depth, stable so each depth stays in index order
+		m_levelOffsets.assign(m_maxDepth + 2, 0);
+
+		for (size_t node : m_dirtyNodes)
+			++m_levelOffsets[m_depths[node] + 1];
+
+		for (size_t depth = 1; depth < m_levelOffsets.size(); ++depth)
+			m_levelOffsets[depth] += m_levelOffsets[depth - 1];
+
+		m_levelNodes.resize(m_dirtyNodes.size());
+		m_levelCursors.assign(m_levelOffsets.begin(), m_levelOffsets.end() - 1);
+
+		for (size_t node : m_dirtyNodes)
+			m_levelNodes[m_levelCursors[m_depths[node]]++] = node;
+
+		// Depth d only reads world matrices of depth d - 1, finished by the previous iteration
+		for (size_t depth = 0; depth <= m_maxDepth; ++depth)
+		{
+			const size_t begin = m_levelOffsets[depth];
+			const size_t count = m_levelOffsets[depth + 1] - begin;
+
+			ParallelFor(count, [&](size_t first, size_t last)
+			{
+				for (size_t i = first; i < last; ++i)
+					UpdateNode(m_levelNodes[begin + i]);
+			}, ParallelBatchSize);
+		}
+
+		for (size_t node : m_dirtyNodes)
+			m_dirty[node] = 0;
+
+		return m_dirtyNodes.size();
+	}
+
+	template<math::math_type::NumericType T>
+	inline void TransformHierarchy<T>::UpdateNode(size_t index)
+	{
+		const size_t parent = m_parents[index];
+
+		if (parent == NoParent)
+			m_world[index] = LocalMatrix(index);
+		else
+			m_world[index] = m_world[parent] * LocalMatrix(index);
+	}
+}
+
+namespace LibMath = math;
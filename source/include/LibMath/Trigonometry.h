@@ -0,0 +1,174 @@
+#pragma once
+
+#include "VariableType.hpp"
+#include "Arithmetic.h"
+#include "Deterministic.h"
+#include "angle/Degrees.h"
+#include "angle/Radians.h"
+#include "simd/Simd.h"
+
+#include <span>
+#include <type_traits>
+
+/*
+*	------- Trigonometry -------
+*	SinCos returns the sine & cosine of one angle with a single
+*	range reduction, the angle is split into a quadrant & a
+*	remainder in [-pi / 4, pi / 4] (pi / 2 is stored as 3 parts so
+*	quadrant * part stays exact) before evaluating both polynomials.
+*
+*	Precision tiers:
+*	- Exact		<cmath> sin & cos (long double series at compile time),
+*				math::deterministic with LIBMATH_DETERMINISTIC
+*	- Medium	minimax polynomials, float absolute error below 1e-7
+*				(1 ulp on [-pi, pi]), double within 2 ulp
+*	- Fast		shorter polynomials, absolute error below 4e-5
+*
+*	Medium & Fast are implemented for float & double, |angle| must
+*	be below 8192 (float) or 2^30 (double) radians, larger angles,
+*	infinity, NaN & other types use the exact path.
+*
+*	Medium & Fast are plain arithmetic, they return the same value
+*	at compile time & at runtime. The float batches use SIMD kernels
+*	evaluating the same operations lane by lane, batch results match
+*	the single angle function.
+*
+*	The polynomial constants & the quadrant reduction are shared with
+*	the deterministic functions in Deterministic.h.
+*
+*	Functions
+*	- SinCos			DONE
+*	- SinCos (batch)	DONE	(Radian & Degree spans)
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	inline constexpr void SinCos(T const& rad, T& sin, T& cos, Precision precision = Precision::Exact) noexcept;
+
+	template<math::math_type::NumericType T>
+	inline constexpr void SinCos(Radian<T> const& angle, T& sin, T& cos, Precision precision = Precision::Exact) noexcept;
+
+	template<math::math_type::NumericType T>
+	inline constexpr void SinCos(Degree<T> const& angle, T& sin, T& cos, Precision precision = Precision::Exact) noexcept;
+
+	template<math::math_type::NumericType T>
+	inline void SinCos(std::span<Radian<T> const> angles, std::span<T> sin, std::span<T> cos, Precision precision = Precision::Exact);
+
+	template<math::math_type::NumericType T>
+	inline void SinCos(std::span<Degree<T> const> angles, std::span<T> sin, std::span<T> cos, Precision precision = Precision::Exact);
+}
+
+template<math::math_type::NumericType T>
+constexpr void math::SinCos(T const& rad, T& sin, T& cos, Precision precision) noexcept
+{
+	if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>)
+	{
+		using Constants = trigonometry::SinCosConstants<T>;
+
+		// NaN fails the range check
+		if (precision != Precision::Exact && math::Abs(rad) <= Constants::limit)
+		{
+			int quadrant = 0;
+
+			const T r = trigonometry::ReduceQuadrant(rad, quadrant);
+			const T z = r * r;
+
+			T sinR;
+			T cosR;
+
+			if (precision == Precision::Medium)
+			{
+				sinR = r + (r * z) * trigonometry::Horner(z, Constants::sinMedium);
+				cosR = ((z * z) * trigonometry::Horner(z, Constants::cosMedium) - static_cast<T>(0.5) * z) + static_cast<T>(1);
+			}
+			else
+			{
+				sinR = r + (r * z) * trigonometry::Horner(z, Constants::sinFast);
+				cosR = static_cast<T>(1) + z * trigonometry::Horner(z, Constants::cosFast);
+			}
+
+			trigonometry::ApplyQuadrant(quadrant, sinR, cosR, sin, cos);
+
+			return;
+		}
+	}
+
+	sin = math::Sin(rad);
+	cos = math::Cos(rad);
+}
+
+template<math::math_type::NumericType T>
+constexpr void math::SinCos(Radian<T> const& angle, T& sin, T& cos, Precision precision) noexcept
+{
+	math::SinCos(angle.Value(), sin, cos, precision);
+}
+
+template<math::math_type::NumericType T>
+constexpr void math::SinCos(Degree<T> const& angle, T& sin, T& cos, Precision precision) noexcept
+{
+	// π / 180 rounded to T, DEG2RAD is a float
+	constexpr T degToRad = static_cast<T>(0.0174532925199432957692369076848861271L);
+
+	math::SinCos(static_cast<T>(angle.Value() * degToRad), sin, cos, precision);
+}
+
+template<math::math_type::NumericType T>
+void math::SinCos(std::span<Radian<T> const> angles, std::span<T> sin, std::span<T> cos, Precision precision)
+{
+	_ASSERT(sin.size() >= angles.size() && cos.size() >= angles.size());
+
+#if LIBMATH_SIMD_SSE2
+	if constexpr (std::is_same_v<T, float>)
+	{
+		static_assert(sizeof(Radian<float>) == sizeof(float));
+
+		if (precision != Precision::Exact)
+		{
+			float const* values = reinterpret_cast<float const*>(angles.data());
+
+			if (precision == Precision::Fast)
+				simd::SinCosFast(sin.data(), cos.data(), values, angles.size(), 1.0f);
+			else
+				simd::SinCos(sin.data(), cos.data(), values, angles.size(), 1.0f);
+
+			return;
+		}
+	}
+#endif
+
+	for (size_t i = 0; i < angles.size(); ++i)
+		math::SinCos(angles[i], sin[i], cos[i], precision);
+}
+
+template<math::math_type::NumericType T>
+void math::SinCos(std::span<Degree<T> const> angles, std::span<T> sin, std::span<T> cos, Precision precision)
+{
+	_ASSERT(sin.size() >= angles.size() && cos.size() >= angles.size());
+
+#if LIBMATH_SIMD_SSE2
+	if constexpr (std::is_same_v<T, float>)
+	{
+		static_assert(sizeof(Degree<float>) == sizeof(float));
+
+		if (precision != Precision::Exact)
+		{
+			constexpr float degToRad = static_cast<float>(0.0174532925199432957692369076848861271L);
+
+			float const* values = reinterpret_cast<float const*>(angles.data());
+
+			if (precision == Precision::Fast)
+				simd::SinCosFast(sin.data(), cos.data(), values, angles.size(), degToRad);
+			else
+				simd::SinCos(sin.data(), cos.data(), values, angles.size(), degToRad);
+
+			return;
+		}
+	}
+#endif
+
+	for (size_t i = 0; i < angles.size(); ++i)
+		math::SinCos(angles[i], sin[i], cos[i], precision);
+}
+
+namespace LibMath = math;
@@ -1,16 +1,41 @@
 #pragma once
 
+#include <concepts>
+#include <limits>
 #include <type_traits>
 
 namespace math
 {
 	namespace math_type
 	{
+		// Class types (e.g. Fixed) specialise std::numeric_limits, provide the arithmetic & comparison
+		// operators & static Sqrt, Sin, Cos, Tan, Asin, Acos & Atan used by the functions in Arithmetic.h
 		template<typename T>
-		concept NumericType = std::is_arithmetic<T>::value;
+		concept CustomNumericType = std::is_class_v<T> && std::numeric_limits<T>::is_specialized &&
+			requires(T value1, T value2)
+			{
+				{ value1 + value2 } -> std::same_as<T>;
+				{ value1 - value2 } -> std::same_as<T>;
+				{ value1 * value2 } -> std::same_as<T>;
+				{ value1 / value2 } -> std::same_as<T>;
+				{ value1 % value2 } -> std::same_as<T>;
+				{ -value1 } -> std::same_as<T>;
+				{ value1 < value2 } -> std::same_as<bool>;
+				{ value1 == value2 } -> std::same_as<bool>;
+				{ T::Sqrt(value1) } -> std::same_as<T>;
+				{ T::Sin(value1) } -> std::same_as<T>;
+				{ T::Cos(value1) } -> std::same_as<T>;
+				{ T::Tan(value1) } -> std::same_as<T>;
+				{ T::Asin(value1) } -> std::same_as<T>;
+				{ T::Acos(value1) } -> std::same_as<T>;
+				{ T::Atan(value1) } -> std::same_as<T>;
+			};
 
 		template<typename T>
-		concept UnsignedType = std::is_unsigned<T>::value;
+		concept NumericType = std::is_arithmetic<T>::value || CustomNumericType<T>;
+
+		template<typename T>
+		concept UnsignedType = NumericType<T> && std::is_unsigned<T>::value;
 
 
 	}
@@ -2,4 +2,6 @@
 
 #include "vector/Vector2.h"
 #include "vector/Vector3.h"
-#include "vector/Vector4.h"
\ No newline at end of file
+#include "vector/Vector4.h"
+#include "vector/Vector3Stream.h"
+#include "vector/VectorN.h"
\ No newline at end of file
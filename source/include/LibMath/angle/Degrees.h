@@ -33,40 +33,40 @@ namespace math
 	class Degree
 	{
 	public:
-					Degree(void) = default;
-					Degree(T const value);
-
-					~Degree(void) = default;
-
-		Degree<T>	Wrap(bool to360 = true);	// true -> 0 - 360 | false -> -180 - 180
-		T			Value(void) const noexcept;
-		T&			Value(void);
-
-		Degree<T>	operator+(T const value);
-		Degree<T>	operator+(Degree<T> const& value);
-		Degree<T>	operator-(T const value);
-		Degree<T>	operator-(Degree<T> const& value);
-		Degree<T>	operator*(T const value);
-		Degree<T>	operator/(T const value);
-		Degree<T>&	operator+=(T const value);
-		Degree<T>&	operator+=(Degree<T> const& value);
-		Degree<T>&	operator-=(T const value);
-		Degree<T>&	operator-=(Degree<T> const& value);
-
-		bool		operator==(Degree<T> const& Degree) const noexcept;
-		bool		operator!=(Degree<T> const& Degree) const noexcept;
+		constexpr				Degree(void) = default;
+		constexpr				Degree(T const value);
+
+								~Degree(void) = default;
+
+		constexpr Degree<T>		Wrap(bool to360 = true);	// true -> 0 - 360 | false -> -180 - 180
+		constexpr T				Value(void) const noexcept;
+		constexpr T&			Value(void);
+
+		constexpr Degree<T>		operator+(T const value);
+		constexpr Degree<T>		operator+(Degree<T> const& value);
+		constexpr Degree<T>		operator-(T const value);
+		constexpr Degree<T>		operator-(Degree<T> const& value);
+		constexpr Degree<T>		operator*(T const value);
+		constexpr Degree<T>		operator/(T const value);
+		constexpr Degree<T>&	operator+=(T const value);
+		constexpr Degree<T>&	operator+=(Degree<T> const& value);
+		constexpr Degree<T>&	operator-=(T const value);
+		constexpr Degree<T>&	operator-=(Degree<T> const& value);
+
+		constexpr bool			operator==(Degree<T> const& Degree) const noexcept;
+		constexpr bool			operator!=(Degree<T> const& Degree) const noexcept;
 	private:
 		T m_angle = 0;
 	};
 
 	template<math::math_type::NumericType T>
-	inline math::Degree<T>::Degree(T const value)
+	inline constexpr math::Degree<T>::Degree(T const value)
 		: m_angle(value)
 	{
 	}
 
 	template<math::math_type::NumericType T>
-	inline Degree<T> Degree<T>::Wrap(bool to360)
+	inline constexpr Degree<T> Degree<T>::Wrap(bool to360)
 	{
 		T lowerBound = to360 ? 0 : -180;
 
@@ -76,49 +76,49 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Degree<T>::Value(void) const noexcept
+	inline constexpr T Degree<T>::Value(void) const noexcept
 	{
 		return m_angle;
 	}
 
 	template<math::math_type::NumericType T>
-	inline T& Degree<T>::Value(void)
+	inline constexpr T& Degree<T>::Value(void)
 	{
 		return m_angle;
 	}
 
 	template<math::math_type::NumericType T>
-	inline math::Degree<T> math::Degree<T>::operator+(T const value)
+	inline constexpr math::Degree<T> math::Degree<T>::operator+(T const value)
 	{
 		return m_angle + value;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Degree<T> Degree<T>::operator+(Degree<T> const& value)
+	inline constexpr Degree<T> Degree<T>::operator+(Degree<T> const& value)
 	{
 		return Degree<T>(m_angle + value.m_angle);
 	}
 
 	template<math::math_type::NumericType T>
-	inline math::Degree<T> math::Degree<T>::operator-(T const value)
+	inline constexpr math::Degree<T> math::Degree<T>::operator-(T const value)
 	{
 		return m_angle - value;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Degree<T> Degree<T>::operator-(Degree<T> const& value)
+	inline constexpr Degree<T> Degree<T>::operator-(Degree<T> const& value)
 	{
 		return Degree<T>(m_angle - value.m_angle);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Degree<T> Degree<T>::operator*(T const value)
+	inline constexpr Degree<T> Degree<T>::operator*(T const value)
 	{
 		return Degree<T>(m_angle * value);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Degree<T> Degree<T>::operator/(T const value)
+	inline constexpr Degree<T> Degree<T>::operator/(T const value)
 	{
 		_ASSERT(value != (T) 0);
 
@@ -126,7 +126,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline math::Degree<T>& Degree<T>::operator+=(T const value)
+	inline constexpr math::Degree<T>& Degree<T>::operator+=(T const value)
 	{
 		T result = m_angle + value;
 
@@ -134,7 +134,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Degree<T>& Degree<T>::operator+=(Degree<T> const& value)
+	inline constexpr Degree<T>& Degree<T>::operator+=(Degree<T> const& value)
 	{
 		m_angle += value.m_angle;
 
@@ -142,7 +142,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline math::Degree<T>& math::Degree<T>::operator-=(T const value)
+	inline constexpr math::Degree<T>& math::Degree<T>::operator-=(T const value)
 	{
 		T result = m_angle - value;
 
@@ -150,7 +150,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Degree<T>& Degree<T>::operator-=(Degree<T> const& value)
+	inline constexpr Degree<T>& Degree<T>::operator-=(Degree<T> const& value)
 	{
 		m_angle -= value.m_angle;
 
@@ -158,7 +158,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Degree<T>::operator==(Degree<T> const& Degree) const noexcept
+	inline constexpr bool Degree<T>::operator==(Degree<T> const& Degree) const noexcept
 	{
 		bool result = math::AlmostEqual(m_angle, Degree.m_angle);
 
@@ -166,7 +166,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Degree<T>::operator!=(Degree<T> const& Degree) const noexcept
+	inline constexpr bool Degree<T>::operator!=(Degree<T> const& Degree) const noexcept
 	{
 		return !math::AlmostEqual(m_angle, Degree.m_angle);
 	}
@@ -32,40 +32,40 @@ namespace math
 	class Radian
 	{
 	public:
-					Radian(void) = default;
-					Radian(T const value);
-
-					~Radian(void) = default;
-
-		Radian<T>	Wrap(bool to2Pi = true);	// true -> 0 - 2Pi | false -> -Pi - Pi
-		T			Value(void) const noexcept;
-		T&			Value(void);
-
-		Radian<T>	operator+(T const value);
-		Radian<T>	operator+(Radian<T> const& radian);
-		Radian<T>	operator-(T const value);
-		Radian<T>	operator-(Radian<T> const& radian);
-		Radian<T>	operator*(T const value);
-		Radian<T>	operator/(T const value);
-		Radian<T>&	operator+=(T const value);
-		Radian<T>&	operator+=(Radian<T> const& radian);
-		Radian<T>&	operator-=(T const value);
-		Radian<T>&	operator-=(Radian<T> const& radian);
-
-		bool		operator==(Radian const& radian) const noexcept;
-		bool		operator!=(Radian const& radian) const noexcept;
+		constexpr				Radian(void) = default;
+		constexpr				Radian(T const value);
+
+								~Radian(void) = default;
+
+		constexpr Radian<T>		Wrap(bool to2Pi = true);	// true -> 0 - 2Pi | false -> -Pi - Pi
+		constexpr T				Value(void) const noexcept;
+		constexpr T&			Value(void);
+
+		constexpr Radian<T>		operator+(T const value);
+		constexpr Radian<T>		operator+(Radian<T> const& radian);
+		constexpr Radian<T>		operator-(T const value);
+		constexpr Radian<T>		operator-(Radian<T> const& radian);
+		constexpr Radian<T>		operator*(T const value);
+		constexpr Radian<T>		operator/(T const value);
+		constexpr Radian<T>&	operator+=(T const value);
+		constexpr Radian<T>&	operator+=(Radian<T> const& radian);
+		constexpr Radian<T>&	operator-=(T const value);
+		constexpr Radian<T>&	operator-=(Radian<T> const& radian);
+
+		constexpr bool			operator==(Radian const& radian) const noexcept;
+		constexpr bool			operator!=(Radian const& radian) const noexcept;
 	private:
 		T m_angle = 0;
 	};
 
 	template<math::math_type::NumericType T>
-	inline Radian<T>::Radian(T const value)
+	inline constexpr Radian<T>::Radian(T const value)
 		: m_angle(value)
 	{
 	}
 
 	template<math::math_type::NumericType T>
-	inline Radian<T> Radian<T>::Wrap(bool to2Pi)
+	inline constexpr Radian<T> Radian<T>::Wrap(bool to2Pi)
 	{
 		T lowerBound = to2Pi ? 0.0f : -PI;
 
@@ -75,49 +75,49 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Radian<T>::Value(void) const noexcept
+	inline constexpr T Radian<T>::Value(void) const noexcept
 	{
 		return m_angle;
 	}
 
 	template<math::math_type::NumericType T>
-	inline T& Radian<T>::Value(void)
+	inline constexpr T& Radian<T>::Value(void)
 	{
 		return m_angle;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Radian<T> Radian<T>::operator+(T const value)
+	inline constexpr Radian<T> Radian<T>::operator+(T const value)
 	{
 		return Radian<T>(m_angle + value);
 	}
 
 	template<math::math_type::NumericType T>
-	inline math::Radian<T> Radian<T>::operator+(math::Radian<T> const& radian)
+	inline constexpr math::Radian<T> Radian<T>::operator+(math::Radian<T> const& radian)
 	{
 		return Radian(m_angle + radian.m_angle);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Radian<T> Radian<T>::operator-(T const value)
+	inline constexpr Radian<T> Radian<T>::operator-(T const value)
 	{
 		return Radian<T>(m_angle - value);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Radian<T> Radian<T>::operator-(Radian<T> const& radian)
+	inline constexpr Radian<T> Radian<T>::operator-(Radian<T> const& radian)
 	{
 		return Radian<T>(m_angle - radian.m_angle);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Radian<T> Radian<T>::operator*(T const value)
+	inline constexpr Radian<T> Radian<T>::operator*(T const value)
 	{
 		return Radian<T>(m_angle * value);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Radian<T> Radian<T>::operator/(T const value)
+	inline constexpr Radian<T> Radian<T>::operator/(T const value)
 	{
 		_ASSERT(value != 0.0f);
 
@@ -125,7 +125,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Radian<T>& Radian<T>::operator+=(T const value)
+	inline constexpr Radian<T>& Radian<T>::operator+=(T const value)
 	{
 		m_angle += value;
 
@@ -133,7 +133,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Radian<T>& Radian<T>::operator+=(Radian<T> const& radian)
+	inline constexpr Radian<T>& Radian<T>::operator+=(Radian<T> const& radian)
 	{
 		m_angle += radian.m_angle;
 
@@ -141,7 +141,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Radian<T>& Radian<T>::operator-=(T const value)
+	inline constexpr Radian<T>& Radian<T>::operator-=(T const value)
 	{
 		m_angle -= value;
 
@@ -149,7 +149,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Radian<T>& Radian<T>::operator-=(Radian<T> const& radian)
+	inline constexpr Radian<T>& Radian<T>::operator-=(Radian<T> const& radian)
 	{
 		m_angle -= radian.m_angle;
 
@@ -157,13 +157,13 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Radian<T>::operator==(Radian const& radian) const noexcept
+	inline constexpr bool Radian<T>::operator==(Radian const& radian) const noexcept
 	{
 		return math::AlmostEqual(m_angle, radian.m_angle, (T) INNACURATE_EPSILON);
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Radian<T>::operator!=(Radian const& radian) const noexcept
+	inline constexpr bool Radian<T>::operator!=(Radian const& radian) const noexcept
 	{
 		return !math::AlmostEqual(m_angle, radian.m_angle);
 	}
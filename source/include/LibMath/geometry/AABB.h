@@ -0,0 +1,147 @@
+#pragma once
+
+#include "../VariableType.hpp"
+#include "../Arithmetic.h"
+#include "../vector/Vector3.h"
+
+/*
+*	------- AABB -------
+*	Axis aligned bounding box stored as its min & max corners.
+*
+*	Functions:
+*	- FromCenter	DONE
+*	- Min			DONE
+*	- Max			DONE
+*	- Center		DONE
+*	- Extents		DONE
+*	- Contains		DONE
+*	- Intersects	DONE
+*	- Extend		DONE
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class AABB
+	{
+	public:
+		constexpr					AABB(void) = default;
+		constexpr					AABB(Vector3<T> const& min, Vector3<T> const& max);
+
+									~AABB(void) = default;
+
+		static constexpr AABB<T>	FromCenter(Vector3<T> const& center, Vector3<T> const& extents);
+
+		constexpr Vector3<T> const&	Min(void) const noexcept;
+		constexpr Vector3<T> const&	Max(void) const noexcept;
+		constexpr Vector3<T>		Center(void) const;
+		constexpr Vector3<T>		Extents(void) const;
+
+		constexpr bool				Contains(Vector3<T> const& point) const;
+		constexpr bool				Intersects(AABB<T> const& box) const;
+
+		constexpr AABB<T>&			Extend(Vector3<T> const& point);
+		constexpr AABB<T>&			Extend(AABB<T> const& box);
+
+		constexpr bool				operator==(AABB<T> const& box) const;
+		constexpr bool				operator!=(AABB<T> const& box) const;
+
+	private:
+		Vector3<T>	m_min;
+		Vector3<T>	m_max;
+	};
+
+	template<math::math_type::NumericType T>
+	inline constexpr AABB<T>::AABB(Vector3<T> const& min, Vector3<T> const& max)
+		: m_min(min), m_max(max)
+	{
+		_ASSERT(min[0] <= max[0] && min[1] <= max[1] && min[2] <= max[2]);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AABB<T> AABB<T>::FromCenter(Vector3<T> const& center, Vector3<T> const& extents)
+	{
+		return AABB<T>(center - extents, center + extents);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> const& AABB<T>::Min(void) const noexcept
+	{
+		return m_min;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> const& AABB<T>::Max(void) const noexcept
+	{
+		return m_max;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> AABB<T>::Center(void) const
+	{
+		return (m_min + m_max) * static_cast<T>(0.5);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> AABB<T>::Extents(void) const
+	{
+		return (m_max - m_min) * static_cast<T>(0.5);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool AABB<T>::Contains(Vector3<T> const& point) const
+	{
+		return
+			point[0] >= m_min[0] && point[0] <= m_max[0] &&
+			point[1] >= m_min[1] && point[1] <= m_max[1] &&
+			point[2] >= m_min[2] && point[2] <= m_max[2];
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool AABB<T>::Intersects(AABB<T> const& box) const
+	{
+		// Touching boxes intersect
+		return
+			m_min[0] <= box.m_max[0] && m_max[0] >= box.m_min[0] &&
+			m_min[1] <= box.m_max[1] && m_max[1] >= box.m_min[1] &&
+			m_min[2] <= box.m_max[2] && m_max[2] >= box.m_min[2];
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AABB<T>& AABB<T>::Extend(Vector3<T> const& point)
+	{
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			m_min[i] = math::Min(m_min[i], point[i]);
+			m_max[i] = math::Max(m_max[i], point[i]);
+		}
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AABB<T>& AABB<T>::Extend(AABB<T> const& box)
+	{
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			m_min[i] = math::Min(m_min[i], box.m_min[i]);
+			m_max[i] = math::Max(m_max[i], box.m_max[i]);
+		}
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool AABB<T>::operator==(AABB<T> const& box) const
+	{
+		return m_min == box.m_min && m_max == box.m_max;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool AABB<T>::operator!=(AABB<T> const& box) const
+	{
+		return !(*this == box);
+	}
+}
+
+namespace LibMath = math;
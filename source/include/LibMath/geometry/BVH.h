@@ -0,0 +1,909 @@
+#pragma once
+
+#include "../VariableType.hpp"
+#include "../Arithmetic.h"
+#include "../Parallel.h"
+#include "../vector/Vector3.h"
+#include "AABB.h"
+#include "Ray.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/*
+*	------- BVH -------
+*	Bounding volume hierarchy over axis aligned boxes, primitive i is
+*	the box bounds[i] given to Build.
+*
+*	Build splits nodes with the surface area heuristic evaluated on
+*	up to 16 centroid bins per axis. The tree is built one depth at a time,
+*	the nodes of a depth are split in parallel & the primitives of the
+*	first wide nodes are binned across threads.
+*
+*	Nodes are stored breadth first in a flat array with siblings next
+*	to each other, a float node is 32 bytes (bounds, child or first
+*	primitive index & primitive count). Traversal uses a fixed stack,
+*	the nearest child is visited first & ray casts skip the nodes
+*	beyond the closest hit.
+*
+*	Refit updates the bounds of moved primitives & their ancestors
+*	without changing the tree, queries get slower as objects move far
+*	from their position at build time & the tree should be rebuilt.
+*
+*	Functions:
+*	- Build			DONE
+*	- Refit			DONE
+*	- Size			DONE
+*	- NodeCount		DONE
+*	- Depth			DONE
+*	- Bounds		DONE
+*	- Nodes			DONE
+*	- Primitives	DONE
+*	- Raycast		DONE
+*	- Query			DONE
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class BVH
+	{
+		static_assert(std::is_floating_point_v<T>, "BVH bounds need a floating point type");
+
+	public:
+		struct Node
+		{
+			T			m_min[3];
+			T			m_max[3];
+
+			// Index of the left child (the right child follows it) or of the first primitive in Primitives()
+			uint32_t	m_offset;
+
+			// Primitive count of a leaf, 0 for internal nodes
+			uint32_t	m_count;
+
+			constexpr bool				IsLeaf(void) const noexcept;
+		};
+
+		static constexpr uint32_t		BinCount = 16;
+		static constexpr uint32_t		MaxLeafSize = 8;
+
+		// Nodes deeper than this are split at the median, any path from the root then fits the traversal stack
+		static constexpr uint32_t		MaxSahDepth = 64;
+		static constexpr size_t			StackSize = 96;
+
+		// Primitives per thread when building & nodes per thread when refitting
+		static constexpr size_t			ParallelBuildSize = 16384;
+		static constexpr size_t			RefitBatchSize = 4096;
+
+										BVH(void) = default;
+										~BVH(void) = default;
+
+		void							Build(std::span<AABB<T> const> bounds);
+		void							Refit(std::span<AABB<T> const> bounds);
+		void							Refit(std::span<AABB<T> const> bounds, std::span<uint32_t const> moved);
+
+		size_t							Size(void) const noexcept;
+		size_t							NodeCount(void) const noexcept;
+		size_t							Depth(void) const noexcept;
+		AABB<T>							Bounds(void) const;
+
+		std::span<Node const>			Nodes(void) const noexcept;
+		std::span<uint32_t const>		Primitives(void) const noexcept;
+
+		bool							Raycast(Ray<T> const& ray, T& distance, uint32_t& primitive) const;
+
+		template<typename IntersectPrimitive>
+		bool							Raycast(Ray<T> const& ray, T& distance, uint32_t& primitive, IntersectPrimitive intersect) const;
+
+		template<typename Callback>
+		size_t							Query(AABB<T> const& box, Callback callback) const;
+
+	private:
+		static constexpr uint32_t		NoParent = UINT32_MAX;
+		static constexpr uint32_t		BinChunkSize = 4096;
+
+		struct Box
+		{
+			T			m_min[3] = { std::numeric_limits<T>::max(), std::numeric_limits<T>::max(), std::numeric_limits<T>::max() };
+			T			m_max[3] = { std::numeric_limits<T>::lowest(), std::numeric_limits<T>::lowest(), std::numeric_limits<T>::lowest() };
+
+			void		Extend(T const* point);
+			void		Extend(T const* min, T const* max);
+			void		Extend(Vector3<T> const& min, Vector3<T> const& max);
+			void		Extend(Box const& box);
+			T			HalfArea(void) const;
+		};
+
+		struct Bin
+		{
+			Box			m_bounds;
+			uint32_t	m_count = 0;
+		};
+
+		// Primitives are partitioned with their bounds, the build reads them in order
+		struct BuildPrimitive
+		{
+			T			m_min[3];
+			T			m_max[3];
+			T			m_centroid[3];
+			uint32_t	m_index;
+		};
+
+		struct BinSet
+		{
+			Bin			m_bins[3][BinCount];
+			uint32_t	m_binCount = BinCount;
+		};
+
+		struct BuildTask
+		{
+			uint32_t	m_node;
+			uint32_t	m_begin;
+			uint32_t	m_end;
+			uint32_t	m_depth;
+			Box			m_centroids;
+		};
+
+		struct BuildSplit
+		{
+			bool		m_leaf = true;
+			uint32_t	m_middle = 0;
+			Box			m_bounds[2];
+			Box			m_centroids[2];
+		};
+
+		BuildSplit						SplitNode(BuildTask const& task, bool parallelBinning);
+		void							MedianSplit(BuildTask const& task, int axis, BuildSplit& split);
+		void							BinPrimitives(BuildTask const& task, T const* scales, BinSet& bins, bool parallel) const;
+		void							ComputeBounds(uint32_t begin, uint32_t end, Box& bounds, Box& centroids) const;
+		void							ComputeCentroids(uint32_t begin, uint32_t end, Box& centroids) const;
+		uint32_t						AddNode(Box const& box, uint32_t parent);
+		bool							RefitNode(uint32_t index);
+
+		static uint32_t					BinIndex(T value, T min, T scale, uint32_t binCount) noexcept;
+		static bool						IntersectNode(Node const& node, T const* origin, T const* inverseDirection, T maxDistance, T& entry) noexcept;
+		static bool						OverlapNode(Node const& node, AABB<T> const& box) noexcept;
+
+		std::vector<Node>			m_nodes;
+		std::vector<uint32_t>		m_parents;
+		std::vector<uint32_t>		m_primitives;
+		std::vector<uint32_t>		m_leaves;
+		std::vector<AABB<T>>		m_bounds;
+
+		// First node of each depth, nodes of one depth are contiguous
+		std::vector<size_t>			m_levelOffsets;
+
+		// Build scratch, kept between builds to avoid reallocating
+		std::vector<BuildPrimitive>	m_buildPrimitives;
+	};
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool BVH<T>::Node::IsLeaf(void) const noexcept
+	{
+		return m_count != 0;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void BVH<T>::Build(std::span<AABB<T> const> bounds)
+	{
+		_ASSERT(bounds.size() < static_cast<size_t>(UINT32_MAX));
+
+		const uint32_t count = static_cast<uint32_t>(bounds.size());
+
+		m_nodes.clear();
+		m_parents.clear();
+		m_levelOffsets.clear();
+
+		m_bounds.assign(bounds.begin(), bounds.end());
+		m_primitives.resize(count);
+		m_leaves.resize(count);
+		m_buildPrimitives.resize(count);
+
+		if (count == 0)
+			return;
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			BuildPrimitive& primitive = m_buildPrimitives[i];
+
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				primitive.m_min[axis] = bounds[i].Min()[axis];
+				primitive.m_max[axis] = bounds[i].Max()[axis];
+				primitive.m_centroid[axis] = (primitive.m_min[axis] + primitive.m_max[axis]) * static_cast<T>(0.5);
+			}
+
+			primitive.m_index = i;
+		}
+
+		Box rootBounds;
+		BuildTask root = { 0, 0, count, 0, Box() };
+
+		ComputeBounds(0, count, rootBounds, root.m_centroids);
+
+		// A binary tree with at most count leaves
+		m_nodes.reserve(static_cast<size_t>(count) * 2);
+		m_parents.reserve(static_cast<size_t>(count) * 2);
+
+		AddNode(rootBounds, NoParent);
+
+		const size_t threadCount = ParallelThreadCount();
+
+		std::vector<BuildTask> tasks = { root };
+		std::vector<BuildTask> nextTasks;
+		std::vector<BuildSplit> splits;
+
+		while (!tasks.empty())
+		{
+			m_levelOffsets.push_back(tasks.front().m_node);
+			splits.resize(tasks.size());
+
+			if (tasks.size() < threadCount)
+			{
+				// Fewer nodes than threads, bin the primitives of each node in parallel instead
+				for (size_t i = 0; i < tasks.size(); ++i)
+					splits[i] = SplitNode(tasks[i], true);
+			}
+			else
+			{
+				// Nodes own disjoint primitive ranges, each one is partitioned independently
+				size_t levelPrimitives = 0;
+
+				for (BuildTask const& task : tasks)
+					levelPrimitives += task.m_end - task.m_begin;
+
+				const size_t minBatchSize = std::max<size_t>(tasks.size() * ParallelBuildSize / levelPrimitives, 1);
+
+				ParallelFor(tasks.size(), [&](size_t first, size_t last)
+				{
+					for (size_t i = first; i < last; ++i)
+						splits[i] = SplitNode(tasks[i], false);
+				}, minBatchSize);
+			}
+
+			// Children are added in task order, the next depth is contiguous & the layout does not depend on threads
+			nextTasks.clear();
+
+			for (size_t i = 0; i < tasks.size(); ++i)
+			{
+				BuildTask const& task = tasks[i];
+				BuildSplit const& split = splits[i];
+
+				if (split.m_leaf)
+				{
+					m_nodes[task.m_node].m_offset = task.m_begin;
+					m_nodes[task.m_node].m_count = task.m_end - task.m_begin;
+
+					for (uint32_t i = task.m_begin; i < task.m_end; ++i)
+					{
+						m_primitives[i] = m_buildPrimitives[i].m_index;
+						m_leaves[m_primitives[i]] = task.m_node;
+					}
+
+					continue;
+				}
+
+				const uint32_t left = static_cast<uint32_t>(m_nodes.size());
+
+				m_nodes[task.m_node].m_offset = left;
+				m_nodes[task.m_node].m_count = 0;
+
+				AddNode(split.m_bounds[0], task.m_node);
+				AddNode(split.m_bounds[1], task.m_node);
+
+				nextTasks.push_back({ left, task.m_begin, split.m_middle, task.m_depth + 1, split.m_centroids[0] });
+				nextTasks.push_back({ left + 1, split.m_middle, task.m_end, task.m_depth + 1, split.m_centroids[1] });
+			}
+
+			tasks.swap(nextTasks);
+		}
+
+		m_levelOffsets.push_back(m_nodes.size());
+	}
+
+	template<math::math_type::NumericType T>
+	inline void BVH<T>::Refit(std::span<AABB<T> const> bounds)
+	{
+		_ASSERT(bounds.size() == Size());
+
+		std::copy(bounds.begin(), bounds.end(), m_bounds.begin());
+
+		// Children are one depth below their parent, refit the deepest nodes first
+		for (size_t depth = Depth(); depth-- > 0;)
+		{
+			const size_t begin = m_levelOffsets[depth];
+			const size_t count = m_levelOffsets[depth + 1] - begin;
+
+			ParallelFor(count, [&](size_t first, size_t last)
+			{
+				for (size_t i = first; i < last; ++i)
+					RefitNode(static_cast<uint32_t>(begin + i));
+			}, RefitBatchSize);
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	inline void BVH<T>::Refit(std::span<AABB<T> const> bounds, std::span<uint32_t const> moved)
+	{
+		_ASSERT(bounds.size() == Size());
+
+		for (uint32_t primitive : moved)
+		{
+			_ASSERT(primitive < Size());
+
+			m_bounds[primitive] = bounds[primitive];
+		}
+
+		// Walk up from each leaf until a node keeps its bounds, its ancestors are then up to date
+		for (uint32_t primitive : moved)
+		{
+			for (uint32_t node = m_leaves[primitive]; node != NoParent && RefitNode(node); node = m_parents[node])
+				;
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t BVH<T>::Size(void) const noexcept
+	{
+		return m_primitives.size();
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t BVH<T>::NodeCount(void) const noexcept
+	{
+		return m_nodes.size();
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t BVH<T>::Depth(void) const noexcept
+	{
+		return m_levelOffsets.empty() ? 0 : m_levelOffsets.size() - 1;
+	}
+
+	template<math::math_type::NumericType T>
+	inline AABB<T> BVH<T>::Bounds(void) const
+	{
+		_ASSERT(!m_nodes.empty());
+
+		Node const& root = m_nodes[0];
+
+		return AABB<T>(Vector3<T>(root.m_min[0], root.m_min[1], root.m_min[2]), Vector3<T>(root.m_max[0], root.m_max[1], root.m_max[2]));
+	}
+
+	template<math::math_type::NumericType T>
+	inline std::span<typename BVH<T>::Node const> BVH<T>::Nodes(void) const noexcept
+	{
+		return std::span<Node const>(m_nodes.data(), m_nodes.size());
+	}
+
+	template<math::math_type::NumericType T>
+	inline std::span<uint32_t const> BVH<T>::Primitives(void) const noexcept
+	{
+		return std::span<uint32_t const>(m_primitives.data(), m_primitives.size());
+	}
+
+	template<math::math_type::NumericType T>
+	inline bool BVH<T>::Raycast(Ray<T> const& ray, T& distance, uint32_t& primitive) const
+	{
+		return Raycast(ray, distance, primitive, [&](uint32_t index, T& hitDistance)
+		{
+			return ray.Intersect(m_bounds[index], hitDistance);
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	template<typename IntersectPrimitive>
+	inline bool BVH<T>::Raycast(Ray<T> const& ray, T& distance, uint32_t& primitive, IntersectPrimitive intersect) const
+	{
+		T origin[3];
+		T inverseDirection[3];
+
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			origin[i] = ray.Origin()[i];
+			inverseDirection[i] = static_cast<T>(1) / ray.Direction()[i];
+		}
+
+		T closest = std::numeric_limits<T>::infinity();
+		T entry = static_cast<T>(0);
+
+		if (m_nodes.empty() || !IntersectNode(m_nodes[0], origin, inverseDirection, closest, entry))
+			return false;
+
+		uint32_t stack[StackSize];
+		T stackEntries[StackSize];
+		size_t stackSize = 0;
+
+		bool hit = false;
+		uint32_t node = 0;
+
+		for (;;)
+		{
+			Node const& current = m_nodes[node];
+
+			if (current.IsLeaf())
+			{
+				for (uint32_t i = current.m_offset; i < current.m_offset + current.m_count; ++i)
+				{
+					T hitDistance;
+
+					if (intersect(m_primitives[i], hitDistance) && hitDistance < closest)
+					{
+						closest = hitDistance;
+						primitive = m_primitives[i];
+						hit = true;
+					}
+				}
+			}
+			else
+			{
+				uint32_t nearChild = current.m_offset;
+				uint32_t farChild = current.m_offset + 1;
+				T nearEntry = static_cast<T>(0);
+				T farEntry = static_cast<T>(0);
+
+				const bool hitNear = IntersectNode(m_nodes[nearChild], origin, inverseDirection, closest, nearEntry);
+				const bool hitFar = IntersectNode(m_nodes[farChild], origin, inverseDirection, closest, farEntry);
+
+				if (hitNear && hitFar)
+				{
+					if (farEntry < nearEntry)
+					{
+						std::swap(nearChild, farChild);
+						std::swap(nearEntry, farEntry);
+					}
+
+					_ASSERT(stackSize < StackSize);
+
+					stack[stackSize] = farChild;
+					stackEntries[stackSize++] = farEntry;
+
+					node = nearChild;
+					continue;
+				}
+
+				if (hitNear || hitFar)
+				{
+					node = hitNear ? nearChild : farChild;
+					continue;
+				}
+			}
+
+			// Next node still closer than the closest hit
+			do
+			{
+				if (stackSize == 0)
+				{
+					if (hit)
+						distance = closest;
+
+					return hit;
+				}
+			} while (stackEntries[--stackSize] > closest);
+
+			node = stack[stackSize];
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	template<typename Callback>
+	inline size_t BVH<T>::Query(AABB<T> const& box, Callback callback) const
+	{
+		if (m_nodes.empty() || !OverlapNode(m_nodes[0], box))
+			return 0;
+
+		uint32_t stack[StackSize];
+		size_t stackSize = 0;
+		size_t overlapCount = 0;
+		uint32_t node = 0;
+
+		for (;;)
+		{
+			Node const& current = m_nodes[node];
+
+			if (current.IsLeaf())
+			{
+				for (uint32_t i = current.m_offset; i < current.m_offset + current.m_count; ++i)
+				{
+					if (m_bounds[m_primitives[i]].Intersects(box))
+					{
+						callback(m_primitives[i]);
+						++overlapCount;
+					}
+				}
+			}
+			else
+			{
+				const bool overlapLeft = OverlapNode(m_nodes[current.m_offset], box);
+				const bool overlapRight = OverlapNode(m_nodes[current.m_offset + 1], box);
+
+				if (overlapLeft && overlapRight)
+				{
+					_ASSERT(stackSize < StackSize);
+
+					stack[stackSize++] = current.m_offset + 1;
+					node = current.m_offset;
+					continue;
+				}
+
+				if (overlapLeft || overlapRight)
+				{
+					node = overlapLeft ? current.m_offset : current.m_offset + 1;
+					continue;
+				}
+			}
+
+			if (stackSize == 0)
+				return overlapCount;
+
+			node = stack[--stackSize];
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	inline typename BVH<T>::BuildSplit BVH<T>::SplitNode(BuildTask const& task, bool parallelBinning)
+	{
+		BuildSplit split;
+
+		const uint32_t count = task.m_end - task.m_begin;
+
+		if (count == 1)
+			return split;
+
+		const T centroidExtent[3] =
+		{
+			task.m_centroids.m_max[0] - task.m_centroids.m_min[0],
+			task.m_centroids.m_max[1] - task.m_centroids.m_min[1],
+			task.m_centroids.m_max[2] - task.m_centroids.m_min[2]
+		};
+
+		const int widestAxis = (centroidExtent[0] >= centroidExtent[1]) ? ((centroidExtent[0] >= centroidExtent[2]) ? 0 : 2) : ((centroidExtent[1] >= centroidExtent[2]) ? 1 : 2);
+
+		// All centroids at one point or too deep for the traversal stack
+		if (centroidExtent[widestAxis] <= static_cast<T>(0) || task.m_depth >= MaxSahDepth)
+		{
+			if (count > MaxLeafSize)
+				MedianSplit(task, (centroidExtent[widestAxis] <= static_cast<T>(0)) ? -1 : widestAxis, split);
+
+			return split;
+		}
+
+		// Small nodes use one bin per primitive, most nodes are small & evaluating 16 bins dominates their cost
+		BinSet bins;
+		bins.m_binCount = std::min(BinCount, count);
+
+		const uint32_t binCount = bins.m_binCount;
+		T scales[3];
+
+		for (int axis = 0; axis < 3; ++axis)
+			scales[axis] = (centroidExtent[axis] > static_cast<T>(0)) ? static_cast<T>(binCount) / centroidExtent[axis] : static_cast<T>(0);
+
+		BinPrimitives(task, scales, bins, parallelBinning);
+
+		// Cost of a split relative to the node area: 1 (both child boxes) + area weighted primitive counts
+		T bestCost = std::numeric_limits<T>::max();
+		int bestAxis = -1;
+		uint32_t bestBin = 0;
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			if (scales[axis] == static_cast<T>(0))
+				continue;
+
+			Bin const (&axisBins)[BinCount] = bins.m_bins[axis];
+
+			T leftCosts[BinCount - 1];
+			uint32_t leftCounts[BinCount - 1];
+
+			Box left;
+			uint32_t leftCount = 0;
+
+			for (uint32_t bin = 0; bin < binCount - 1; ++bin)
+			{
+				left.Extend(axisBins[bin].m_bounds);
+				leftCount += axisBins[bin].m_count;
+
+				leftCounts[bin] = leftCount;
+				leftCosts[bin] = (leftCount != 0) ? left.HalfArea() * static_cast<T>(leftCount) : static_cast<T>(0);
+			}
+
+			Box right;
+			uint32_t rightCount = 0;
+
+			for (uint32_t bin = binCount - 1; bin > 0; --bin)
+			{
+				right.Extend(axisBins[bin].m_bounds);
+				rightCount += axisBins[bin].m_count;
+
+				if (rightCount == 0 || leftCounts[bin - 1] == 0)
+					continue;
+
+				const T cost = leftCosts[bin - 1] + right.HalfArea() * static_cast<T>(rightCount);
+
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = axis;
+					bestBin = bin;
+				}
+			}
+		}
+
+		if (bestAxis < 0)
+		{
+			if (count > MaxLeafSize)
+				MedianSplit(task, widestAxis, split);
+
+			return split;
+		}
+
+		Box nodeBounds;
+		nodeBounds.Extend(m_nodes[task.m_node].m_min, m_nodes[task.m_node].m_max);
+
+		const T nodeArea = nodeBounds.HalfArea();
+
+		if (count <= MaxLeafSize && nodeArea * static_cast<T>(count) <= nodeArea + bestCost)
+			return split;
+
+		// Same bin index as BinPrimitives, the partition matches the bin counts
+		const T axisMin = task.m_centroids.m_min[bestAxis];
+		const T axisScale = scales[bestAxis];
+
+		auto middle = std::partition(m_buildPrimitives.begin() + task.m_begin, m_buildPrimitives.begin() + task.m_end, [&](BuildPrimitive const& primitive)
+		{
+			return BinIndex(primitive.m_centroid[bestAxis], axisMin, axisScale, binCount) < bestBin;
+		});
+
+		split.m_leaf = false;
+		split.m_middle = static_cast<uint32_t>(middle - m_buildPrimitives.begin());
+
+		for (uint32_t bin = 0; bin < binCount; ++bin)
+			split.m_bounds[(bin < bestBin) ? 0 : 1].Extend(bins.m_bins[bestAxis][bin].m_bounds);
+
+		ComputeCentroids(task.m_begin, split.m_middle, split.m_centroids[0]);
+		ComputeCentroids(split.m_middle, task.m_end, split.m_centroids[1]);
+
+		return split;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void BVH<T>::MedianSplit(BuildTask const& task, int axis, BuildSplit& split)
+	{
+		// Axis -1 keeps the current order, the primitives cannot be told apart by their centroids
+		const uint32_t middle = task.m_begin + (task.m_end - task.m_begin) / 2;
+
+		if (axis >= 0)
+		{
+			std::nth_element(m_buildPrimitives.begin() + task.m_begin, m_buildPrimitives.begin() + middle, m_buildPrimitives.begin() + task.m_end, [axis](BuildPrimitive const& a, BuildPrimitive const& b)
+			{
+				return a.m_centroid[axis] < b.m_centroid[axis];
+			});
+		}
+
+		split.m_leaf = false;
+		split.m_middle = middle;
+
+		ComputeBounds(task.m_begin, middle, split.m_bounds[0], split.m_centroids[0]);
+		ComputeBounds(middle, task.m_end, split.m_bounds[1], split.m_centroids[1]);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void BVH<T>::BinPrimitives(BuildTask const& task, T const* scales, BinSet& bins, bool parallel) const
+	{
+		auto binRange = [&](uint32_t begin, uint32_t end, BinSet& output)
+		{
+			for (uint32_t i = begin; i < end; ++i)
+			{
+				BuildPrimitive const& primitive = m_buildPrimitives[i];
+
+				for (int axis = 0; axis < 3; ++axis)
+				{
+					Bin& bin = output.m_bins[axis][BinIndex(primitive.m_centroid[axis], task.m_centroids.m_min[axis], scales[axis], bins.m_binCount)];
+
+					bin.m_bounds.Extend(primitive.m_min, primitive.m_max);
+					++bin.m_count;
+				}
+			}
+		};
+
+		const uint32_t count = task.m_end - task.m_begin;
+
+		if (!parallel || count < ParallelBuildSize)
+		{
+			binRange(task.m_begin, task.m_end, bins);
+			return;
+		}
+
+		// One bin set per chunk, merged once every thread is done
+		const uint32_t chunkCount = (count + BinChunkSize - 1) / BinChunkSize;
+
+		std::vector<BinSet> chunkBins(chunkCount);
+
+		ParallelFor(chunkCount, [&](size_t first, size_t last)
+		{
+			for (size_t chunk = first; chunk < last; ++chunk)
+			{
+				const uint32_t begin = task.m_begin + static_cast<uint32_t>(chunk) * BinChunkSize;
+
+				binRange(begin, std::min(begin + BinChunkSize, task.m_end), chunkBins[chunk]);
+			}
+		}, ParallelBuildSize / BinChunkSize);
+
+		for (BinSet const& chunk : chunkBins)
+		{
+			for (int axis = 0; axis < 3; ++axis)
+			{
+				for (uint32_t bin = 0; bin < bins.m_binCount; ++bin)
+				{
+					bins.m_bins[axis][bin].m_bounds.Extend(chunk.m_bins[axis][bin].m_bounds);
+					bins.m_bins[axis][bin].m_count += chunk.m_bins[axis][bin].m_count;
+				}
+			}
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	inline void BVH<T>::ComputeBounds(uint32_t begin, uint32_t end, Box& bounds, Box& centroids) const
+	{
+		for (uint32_t i = begin; i < end; ++i)
+		{
+			bounds.Extend(m_buildPrimitives[i].m_min, m_buildPrimitives[i].m_max);
+			centroids.Extend(m_buildPrimitives[i].m_centroid);
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	inline void BVH<T>::ComputeCentroids(uint32_t begin, uint32_t end, Box& centroids) const
+	{
+		for (uint32_t i = begin; i < end; ++i)
+			centroids.Extend(m_buildPrimitives[i].m_centroid);
+	}
+
+	template<math::math_type::NumericType T>
+	inline uint32_t BVH<T>::AddNode(Box const& box, uint32_t parent)
+	{
+		Node node;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			node.m_min[i] = box.m_min[i];
+			node.m_max[i] = box.m_max[i];
+		}
+
+		node.m_offset = 0;
+		node.m_count = 0;
+
+		m_nodes.push_back(node);
+		m_parents.push_back(parent);
+
+		return static_cast<uint32_t>(m_nodes.size() - 1);
+	}
+
+	template<math::math_type::NumericType T>
+	inline bool BVH<T>::RefitNode(uint32_t index)
+	{
+		Node& node = m_nodes[index];
+		Box box;
+
+		if (node.IsLeaf())
+		{
+			for (uint32_t i = node.m_offset; i < node.m_offset + node.m_count; ++i)
+				box.Extend(m_bounds[m_primitives[i]].Min(), m_bounds[m_primitives[i]].Max());
+		}
+		else
+		{
+			for (uint32_t child = node.m_offset; child < node.m_offset + 2; ++child)
+				box.Extend(m_nodes[child].m_min, m_nodes[child].m_max);
+		}
+
+		bool changed = false;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			changed |= (node.m_min[i] != box.m_min[i]) || (node.m_max[i] != box.m_max[i]);
+
+			node.m_min[i] = box.m_min[i];
+			node.m_max[i] = box.m_max[i];
+		}
+
+		return changed;
+	}
+
+	template<math::math_type::NumericType T>
+	inline uint32_t BVH<T>::BinIndex(T value, T min, T scale, uint32_t binCount) noexcept
+	{
+		const uint32_t bin = static_cast<uint32_t>((value - min) * scale);
+
+		return (bin < binCount) ? bin : binCount - 1;
+	}
+
+	template<math::math_type::NumericType T>
+	inline bool BVH<T>::IntersectNode(Node const& node, T const* origin, T const* inverseDirection, T maxDistance, T& entry) noexcept
+	{
+		// Slab test of Ray::Intersect with the inverse direction computed once per ray
+		T slabNear[3];
+		T slabFar[3];
+
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			const T t1 = (node.m_min[i] - origin[i]) * inverseDirection[i];
+			const T t2 = (node.m_max[i] - origin[i]) * inverseDirection[i];
+
+			slabNear[i] = math::Min(t1, t2);
+			slabFar[i] = math::Max(t1, t2);
+		}
+
+		const T tNear = math::Max(math::Max(math::Max(slabNear[0], slabNear[1]), slabNear[2]), static_cast<T>(0));
+		const T tFar = math::Min(math::Min(slabFar[0], slabFar[1]), slabFar[2]);
+
+		if (!(tNear <= tFar) || tNear > maxDistance)
+			return false;
+
+		entry = tNear;
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline bool BVH<T>::OverlapNode(Node const& node, AABB<T> const& box) noexcept
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			if (node.m_min[i] > box.Max()[i] || node.m_max[i] < box.Min()[i])
+				return false;
+		}
+
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void BVH<T>::Box::Extend(T const* point)
+	{
+		Extend(point, point);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void BVH<T>::Box::Extend(T const* min, T const* max)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			m_min[i] = math::Min(m_min[i], min[i]);
+			m_max[i] = math::Max(m_max[i], max[i]);
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	inline void BVH<T>::Box::Extend(Vector3<T> const& min, Vector3<T> const& max)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			m_min[i] = math::Min(m_min[i], min[i]);
+			m_max[i] = math::Max(m_max[i], max[i]);
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	inline void BVH<T>::Box::Extend(Box const& box)
+	{
+		Extend(box.m_min, box.m_max);
+	}
+
+	template<math::math_type::NumericType T>
+	inline T BVH<T>::Box::HalfArea(void) const
+	{
+		const T sizeX = m_max[0] - m_min[0];
+		const T sizeY = m_max[1] - m_min[1];
+		const T sizeZ = m_max[2] - m_min[2];
+
+		return sizeX * sizeY + sizeY * sizeZ + sizeZ * sizeX;
+	}
+
+	static_assert(sizeof(BVH<float>::Node) == 32, "Float nodes should stay 32 bytes, two siblings per cache line");
+}
+
+namespace LibMath = math;
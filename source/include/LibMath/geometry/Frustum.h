@@ -0,0 +1,296 @@
+#pragma once
+
+#include "../VariableType.hpp"
+#include "../Arithmetic.h"
+#include "../Parallel.h"
+#include "../simd/Simd.h"
+#include "../vector/Vector3.h"
+#include "../vector/Vector3Stream.h"
+#include "../matrix/Matrix4.h"
+#include "AABB.h"
+#include "Plane.h"
+#include "Sphere.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/*
+*	------- Frustum -------
+*	6 normalized planes extracted from a projection * view matrix
+*	(Gribb & Hartmann), normals point inside the frustum. Clip space
+*	follows Ortho: x, y & z in [-w, w].
+*
+*	Boxes are axis aligned & given as center + half extents. Objects
+*	are culled when they are fully behind one plane, objects near a
+*	corner of the frustum may be kept (conservative).
+*
+*	Batch culling reads structure of arrays bounds & writes the index
+*	of every visible object in increasing order. Float streams with
+*	contiguous lanes test 4 (SSE2) or 8 (AVX) objects per iteration,
+*	large batches are split across threads.
+*
+*	Functions:
+*	- GetPlane			DONE
+*	- Contains			DONE
+*	- IsSphereVisible	DONE
+*	- IsBoxVisible		DONE
+*	- IsVisible			DONE
+*	- CullSpheres		DONE
+*	- CullBoxes			DONE
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class Frustum
+	{
+	public:
+		enum Side
+		{
+			Left = 0,
+			Right,
+			Bottom,
+			Top,
+			Near,
+			Far,
+			SideCount
+		};
+
+		// Objects per culling task, tasks are compacted into the visible list once all threads are done
+		static constexpr size_t		CullBatchSize = 4096;
+
+		constexpr					Frustum(void) = default;
+		constexpr					Frustum(Matrix4<T> const& viewProjection);
+
+									~Frustum(void) = default;
+
+		constexpr Plane<T> const&	GetPlane(Side side) const;
+
+		constexpr bool				Contains(Vector3<T> const& point) const;
+		constexpr bool				IsSphereVisible(Vector3<T> const& center, T radius) const;
+		constexpr bool				IsBoxVisible(Vector3<T> const& center, Vector3<T> const& extents) const;
+		constexpr bool				IsVisible(Sphere<T> const& sphere) const;
+		constexpr bool				IsVisible(AABB<T> const& box) const;
+
+		size_t						CullSpheres(Vector3StreamView<T> const& centers, std::span<T const> radii, std::span<uint32_t> visible) const;
+		size_t						CullBoxes(Vector3StreamView<T> const& centers, Vector3StreamView<T> const& extents, std::span<uint32_t> visible) const;
+
+	private:
+		constexpr void				StorePlanes(T* planes) const;
+
+		template<typename CullRange>
+		static size_t				CullBatches(size_t count, std::span<uint32_t> visible, CullRange cullRange);
+
+		Plane<T>	m_planes[SideCount];
+	};
+
+	template<math::math_type::NumericType T>
+	inline constexpr Frustum<T>::Frustum(Matrix4<T> const& viewProjection)
+	{
+		// Column major, row i of the matrix is m_matrix[0..3][i]
+		T const (&matrix)[4][4] = viewProjection.m_matrix;
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			m_planes[axis * 2] = Plane<T>(
+				matrix[0][3] + matrix[0][axis],
+				matrix[1][3] + matrix[1][axis],
+				matrix[2][3] + matrix[2][axis],
+				matrix[3][3] + matrix[3][axis]
+			);
+
+			m_planes[axis * 2 + 1] = Plane<T>(
+				matrix[0][3] - matrix[0][axis],
+				matrix[1][3] - matrix[1][axis],
+				matrix[2][3] - matrix[2][axis],
+				matrix[3][3] - matrix[3][axis]
+			);
+		}
+
+		for (Plane<T>& plane : m_planes)
+			plane.Normalize();
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Plane<T> const& Frustum<T>::GetPlane(Side side) const
+	{
+		_ASSERT(side < SideCount);
+
+		return m_planes[side];
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Frustum<T>::Contains(Vector3<T> const& point) const
+	{
+		for (Plane<T> const& plane : m_planes)
+		{
+			if (plane.SignedDistance(point) < static_cast<T>(0))
+				return false;
+		}
+
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Frustum<T>::IsSphereVisible(Vector3<T> const& center, T radius) const
+	{
+		for (Plane<T> const& plane : m_planes)
+		{
+			if (plane.SignedDistance(center) < -radius)
+				return false;
+		}
+
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Frustum<T>::IsBoxVisible(Vector3<T> const& center, Vector3<T> const& extents) const
+	{
+		for (Plane<T> const& plane : m_planes)
+		{
+			// Projected half size of the box onto the plane normal
+			Vector3<T> const& normal = plane.Normal();
+			const T radius = (math::Abs(normal[0]) * extents[0]) + (math::Abs(normal[1]) * extents[1]) + (math::Abs(normal[2]) * extents[2]);
+
+			if (plane.SignedDistance(center) < -radius)
+				return false;
+		}
+
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Frustum<T>::IsVisible(Sphere<T> const& sphere) const
+	{
+		return IsSphereVisible(sphere.Center(), sphere.Radius());
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Frustum<T>::IsVisible(AABB<T> const& box) const
+	{
+		return IsBoxVisible(box.Center(), box.Extents());
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t Frustum<T>::CullSpheres(Vector3StreamView<T> const& centers, std::span<T const> radii, std::span<uint32_t> visible) const
+	{
+		_ASSERT(radii.size() == centers.Size() && visible.size() >= centers.Size());
+
+		return CullBatches(centers.Size(), visible, [&](size_t begin, size_t end, uint32_t* output) -> size_t
+		{
+#if LIBMATH_SIMD_SSE2
+			if constexpr (std::is_same_v<T, float>)
+			{
+				if (centers.IsContiguous())
+				{
+					float planes[SideCount * 4];
+					StorePlanes(planes);
+
+					return simd::FrustumCullSpheres(output, centers.X() + begin, centers.Y() + begin, centers.Z() + begin, radii.data() + begin, end - begin, planes, static_cast<uint32_t>(begin));
+				}
+			}
+#endif
+
+			size_t visibleCount = 0;
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				if (IsSphereVisible(centers.Get(i), radii[i]))
+					output[visibleCount++] = static_cast<uint32_t>(i);
+			}
+
+			return visibleCount;
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t Frustum<T>::CullBoxes(Vector3StreamView<T> const& centers, Vector3StreamView<T> const& extents, std::span<uint32_t> visible) const
+	{
+		_ASSERT(extents.Size() == centers.Size() && visible.size() >= centers.Size());
+
+		return CullBatches(centers.Size(), visible, [&](size_t begin, size_t end, uint32_t* output) -> size_t
+		{
+#if LIBMATH_SIMD_SSE2
+			if constexpr (std::is_same_v<T, float>)
+			{
+				if (centers.IsContiguous() && extents.IsContiguous())
+				{
+					float planes[SideCount * 4];
+					StorePlanes(planes);
+
+					return simd::FrustumCullBoxes(
+						output,
+						centers.X() + begin, centers.Y() + begin, centers.Z() + begin,
+						extents.X() + begin, extents.Y() + begin, extents.Z() + begin,
+						end - begin, planes, static_cast<uint32_t>(begin)
+					);
+				}
+			}
+#endif
+
+			size_t visibleCount = 0;
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				if (IsBoxVisible(centers.Get(i), extents.Get(i)))
+					output[visibleCount++] = static_cast<uint32_t>(i);
+			}
+
+			return visibleCount;
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr void Frustum<T>::StorePlanes(T* planes) const
+	{
+		// (normal x, normal y, normal z, distance) per side, the layout of the culling kernels
+		for (int side = 0; side < SideCount; ++side)
+		{
+			planes[side * 4] = m_planes[side].Normal()[0];
+			planes[side * 4 + 1] = m_planes[side].Normal()[1];
+			planes[side * 4 + 2] = m_planes[side].Normal()[2];
+			planes[side * 4 + 3] = m_planes[side].Distance();
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	template<typename CullRange>
+	inline size_t Frustum<T>::CullBatches(size_t count, std::span<uint32_t> visible, CullRange cullRange)
+	{
+		_ASSERT(count <= static_cast<size_t>(UINT32_MAX));
+
+		// Each batch writes its visible indices at its own offset, the lists are then moved down in order
+		const size_t batchCount = (count + CullBatchSize - 1) / CullBatchSize;
+
+		std::vector<size_t> visibleCounts(batchCount);
+
+		ParallelFor(batchCount, [&](size_t first, size_t last)
+		{
+			for (size_t batch = first; batch < last; ++batch)
+			{
+				const size_t begin = batch * CullBatchSize;
+				const size_t end = std::min(begin + CullBatchSize, count);
+
+				visibleCounts[batch] = cullRange(begin, end, visible.data() + begin);
+			}
+		}, PARALLEL_MIN_BATCH_SIZE / CullBatchSize);
+
+		size_t visibleCount = 0;
+
+		for (size_t batch = 0; batch < batchCount; ++batch)
+		{
+			uint32_t* batchBegin = visible.data() + batch * CullBatchSize;
+
+			std::copy(batchBegin, batchBegin + visibleCounts[batch], visible.data() + visibleCount);
+			visibleCount += visibleCounts[batch];
+		}
+
+		return visibleCount;
+	}
+}
+
+namespace LibMath = math;
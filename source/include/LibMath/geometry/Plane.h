@@ -0,0 +1,130 @@
+#pragma once
+
+#include "../VariableType.hpp"
+#include "../Arithmetic.h"
+#include "../vector/Vector3.h"
+
+/*
+*	------- Plane -------
+*	Points p on the plane satisfy dot(normal, p) + distance = 0,
+*	the normal points towards the positive half space.
+*
+*	Functions:
+*	- Normal			DONE
+*	- Distance			DONE
+*	- Normalize			DONE
+*	- SignedDistance	DONE
+*	- Project			DONE
+*
+*	Operators:
+*	- Compare		(==)	DONE
+*	- InvCompare	(!=)	DONE
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class Plane
+	{
+	public:
+		constexpr					Plane(void);
+		constexpr					Plane(Vector3<T> const& normal, T distance);
+		constexpr					Plane(Vector3<T> const& normal, Vector3<T> const& point);
+		constexpr					Plane(T a, T b, T c, T d);
+
+									~Plane(void) = default;
+
+		constexpr Vector3<T> const&	Normal(void) const noexcept;
+		constexpr T					Distance(void) const noexcept;
+
+		constexpr Plane<T>&			Normalize(void);
+		constexpr T					SignedDistance(Vector3<T> const& point) const;
+		constexpr Vector3<T>		Project(Vector3<T> const& point) const;
+
+		constexpr bool				operator==(Plane<T> const& plane) const;
+		constexpr bool				operator!=(Plane<T> const& plane) const;
+
+	private:
+		Vector3<T>	m_normal;
+		T			m_distance;
+	};
+
+	template<math::math_type::NumericType T>
+	inline constexpr Plane<T>::Plane(void)
+		: m_normal(static_cast<T>(0), static_cast<T>(1), static_cast<T>(0)), m_distance(static_cast<T>(0))
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Plane<T>::Plane(Vector3<T> const& normal, T distance)
+		: m_normal(normal), m_distance(distance)
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Plane<T>::Plane(Vector3<T> const& normal, Vector3<T> const& point)
+		: m_normal(normal), m_distance(-normal.Dot(point))
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Plane<T>::Plane(T a, T b, T c, T d)
+		: m_normal(a, b, c), m_distance(d)
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> const& Plane<T>::Normal(void) const noexcept
+	{
+		return m_normal;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr T Plane<T>::Distance(void) const noexcept
+	{
+		return m_distance;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Plane<T>& Plane<T>::Normalize(void)
+	{
+		// Scale the whole equation so signed distances are in world units
+		const T magnitude = m_normal.Magnitude();
+
+		_ASSERT(magnitude != static_cast<T>(0));
+
+		const T inverseMagnitude = static_cast<T>(1) / magnitude;
+
+		m_normal = m_normal * inverseMagnitude;
+		m_distance *= inverseMagnitude;
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr T Plane<T>::SignedDistance(Vector3<T> const& point) const
+	{
+		return m_normal.Dot(point) + m_distance;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> Plane<T>::Project(Vector3<T> const& point) const
+	{
+		// Unit normal only
+		return point - m_normal * SignedDistance(point);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Plane<T>::operator==(Plane<T> const& plane) const
+	{
+		return m_normal == plane.m_normal && m_distance == plane.m_distance;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Plane<T>::operator!=(Plane<T> const& plane) const
+	{
+		return !(*this == plane);
+	}
+}
+
+namespace LibMath = math;
@@ -0,0 +1,388 @@
+#pragma once
+
+#include "../VariableType.hpp"
+#include "../Arithmetic.h"
+#include "../Parallel.h"
+#include "../simd/Simd.h"
+#include "../vector/Vector3.h"
+#include "../vector/Vector3Stream.h"
+#include "AABB.h"
+#include "Plane.h"
+#include "Sphere.h"
+#include "Triangle.h"
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+/*
+*	------- Ray -------
+*	origin + direction * t for t >= 0, the direction does not need to
+*	be normalized, distances are in units of its length.
+*
+*	Intersect returns the smallest t where the ray enters the shape,
+*	0 when the origin is inside a box or a sphere. Boxes use the slab
+*	method, triangles use Moller-Trumbore & are double sided.
+*
+*	Batch functions intersect one ray with N shapes stored as
+*	structure of arrays, distances are infinity for missed shapes.
+*	Float streams with contiguous lanes test 4 (SSE2) or 8 (AVX)
+*	shapes per iteration with the operations of the single shape
+*	functions (identical results), large batches are split across
+*	threads.
+*
+*	Functions:
+*	- Origin				DONE
+*	- Direction				DONE
+*	- PointAt				DONE
+*	- Intersect				DONE
+*	- IntersectBoxes		DONE
+*	- IntersectSpheres		DONE
+*	- IntersectPlanes		DONE
+*	- IntersectTriangles	DONE
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class Ray
+	{
+	public:
+		constexpr					Ray(void);
+		constexpr					Ray(Vector3<T> const& origin, Vector3<T> const& direction);
+
+									~Ray(void) = default;
+
+		constexpr Vector3<T> const&	Origin(void) const noexcept;
+		constexpr Vector3<T> const&	Direction(void) const noexcept;
+		constexpr Vector3<T>		PointAt(T distance) const;
+
+		constexpr bool				Intersect(AABB<T> const& box, T& distance) const;
+		constexpr bool				Intersect(Sphere<T> const& sphere, T& distance) const;
+		constexpr bool				Intersect(Plane<T> const& plane, T& distance) const;
+		constexpr bool				Intersect(Triangle<T> const& triangle, T& distance) const;
+
+		size_t						IntersectBoxes(Vector3StreamView<T> const& mins, Vector3StreamView<T> const& maxs, std::span<T> distances) const;
+		size_t						IntersectSpheres(Vector3StreamView<T> const& centers, std::span<T const> radii, std::span<T> distances) const;
+		size_t						IntersectPlanes(Vector3StreamView<T> const& normals, std::span<T const> planeDistances, std::span<T> distances) const;
+		size_t						IntersectTriangles(Vector3StreamView<T> const& vertices0, Vector3StreamView<T> const& vertices1, Vector3StreamView<T> const& vertices2, std::span<T> distances) const;
+
+	private:
+		constexpr void				StoreRay(T* ray) const;
+
+		template<typename IntersectRange>
+		static size_t				IntersectBatches(size_t count, IntersectRange intersectRange);
+
+		Vector3<T>	m_origin;
+		Vector3<T>	m_direction;
+	};
+
+	template<math::math_type::NumericType T>
+	inline constexpr Ray<T>::Ray(void)
+		: m_origin(static_cast<T>(0)), m_direction(static_cast<T>(0), static_cast<T>(0), static_cast<T>(-1))
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Ray<T>::Ray(Vector3<T> const& origin, Vector3<T> const& direction)
+		: m_origin(origin), m_direction(direction)
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> const& Ray<T>::Origin(void) const noexcept
+	{
+		return m_origin;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> const& Ray<T>::Direction(void) const noexcept
+	{
+		return m_direction;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> Ray<T>::PointAt(T distance) const
+	{
+		return m_origin + m_direction * distance;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Ray<T>::Intersect(AABB<T> const& box, T& distance) const
+	{
+		// Entry & exit distance of each slab, a zero direction component gives +/- infinity
+		T slabNear[3];
+		T slabFar[3];
+
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			const T inverseDirection = static_cast<T>(1) / m_direction[i];
+			const T t1 = (box.Min()[i] - m_origin[i]) * inverseDirection;
+			const T t2 = (box.Max()[i] - m_origin[i]) * inverseDirection;
+
+			slabNear[i] = math::Min(t1, t2);
+			slabFar[i] = math::Max(t1, t2);
+		}
+
+		// Same order as the SIMD kernels, math::Min & math::Max match the min & max instructions
+		const T tNear = math::Max(math::Max(math::Max(slabNear[0], slabNear[1]), slabNear[2]), static_cast<T>(0));
+		const T tFar = math::Min(math::Min(slabFar[0], slabFar[1]), slabFar[2]);
+
+		if (!(tNear <= tFar))
+			return false;
+
+		distance = tNear;
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Ray<T>::Intersect(Sphere<T> const& sphere, T& distance) const
+	{
+		// |offset + direction * t| = radius
+		const Vector3<T> offset = m_origin - sphere.Center();
+
+		const T a = m_direction.Dot(m_direction);
+		const T b = offset.Dot(m_direction);
+		const T c = offset.Dot(offset) - sphere.Radius() * sphere.Radius();
+
+		// Outside & pointing away
+		if (c > static_cast<T>(0) && b > static_cast<T>(0))
+			return false;
+
+		const T discriminant = b * b - a * c;
+
+		if (discriminant < static_cast<T>(0))
+			return false;
+
+		distance = math::Max((-b - math::Sqrt(discriminant)) / a, static_cast<T>(0));
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Ray<T>::Intersect(Plane<T> const& plane, T& distance) const
+	{
+		const T denominator = plane.Normal().Dot(m_direction);
+
+		// Parallel to the plane
+		if (math::Abs(denominator) <= std::numeric_limits<T>::epsilon())
+			return false;
+
+		const T t = -plane.SignedDistance(m_origin) / denominator;
+
+		if (t < static_cast<T>(0))
+			return false;
+
+		distance = t;
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Ray<T>::Intersect(Triangle<T> const& triangle, T& distance) const
+	{
+		const Vector3<T> edge1 = triangle[1] - triangle[0];
+		const Vector3<T> edge2 = triangle[2] - triangle[0];
+		const Vector3<T> p = m_direction.Cross(edge2);
+		const T determinant = edge1.Dot(p);
+
+		// Parallel to the triangle
+		if (math::Abs(determinant) <= std::numeric_limits<T>::epsilon())
+			return false;
+
+		const T inverseDeterminant = static_cast<T>(1) / determinant;
+		const Vector3<T> s = m_origin - triangle[0];
+		const T u = s.Dot(p) * inverseDeterminant;
+
+		if (u < static_cast<T>(0) || u > static_cast<T>(1))
+			return false;
+
+		const Vector3<T> q = s.Cross(edge1);
+		const T v = m_direction.Dot(q) * inverseDeterminant;
+
+		if (v < static_cast<T>(0) || u + v > static_cast<T>(1))
+			return false;
+
+		const T t = edge2.Dot(q) * inverseDeterminant;
+
+		if (t < static_cast<T>(0))
+			return false;
+
+		distance = t;
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t Ray<T>::IntersectBoxes(Vector3StreamView<T> const& mins, Vector3StreamView<T> const& maxs, std::span<T> distances) const
+	{
+		_ASSERT(maxs.Size() == mins.Size() && distances.size() >= mins.Size());
+
+		return IntersectBatches(mins.Size(), [&](size_t begin, size_t end) -> size_t
+		{
+#if LIBMATH_SIMD_SSE2
+			if constexpr (std::is_same_v<T, float>)
+			{
+				if (mins.IsContiguous() && maxs.IsContiguous())
+				{
+					float ray[6];
+					StoreRay(ray);
+
+					return simd::RayIntersectBoxes(
+						distances.data() + begin, ray,
+						mins.X() + begin, mins.Y() + begin, mins.Z() + begin,
+						maxs.X() + begin, maxs.Y() + begin, maxs.Z() + begin,
+						end - begin
+					);
+				}
+			}
+#endif
+
+			size_t hitCount = 0;
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				if (Intersect(AABB<T>(mins.Get(i), maxs.Get(i)), distances[i]))
+					++hitCount;
+				else
+					distances[i] = std::numeric_limits<T>::infinity();
+			}
+
+			return hitCount;
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t Ray<T>::IntersectSpheres(Vector3StreamView<T> const& centers, std::span<T const> radii, std::span<T> distances) const
+	{
+		_ASSERT(radii.size() == centers.Size() && distances.size() >= centers.Size());
+
+		return IntersectBatches(centers.Size(), [&](size_t begin, size_t end) -> size_t
+		{
+#if LIBMATH_SIMD_SSE2
+			if constexpr (std::is_same_v<T, float>)
+			{
+				if (centers.IsContiguous())
+				{
+					float ray[6];
+					StoreRay(ray);
+
+					return simd::RayIntersectSpheres(distances.data() + begin, ray, centers.X() + begin, centers.Y() + begin, centers.Z() + begin, radii.data() + begin, end - begin);
+				}
+			}
+#endif
+
+			size_t hitCount = 0;
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				if (Intersect(Sphere<T>(centers.Get(i), radii[i]), distances[i]))
+					++hitCount;
+				else
+					distances[i] = std::numeric_limits<T>::infinity();
+			}
+
+			return hitCount;
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t Ray<T>::IntersectPlanes(Vector3StreamView<T> const& normals, std::span<T const> planeDistances, std::span<T> distances) const
+	{
+		_ASSERT(planeDistances.size() == normals.Size() && distances.size() >= normals.Size());
+
+		return IntersectBatches(normals.Size(), [&](size_t begin, size_t end) -> size_t
+		{
+#if LIBMATH_SIMD_SSE2
+			if constexpr (std::is_same_v<T, float>)
+			{
+				if (normals.IsContiguous())
+				{
+					float ray[6];
+					StoreRay(ray);
+
+					return simd::RayIntersectPlanes(distances.data() + begin, ray, normals.X() + begin, normals.Y() + begin, normals.Z() + begin, planeDistances.data() + begin, end - begin);
+				}
+			}
+#endif
+
+			size_t hitCount = 0;
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				if (Intersect(Plane<T>(normals.Get(i), planeDistances[i]), distances[i]))
+					++hitCount;
+				else
+					distances[i] = std::numeric_limits<T>::infinity();
+			}
+
+			return hitCount;
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t Ray<T>::IntersectTriangles(Vector3StreamView<T> const& vertices0, Vector3StreamView<T> const& vertices1, Vector3StreamView<T> const& vertices2, std::span<T> distances) const
+	{
+		_ASSERT(vertices1.Size() == vertices0.Size() && vertices2.Size() == vertices0.Size() && distances.size() >= vertices0.Size());
+
+		return IntersectBatches(vertices0.Size(), [&](size_t begin, size_t end) -> size_t
+		{
+#if LIBMATH_SIMD_SSE2
+			if constexpr (std::is_same_v<T, float>)
+			{
+				if (vertices0.IsContiguous() && vertices1.IsContiguous() && vertices2.IsContiguous())
+				{
+					float ray[6];
+					StoreRay(ray);
+
+					return simd::RayIntersectTriangles(
+						distances.data() + begin, ray,
+						vertices0.X() + begin, vertices0.Y() + begin, vertices0.Z() + begin,
+						vertices1.X() + begin, vertices1.Y() + begin, vertices1.Z() + begin,
+						vertices2.X() + begin, vertices2.Y() + begin, vertices2.Z() + begin,
+						end - begin
+					);
+				}
+			}
+#endif
+
+			size_t hitCount = 0;
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				if (Intersect(Triangle<T>(vertices0.Get(i), vertices1.Get(i), vertices2.Get(i)), distances[i]))
+					++hitCount;
+				else
+					distances[i] = std::numeric_limits<T>::infinity();
+			}
+
+			return hitCount;
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr void Ray<T>::StoreRay(T* ray) const
+	{
+		// (origin x, y, z, direction x, y, z), the layout of the intersection kernels
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			ray[i] = m_origin[i];
+			ray[i + 3] = m_direction[i];
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	template<typename IntersectRange>
+	inline size_t Ray<T>::IntersectBatches(size_t count, IntersectRange intersectRange)
+	{
+		std::atomic<size_t> hitCount = 0;
+
+		ParallelFor(count, [&](size_t begin, size_t end)
+		{
+			hitCount += intersectRange(begin, end);
+		});
+
+		return hitCount;
+	}
+}
+
+namespace LibMath = math;
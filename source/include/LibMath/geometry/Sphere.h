@@ -0,0 +1,107 @@
+#pragma once
+
+#include "../VariableType.hpp"
+#include "../Arithmetic.h"
+#include "../vector/Vector3.h"
+#include "AABB.h"
+
+/*
+*	------- Sphere -------
+*	Functions:
+*	- Center		DONE
+*	- Radius		DONE
+*	- Contains		DONE
+*	- Intersects	DONE
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class Sphere
+	{
+	public:
+		constexpr					Sphere(void);
+		constexpr					Sphere(Vector3<T> const& center, T radius);
+
+									~Sphere(void) = default;
+
+		constexpr Vector3<T> const&	Center(void) const noexcept;
+		constexpr T					Radius(void) const noexcept;
+
+		constexpr bool				Contains(Vector3<T> const& point) const;
+		constexpr bool				Intersects(Sphere<T> const& sphere) const;
+		constexpr bool				Intersects(AABB<T> const& box) const;
+
+		constexpr bool				operator==(Sphere<T> const& sphere) const;
+		constexpr bool				operator!=(Sphere<T> const& sphere) const;
+
+	private:
+		Vector3<T>	m_center;
+		T			m_radius;
+	};
+
+	template<math::math_type::NumericType T>
+	inline constexpr Sphere<T>::Sphere(void)
+		: m_center(static_cast<T>(0)), m_radius(static_cast<T>(1))
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Sphere<T>::Sphere(Vector3<T> const& center, T radius)
+		: m_center(center), m_radius(radius)
+	{
+		_ASSERT(radius >= static_cast<T>(0));
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> const& Sphere<T>::Center(void) const noexcept
+	{
+		return m_center;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr T Sphere<T>::Radius(void) const noexcept
+	{
+		return m_radius;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Sphere<T>::Contains(Vector3<T> const& point) const
+	{
+		return (point - m_center).MagnitudeSquared() <= m_radius * m_radius;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Sphere<T>::Intersects(Sphere<T> const& sphere) const
+	{
+		const T radii = m_radius + sphere.m_radius;
+
+		return (sphere.m_center - m_center).MagnitudeSquared() <= radii * radii;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Sphere<T>::Intersects(AABB<T> const& box) const
+	{
+		// Distance from the center to the closest point of the box
+		Vector3<T> closest;
+
+		for (unsigned int i = 0; i < 3; ++i)
+			closest[i] = math::Clamp(m_center[i], box.Min()[i], box.Max()[i]);
+
+		return Contains(closest);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Sphere<T>::operator==(Sphere<T> const& sphere) const
+	{
+		return m_center == sphere.m_center && m_radius == sphere.m_radius;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Sphere<T>::operator!=(Sphere<T> const& sphere) const
+	{
+		return !(*this == sphere);
+	}
+}
+
+namespace LibMath = math;
@@ -0,0 +1,332 @@
+#pragma once
+
+#include "../VariableType.hpp"
+#include "../simd/Simd.h"
+#include "../vector/Vector3Stream.h"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+/*
+*	------- SweepAndPrune -------
+*	Broadphase for moving axis aligned boxes, finds every pair of
+*	overlapping boxes (touching boxes overlap). Box i is (mins[i],
+*	maxs[i]) of the streams given to Update.
+*
+*	Boxes are sorted by their min on one axis, a box can only overlap
+*	the boxes starting before its max on that axis. The order is kept
+*	between updates, boxes move little from one tick to the next & an
+*	insertion sort restores the order in close to linear time. A radix
+*	sort runs on the first update, when the box count changes or when
+*	too many boxes changed places, it also picks the axis where the
+*	box centers are the most spread.
+*
+*	Pairs are written to the caller's buffer, Update allocates only
+*	when the box count grows past the reserved size. Float boxes are
+*	tested against 4 (SSE2) or 8 (AVX) boxes at once.
+*
+*	Functions:
+*	- Reserve	DONE
+*	- Update	DONE
+*	- Size		DONE
+*	- Axis		DONE
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class SweepAndPrune
+	{
+		static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>, "SweepAndPrune sorts float or double bounds");
+
+	public:
+		// Indices of two overlapping boxes, m_first < m_second
+		struct Pair
+		{
+			uint32_t	m_first;
+			uint32_t	m_second;
+		};
+
+		// Insertion sort moves per box before the order is rebuilt with a radix sort
+		static constexpr size_t			MaxInsertionMoves = 8;
+
+										SweepAndPrune(void) = default;
+										~SweepAndPrune(void) = default;
+
+		void							Reserve(size_t boxCount);
+		size_t							Update(Vector3StreamView<T> const& mins, Vector3StreamView<T> const& maxs, std::span<Pair> pairs);
+
+		size_t							Size(void) const noexcept;
+		int								Axis(void) const noexcept;
+
+	private:
+		using Key = std::conditional_t<std::is_same_v<T, float>, uint32_t, uint64_t>;
+
+		bool							InsertionSort(void);
+		void							RadixSort(Vector3StreamView<T> const& mins, Vector3StreamView<T> const& maxs);
+
+		static T const*					Lane(Vector3StreamView<T> const& stream, int axis) noexcept;
+		static Key						SortKey(T value) noexcept;
+
+		std::vector<uint32_t>	m_order;
+		std::vector<T>			m_keys;
+
+		// Bounds in sorted order, lanes of min x, y, z then max x, y, z with x the sweep axis
+		std::vector<T>			m_sweep;
+
+		// Radix sort scratch
+		std::vector<uint32_t>	m_orderScratch;
+		std::vector<Key>		m_radixKeys;
+		std::vector<Key>		m_radixScratch;
+
+		int						m_axis = 0;
+	};
+
+	template<math::math_type::NumericType T>
+	inline void SweepAndPrune<T>::Reserve(size_t boxCount)
+	{
+		m_order.reserve(boxCount);
+		m_keys.reserve(boxCount);
+		m_sweep.reserve(boxCount * 6);
+		m_orderScratch.reserve(boxCount);
+		m_radixKeys.reserve(boxCount);
+		m_radixScratch.reserve(boxCount);
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t SweepAndPrune<T>::Update(Vector3StreamView<T> const& mins, Vector3StreamView<T> const& maxs, std::span<Pair> pairs)
+	{
+		_ASSERT(maxs.Size() == mins.Size() && mins.Size() < static_cast<size_t>(UINT32_MAX));
+
+		const size_t count = mins.Size();
+		bool sorted = false;
+
+		if (count == m_order.size())
+		{
+			// Previous order, only boxes that moved past their neighbours are out of place
+			T const* minLane = Lane(mins, m_axis);
+
+			for (size_t i = 0; i < count; ++i)
+				m_keys[i] = minLane[m_order[i] * mins.Stride()];
+
+			sorted = InsertionSort();
+		}
+		else
+		{
+			m_order.resize(count);
+			m_keys.resize(count);
+			m_sweep.resize(count * 6);
+		}
+
+		if (!sorted)
+			RadixSort(mins, maxs);
+
+		// Gather the bounds in sorted order, the sweep then reads the lanes front to back
+		const int axes[3] = { m_axis, (m_axis + 1) % 3, (m_axis + 2) % 3 };
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			T const* minLane = Lane(mins, axes[axis]);
+			T const* maxLane = Lane(maxs, axes[axis]);
+
+			T* sweepMin = m_sweep.data() + count * axis;
+			T* sweepMax = m_sweep.data() + count * (axis + 3);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				sweepMin[i] = minLane[m_order[i] * mins.Stride()];
+				sweepMax[i] = maxLane[m_order[i] * maxs.Stride()];
+			}
+		}
+
+#if LIBMATH_SIMD_SSE2
+		if constexpr (std::is_same_v<T, float>)
+		{
+			static_assert(sizeof(Pair) == sizeof(uint32_t) * 2, "Pair is stored as 2 indices by the sweep kernels");
+
+			return simd::SweepAndPruneOverlaps(reinterpret_cast<uint32_t*>(pairs.data()), pairs.size(), m_sweep.data(), m_order.data(), count);
+		}
+#endif
+
+		// Boxes after i overlap it on the sweep axis until one starts past its max
+		size_t pairCount = 0;
+
+		T const* minX = m_sweep.data();
+		T const* minY = minX + count;
+		T const* minZ = minX + count * 2;
+		T const* maxX = minX + count * 3;
+		T const* maxY = minX + count * 4;
+		T const* maxZ = minX + count * 5;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			for (size_t j = i + 1; j < count && minX[j] <= maxX[i]; ++j)
+			{
+				if (minY[j] <= maxY[i] && maxY[j] >= minY[i] && minZ[j] <= maxZ[i] && maxZ[j] >= minZ[i])
+				{
+					if (pairCount < pairs.size())
+					{
+						const uint32_t first = m_order[i];
+						const uint32_t second = m_order[j];
+
+						pairs[pairCount] = (first < second) ? Pair{ first, second } : Pair{ second, first };
+					}
+
+					++pairCount;
+				}
+			}
+		}
+
+		// More pairs than the buffer holds, the caller can grow it & update again
+		return pairCount;
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t SweepAndPrune<T>::Size(void) const noexcept
+	{
+		return m_order.size();
+	}
+
+	template<math::math_type::NumericType T>
+	inline int SweepAndPrune<T>::Axis(void) const noexcept
+	{
+		return m_axis;
+	}
+
+	template<math::math_type::NumericType T>
+	inline bool SweepAndPrune<T>::InsertionSort(void)
+	{
+		// Gives up once the boxes moved too much, a radix sort is then cheaper
+		const size_t maxMoves = m_keys.size() * MaxInsertionMoves;
+		size_t moves = 0;
+
+		for (size_t i = 1; i < m_keys.size(); ++i)
+		{
+			const T key = m_keys[i];
+
+			if (!(key < m_keys[i - 1]))
+				continue;
+
+			const uint32_t index = m_order[i];
+			size_t j = i;
+
+			for (; j > 0 && key < m_keys[j - 1]; --j)
+			{
+				m_keys[j] = m_keys[j - 1];
+				m_order[j] = m_order[j - 1];
+			}
+
+			m_keys[j] = key;
+			m_order[j] = index;
+
+			moves += i - j;
+
+			if (moves > maxMoves)
+				return false;
+		}
+
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void SweepAndPrune<T>::RadixSort(Vector3StreamView<T> const& mins, Vector3StreamView<T> const& maxs)
+	{
+		const size_t count = mins.Size();
+
+		// Sweep along the axis where the box centers spread the most, fewer boxes share an interval
+		T spread[3] = {};
+
+		for (int axis = 0; axis < 3; ++axis)
+		{
+			T const* minLane = Lane(mins, axis);
+			T const* maxLane = Lane(maxs, axis);
+			T sum = static_cast<T>(0);
+			T sumSquared = static_cast<T>(0);
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const T center = minLane[i * mins.Stride()] + maxLane[i * maxs.Stride()];
+
+				sum += center;
+				sumSquared += center * center;
+			}
+
+			spread[axis] = (count != 0) ? sumSquared - sum * sum / static_cast<T>(count) : static_cast<T>(0);
+		}
+
+		m_axis = (spread[0] >= spread[1]) ? ((spread[0] >= spread[2]) ? 0 : 2) : ((spread[1] >= spread[2]) ? 1 : 2);
+
+		m_orderScratch.resize(count);
+		m_radixKeys.resize(count);
+		m_radixScratch.resize(count);
+
+		// Least significant byte first, one histogram pass for every byte
+		constexpr size_t passCount = sizeof(Key);
+
+		uint32_t histograms[passCount][256] = {};
+		T const* minLane = Lane(mins, m_axis);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const Key key = SortKey(minLane[i * mins.Stride()]);
+
+			m_radixKeys[i] = key;
+			m_order[i] = static_cast<uint32_t>(i);
+
+			for (size_t pass = 0; pass < passCount; ++pass)
+				++histograms[pass][(key >> (pass * 8)) & 0xFF];
+		}
+
+		for (size_t pass = 0; pass < passCount; ++pass)
+		{
+			uint32_t (&histogram)[256] = histograms[pass];
+
+			// Every key has the same byte, the pass would not move anything
+			if (count == 0 || histogram[(m_radixKeys[0] >> (pass * 8)) & 0xFF] == count)
+				continue;
+
+			uint32_t offset = 0;
+
+			for (uint32_t& bucket : histogram)
+			{
+				const uint32_t bucketSize = bucket;
+
+				bucket = offset;
+				offset += bucketSize;
+			}
+
+			for (size_t i = 0; i < count; ++i)
+			{
+				const uint32_t destination = histogram[(m_radixKeys[i] >> (pass * 8)) & 0xFF]++;
+
+				m_radixScratch[destination] = m_radixKeys[i];
+				m_orderScratch[destination] = m_order[i];
+			}
+
+			m_radixKeys.swap(m_radixScratch);
+			m_order.swap(m_orderScratch);
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	inline T const* SweepAndPrune<T>::Lane(Vector3StreamView<T> const& stream, int axis) noexcept
+	{
+		return (axis == 0) ? stream.X() : ((axis == 1) ? stream.Y() : stream.Z());
+	}
+
+	template<math::math_type::NumericType T>
+	inline typename SweepAndPrune<T>::Key SweepAndPrune<T>::SortKey(T value) noexcept
+	{
+		// Flip negative values & set the sign bit of positive ones, unsigned order then matches float order
+		const Key bits = std::bit_cast<Key>(value);
+		const Key signBit = static_cast<Key>(1) << (sizeof(Key) * 8 - 1);
+
+		return (bits & signBit) ? ~bits : (bits | signBit);
+	}
+}
+
+namespace LibMath = math;
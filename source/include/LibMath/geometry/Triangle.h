@@ -0,0 +1,82 @@
+#pragma once
+
+#include "../VariableType.hpp"
+#include "../vector/Vector3.h"
+
+/*
+*	------- Triangle -------
+*	3 vertices, counter clockwise vertices face the normal.
+*
+*	Functions:
+*	- Normal		DONE
+*	- Area			DONE
+*	- Centroid		DONE
+*
+*	Operators:
+*	- Index			(index operator)	DONE
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class Triangle
+	{
+	public:
+		constexpr					Triangle(void) = default;
+		constexpr					Triangle(Vector3<T> const& vertex0, Vector3<T> const& vertex1, Vector3<T> const& vertex2);
+
+									~Triangle(void) = default;
+
+		constexpr Vector3<T>		Normal(void) const;
+		constexpr T					Area(void) const;
+		constexpr Vector3<T>		Centroid(void) const;
+
+		constexpr Vector3<T>&		operator[](unsigned int index);
+		constexpr Vector3<T> const&	operator[](unsigned int index) const;
+
+	private:
+		Vector3<T>	m_vertices[3];
+	};
+
+	template<math::math_type::NumericType T>
+	inline constexpr Triangle<T>::Triangle(Vector3<T> const& vertex0, Vector3<T> const& vertex1, Vector3<T> const& vertex2)
+		: m_vertices{ vertex0, vertex1, vertex2 }
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> Triangle<T>::Normal(void) const
+	{
+		return (m_vertices[1] - m_vertices[0]).Cross(m_vertices[2] - m_vertices[0]).Normalize();
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr T Triangle<T>::Area(void) const
+	{
+		return (m_vertices[1] - m_vertices[0]).Cross(m_vertices[2] - m_vertices[0]).Magnitude() * static_cast<T>(0.5);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> Triangle<T>::Centroid(void) const
+	{
+		return (m_vertices[0] + m_vertices[1] + m_vertices[2]) / static_cast<T>(3);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T>& Triangle<T>::operator[](unsigned int index)
+	{
+		_ASSERT(index < 3);
+
+		return m_vertices[index];
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> const& Triangle<T>::operator[](unsigned int index) const
+	{
+		_ASSERT(index < 3);
+
+		return m_vertices[index];
+	}
+}
+
+namespace LibMath = math;
@@ -0,0 +1,452 @@
+#pragma once
+
+#include "../VariableType.hpp"
+#include "../Arithmetic.h"
+#include "../vector/Vector3.h"
+#include "../Quaternion.h"
+#include "Matrix3.h"
+#include "Matrix4.h"
+
+#include <utility>
+
+/*
+*	AffineMatrix4
+*
+*	A 4x4 transform whose last row is implicitly (0, 0, 0, 1).
+*	Stored as 4 columns of 3 values, columns 0 - 2 are the linear
+*	(rotation & scale) part & column 3 is the translation, the same
+*	layout as Matrix4 without the projective row.
+*
+*	Constructor
+*	- Void						DONE
+*	- Linear & translation		DONE
+*	- Matrix4					DONE
+*
+*	Functions
+*	- Identity					DONE
+*	- Linear					DONE
+*	- Translation				DONE
+*	- ToMatrix4					DONE
+*	- Determinant				DONE
+*	- Inverse					DONE
+*	- TryInverse				DONE
+*	- InverseOrthogonal			DONE
+*	- InverseOrthonormal		DONE
+*	- TransformPoint			DONE
+*	- TransformDirection		DONE
+*
+*	Transformation
+*	- Scale						DONE
+*	- Translate					DONE
+*	- Transform (Quaternion)	DONE
+*
+*	Operators
+*	- Multiplication			DONE
+*	- Equality					DONE
+*	- Inverse equality			DONE
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class AffineMatrix4
+	{
+	public:
+				constexpr					AffineMatrix4(void);
+				constexpr					AffineMatrix4(Matrix3<T> const& linear, Vector3<T> const& translation);
+				explicit constexpr			AffineMatrix4(Matrix4<T> const& matrix);
+
+											~AffineMatrix4(void) = default;
+
+		static	constexpr AffineMatrix4<T>	Identity(void);
+		static	constexpr AffineMatrix4<T>	Transform(Quaternion<T> const& quat);
+
+				constexpr Matrix3<T>		Linear(void) const;
+				constexpr Vector3<T>		Translation(void) const;
+				constexpr Matrix4<T>		ToMatrix4(void) const;
+
+				constexpr T					Determinant(void) const noexcept;
+				constexpr AffineMatrix4<T>&	Inverse(void) noexcept;
+				constexpr bool				TryInverse(void) noexcept;
+				constexpr AffineMatrix4<T>&	InverseOrthogonal(void) noexcept;
+				constexpr AffineMatrix4<T>&	InverseOrthonormal(void) noexcept;
+
+				constexpr Vector3<T>		TransformPoint(Vector3<T> const& point) const noexcept;
+				constexpr Vector3<T>		TransformDirection(Vector3<T> const& direction) const noexcept;
+
+				constexpr AffineMatrix4<T>&	Scale(T scale) noexcept;
+				constexpr AffineMatrix4<T>&	Translate(Vector3<T> const& vec3) noexcept;
+				constexpr AffineMatrix4<T>&	Translate(T x, T y, T z) noexcept;
+
+				constexpr AffineMatrix4<T>	operator*(AffineMatrix4<T> const& matrix) const& noexcept;
+				constexpr AffineMatrix4<T>	operator*(AffineMatrix4<T> const& matrix) && noexcept;
+				constexpr AffineMatrix4<T>&	operator*=(AffineMatrix4<T> const& matrix) noexcept;
+
+				constexpr bool				operator==(AffineMatrix4<T> const& matrix) const noexcept;
+				constexpr bool				operator!=(AffineMatrix4<T> const& matrix) const noexcept;
+
+		T m_matrix[4][3];
+	};
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T>::AffineMatrix4(void)
+	{
+		m_matrix[0][0] = 1; m_matrix[0][1] = 0; m_matrix[0][2] = 0;
+		m_matrix[1][0] = 0; m_matrix[1][1] = 1; m_matrix[1][2] = 0;
+		m_matrix[2][0] = 0; m_matrix[2][1] = 0; m_matrix[2][2] = 1;
+		m_matrix[3][0] = 0; m_matrix[3][1] = 0; m_matrix[3][2] = 0;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T>::AffineMatrix4(Matrix3<T> const& linear, Vector3<T> const& translation)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				m_matrix[i][j] = linear.m_matrix[i][j];
+			}
+		}
+
+		m_matrix[3][0] = translation[0];
+		m_matrix[3][1] = translation[1];
+		m_matrix[3][2] = translation[2];
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T>::AffineMatrix4(Matrix4<T> const& matrix)
+	{
+		// The projective row (m_matrix[i][3]) is discarded
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				m_matrix[i][j] = matrix.m_matrix[i][j];
+			}
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T> AffineMatrix4<T>::Identity(void)
+	{
+		return AffineMatrix4<T>();
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T> AffineMatrix4<T>::Transform(Quaternion<T> const& quat)
+	{
+		return AffineMatrix4<T>(Matrix4<T>().Transform(quat));
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Matrix3<T> AffineMatrix4<T>::Linear(void) const
+	{
+		Matrix3<T> result;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				result.m_matrix[i][j] = m_matrix[i][j];
+			}
+		}
+
+		return result;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> AffineMatrix4<T>::Translation(void) const
+	{
+		return Vector3<T>(m_matrix[3][0], m_matrix[3][1], m_matrix[3][2]);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Matrix4<T> AffineMatrix4<T>::ToMatrix4(void) const
+	{
+		Matrix4<T> result;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				result.m_matrix[i][j] = m_matrix[i][j];
+			}
+		}
+
+		return result;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr T AffineMatrix4<T>::Determinant(void) const noexcept
+	{
+		// The determinant of the 4x4 matrix is the determinant of the linear part: c0 . (c1 x c2)
+		const Vector3<T> column0(m_matrix[0][0], m_matrix[0][1], m_matrix[0][2]);
+		const Vector3<T> column1(m_matrix[1][0], m_matrix[1][1], m_matrix[1][2]);
+		const Vector3<T> column2(m_matrix[2][0], m_matrix[2][1], m_matrix[2][2]);
+
+		return column0.Dot(column1.Cross(column2));
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T>& AffineMatrix4<T>::Inverse(void) noexcept
+	{
+		// A singular matrix is left unchanged, use TryInverse to detect it
+		TryInverse();
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool AffineMatrix4<T>::TryInverse(void) noexcept
+	{
+		/*
+		*	|L t|^-1   |L^-1  -L^-1 * t|
+		*	|0 1|    = |0      1       |
+		*
+		*	The rows of L^-1 are the cross products of the columns of L
+		*	divided by the determinant
+		*/
+
+		const Vector3<T> column0(m_matrix[0][0], m_matrix[0][1], m_matrix[0][2]);
+		const Vector3<T> column1(m_matrix[1][0], m_matrix[1][1], m_matrix[1][2]);
+		const Vector3<T> column2(m_matrix[2][0], m_matrix[2][1], m_matrix[2][2]);
+		const Vector3<T> translation = Translation();
+
+		const Vector3<T> row0 = column1.Cross(column2);
+		const Vector3<T> row1 = column2.Cross(column0);
+		const Vector3<T> row2 = column0.Cross(column1);
+
+		const T determinant = column0.Dot(row0);
+
+		if (determinant == 0)
+			return false;
+
+		const T oneOverDeterminant = static_cast<T>(1) / determinant;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			m_matrix[i][0] = row0[i] * oneOverDeterminant;
+			m_matrix[i][1] = row1[i] * oneOverDeterminant;
+			m_matrix[i][2] = row2[i] * oneOverDeterminant;
+		}
+
+		m_matrix[3][0] = -row0.Dot(translation) * oneOverDeterminant;
+		m_matrix[3][1] = -row1.Dot(translation) * oneOverDeterminant;
+		m_matrix[3][2] = -row2.Dot(translation) * oneOverDeterminant;
+
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T>& AffineMatrix4<T>::InverseOrthogonal(void) noexcept
+	{
+		/*
+		*	Rotation & non uniform scale (orthogonal columns): the inverse
+		*	of the linear part is its transpose with each row divided by
+		*	the squared length of the matching column
+		*/
+
+		Vector3<T> columns[3] =
+		{
+			Vector3<T>(m_matrix[0][0], m_matrix[0][1], m_matrix[0][2]),
+			Vector3<T>(m_matrix[1][0], m_matrix[1][1], m_matrix[1][2]),
+			Vector3<T>(m_matrix[2][0], m_matrix[2][1], m_matrix[2][2])
+		};
+
+		const Vector3<T> translation = Translation();
+
+		for (int i = 0; i < 3; ++i)
+		{
+			const T lengthSquared = columns[i].MagnitudeSquared();
+
+			_ASSERT(lengthSquared != 0);
+
+			columns[i] = columns[i] * (static_cast<T>(1) / lengthSquared);
+		}
+
+		for (int i = 0; i < 3; ++i)
+		{
+			m_matrix[i][0] = columns[0][i];
+			m_matrix[i][1] = columns[1][i];
+			m_matrix[i][2] = columns[2][i];
+		}
+
+		m_matrix[3][0] = -columns[0].Dot(translation);
+		m_matrix[3][1] = -columns[1].Dot(translation);
+		m_matrix[3][2] = -columns[2].Dot(translation);
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T>& AffineMatrix4<T>::InverseOrthonormal(void) noexcept
+	{
+		// Pure rotation & translation: the inverse rotation is the transpose
+		const Vector3<T> translation = Translation();
+
+		T tmp = m_matrix[0][1];
+		m_matrix[0][1] = m_matrix[1][0];
+		m_matrix[1][0] = tmp;
+
+		tmp = m_matrix[0][2];
+		m_matrix[0][2] = m_matrix[2][0];
+		m_matrix[2][0] = tmp;
+
+		tmp = m_matrix[1][2];
+		m_matrix[1][2] = m_matrix[2][1];
+		m_matrix[2][1] = tmp;
+
+		// -R^T * t
+		const Vector3<T> newTranslation = TransformDirection(translation);
+
+		m_matrix[3][0] = -newTranslation[0];
+		m_matrix[3][1] = -newTranslation[1];
+		m_matrix[3][2] = -newTranslation[2];
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> AffineMatrix4<T>::TransformPoint(Vector3<T> const& point) const noexcept
+	{
+		return Vector3<T>(
+			m_matrix[0][0] * point[0] + m_matrix[1][0] * point[1] + m_matrix[2][0] * point[2] + m_matrix[3][0],
+			m_matrix[0][1] * point[0] + m_matrix[1][1] * point[1] + m_matrix[2][1] * point[2] + m_matrix[3][1],
+			m_matrix[0][2] * point[0] + m_matrix[1][2] * point[1] + m_matrix[2][2] * point[2] + m_matrix[3][2]
+		);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Vector3<T> AffineMatrix4<T>::TransformDirection(Vector3<T> const& direction) const noexcept
+	{
+		return Vector3<T>(
+			m_matrix[0][0] * direction[0] + m_matrix[1][0] * direction[1] + m_matrix[2][0] * direction[2],
+			m_matrix[0][1] * direction[0] + m_matrix[1][1] * direction[1] + m_matrix[2][1] * direction[2],
+			m_matrix[0][2] * direction[0] + m_matrix[1][2] * direction[1] + m_matrix[2][2] * direction[2]
+		);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T>& AffineMatrix4<T>::Scale(T scale) noexcept
+	{
+		m_matrix[0][0] *= scale;
+		m_matrix[1][1] *= scale;
+		m_matrix[2][2] *= scale;
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T>& AffineMatrix4<T>::Translate(Vector3<T> const& vec3) noexcept
+	{
+		m_matrix[3][0] += vec3[0];
+		m_matrix[3][1] += vec3[1];
+		m_matrix[3][2] += vec3[2];
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T>& AffineMatrix4<T>::Translate(T x, T y, T z) noexcept
+	{
+		m_matrix[3][0] += x;
+		m_matrix[3][1] += y;
+		m_matrix[3][2] += z;
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T> AffineMatrix4<T>::operator*(AffineMatrix4<T> const& matrix) const& noexcept
+	{
+		AffineMatrix4<T> result(*this);
+
+		return std::move(result) * matrix;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T> AffineMatrix4<T>::operator*(AffineMatrix4<T> const& matrix) && noexcept
+	{
+		/*
+		*	Same convention as Matrix4: column j of the result is this matrix
+		*	applied to column j of the other matrix. The implicit (0, 0, 0, 1)
+		*	row removes 28 of the 64 multiplications of a 4x4 product.
+		*
+		*	The left operand is a temporary, e.g. a * b in a * b * c, the
+		*	product is written to it instead of a copy.
+		*/
+
+		// Every row of the result reads all of matrix, loaded once as matrix may be *this
+		T other[4][3];
+
+		for (int j = 0; j < 4; ++j)
+		{
+			for (int k = 0; k < 3; ++k)
+				other[j][k] = matrix.m_matrix[j][k];
+		}
+
+		// Row i of the result only reads row i of *this, only the translation column has a w component of 1
+		for (int i = 0; i < 3; ++i)
+		{
+			const T row[4] = { m_matrix[0][i], m_matrix[1][i], m_matrix[2][i], m_matrix[3][i] };
+
+			for (int j = 0; j < 4; ++j)
+				m_matrix[j][i] = row[0] * other[j][0] + row[1] * other[j][1] + row[2] * other[j][2];
+
+			m_matrix[3][i] += row[3];
+		}
+
+		return std::move(*this);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr AffineMatrix4<T>& AffineMatrix4<T>::operator*=(AffineMatrix4<T> const& matrix) noexcept
+	{
+		// Multiplies on the left like Matrix4, *this = matrix * *this. Every column of the result reads all of matrix, loaded once as matrix may be *this
+		T other[4][3];
+
+		for (int k = 0; k < 4; ++k)
+		{
+			for (int i = 0; i < 3; ++i)
+				other[k][i] = matrix.m_matrix[k][i];
+		}
+
+		// Column j of the result only reads column j of *this
+		for (int j = 0; j < 4; ++j)
+		{
+			const T column[3] = { m_matrix[j][0], m_matrix[j][1], m_matrix[j][2] };
+
+			for (int i = 0; i < 3; ++i)
+				m_matrix[j][i] = other[0][i] * column[0] + other[1][i] * column[1] + other[2][i] * column[2];
+		}
+
+		m_matrix[3][0] += other[3][0];
+		m_matrix[3][1] += other[3][1];
+		m_matrix[3][2] += other[3][2];
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool AffineMatrix4<T>::operator==(AffineMatrix4<T> const& matrix) const noexcept
+	{
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 3; ++j)
+			{
+				if (!AlmostEqual(m_matrix[i][j], matrix.m_matrix[i][j]))
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool AffineMatrix4<T>::operator!=(AffineMatrix4<T> const& matrix) const noexcept
+	{
+		return !(*this == matrix);
+	}
+}
+
+namespace LibMath = math;
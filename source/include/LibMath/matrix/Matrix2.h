@@ -3,8 +3,10 @@
 #include "../VariableType.hpp"
 #include "../Macros.h"
 #include "../Arithmetic.h"
+#include "MatrixRxC.h"
 
 #include <cmath>
+#include <utility>
 
 /*
 *	================= Matrix 2D =================
@@ -35,6 +37,9 @@
 *		->	Scalar		DONE
 *		->	Matrix		DONE
 *	- Division (scalar) DONE
+*
+*	Thin wrapper over Matrix<2, 2, T>, the arithmetic & the product
+*	are forwarded to it. a * b is MatrixMultiply(a, b).
 *	=================================================
 */
 
@@ -57,58 +62,78 @@ namespace math
 	class Matrix3;
 
 	template<math::math_type::NumericType T>
-	class Matrix2
+	class Matrix2 : public Matrix<2, 2, T>
 	{
 	public:
-							Matrix2(void);
-							Matrix2(T value);
-							Matrix2(T x, T y, T z, T w);
-
-							~Matrix2(void) = default;
-
-		static Matrix2<T>	Zero(void);
-		static Matrix2<T>	One(void);
-		static Matrix2<T>	Identity(T scalar);
-
-		Matrix2<T>&			GetMatrix2(Matrix3<T> const& matrix, int row, int column);
-		Matrix2<T>&			Transpose(void);
-		T					Determinant(void);
-		Matrix2<T>&			Minor(void);
-		Matrix2<T>&			Cofactor(void);
-		Matrix2<T>&			Adjugate(void);
-		Matrix2<T>&			Inverse(void);
-
-		Matrix2<T>			operator+(Matrix2<T> const& matrix);
-		Matrix2<T>			operator-(Matrix2<T> const& matrix);
-		Matrix2<T>			operator*(Matrix2<T> const& matrix);
-		Matrix2<T>			operator*(T const& scalar);
-		Matrix2<T>			operator/(T const& scalar);
-		Matrix2<T>&			operator+=(Matrix2<T> const& matrix);
-		Matrix2<T>&			operator-=(Matrix2<T> const& matrix);
-		Matrix2<T>&			operator*=(Matrix2<T> const& matrix);
-		Matrix2<T>&			operator*=(T const& scalar);
-		Matrix2<T>&			operator/=(T const& scalar);
-
-		bool				operator==(Matrix2<T> const& matrix) const noexcept;
-		bool				operator!=(Matrix2<T> const& matrix) const noexcept;
-
-		T m_matrix[2][2];
+		constexpr					Matrix2(void);
+		constexpr					Matrix2(T value);
+		constexpr					Matrix2(T x, T y, T z, T w);
+		constexpr explicit			Matrix2(Matrix<2, 2, T> const& matrix);
+
+									~Matrix2(void) = default;
+
+		static constexpr Matrix2<T>	Zero(void);
+		static constexpr Matrix2<T>	One(void);
+		static constexpr Matrix2<T>	Identity(T scalar);
+
+		constexpr Matrix2<T>&		GetMatrix2(Matrix3<T> const& matrix, int row, int column) noexcept;
+		constexpr Matrix2<T>&		Transpose(void) noexcept;
+		constexpr T					Determinant(void) const noexcept;
+		constexpr Matrix2<T>&		Minor(void) noexcept;
+		constexpr Matrix2<T>&		Cofactor(void) noexcept;
+		constexpr Matrix2<T>&		Adjugate(void) noexcept;
+		constexpr Matrix2<T>&		Inverse(void) noexcept;
+
+		constexpr Matrix2<T>		operator+(Matrix2<T> const& matrix) const noexcept;
+		constexpr Matrix2<T>		operator-(Matrix2<T> const& matrix) const noexcept;
+		constexpr Matrix2<T>		operator*(Matrix2<T> const& matrix) const& noexcept;
+		constexpr Matrix2<T>		operator*(Matrix2<T> const& matrix) && noexcept;
+		constexpr Matrix2<T>		operator*(T const& scalar) const noexcept;
+		constexpr Matrix2<T>		operator/(T const& scalar) const noexcept;
+		constexpr Matrix2<T>&		operator+=(Matrix2<T> const& matrix) noexcept;
+		constexpr Matrix2<T>&		operator-=(Matrix2<T> const& matrix) noexcept;
+		constexpr Matrix2<T>&		operator*=(Matrix2<T> const& matrix) noexcept;
+		constexpr Matrix2<T>&		operator*=(T const& scalar) noexcept;
+		constexpr Matrix2<T>&		operator/=(T const& scalar) noexcept;
+
+		constexpr bool				operator==(Matrix2<T> const& matrix) const noexcept;
+		constexpr bool				operator!=(Matrix2<T> const& matrix) const noexcept;
+
+		using Matrix<2, 2, T>::m_matrix;
+
+	private:
+		using typename Matrix<2, 2, T>::Uninitialised;
+
+		constexpr explicit			Matrix2(Uninitialised) noexcept;
 	};
 
 	template<math::math_type::NumericType T>
-	inline math::Matrix2<T>::Matrix2(void)
+	inline constexpr math::Matrix2<T>::Matrix2(void)
+		: Matrix<2, 2, T>()
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr math::Matrix2<T>::Matrix2(T value)
+		: Matrix<2, 2, T>(value)
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr math::Matrix2<T>::Matrix2(Matrix<2, 2, T> const& matrix)
+		: Matrix<2, 2, T>(matrix)
 	{
-		*this = Identity(1);
 	}
 
 	template<math::math_type::NumericType T>
-	inline math::Matrix2<T>::Matrix2(T value)
+	inline constexpr math::Matrix2<T>::Matrix2(Uninitialised) noexcept
+		: Matrix<2, 2, T>(Uninitialised())
 	{
-		*this = Identity(value);
 	}
 
 	template<math::math_type::NumericType T>
-	inline math::Matrix2<T>::Matrix2(T x, T y, T z, T w)
+	inline constexpr math::Matrix2<T>::Matrix2(T x, T y, T z, T w)
+		: Matrix<2, 2, T>(Uninitialised())
 	{
 		m_matrix[0][0] = x;
 		m_matrix[0][1] = y;
@@ -122,25 +147,25 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T> Matrix2<T>::Zero(void)
+	inline constexpr Matrix2<T> Matrix2<T>::Zero(void)
 	{
 		return Matrix2<T>(0, 0, 0, 0);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T> Matrix2<T>::One(void)
+	inline constexpr Matrix2<T> Matrix2<T>::One(void)
 	{
 		return Matrix2<T>(1, 1, 1, 1);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T> Matrix2<T>::Identity(T scalar)
+	inline constexpr Matrix2<T> Matrix2<T>::Identity(T scalar)
 	{
 		return Matrix2<T>(scalar, 0, 0, scalar);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T>& Matrix2<T>::GetMatrix2(Matrix3<T> const& matrix, int row, int column)
+	inline constexpr Matrix2<T>& Matrix2<T>::GetMatrix2(Matrix3<T> const& matrix, int row, int column) noexcept
 	{
 		int currentRow = 0;
 		int currentColumn = 0;
@@ -167,18 +192,15 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline math::Matrix2<T>& Matrix2<T>::Transpose(void)
+	inline constexpr math::Matrix2<T>& Matrix2<T>::Transpose(void) noexcept
 	{
-		T tmp = m_matrix[0][1];
-
-		m_matrix[0][1] = m_matrix[1][0];
-		m_matrix[1][0] = tmp;
+		Matrix<2, 2, T>::Transpose();
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Matrix2<T>::Determinant(void)
+	inline constexpr T Matrix2<T>::Determinant(void) const noexcept
 	{
 		/*
 		*	Determinant of 2x2 matrix
@@ -194,20 +216,17 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T>& Matrix2<T>::Minor(void)
+	inline constexpr Matrix2<T>& Matrix2<T>::Minor(void) noexcept
 	{
-		Matrix2<T> tmp(*this);
-
-		m_matrix[0][0] = tmp.m_matrix[1][1];
-		m_matrix[0][1] = tmp.m_matrix[1][0];
-		m_matrix[1][0] = tmp.m_matrix[0][1];
-		m_matrix[1][1] = tmp.m_matrix[0][0];
+		// The minor of each value is the value in the opposite corner
+		std::swap(m_matrix[0][0], m_matrix[1][1]);
+		std::swap(m_matrix[0][1], m_matrix[1][0]);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T>& Matrix2<T>::Cofactor(void)
+	inline constexpr Matrix2<T>& Matrix2<T>::Cofactor(void) noexcept
 	{
 		this->Minor();
 
@@ -218,7 +237,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T>& Matrix2<T>::Adjugate(void)
+	inline constexpr Matrix2<T>& Matrix2<T>::Adjugate(void) noexcept
 	{
 		this->Cofactor();
 		this->Transpose();
@@ -227,123 +246,128 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T>& Matrix2<T>::Inverse(void)
+	inline constexpr Matrix2<T>& Matrix2<T>::Inverse(void) noexcept
 	{
-		T determinant = Determinant();
+		const T determinant = Determinant();
 		
 		if (determinant == 0)
 			return *this;
 
-		*this = Adjugate() / determinant;
+		Adjugate();
 
-		return *this;
+		return *this /= determinant;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T> Matrix2<T>::operator+(Matrix2<T> const& matrix)
+	inline constexpr Matrix2<T> Matrix2<T>::operator+(Matrix2<T> const& matrix) const noexcept
 	{
-		return Matrix2<T>(
-			m_matrix[0][0] + matrix.m_matrix[0][0], m_matrix[0][1] + matrix.m_matrix[0][1],
-			m_matrix[1][0] + matrix.m_matrix[1][0], m_matrix[1][1] + matrix.m_matrix[1][1]
-		);
+		Matrix2<T> result(*this);
+
+		result += matrix;
+
+		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T> Matrix2<T>::operator-(Matrix2<T> const& matrix)
+	inline constexpr Matrix2<T> Matrix2<T>::operator-(Matrix2<T> const& matrix) const noexcept
 	{
-		return Matrix2<T>(
-			m_matrix[0][0] - matrix.m_matrix[0][0], m_matrix[0][1] - matrix.m_matrix[0][1],
-			m_matrix[1][0] - matrix.m_matrix[1][0], m_matrix[1][1] - matrix.m_matrix[1][1]
-		);
+		Matrix2<T> result(*this);
+
+		result -= matrix;
+
+		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T> Matrix2<T>::operator*(Matrix2<T> const& matrix)
+	inline constexpr Matrix2<T> Matrix2<T>::operator*(Matrix2<T> const& matrix) const& noexcept
 	{
-		return Matrix2<T>(
-			m_matrix[0][0] * matrix.m_matrix[0][0] + m_matrix[1][0] * matrix.m_matrix[0][1],
-			m_matrix[0][1] * matrix.m_matrix[0][0] + m_matrix[1][1] * matrix.m_matrix[0][1],
-			m_matrix[0][0] * matrix.m_matrix[1][0] + m_matrix[1][0] * matrix.m_matrix[1][1],
-			m_matrix[0][1] * matrix.m_matrix[1][0] + m_matrix[1][1] * matrix.m_matrix[1][1]
-		);
+		Matrix2<T> result{ Uninitialised() };
+
+		MatrixMultiply(result, *this, matrix);
+
+		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T> Matrix2<T>::operator*(T const& scalar)
+	inline constexpr Matrix2<T> Matrix2<T>::operator*(Matrix2<T> const& matrix) && noexcept
 	{
-		return Matrix2<T>(
-			m_matrix[0][0] * scalar, m_matrix[0][1] * scalar,
-			m_matrix[1][0] * scalar, m_matrix[1][1] * scalar
-		);
+		// The left operand is a temporary, e.g. a * b in a * b * c, the product is written to it instead of a copy
+		*this *= matrix;
+
+		return std::move(*this);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T> Matrix2<T>::operator/(T const& scalar)
+	inline constexpr Matrix2<T> Matrix2<T>::operator*(T const& scalar) const noexcept
 	{
-		return Matrix2<T>(
-			m_matrix[0][0] / scalar, m_matrix[0][1] / scalar,
-			m_matrix[1][0] / scalar, m_matrix[1][1] / scalar
-		);
+		Matrix2<T> result(*this);
+
+		result *= scalar;
+
+		return result;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Matrix2<T> Matrix2<T>::operator/(T const& scalar) const noexcept
+	{
+		Matrix2<T> result(*this);
+
+		result /= scalar;
+
+		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T>& Matrix2<T>::operator+=(Matrix2<T> const& matrix)
+	inline constexpr Matrix2<T>& Matrix2<T>::operator+=(Matrix2<T> const& matrix) noexcept
 	{
-		*this = *this + matrix;
+		Matrix<2, 2, T>::operator+=(matrix);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T>& Matrix2<T>::operator-=(Matrix2<T> const& matrix)
+	inline constexpr Matrix2<T>& Matrix2<T>::operator-=(Matrix2<T> const& matrix) noexcept
 	{
-		*this = *this - matrix;
+		Matrix<2, 2, T>::operator-=(matrix);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T>& Matrix2<T>::operator*=(Matrix2<T> const& matrix)
+	inline constexpr Matrix2<T>& Matrix2<T>::operator*=(Matrix2<T> const& matrix) noexcept
 	{
-		*this = *this * matrix;
+		// matrix may be *this, MatrixMultiply reads both operands before writing
+		MatrixMultiply(*this, *this, matrix);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T>& Matrix2<T>::operator*=(T const& scalar)
+	inline constexpr Matrix2<T>& Matrix2<T>::operator*=(T const& scalar) noexcept
 	{
-		*this = *this * scalar;
+		Matrix<2, 2, T>::operator*=(scalar);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix2<T>& Matrix2<T>::operator/=(T const& scalar)
+	inline constexpr Matrix2<T>& Matrix2<T>::operator/=(T const& scalar) noexcept
 	{
-		*this = *this / scalar;
+		Matrix<2, 2, T>::operator/=(scalar);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Matrix2<T>::operator==(Matrix2<T> const& matrix) const noexcept
+	inline constexpr bool Matrix2<T>::operator==(Matrix2<T> const& matrix) const noexcept
 	{
-		return
-			AlmostEqual(m_matrix[0][0], matrix.m_matrix[0][0]) &&
-			AlmostEqual(m_matrix[0][1], matrix.m_matrix[0][1]) &&
-			AlmostEqual(m_matrix[1][0], matrix.m_matrix[1][0]) &&
-			AlmostEqual(m_matrix[1][1], matrix.m_matrix[1][1]);
+		return math::AlmostEqual(*this, matrix);
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Matrix2<T>::operator!=(Matrix2<T> const& matrix) const noexcept
+	inline constexpr bool Matrix2<T>::operator!=(Matrix2<T> const& matrix) const noexcept
 	{
-		return
-			!(	AlmostEqual(m_matrix[0][0], matrix.m_matrix[0][0]) &&
-				AlmostEqual(m_matrix[0][1], matrix.m_matrix[0][1]) &&
-				AlmostEqual(m_matrix[1][0], matrix.m_matrix[1][0]) &&
-				AlmostEqual(m_matrix[1][1], matrix.m_matrix[1][1]));
+		return !math::AlmostEqual(*this, matrix);
 	}
 }
 
@@ -5,9 +5,10 @@
 #include "../Macros.h"
 #include "../VariableType.hpp"
 #include "Matrix2.h"
-#include "Matrix4.h"
+#include "MatrixRxC.h"
 
 #include <cmath>
+#include <utility>
 
 /*
 *	Matrix3
@@ -37,6 +38,10 @@
 *	- Division (scalar)		DONE
 *	- Equality				DONE
 *	- Inverse equality		DONE
+*
+*	Thin wrapper over Matrix<3, 3, T>, the arithmetic & the product are
+*	forwarded to it. m_matrix is read as [row][column], so a * b is
+*	MatrixMultiply(b, a) on the column major base.
 * 
 */
 
@@ -46,62 +51,80 @@ namespace math
 	class Matrix4;
 
 	template<math::math_type::NumericType T>
-	class Matrix3
+	class Matrix3 : public Matrix<3, 3, T>
 	{
 	public:
-							Matrix3(void);
-							Matrix3(T scalar);
-							Matrix3(T const arr[9]);
-
-							~Matrix3(void) = default;
-
-				Matrix3<T>&	GetMatrix3(Matrix4<T> const& matrix, int row, int column);
-				Matrix3<T>&	Transpose(void);
-		static	Matrix3<T>	Identity(void);
-				T			Determinant(void);
-				Matrix3<T>&	Minor(void);
-				Matrix3<T>&	Cofactor(void);
-				Matrix3<T>&	Adjugate(void);
-				Matrix3<T>&	Inverse(void);
-
-		static	Matrix3<T>	RollPitchYawRotation(Radian<T> const& thetaX, Radian<T> const& thetaY, Radian<T> const& thetaZ);
-
-				Matrix3<T>&	operator=(const T arr[][3]);
-				Matrix3<T>&	operator=(const T arr[9]);
-				Matrix3<T>	operator+(Matrix3<T> const& matrix);
-				Matrix3<T>	operator-(Matrix3<T> const& matrix);
-				Matrix3<T>	operator*(Matrix3<T> const& matrix);
-				Matrix3<T>	operator*(T scalar);
-				Matrix3<T>	operator/(T scalar);
-				Matrix3<T>&	operator+=(Matrix3<T> const& matrix);
-				Matrix3<T>&	operator-=(Matrix3<T> const& matrix);
-				Matrix3<T>&	operator*=(Matrix3<T> const& matrix);
-				Matrix3<T>&	operator*=(T scalar);
-				Matrix3<T>&	operator/=(T scalar);
-
-				bool		operator==(Matrix3<T> const& matrix) const noexcept;
-				bool		operator!=(Matrix3<T> const& matrix) const noexcept;
-
-		T m_matrix[3][3];
+				constexpr				Matrix3(void);
+				constexpr				Matrix3(T scalar);
+				constexpr				Matrix3(T const arr[9]);
+				constexpr explicit		Matrix3(Matrix<3, 3, T> const& matrix);
+
+										~Matrix3(void) = default;
+
+				constexpr Matrix3<T>&	GetMatrix3(Matrix4<T> const& matrix, int row, int column) noexcept;
+				constexpr Matrix3<T>&	Transpose(void) noexcept;
+		static	constexpr Matrix3<T>	Identity(void);
+				constexpr T				Determinant(void) const noexcept;
+				constexpr Matrix3<T>&	Minor(void) noexcept;
+				constexpr Matrix3<T>&	Cofactor(void) noexcept;
+				constexpr Matrix3<T>&	Adjugate(void) noexcept;
+				constexpr Matrix3<T>&	Inverse(void) noexcept;
+
+		static	constexpr Matrix3<T>	RollPitchYawRotation(Radian<T> const& thetaX, Radian<T> const& thetaY, Radian<T> const& thetaZ);
+
+				constexpr Matrix3<T>&	operator=(const T arr[][3]);
+				constexpr Matrix3<T>&	operator=(const T arr[9]);
+				constexpr Matrix3<T>	operator+(Matrix3<T> const& matrix) const noexcept;
+				constexpr Matrix3<T>	operator-(Matrix3<T> const& matrix) const noexcept;
+				constexpr Matrix3<T>	operator*(Matrix3<T> const& matrix) const& noexcept;
+				constexpr Matrix3<T>	operator*(Matrix3<T> const& matrix) && noexcept;
+				constexpr Matrix3<T>	operator*(T scalar) const noexcept;
+				constexpr Matrix3<T>	operator/(T scalar) const noexcept;
+				constexpr Matrix3<T>&	operator+=(Matrix3<T> const& matrix) noexcept;
+				constexpr Matrix3<T>&	operator-=(Matrix3<T> const& matrix) noexcept;
+				constexpr Matrix3<T>&	operator*=(Matrix3<T> const& matrix) noexcept;
+				constexpr Matrix3<T>&	operator*=(T scalar) noexcept;
+				constexpr Matrix3<T>&	operator/=(T scalar) noexcept;
+
+				constexpr bool			operator==(Matrix3<T> const& matrix) const noexcept;
+				constexpr bool			operator!=(Matrix3<T> const& matrix) const noexcept;
+
+				using Matrix<3, 3, T>::m_matrix;
+
+	private:
+				using typename Matrix<3, 3, T>::Uninitialised;
+
+				constexpr explicit		Matrix3(Uninitialised) noexcept;
 	};
 
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>::Matrix3(void)
+	inline constexpr Matrix3<T>::Matrix3(void)
+		: Matrix<3, 3, T>()
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Matrix3<T>::Matrix3(T scalar)
+		: Matrix<3, 3, T>(scalar)
 	{
-		m_matrix[0][0] = 1; m_matrix[0][1] = 0; m_matrix[0][2] = 0;
-		m_matrix[1][0] = 0; m_matrix[1][1] = 1; m_matrix[1][2] = 0;
-		m_matrix[2][0] = 0; m_matrix[2][1] = 0; m_matrix[2][2] = 1;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>::Matrix3(T scalar)
+	inline constexpr Matrix3<T>::Matrix3(Matrix<3, 3, T> const& matrix)
+		: Matrix<3, 3, T>(matrix)
 	{
-		*this = Matrix3<T>() * scalar;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>::Matrix3(T const arr[9])
+	inline constexpr Matrix3<T>::Matrix3(Uninitialised) noexcept
+		: Matrix<3, 3, T>(Uninitialised())
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Matrix3<T>::Matrix3(T const arr[9])
+		: Matrix<3, 3, T>(Uninitialised())
 	{
 #ifndef COLUMN_MAJOR
 		m_matrix[0][0] = arr[0]; m_matrix[0][1] = arr[1]; m_matrix[0][2] = arr[2];
@@ -115,7 +138,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& Matrix3<T>::GetMatrix3(Matrix4<T> const& matrix, int row, int column)
+	inline constexpr Matrix3<T>& Matrix3<T>::GetMatrix3(Matrix4<T> const& matrix, int row, int column) noexcept
 	{
 		int currentRow = 0;
 		int currentColumn = 0;
@@ -142,28 +165,21 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& math::Matrix3<T>::Transpose(void)
+	inline constexpr Matrix3<T>& math::Matrix3<T>::Transpose(void) noexcept
 	{
-		const Matrix3<T> tmp = *this;
-
-		m_matrix[0][1] = tmp.m_matrix[1][0];
-		m_matrix[0][2] = tmp.m_matrix[2][0];
-		m_matrix[1][0] = tmp.m_matrix[0][1];
-		m_matrix[1][2] = tmp.m_matrix[2][1];
-		m_matrix[2][0] = tmp.m_matrix[0][2];
-		m_matrix[2][1] = tmp.m_matrix[1][2];
+		Matrix<3, 3, T>::Transpose();
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T> math::Matrix3<T>::Identity(void)
+	inline constexpr Matrix3<T> math::Matrix3<T>::Identity(void)
 	{
 		return math::Matrix3<T>();
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Matrix3<T>::Determinant(void)
+	inline constexpr T Matrix3<T>::Determinant(void) const noexcept
 	{
 		/*
 		*	Split 3x3 matrix into 3 2x2 matrix and multiply by the coefficient
@@ -184,33 +200,37 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& Matrix3<T>::Minor(void)
+	inline constexpr Matrix3<T>& Matrix3<T>::Minor(void) noexcept
 	{
 		/*
 		*	Minor: set each value in the given 3x3 matrix equal to the determinant
 		*	of a 2x2 matrix
+		*
+		*	Row i of the minors only reads the other 2 rows, the first 2 rows
+		*	are saved before being overwritten
 		*/
-		
-		Matrix2<T> matrix2;
-		const Matrix3<T> tmp(*this);
 
-		for (int i = 0; i < 3; ++i)
-		{
-			for (int j = 0; j < 3; ++j)
-			{
-				matrix2.GetMatrix2(tmp, i, j);
+		const T row0[3] = { m_matrix[0][0], m_matrix[0][1], m_matrix[0][2] };
+		const T row1[3] = { m_matrix[1][0], m_matrix[1][1], m_matrix[1][2] };
+		T (&m)[3][3] = m_matrix;
 
-				T determinant = matrix2.Determinant();
+		m[0][0] = (m[1][1] * m[2][2]) - (m[1][2] * m[2][1]);
+		m[0][1] = (m[1][0] * m[2][2]) - (m[1][2] * m[2][0]);
+		m[0][2] = (m[1][0] * m[2][1]) - (m[1][1] * m[2][0]);
 
-				m_matrix[i][j] = determinant;
-			}
-		}
+		m[1][0] = (row0[1] * m[2][2]) - (row0[2] * m[2][1]);
+		m[1][1] = (row0[0] * m[2][2]) - (row0[2] * m[2][0]);
+		m[1][2] = (row0[0] * m[2][1]) - (row0[1] * m[2][0]);
+
+		m[2][0] = (row0[1] * row1[2]) - (row0[2] * row1[1]);
+		m[2][1] = (row0[0] * row1[2]) - (row0[2] * row1[0]);
+		m[2][2] = (row0[0] * row1[1]) - (row0[1] * row1[0]);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& Matrix3<T>::Cofactor(void)
+	inline constexpr Matrix3<T>& Matrix3<T>::Cofactor(void) noexcept
 	{
 		this->Minor();
 
@@ -223,7 +243,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& Matrix3<T>::Adjugate(void)
+	inline constexpr Matrix3<T>& Matrix3<T>::Adjugate(void) noexcept
 	{
 		this->Cofactor();
 		this->Transpose();
@@ -232,14 +252,14 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& math::Matrix3<T>::Inverse(void)
+	inline constexpr Matrix3<T>& math::Matrix3<T>::Inverse(void) noexcept
 	{
 		/*
 		*	The inverse of a matrix is equal to the adjugate of the matrix
 		*	divided by the determinant
 		*/
 		
-		T determinant = this->Determinant();
+		const T determinant = this->Determinant();
 
 		if (determinant == 0)
 			return *this;
@@ -252,15 +272,15 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline math::Matrix3<T> math::Matrix3<T>::RollPitchYawRotation(Radian<T> const& thetaX, Radian<T> const& thetaY, Radian<T> const& thetaZ)
+	inline constexpr math::Matrix3<T> math::Matrix3<T>::RollPitchYawRotation(Radian<T> const& thetaX, Radian<T> const& thetaY, Radian<T> const& thetaZ)
 	{
 		// Convert radian values to float
-		static const T halfPi = PI * 0.5f;
+		const T halfPi = PI * 0.5f;
 
 		// Calculate sin & cos for yaw, pitch & roll
-		T sinYaw = sinf(thetaX);
-		T sinPitch = sinf(thetaY);
-		T sinRoll = sinf(thetaZ);
+		T sinYaw = math::Sin(thetaX.Value());
+		T sinPitch = math::Sin(thetaY.Value());
+		T sinRoll = math::Sin(thetaZ.Value());
 
 		// Instead of calculating cos we add an offset to sin 
 		T cosYaw = sinYaw + halfPi;
@@ -280,7 +300,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& math::Matrix3<T>::operator=(const T arr[][3])
+	inline constexpr Matrix3<T>& math::Matrix3<T>::operator=(const T arr[][3])
 	{
 		m_matrix[0][0] = arr[0][0]; m_matrix[0][1] = arr[0][1]; m_matrix[0][2] = arr[0][2];
 		m_matrix[1][0] = arr[1][0]; m_matrix[1][1] = arr[1][1]; m_matrix[1][2] = arr[1][2];
@@ -290,7 +310,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& Matrix3<T>::operator=(const T arr[9])
+	inline constexpr Matrix3<T>& Matrix3<T>::operator=(const T arr[9])
 	{
 		m_matrix[0][0] = arr[0]; m_matrix[0][1] = arr[1]; m_matrix[0][2] = arr[2];
 		m_matrix[1][0] = arr[3]; m_matrix[1][1] = arr[4]; m_matrix[1][2] = arr[5];
@@ -300,136 +320,112 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T> Matrix3<T>::operator+(Matrix3<T> const& matrix)
+	inline constexpr Matrix3<T> Matrix3<T>::operator+(Matrix3<T> const& matrix) const noexcept
 	{
 		Matrix3<T> result(*this);
-
-		result.m_matrix[0][0] += matrix.m_matrix[0][0]; result.m_matrix[0][1] += matrix.m_matrix[0][1]; result.m_matrix[0][2] += matrix.m_matrix[0][2];
-		result.m_matrix[1][0] += matrix.m_matrix[1][0]; result.m_matrix[1][1] += matrix.m_matrix[1][1]; result.m_matrix[1][2] += matrix.m_matrix[1][2];
-		result.m_matrix[2][0] += matrix.m_matrix[2][0]; result.m_matrix[2][1] += matrix.m_matrix[2][1]; result.m_matrix[2][2] += matrix.m_matrix[2][2];
+		result += matrix;
 
 		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T> Matrix3<T>::operator-(Matrix3<T> const& matrix)
+	inline constexpr Matrix3<T> Matrix3<T>::operator-(Matrix3<T> const& matrix) const noexcept
 	{
 		Matrix3<T> result(*this);
-
-		result.m_matrix[0][0] -= matrix.m_matrix[0][0]; result.m_matrix[0][1] -= matrix.m_matrix[0][1]; result.m_matrix[0][2] -= matrix.m_matrix[0][2];
-		result.m_matrix[1][0] -= matrix.m_matrix[1][0]; result.m_matrix[1][1] -= matrix.m_matrix[1][1]; result.m_matrix[1][2] -= matrix.m_matrix[1][2];
-		result.m_matrix[2][0] -= matrix.m_matrix[2][0]; result.m_matrix[2][1] -= matrix.m_matrix[2][1]; result.m_matrix[2][2] -= matrix.m_matrix[2][2];
+		result -= matrix;
 
 		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T> Matrix3<T>::operator*(Matrix3<T> const& matrix)
+	inline constexpr Matrix3<T> Matrix3<T>::operator*(Matrix3<T> const& matrix) const& noexcept
 	{
-		// Initialize null 3x3 matrix
-		Matrix3<T> result((T) 0);
-		
-		// Iterate through matrix to set the result matrix equal to the sum of the 2 matrices multiplied
-		for (int i = 0; i < 3; ++i)
-		{
-			for (int j = 0; j < 3; ++j)
-			{
-				for (int k = 0; k < 3; ++k)
-				{
-					// Add the value obtained from multiplying the 2 matrices row * column
-					result.m_matrix[i][j] += m_matrix[i][k] * matrix.m_matrix[k][j];
-				}
-			}
-		}
-		
+		Matrix3<T> result{ Uninitialised() };
+
+		// Row i of this times column j of matrix is element [j][i] of matrix * this on the column major base
+		MatrixMultiply(result, matrix, *this);
+
 		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T> Matrix3<T>::operator*(T scalar)
+	inline constexpr Matrix3<T> Matrix3<T>::operator*(Matrix3<T> const& matrix) && noexcept
 	{
-		Matrix3<T> result(*this);
+		// The left operand is a temporary, e.g. a * b in a * b * c, the product is written to it instead of a copy
+		*this *= matrix;
 
-		result.m_matrix[0][0] *= scalar; result.m_matrix[0][1] *= scalar; result.m_matrix[0][2] *= scalar;
-		result.m_matrix[1][0] *= scalar; result.m_matrix[1][1] *= scalar; result.m_matrix[1][2] *= scalar;
-		result.m_matrix[2][0] *= scalar; result.m_matrix[2][1] *= scalar; result.m_matrix[2][2] *= scalar;
+		return std::move(*this);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Matrix3<T> Matrix3<T>::operator*(T scalar) const noexcept
+	{
+		Matrix3<T> result(*this);
+		result *= scalar;
 
 		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T> Matrix3<T>::operator/(T scalar)
+	inline constexpr Matrix3<T> Matrix3<T>::operator/(T scalar) const noexcept
 	{
 		Matrix3<T> result(*this);
-
-		result.m_matrix[0][0] /= scalar; result.m_matrix[0][1] /= scalar; result.m_matrix[0][2] /= scalar;
-		result.m_matrix[1][0] /= scalar; result.m_matrix[1][1] /= scalar; result.m_matrix[1][2] /= scalar;
-		result.m_matrix[2][0] /= scalar; result.m_matrix[2][1] /= scalar; result.m_matrix[2][2] /= scalar;
+		result /= scalar;
 
 		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& Matrix3<T>::operator+=(Matrix3<T> const& matrix)
+	inline constexpr Matrix3<T>& Matrix3<T>::operator+=(Matrix3<T> const& matrix) noexcept
 	{
-		*this = *this + matrix;
+		Matrix<3, 3, T>::operator+=(matrix);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& Matrix3<T>::operator-=(Matrix3<T> const& matrix)
+	inline constexpr Matrix3<T>& Matrix3<T>::operator-=(Matrix3<T> const& matrix) noexcept
 	{
-		*this = *this - matrix;
-		
+		Matrix<3, 3, T>::operator-=(matrix);
+
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& Matrix3<T>::operator*=(Matrix3<T> const& matrix)
+	inline constexpr Matrix3<T>& Matrix3<T>::operator*=(Matrix3<T> const& matrix) noexcept
 	{
-		*this = *this * matrix;
+		// matrix may be *this, MatrixMultiply reads both operands before writing
+		MatrixMultiply(*this, matrix, *this);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& Matrix3<T>::operator*=(T scalar)
+	inline constexpr Matrix3<T>& Matrix3<T>::operator*=(T scalar) noexcept
 	{
-		*this = *this * scalar;
+		Matrix<3, 3, T>::operator*=(scalar);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix3<T>& Matrix3<T>::operator/=(T scalar)
+	inline constexpr Matrix3<T>& Matrix3<T>::operator/=(T scalar) noexcept
 	{
-		*this = *this / scalar;
+		Matrix<3, 3, T>::operator/=(scalar);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Matrix3<T>::operator==(Matrix3<T> const& matrix) const noexcept
+	inline constexpr bool Matrix3<T>::operator==(Matrix3<T> const& matrix) const noexcept
 	{
-		for (int i = 0; i < 3; ++i)
-		{
-			for (int j = 0; j < 3; ++j)
-			{
-				if (!AlmostEqual(m_matrix[i][j], matrix.m_matrix[i][j]))
-				{
-					return false;
-				}
-			}
-		}
-
-		return true;
+		return math::AlmostEqual(*this, matrix);
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Matrix3<T>::operator!=(Matrix3<T> const& matrix) const noexcept
+	inline constexpr bool Matrix3<T>::operator!=(Matrix3<T> const& matrix) const noexcept
 	{
-		return !(*this == matrix);
+		return !math::AlmostEqual(*this, matrix);
 	}
 }
 
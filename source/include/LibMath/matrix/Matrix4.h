@@ -5,10 +5,17 @@
 #include "../Arithmetic.h"
 #include "../angle/Radians.h"
 #include "../vector/Vector3.h"
+#include "../Parallel.h"
 #include "../Quaternion.h"
+#include "../simd/Simd.h"
 #include "Matrix3.h"
+#include "MatrixRxC.h"
 
+#include <atomic>
 #include <cmath>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 /*
 *	Matrix4
@@ -26,11 +33,22 @@
 *	- Cofactor					DONE
 *	- Adjugate					DONE
 *	- Inverse					DONE
+*	- TryInverse				DONE
+*	- InverseAffine				DONE
 *
 *	Transformation
 *	- Scale						DONE
 *	- Translation				DONE
 *	- Rotation
+*	- ComposeTRS				DONE	(span batch)
+*	- Decompose					DONE	(span batch)
+*
+*	ComposeTRS builds translation * rotation * scale directly, the
+*	rotation must be unit length. Decompose is the reverse: the
+*	rotation comes from the normalised columns with Shepperd's method
+*	& a mirror is folded into a negative x scale. It returns false for
+*	shear, a zero scale or a projective last row. Float batches use
+*	the SIMD kernels & large batches are split across threads.
 *
 *	- Ortho						TESTING REQUIRED
 *	- Perspective				TESTING REQUIRED
@@ -44,6 +62,10 @@
 *	- Inverse equality			DONE
 *	- Assignment with 1D array	DONE
 *	- Assignment with 2D array	DONE
+*
+*	Thin wrapper over Matrix<4, 4, T>, the arithmetic & the product are
+*	forwarded to it. a * b is MatrixMultiply(a, b) but a *= b multiplies
+*	on the left, a = b * a.
 */
 
 namespace math
@@ -55,70 +77,92 @@ namespace math
 	class Quaternion;
 
 	template<math::math_type::NumericType T>
-	class Matrix4
+	class Matrix4 : public Matrix<4, 4, T>
 	{
 	public:
-								Matrix4(void);
-								Matrix4(T scalar);
-								Matrix4(T const arr[16]);
-
-								~Matrix4(void) = default;
-
-				T				Determinant(void);
-		static	Matrix4<T>		Identity(void);
-				Matrix4<T>&		Transpose(void);
-				Matrix4<T>&		Minor(void);
-				Matrix4<T>&		Cofactor(void);
-				Matrix4<T>&		Adjugate(void);
-				Matrix4<T>&		Inverse(void);
-
-				Matrix4<T>&		Scale(T scale);
-				Matrix4<T>&		Translate(Vector3<T> const& vec3, bool rowMajor = false);
-				Matrix4<T>&		Translate(T x, T y, T z, bool rowMajor = false);
-				Matrix4<T>		Transform(Quaternion<T> const& quat);
-
-		static	Matrix4<T>		Ortho(T left, T right, T bottom, T top, T zNear, T zFar);
-		static	Matrix4<T>		Perspective(math::Vector3<T> const& position, math::Vector3<T> const& center, math::Vector3<T> const& up);
-
-				Matrix4<T>&		operator=(const T arr[16]);
-				Matrix4<T>&		operator=(const T arr[][4]);
-				Matrix4<T>		operator+(Matrix4<T> const& matrix);
-				Matrix4<T>		operator-(Matrix4<T> const& matrix);
-				Matrix4<T>		operator*(Matrix4<T> const& matrix);
-				Matrix4<T>		operator*(T scalar);
-				Matrix4<T>		operator/(T scalar);
-				Matrix4<T>&		operator+=(Matrix4<T> const& matrix);
-				Matrix4<T>&		operator-=(Matrix4<T> const& matrix);
-				Matrix4<T>&		operator*=(Matrix4<T> const& matrix);
-				Matrix4<T>&		operator*=(T scalar);
-				Matrix4<T>&		operator/=(T scalar);
-
-				bool			operator==(Matrix4<T> const& matrix) const noexcept;
-				bool			operator!=(Matrix4<T> const& matrix) const noexcept;
-
-		T m_matrix[4][4];
+				constexpr				Matrix4(void);
+				constexpr				Matrix4(T scalar);
+				constexpr				Matrix4(T const arr[16]);
+				constexpr explicit		Matrix4(Matrix<4, 4, T> const& matrix);
+
+										~Matrix4(void) = default;
+
+				constexpr T				Determinant(void) const noexcept;
+		static	constexpr Matrix4<T>	Identity(void);
+				constexpr Matrix4<T>&	Transpose(void) noexcept;
+				constexpr Matrix4<T>&	Minor(void) noexcept;
+				constexpr Matrix4<T>&	Cofactor(void) noexcept;
+				constexpr Matrix4<T>&	Adjugate(void) noexcept;
+				constexpr Matrix4<T>&	Inverse(void) noexcept;
+				constexpr bool			TryInverse(void) noexcept;
+				constexpr Matrix4<T>&	InverseAffine(void) noexcept;
+
+				constexpr Matrix4<T>&	Scale(T scale) noexcept;
+				constexpr Matrix4<T>&	Translate(Vector3<T> const& vec3, bool rowMajor = false) noexcept;
+				constexpr Matrix4<T>&	Translate(T x, T y, T z, bool rowMajor = false) noexcept;
+				constexpr Matrix4<T>	Transform(Quaternion<T> const& quat) const;
+		static	constexpr Matrix4<T>	ComposeTRS(Vector3<T> const& translation, Quaternion<T> const& rotation, Vector3<T> const& scale) noexcept;
+		static	void					ComposeTRS(std::span<Vector3<T> const> translations, std::span<Quaternion<T> const> rotations, std::span<Vector3<T> const> scales, std::span<Matrix4<T>> result);
+				constexpr bool			Decompose(Vector3<T>& translation, Quaternion<T>& rotation, Vector3<T>& scale) const noexcept;
+		static	size_t					Decompose(std::span<Matrix4<T> const> matrices, std::span<Vector3<T>> translations, std::span<Quaternion<T>> rotations, std::span<Vector3<T>> scales);
+
+		static	constexpr Matrix4<T>	Ortho(T left, T right, T bottom, T top, T zNear, T zFar);
+		static	constexpr Matrix4<T>	Perspective(math::Vector3<T> const& position, math::Vector3<T> const& center, math::Vector3<T> const& up);
+
+				constexpr Matrix4<T>&	operator=(const T arr[16]);
+				constexpr Matrix4<T>&	operator=(const T arr[][4]);
+				constexpr Matrix4<T>	operator+(Matrix4<T> const& matrix) const noexcept;
+				constexpr Matrix4<T>	operator-(Matrix4<T> const& matrix) const noexcept;
+				constexpr Matrix4<T>	operator*(Matrix4<T> const& matrix) const& noexcept;
+				constexpr Matrix4<T>	operator*(Matrix4<T> const& matrix) && noexcept;
+				constexpr Matrix4<T>	operator*(T scalar) const noexcept;
+				constexpr Matrix4<T>	operator/(T scalar) const noexcept;
+				constexpr Matrix4<T>&	operator+=(Matrix4<T> const& matrix) noexcept;
+				constexpr Matrix4<T>&	operator-=(Matrix4<T> const& matrix) noexcept;
+				constexpr Matrix4<T>&	operator*=(Matrix4<T> const& matrix) noexcept;
+				constexpr Matrix4<T>&	operator*=(T scalar) noexcept;
+				constexpr Matrix4<T>&	operator/=(T scalar) noexcept;
+
+				constexpr bool			operator==(Matrix4<T> const& matrix) const noexcept;
+				constexpr bool			operator!=(Matrix4<T> const& matrix) const noexcept;
+
+				using Matrix<4, 4, T>::m_matrix;
+
+	private:
+				using typename Matrix<4, 4, T>::Uninitialised;
+
+				constexpr explicit		Matrix4(Uninitialised) noexcept;
+
+				constexpr void			StoreAdjugate(T (&adjugate)[4][4]) const noexcept;
 	};
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>::Matrix4(void)
+	inline constexpr Matrix4<T>::Matrix4(void)
+		: Matrix<4, 4, T>()
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Matrix4<T>::Matrix4(T scalar)
+		: Matrix<4, 4, T>(scalar)
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Matrix4<T>::Matrix4(Matrix<4, 4, T> const& matrix)
+		: Matrix<4, 4, T>(matrix)
 	{
-		m_matrix[0][0] = 1; m_matrix[0][1] = 0; m_matrix[0][2] = 0; m_matrix[0][3] = 0;
-		m_matrix[1][0] = 0; m_matrix[1][1] = 1; m_matrix[1][2] = 0; m_matrix[1][3] = 0;
-		m_matrix[2][0] = 0; m_matrix[2][1] = 0; m_matrix[2][2] = 1; m_matrix[2][3] = 0;
-		m_matrix[3][0] = 0; m_matrix[3][1] = 0; m_matrix[3][2] = 0; m_matrix[3][3] = 1;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>::Matrix4(T scalar)
+	inline constexpr Matrix4<T>::Matrix4(Uninitialised) noexcept
+		: Matrix<4, 4, T>(Uninitialised())
 	{
-		m_matrix[0][0] = scalar; m_matrix[0][1] = 0; m_matrix[0][2]= 0; m_matrix[0][3] = 0;
-		m_matrix[1][0] = 0; m_matrix[1][1] = scalar; m_matrix[1][2]= 0; m_matrix[1][3] = 0;
-		m_matrix[2][0] = 0; m_matrix[2][1] = 0; m_matrix[2][2]= scalar; m_matrix[2][3] = 0;
-		m_matrix[3][0] = 0; m_matrix[3][1] = 0; m_matrix[3][2] = 0; m_matrix[3][3] = scalar;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>::Matrix4(T const arr[16])
+	inline constexpr Matrix4<T>::Matrix4(T const arr[16])
+		: Matrix<4, 4, T>(Uninitialised())
 	{
 		m_matrix[0][0] = arr[0]; m_matrix[0][1] = arr[1]; m_matrix[0][2] = arr[2]; m_matrix[0][3] = arr[3];
 		m_matrix[1][0] = arr[4]; m_matrix[1][1] = arr[5]; m_matrix[1][2] = arr[6]; m_matrix[1][3] = arr[7];
@@ -128,74 +172,61 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Matrix4<T>::Determinant(void)
+	inline constexpr T Matrix4<T>::Determinant(void) const noexcept
 	{
-		T determinant = (T) 0.0f;
-
-		for (int i = 0; i < 4; ++i)
-		{
-			// Create 3x3 matrix
-			Matrix3<T> minor;
-
-			// Iterate through 3x3 matrix
-			for (int j = 0; j < 3; ++j)
-			{
-				for (int k = 0; k < 3; ++k)
-				{
-					// Initialize minor matrix's values & skip column containing coefficient
-					minor.m_matrix[j][k] = (k < i) ? m_matrix[j + 1][k] : m_matrix[j + 1][k + 1];
-				}
-			}
-
-			// Get the determinant of 3x3 matrix
-			T minorDeterminant = minor.Determinant();
-
-			// Add or subtract minor's determinant depending if 'i' is even or odd
-			determinant += (i % 2 == 0) ? m_matrix[0][i] * minorDeterminant : -m_matrix[0][i] * minorDeterminant;
-		}
+		/*
+		*	Laplace expansion along the first row, the 3x3 minors are expanded
+		*	with the 2x2 sub determinants of the last 2 rows which are shared
+		*	between the minors
+		*/
 
-		return determinant;
+		const T subFactor00 = m_matrix[2][2] * m_matrix[3][3] - m_matrix[3][2] * m_matrix[2][3];
+		const T subFactor01 = m_matrix[2][1] * m_matrix[3][3] - m_matrix[3][1] * m_matrix[2][3];
+		const T subFactor02 = m_matrix[2][1] * m_matrix[3][2] - m_matrix[3][1] * m_matrix[2][2];
+		const T subFactor03 = m_matrix[2][0] * m_matrix[3][3] - m_matrix[3][0] * m_matrix[2][3];
+		const T subFactor04 = m_matrix[2][0] * m_matrix[3][2] - m_matrix[3][0] * m_matrix[2][2];
+		const T subFactor05 = m_matrix[2][0] * m_matrix[3][1] - m_matrix[3][0] * m_matrix[2][1];
+
+		const T cofactor0 =  (m_matrix[1][1] * subFactor00 - m_matrix[1][2] * subFactor01 + m_matrix[1][3] * subFactor02);
+		const T cofactor1 = -(m_matrix[1][0] * subFactor00 - m_matrix[1][2] * subFactor03 + m_matrix[1][3] * subFactor04);
+		const T cofactor2 =  (m_matrix[1][0] * subFactor01 - m_matrix[1][1] * subFactor03 + m_matrix[1][3] * subFactor05);
+		const T cofactor3 = -(m_matrix[1][0] * subFactor02 - m_matrix[1][1] * subFactor04 + m_matrix[1][2] * subFactor05);
+
+		return
+			m_matrix[0][0] * cofactor0 + m_matrix[0][1] * cofactor1 +
+			m_matrix[0][2] * cofactor2 + m_matrix[0][3] * cofactor3;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T> Matrix4<T>::Identity(void)
+	inline constexpr Matrix4<T> Matrix4<T>::Identity(void)
 	{
 		return Matrix4<T>();
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::Transpose(void)
+	inline constexpr Matrix4<T>& Matrix4<T>::Transpose(void) noexcept
 	{
-		Matrix4<T> tmp = *this;
-
-		m_matrix[0][0] = tmp.m_matrix[0][0]; m_matrix[0][1] = tmp.m_matrix[1][0]; m_matrix[0][2] = tmp.m_matrix[2][0]; m_matrix[0][3] = tmp.m_matrix[3][0];
-		m_matrix[1][0] = tmp.m_matrix[0][1]; m_matrix[1][1] = tmp.m_matrix[1][1]; m_matrix[1][2] = tmp.m_matrix[2][1]; m_matrix[1][3] = tmp.m_matrix[3][1];
-		m_matrix[2][0] = tmp.m_matrix[0][2]; m_matrix[2][1] = tmp.m_matrix[1][2]; m_matrix[2][2] = tmp.m_matrix[2][2]; m_matrix[2][3] = tmp.m_matrix[3][2];
-		m_matrix[3][0] = tmp.m_matrix[0][3]; m_matrix[3][1] = tmp.m_matrix[1][3]; m_matrix[3][2] = tmp.m_matrix[2][3]; m_matrix[3][3] = tmp.m_matrix[3][3];
+		Matrix<4, 4, T>::Transpose();
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::Minor(void)
+	inline constexpr Matrix4<T>& Matrix4<T>::Minor(void) noexcept
 	{
 		/*
 		*	Minor: set each value in the given 4x4 matrix equal to the determinant
-		*	of a 3x3 matrix
+		*	of a 3x3 matrix, the cofactor without its sign
 		*/
 
-		Matrix3<T> matrix3;
-		Matrix4<T> tmp(*this);
+		T adjugate[4][4];
+		StoreAdjugate(adjugate);
 
 		for (int i = 0; i < 4; ++i)
 		{
 			for (int j = 0; j < 4; ++j)
 			{
-				matrix3.GetMatrix3(tmp, i, j);
-
-				T determinant = matrix3.Determinant();
-
-				m_matrix[i][j] = determinant;
+				m_matrix[i][j] = ((i + j) & 1) ? -adjugate[j][i] : adjugate[j][i];
 			}
 		}
 
@@ -203,57 +234,195 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::Cofactor(void)
+	inline constexpr Matrix4<T>& Matrix4<T>::Cofactor(void) noexcept
 	{
 		/*
 		*	The cofactor of a matrix is the determinant when eliminating
 		*	a row & column from the matrix & multiplying by -1 or +1
 		*/
 
-		this->Minor();
+		T adjugate[4][4];
+		StoreAdjugate(adjugate);
 
-		m_matrix[0][1] = -m_matrix[0][1];
-		m_matrix[0][3] = -m_matrix[0][3];
-		m_matrix[1][0] = -m_matrix[1][0];
-		m_matrix[1][2] = -m_matrix[1][2];
-		m_matrix[2][1] = -m_matrix[2][1];
-		m_matrix[2][3] = -m_matrix[2][3];
-		m_matrix[3][0] = -m_matrix[3][0];
-		m_matrix[3][2] = -m_matrix[3][2];
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				m_matrix[i][j] = adjugate[j][i];
+			}
+		}
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::Adjugate(void)
+	inline constexpr Matrix4<T>& Matrix4<T>::Adjugate(void) noexcept
 	{
 		// An adjugate matrix is the transpose of the cofactor of a matrix
-		this->Cofactor();
-		this->Transpose();
+		T adjugate[4][4];
+		StoreAdjugate(adjugate);
+
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				m_matrix[i][j] = adjugate[i][j];
+			}
+		}
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::Inverse(void)
+	inline constexpr Matrix4<T>& Matrix4<T>::Inverse(void) noexcept
+	{
+		// A singular matrix is left unchanged, use TryInverse to detect it
+		TryInverse();
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Matrix4<T>::TryInverse(void) noexcept
 	{
 		/*
 		*	The inverse of a matrix is equal to the adjugate of the matrix
-		*	divided by the determinant
+		*	divided by the determinant.
 		*/
-		
-		T determinant = this->Determinant();
+
+#if LIBMATH_SIMD_SSE2
+		// Same operations as the generic version evaluated 4 lanes at a time
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (!std::is_constant_evaluated())
+				return simd::Matrix4Inverse(&m_matrix[0][0], &m_matrix[0][0]);
+		}
+#endif
+
+		T adjugate[4][4];
+		StoreAdjugate(adjugate);
+
+		T const (&m)[4][4] = m_matrix;
+
+		// The first row dotted with the first adjugate column is the determinant
+		const T determinant =
+			(m[0][0] * adjugate[0][0] + m[0][1] * adjugate[1][0]) +
+			(m[0][2] * adjugate[2][0] + m[0][3] * adjugate[3][0]);
+
+		if (determinant == 0)
+			return false;
+
+		const T oneOverDeterminant = static_cast<T>(1) / determinant;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				m_matrix[i][j] = adjugate[i][j] * oneOverDeterminant;
+			}
+		}
+
+		return true;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr void Matrix4<T>::StoreAdjugate(T (&adjugate)[4][4]) const noexcept
+	{
+		/*
+		*	Each cofactor is a 3x3 determinant expanded with the 2x2 sub
+		*	determinants of 2 columns, the 18 unique sub determinants are
+		*	computed once & shared between the 16 cofactors.
+		*/
+
+		T const (&m)[4][4] = m_matrix;
+
+		const T coef00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+		const T coef02 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+		const T coef03 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+		const T coef04 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+		const T coef06 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
+		const T coef07 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
+		const T coef08 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+		const T coef10 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
+		const T coef11 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
+		const T coef12 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+		const T coef14 = m[1][0] * m[3][3] - m[3][0] * m[1][3];
+		const T coef15 = m[1][0] * m[2][3] - m[2][0] * m[1][3];
+		const T coef16 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+		const T coef18 = m[1][0] * m[3][2] - m[3][0] * m[1][2];
+		const T coef19 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
+		const T coef20 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+		const T coef22 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
+		const T coef23 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
+
+		adjugate[0][0] =  (m[1][1] * coef00 - m[1][2] * coef04 + m[1][3] * coef08);
+		adjugate[0][1] = -(m[0][1] * coef00 - m[0][2] * coef04 + m[0][3] * coef08);
+		adjugate[0][2] =  (m[0][1] * coef02 - m[0][2] * coef06 + m[0][3] * coef10);
+		adjugate[0][3] = -(m[0][1] * coef03 - m[0][2] * coef07 + m[0][3] * coef11);
+
+		adjugate[1][0] = -(m[1][0] * coef00 - m[1][2] * coef12 + m[1][3] * coef16);
+		adjugate[1][1] =  (m[0][0] * coef00 - m[0][2] * coef12 + m[0][3] * coef16);
+		adjugate[1][2] = -(m[0][0] * coef02 - m[0][2] * coef14 + m[0][3] * coef18);
+		adjugate[1][3] =  (m[0][0] * coef03 - m[0][2] * coef15 + m[0][3] * coef19);
+
+		adjugate[2][0] =  (m[1][0] * coef04 - m[1][1] * coef12 + m[1][3] * coef20);
+		adjugate[2][1] = -(m[0][0] * coef04 - m[0][1] * coef12 + m[0][3] * coef20);
+		adjugate[2][2] =  (m[0][0] * coef06 - m[0][1] * coef14 + m[0][3] * coef22);
+		adjugate[2][3] = -(m[0][0] * coef07 - m[0][1] * coef15 + m[0][3] * coef23);
+
+		adjugate[3][0] = -(m[1][0] * coef08 - m[1][1] * coef16 + m[1][2] * coef20);
+		adjugate[3][1] =  (m[0][0] * coef08 - m[0][1] * coef16 + m[0][2] * coef20);
+		adjugate[3][2] = -(m[0][0] * coef10 - m[0][1] * coef18 + m[0][2] * coef22);
+		adjugate[3][3] =  (m[0][0] * coef11 - m[0][1] * coef19 + m[0][2] * coef23);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Matrix4<T>& Matrix4<T>::InverseAffine(void) noexcept
+	{
+		/*
+		*	Fast path for transforms whose last row is (0, 0, 0, 1)
+		*
+		*	|L t|^-1   |L^-1  -L^-1 * t|
+		*	|0 1|    = |0      1       |
+		*
+		*	The rows of L^-1 are the cross products of the columns of L
+		*	divided by the determinant. A singular matrix is left unchanged.
+		*/
+
+		_ASSERT(m_matrix[0][3] == 0 && m_matrix[1][3] == 0 && m_matrix[2][3] == 0 && m_matrix[3][3] == 1);
+
+		const Vector3<T> column0(m_matrix[0][0], m_matrix[0][1], m_matrix[0][2]);
+		const Vector3<T> column1(m_matrix[1][0], m_matrix[1][1], m_matrix[1][2]);
+		const Vector3<T> column2(m_matrix[2][0], m_matrix[2][1], m_matrix[2][2]);
+		const Vector3<T> translation(m_matrix[3][0], m_matrix[3][1], m_matrix[3][2]);
+
+		const Vector3<T> row0 = column1.Cross(column2);
+		const Vector3<T> row1 = column2.Cross(column0);
+		const Vector3<T> row2 = column0.Cross(column1);
+
+		const T determinant = column0.Dot(row0);
 
 		if (determinant == 0)
 			return *this;
 
-		*this = this->Adjugate() / determinant;
+		const T oneOverDeterminant = static_cast<T>(1) / determinant;
+
+		for (int i = 0; i < 3; ++i)
+		{
+			m_matrix[i][0] = row0[i] * oneOverDeterminant;
+			m_matrix[i][1] = row1[i] * oneOverDeterminant;
+			m_matrix[i][2] = row2[i] * oneOverDeterminant;
+		}
+
+		m_matrix[3][0] = -row0.Dot(translation) * oneOverDeterminant;
+		m_matrix[3][1] = -row1.Dot(translation) * oneOverDeterminant;
+		m_matrix[3][2] = -row2.Dot(translation) * oneOverDeterminant;
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::Scale(T scale)
+	inline constexpr Matrix4<T>& Matrix4<T>::Scale(T scale) noexcept
 	{
 		m_matrix[0][0] *= scale;
 		m_matrix[1][1] *= scale;
@@ -263,7 +432,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::Translate(math::Vector3<T> const& vec3, bool rowMajor)
+	inline constexpr Matrix4<T>& Matrix4<T>::Translate(math::Vector3<T> const& vec3, bool rowMajor) noexcept
 	{
 		if (rowMajor)
 		{
@@ -282,7 +451,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::Translate(T x, T y, T z, bool rowMajor)
+	inline constexpr Matrix4<T>& Matrix4<T>::Translate(T x, T y, T z, bool rowMajor) noexcept
 	{
 		if (rowMajor)
 		{
@@ -301,7 +470,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T> Matrix4<T>::Transform(Quaternion<T> const& quat)
+	inline constexpr Matrix4<T> Matrix4<T>::Transform(Quaternion<T> const& quat) const
 	{
 		Matrix4<T> result;
 
@@ -334,7 +503,154 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T> Matrix4<T>::Ortho(T left, T right, T bottom, T top, T zNear, T zFar)
+	inline constexpr Matrix4<T> Matrix4<T>::ComposeTRS(Vector3<T> const& translation, Quaternion<T> const& rotation, Vector3<T> const& scale) noexcept
+	{
+		/*
+		*	Rotation columns of Transform (without normalising the quaternion)
+		*	multiplied by the scales, translation in the last column. Same
+		*	result as Translate * Transform * Scale without the 2 products.
+		*/
+
+		const T one = static_cast<T>(1);
+		const T two = static_cast<T>(2);
+
+		const T w = rotation[0];
+		const T x = rotation[1];
+		const T y = rotation[2];
+		const T z = rotation[3];
+
+		Matrix4<T> result;
+
+		result.m_matrix[0][0] = (one - two * (y * y + z * z)) * scale[0];
+		result.m_matrix[0][1] = two * (x * y + w * z) * scale[0];
+		result.m_matrix[0][2] = two * (x * z - w * y) * scale[0];
+		result.m_matrix[1][0] = two * (x * y - w * z) * scale[1];
+		result.m_matrix[1][1] = (one - two * (x * x + z * z)) * scale[1];
+		result.m_matrix[1][2] = two * (y * z + w * x) * scale[1];
+		result.m_matrix[2][0] = two * (x * z + w * y) * scale[2];
+		result.m_matrix[2][1] = two * (y * z - w * x) * scale[2];
+		result.m_matrix[2][2] = (one - two * (x * x + y * y)) * scale[2];
+
+		result.m_matrix[3][0] = translation[0];
+		result.m_matrix[3][1] = translation[1];
+		result.m_matrix[3][2] = translation[2];
+
+		return result;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Matrix4<T>::ComposeTRS(std::span<Vector3<T> const> translations, std::span<Quaternion<T> const> rotations, std::span<Vector3<T> const> scales, std::span<Matrix4<T>> result)
+	{
+		_ASSERT(rotations.size() >= translations.size() && scales.size() >= translations.size());
+		_ASSERT(result.size() >= translations.size());
+
+		ParallelFor(translations.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			if constexpr (std::is_same_v<T, float>)
+			{
+				static_assert(sizeof(Vector3<float>) == 3 * sizeof(float));
+				static_assert(sizeof(Quaternion<float>) == 4 * sizeof(float));
+				static_assert(sizeof(Matrix4<float>) == 16 * sizeof(float));
+
+				simd::Matrix4ComposeTRS(reinterpret_cast<float*>(result.data() + begin), reinterpret_cast<float const*>(translations.data() + begin), reinterpret_cast<float const*>(rotations.data() + begin), reinterpret_cast<float const*>(scales.data() + begin), end - begin);
+				return;
+			}
+#endif
+
+			for (size_t i = begin; i < end; ++i)
+				result[i] = ComposeTRS(translations[i], rotations[i], scales[i]);
+		});
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Matrix4<T>::Decompose(Vector3<T>& translation, Quaternion<T>& rotation, Vector3<T>& scale) const noexcept
+	{
+		/*
+		*	M = translation * rotation * scale: the scales are the lengths of
+		*	the first 3 columns, a negative determinant (mirror) negates the x
+		*	scale so the basis left after dividing by the scales is a proper
+		*	rotation.
+		*
+		*	Sheared columns are not orthogonal, a cosine between 2 normalised
+		*	columns above INNACURATE_EPSILON is reported as shear. The output
+		*	is still filled, the rotation is the identity for a zero scale.
+		*/
+
+		const Vector3<T> column0(m_matrix[0][0], m_matrix[0][1], m_matrix[0][2]);
+		const Vector3<T> column1(m_matrix[1][0], m_matrix[1][1], m_matrix[1][2]);
+		const Vector3<T> column2(m_matrix[2][0], m_matrix[2][1], m_matrix[2][2]);
+
+		translation = Vector3<T>(m_matrix[3][0], m_matrix[3][1], m_matrix[3][2]);
+		scale = Vector3<T>(column0.Magnitude(), column1.Magnitude(), column2.Magnitude());
+
+		if (column0.Dot(column1.Cross(column2)) < static_cast<T>(0))
+			scale[0] = -scale[0];
+
+		if (scale[0] == static_cast<T>(0) || scale[1] == static_cast<T>(0) || scale[2] == static_cast<T>(0))
+		{
+			rotation = Quaternion<T>(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+			return false;
+		}
+
+		const Vector3<T> axis0 = column0 / scale[0];
+		const Vector3<T> axis1 = column1 / scale[1];
+		const Vector3<T> axis2 = column2 / scale[2];
+
+		rotation = quaternion::FromBasis(axis0, axis1, axis2);
+
+		const T tolerance = static_cast<T>(INNACURATE_EPSILON);
+
+		const bool orthogonal =
+			math::Abs(axis0.Dot(axis1)) <= tolerance &&
+			math::Abs(axis0.Dot(axis2)) <= tolerance &&
+			math::Abs(axis1.Dot(axis2)) <= tolerance;
+
+		const bool affine =
+			m_matrix[0][3] == static_cast<T>(0) && m_matrix[1][3] == static_cast<T>(0) &&
+			m_matrix[2][3] == static_cast<T>(0) && m_matrix[3][3] == static_cast<T>(1);
+
+		return orthogonal && affine;
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t Matrix4<T>::Decompose(std::span<Matrix4<T> const> matrices, std::span<Vector3<T>> translations, std::span<Quaternion<T>> rotations, std::span<Vector3<T>> scales)
+	{
+		// Returns the number of matrices Decompose reports as not TRS
+		_ASSERT(translations.size() >= matrices.size() && rotations.size() >= matrices.size() && scales.size() >= matrices.size());
+
+		std::atomic<size_t> failures = 0;
+
+		ParallelFor(matrices.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			if constexpr (std::is_same_v<T, float>)
+			{
+				static_assert(sizeof(Vector3<float>) == 3 * sizeof(float));
+				static_assert(sizeof(Quaternion<float>) == 4 * sizeof(float));
+				static_assert(sizeof(Matrix4<float>) == 16 * sizeof(float));
+
+				failures += simd::Matrix4Decompose(reinterpret_cast<float*>(translations.data() + begin), reinterpret_cast<float*>(rotations.data() + begin), reinterpret_cast<float*>(scales.data() + begin), reinterpret_cast<float const*>(matrices.data() + begin), end - begin);
+				return;
+			}
+#endif
+
+			size_t rangeFailures = 0;
+
+			for (size_t i = begin; i < end; ++i)
+			{
+				if (!matrices[i].Decompose(translations[i], rotations[i], scales[i]))
+					++rangeFailures;
+			}
+
+			failures += rangeFailures;
+		});
+
+		return failures;
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr Matrix4<T> Matrix4<T>::Ortho(T left, T right, T bottom, T top, T zNear, T zFar)
 	{
 		Matrix4<T> result;
 		const T two = static_cast<T>(2.0f);
@@ -350,7 +666,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T> Matrix4<T>::Perspective(math::Vector3<T> const& position, math::Vector3<T> const& center, math::Vector3<T> const& up)
+	inline constexpr Matrix4<T> Matrix4<T>::Perspective(math::Vector3<T> const& position, math::Vector3<T> const& center, math::Vector3<T> const& up)
 	{
 		Matrix4<T> result;
 
@@ -378,7 +694,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& math::Matrix4<T>::operator=(const T arr[16])
+	inline constexpr Matrix4<T>& math::Matrix4<T>::operator=(const T arr[16])
 	{
 		m_matrix[0][0] = arr[0]; m_matrix[1][0] =  arr[1]; m_matrix[2][0] =  arr[2]; m_matrix[3][0] =  arr[3];
 		m_matrix[0][1] = arr[4]; m_matrix[1][1] =  arr[5]; m_matrix[2][1] =  arr[6]; m_matrix[3][1] =  arr[7];
@@ -389,7 +705,7 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::operator=(const T arr[][4])
+	inline constexpr Matrix4<T>& Matrix4<T>::operator=(const T arr[][4])
 	{
 		m_matrix[0][0] = arr[0]; m_matrix[1][0] = arr[1]; m_matrix[2][0] = arr[2]; m_matrix[3][0] = arr[3];
 		m_matrix[0][1] = arr[4]; m_matrix[1][1] = arr[5]; m_matrix[2][1] = arr[6]; m_matrix[3][1] = arr[7];
@@ -400,156 +716,174 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T> Matrix4<T>::operator+(Matrix4<T> const& matrix)
+	inline constexpr Matrix4<T> Matrix4<T>::operator+(Matrix4<T> const& matrix) const noexcept
 	{
 		Matrix4<T> result(*this);
-
-		for (int i = 0; i < 4; ++i)
-		{
-			for (int j = 0; j < 4; ++j)
-			{
-				result.m_matrix[i][j] += matrix.m_matrix[i][j];
-			}
-		}
+		result += matrix;
 
 		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T> Matrix4<T>::operator-(Matrix4<T> const& matrix)
+	inline constexpr Matrix4<T> Matrix4<T>::operator-(Matrix4<T> const& matrix) const noexcept
 	{
 		Matrix4<T> result(*this);
-
-		for (int i = 0; i < 4; ++i)
-		{
-			for (int j = 0; j < 4; ++j)
-			{
-				result.m_matrix[i][j] -= matrix.m_matrix[i][j];
-			}
-		}
+		result -= matrix;
 
 		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T> Matrix4<T>::operator*(Matrix4<T> const& matrix)
+	inline constexpr Matrix4<T> Matrix4<T>::operator*(Matrix4<T> const& matrix) const& noexcept
 	{
-		// Create a null 4x4 matrix
-		Matrix4<T> result((T) 0.0f);
+		Matrix4<T> result{ Uninitialised() };
 
-		// Iterate through matrix to set the result matrix equal to the result of the 2 matrices multiplied
-		for (int i = 0; i < 4; ++i)
-		{
-			for (int j = 0; j < 4; ++j)
-			{
-				for (int k = 0; k < 4; ++k)
-				{
+		MatrixMultiply(result, *this, matrix);
 
+		return result;
+	}
 
-					// Add the value obtained from multiplying the 2 matrices row * column
-					result.m_matrix[j][i] += m_matrix[k][i] * matrix.m_matrix[j][k];
-				}
-			}
-		}
+	template<math::math_type::NumericType T>
+	inline constexpr Matrix4<T> Matrix4<T>::operator*(Matrix4<T> const& matrix) && noexcept
+	{
+		// The left operand is a temporary, e.g. a * b in a * b * c * d, the product is written to it instead of a new matrix
+		MatrixMultiply(*this, *this, matrix);
 
-		return result;
+		return std::move(*this);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T> Matrix4<T>::operator*(T scalar)
+	inline constexpr Matrix4<T> Matrix4<T>::operator*(T scalar) const noexcept
 	{
 		Matrix4<T> result(*this);
-
-		for (int i = 0; i < 4; ++i)
-		{
-			for (int j = 0; j < 4; ++j)
-			{
-				result.m_matrix[i][j] *= scalar;
-			}
-		}
+		result *= scalar;
 
 		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T> Matrix4<T>::operator/(T scalar)
+	inline constexpr Matrix4<T> Matrix4<T>::operator/(T scalar) const noexcept
 	{
-		_ASSERT(scalar != 0);
-
 		Matrix4<T> result(*this);
-
-		for (int i = 0; i < 4; ++i)
-		{
-			for (int j = 0; j < 4; ++j)
-			{
-				result.m_matrix[i][j] /= scalar;
-			}
-		}
+		result /= scalar;
 
 		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::operator+=(Matrix4<T> const& matrix)
+	inline constexpr Matrix4<T>& Matrix4<T>::operator+=(Matrix4<T> const& matrix) noexcept
 	{
-		*this = *this + matrix;
+		Matrix<4, 4, T>::operator+=(matrix);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::operator-=(Matrix4<T> const& matrix)
+	inline constexpr Matrix4<T>& Matrix4<T>::operator-=(Matrix4<T> const& matrix) noexcept
 	{
-		*this = *this - matrix;
+		Matrix<4, 4, T>::operator-=(matrix);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::operator*=(Matrix4<T> const& matrix)
+	inline constexpr Matrix4<T>& Matrix4<T>::operator*=(Matrix4<T> const& matrix) noexcept
 	{
-		Matrix4<T> tmp(matrix);
-		*this = tmp * *this;
-		
+		// Multiplies on the left, *this = matrix * *this
+		MatrixMultiply(*this, matrix, *this);
+
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::operator*=(T scalar)
+	inline constexpr Matrix4<T>& Matrix4<T>::operator*=(T scalar) noexcept
 	{
-		*this = *this * scalar;
+		Matrix<4, 4, T>::operator*=(scalar);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Matrix4<T>& Matrix4<T>::operator/=(T scalar)
+	inline constexpr Matrix4<T>& Matrix4<T>::operator/=(T scalar) noexcept
 	{
-		*this = *this / scalar;
+		Matrix<4, 4, T>::operator/=(scalar);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Matrix4<T>::operator==(Matrix4<T> const& matrix) const noexcept
+	inline constexpr bool Matrix4<T>::operator==(Matrix4<T> const& matrix) const noexcept
 	{
-		for (int i = 0; i < 4; ++i)
+		return math::AlmostEqual(*this, matrix);
+	}
+
+	template<math::math_type::NumericType T>
+	inline constexpr bool Matrix4<T>::operator!=(Matrix4<T> const& matrix) const noexcept
+	{
+		return !math::AlmostEqual(*this, matrix);
+	}
+
+	// Quaternion::FromMatrix4 needs the Matrix4 layout, Quaternion.h can't include this header
+	namespace quaternion
+	{
+		template<math::math_type::NumericType T>
+		inline constexpr Quaternion<T> FromMatrix4(Matrix4<T> const& matrix)
 		{
-			for (int j = 0; j < 4; ++j)
+			// Upper 3x3, translation & projection are ignored
+			return FromScaledBasis(
+				Vector3<T>(matrix.m_matrix[0][0], matrix.m_matrix[0][1], matrix.m_matrix[0][2]),
+				Vector3<T>(matrix.m_matrix[1][0], matrix.m_matrix[1][1], matrix.m_matrix[1][2]),
+				Vector3<T>(matrix.m_matrix[2][0], matrix.m_matrix[2][1], matrix.m_matrix[2][2])
+			);
+		}
+
+		template<math::math_type::NumericType T>
+		inline void FromMatrix4(std::span<Matrix4<T> const> matrices, std::span<Quaternion<T>> result)
+		{
+			_ASSERT(result.size() >= matrices.size());
+
+			ParallelFor(matrices.size(), [&](size_t begin, size_t end)
 			{
-				if (!AlmostEqual(m_matrix[i][j], matrix.m_matrix[i][j]))
-					return false;
-			}
+#if LIBMATH_SIMD_SSE2
+				if constexpr (std::is_same_v<T, float>)
+				{
+					static_assert(sizeof(Matrix4<float>) == 16 * sizeof(float));
+					static_assert(sizeof(Quaternion<float>) == 4 * sizeof(float));
+
+					simd::Matrix4ToQuaternion(reinterpret_cast<float*>(result.data() + begin), reinterpret_cast<float const*>(matrices.data() + begin), end - begin);
+					return;
+				}
+#endif
+
+				for (size_t i = begin; i < end; ++i)
+					result[i] = FromMatrix4(matrices[i]);
+			});
 		}
+	}
 
-		return true;
+	template<math::math_type::NumericType T>
+	inline constexpr Quaternion<T> Quaternion<T>::FromMatrix4(Matrix4<T> const& matrix)
+	{
+		return quaternion::FromMatrix4(matrix);
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Matrix4<T>::operator!=(Matrix4<T> const& matrix) const noexcept
+	inline void Quaternion<T>::FromMatrix4(std::span<Matrix4<T> const> matrices, std::span<Quaternion<T>> result)
+	{
+		quaternion::FromMatrix4(matrices, result);
+	}
+
+#if LIBMATH_SIMD_SSE2
+	inline constexpr Quaternion<float> Quaternion<float>::FromMatrix4(Matrix4<float> const& matrix)
+	{
+		return quaternion::FromMatrix4(matrix);
+	}
+
+	inline void Quaternion<float>::FromMatrix4(std::span<Matrix4<float> const> matrices, std::span<Quaternion<float>> result)
 	{
-		return !(*this == matrix);
+		quaternion::FromMatrix4(matrices, result);
 	}
+#endif
 }
 
 namespace LibMath = math;
\ No newline at end of file
@@ -0,0 +1,576 @@
+#pragma once
+
+#include "../VariableType.hpp"
+#include "../simd/Simd.h"
+#include "../simd/Float4.h"
+#include "../vector/VectorN.h"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/*
+*	------- Matrix<R, C, T> -------
+*	R rows by C columns, column major like Matrix4: m_matrix[column][row].
+*	Every loop is unrolled at compile time, matrices with 4 float rows
+*	(4x4, 4x3 ...) keep each column in one __m128 & multiply with SSE2.
+*	Sums are added from left to right in both paths so they give the
+*	same results.
+*
+*	A vector is a column, M * v = column 0 * v[0] + column 1 * v[1] ...
+*	v * M treats v as a row (e.g. a 4x3 skinning matrix applied to
+*	(x, y, z, 1) gives a Vector<3>). An R x (R + 1) matrix is affine,
+*	TransformPoint & TransformDirection use an implicit 1 or 0 for the
+*	last component (3x4: rotation & scale in the first 3 columns,
+*	translation in the last).
+*
+*	Matrix2, Matrix3 & Matrix4 derive from the square sizes & forward
+*	their arithmetic & products to MatrixMultiply, they convert to them
+*	implicitly & back explicitly. Determinant & Inverse use their closed
+*	forms (include LibMath/Matrix.h). Unlike Matrix4::operator*=,
+*	a *= b is a = a * b, both are computed in place.
+*
+*	Constructor
+*	- Void				DONE	(identity, 1 on the diagonal)
+*	- Scalar			DONE	(diagonal)
+*	- Array				DONE	(column major)
+*	- Columns			DONE
+*
+*	Functions
+*	- Identity			DONE
+*	- Zero				DONE
+*	- Column			DONE
+*	- Row				DONE
+*	- SetColumn			DONE
+*	- SetRow			DONE
+*	- Transposed		DONE
+*	- Transpose			DONE	(square)
+*	- Determinant		DONE	(square up to 4)
+*	- Inverse			DONE	(square up to 4)
+*	- TransformPoint	DONE	(affine)
+*	- TransformDirection DONE	(affine)
+*
+*	Operators
+*	- Addition			DONE
+*	- Subtraction		DONE
+*	- Multiplication	DONE	(scalar, matrix, column & row vector)
+*	- Division			DONE	(scalar)
+*	- Equality			DONE
+*	- Inverse equality	DONE
+*	- AlmostEqual		DONE	(free function, per element)
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class Matrix2;
+
+	template<math::math_type::NumericType T>
+	class Matrix3;
+
+	template<math::math_type::NumericType T>
+	class Matrix4;
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	class alignas((R == 4 && std::is_same_v<T, float>) ? 16 : alignof(T)) Matrix
+	{
+		static_assert(R > 0 && C > 0, "Matrix needs at least one row & one column");
+
+	public:
+		static constexpr size_t		Rows = R;
+		static constexpr size_t		Columns = C;
+
+		constexpr					Matrix(void);
+		constexpr explicit			Matrix(T scalar);
+		constexpr explicit			Matrix(T const (&values)[R * C]);
+
+		template<typename... ColumnVectors> requires (sizeof...(ColumnVectors) == C && (std::is_same_v<ColumnVectors, Vector<R, T>> && ...))
+		constexpr explicit			Matrix(ColumnVectors const&... columns);
+
+									~Matrix(void) = default;
+
+		static constexpr Matrix		Identity(void) noexcept;
+		static constexpr Matrix		Zero(void) noexcept;
+
+		constexpr Vector<R, T>		Column(size_t column) const;
+		constexpr Vector<C, T>		Row(size_t row) const;
+		constexpr Matrix&			SetColumn(size_t column, Vector<R, T> const& vec);
+		constexpr Matrix&			SetRow(size_t row, Vector<C, T> const& vec);
+
+		constexpr Matrix<C, R, T>	Transposed(void) const noexcept;
+		constexpr Matrix&			Transpose(void) noexcept requires (R == C);
+		constexpr T					Determinant(void) const noexcept requires (R == C && R >= 2 && R <= 4);
+		constexpr Matrix&			Inverse(void) noexcept requires (R == C && R >= 2 && R <= 4);
+
+		constexpr Vector<R, T>		TransformPoint(Vector<R, T> const& point) const noexcept requires (C == R + 1);
+		constexpr Vector<R, T>		TransformDirection(Vector<R, T> const& direction) const noexcept requires (C == R + 1);
+
+		constexpr Matrix			operator+(Matrix const& matrix) const noexcept;
+		constexpr Matrix			operator-(Matrix const& matrix) const noexcept;
+		constexpr Matrix			operator*(T scalar) const noexcept;
+		constexpr Matrix			operator/(T scalar) const noexcept;
+		constexpr Matrix&			operator+=(Matrix const& matrix) noexcept;
+		constexpr Matrix&			operator-=(Matrix const& matrix) noexcept;
+		constexpr Matrix&			operator*=(Matrix<C, C, T> const& matrix) noexcept;
+		constexpr Matrix&			operator*=(T scalar) noexcept;
+		constexpr Matrix&			operator/=(T scalar) noexcept;
+		constexpr bool				operator==(Matrix const& matrix) const noexcept;
+		constexpr bool				operator!=(Matrix const& matrix) const noexcept;
+
+		T m_matrix[C][R];
+
+	protected:
+		// Leaves m_matrix uninitialised, for results whose elements are all written next
+		struct Uninitialised {};
+
+		constexpr explicit			Matrix(Uninitialised) noexcept {}
+
+		template<size_t LhsR, size_t K, size_t RhsC, math::math_type::NumericType U>
+		friend constexpr Matrix<LhsR, RhsC, U>	operator*(Matrix<LhsR, K, U> const& lhs, Matrix<K, RhsC, U> const& rhs) noexcept;
+	};
+
+	// Affine transform & its transpose (skinning palettes are often stored as rows)
+	template<math::math_type::NumericType T>
+	using Matrix3x4 = Matrix<3, 4, T>;
+
+	template<math::math_type::NumericType T>
+	using Matrix4x3 = Matrix<4, 3, T>;
+
+	// result = lhs * rhs without a temporary, result may be lhs or rhs
+	template<size_t R, size_t K, size_t C, math::math_type::NumericType T>
+	inline constexpr void MatrixMultiply(Matrix<R, C, T>& result, Matrix<R, K, T> const& lhs, Matrix<K, C, T> const& rhs) noexcept;
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T>::Matrix(void)
+		: Matrix(static_cast<T>(1))
+	{
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T>::Matrix(T scalar)
+		: m_matrix{}
+	{
+		Unroll<(R < C) ? R : C>([&](size_t i) { m_matrix[i][i] = scalar; });
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T>::Matrix(T const (&values)[R * C])
+	{
+		Unroll<C>([&](size_t column)
+		{
+			Unroll<R>([&](size_t row) { m_matrix[column][row] = values[column * R + row]; });
+		});
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	template<typename... ColumnVectors> requires (sizeof...(ColumnVectors) == C && (std::is_same_v<ColumnVectors, Vector<R, T>> && ...))
+	inline constexpr Matrix<R, C, T>::Matrix(ColumnVectors const&... columns)
+	{
+		size_t column = 0;
+
+		((SetColumn(column++, columns)), ...);
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T> Matrix<R, C, T>::Identity(void) noexcept
+	{
+		return Matrix<R, C, T>();
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T> Matrix<R, C, T>::Zero(void) noexcept
+	{
+		return Matrix<R, C, T>(static_cast<T>(0));
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Vector<R, T> Matrix<R, C, T>::Column(size_t column) const
+	{
+		_ASSERT(column < C);
+
+		Vector<R, T> result;
+
+		Unroll<R>([&](size_t row) { result[row] = m_matrix[column][row]; });
+
+		return result;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Vector<C, T> Matrix<R, C, T>::Row(size_t row) const
+	{
+		_ASSERT(row < R);
+
+		Vector<C, T> result;
+
+		Unroll<C>([&](size_t column) { result[column] = m_matrix[column][row]; });
+
+		return result;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::SetColumn(size_t column, Vector<R, T> const& vec)
+	{
+		_ASSERT(column < C);
+
+		Unroll<R>([&](size_t row) { m_matrix[column][row] = vec[row]; });
+
+		return *this;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::SetRow(size_t row, Vector<C, T> const& vec)
+	{
+		_ASSERT(row < R);
+
+		Unroll<C>([&](size_t column) { m_matrix[column][row] = vec[column]; });
+
+		return *this;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<C, R, T> Matrix<R, C, T>::Transposed(void) const noexcept
+	{
+		Matrix<C, R, T> result;
+
+		Unroll<C>([&](size_t column)
+		{
+			Unroll<R>([&](size_t row) { result.m_matrix[row][column] = m_matrix[column][row]; });
+		});
+
+		return result;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::Transpose(void) noexcept requires (R == C)
+	{
+		// Swap the elements above the diagonal with the ones below it
+		Unroll<R * R>([&](size_t i)
+		{
+			const size_t column = i / R;
+			const size_t row = i % R;
+
+			if (row < column)
+				std::swap(m_matrix[column][row], m_matrix[row][column]);
+		});
+
+		return *this;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr T Matrix<R, C, T>::Determinant(void) const noexcept requires (R == C && R >= 2 && R <= 4)
+	{
+		if constexpr (R == 2)
+			return Matrix2<T>(*this).Determinant();
+		else if constexpr (R == 3)
+			return Matrix3<T>(*this).Determinant();
+		else
+			return Matrix4<T>(*this).Determinant();
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::Inverse(void) noexcept requires (R == C && R >= 2 && R <= 4)
+	{
+		if constexpr (R == 2)
+			return *this = Matrix2<T>(*this).Inverse();
+		else if constexpr (R == 3)
+			return *this = Matrix3<T>(*this).Inverse();
+		else
+			return *this = Matrix4<T>(*this).Inverse();
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Vector<R, T> Matrix<R, C, T>::TransformPoint(Vector<R, T> const& point) const noexcept requires (C == R + 1)
+	{
+		// M * (point, 1), the translation column is added last
+		Vector<R, T> result;
+
+		Unroll<R>([&](size_t row)
+		{
+			T sum = m_matrix[0][row] * point[0];
+
+			Unroll<R - 1>([&](size_t column) { sum += m_matrix[column + 1][row] * point[column + 1]; });
+
+			result[row] = sum + m_matrix[R][row];
+		});
+
+		return result;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Vector<R, T> Matrix<R, C, T>::TransformDirection(Vector<R, T> const& direction) const noexcept requires (C == R + 1)
+	{
+		// M * (direction, 0), the translation column is ignored
+		Vector<R, T> result;
+
+		Unroll<R>([&](size_t row)
+		{
+			T sum = m_matrix[0][row] * direction[0];
+
+			Unroll<R - 1>([&](size_t column) { sum += m_matrix[column + 1][row] * direction[column + 1]; });
+
+			result[row] = sum;
+		});
+
+		return result;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T> Matrix<R, C, T>::operator+(Matrix<R, C, T> const& matrix) const noexcept
+	{
+		Matrix<R, C, T> result(*this);
+		result += matrix;
+
+		return result;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T> Matrix<R, C, T>::operator-(Matrix<R, C, T> const& matrix) const noexcept
+	{
+		Matrix<R, C, T> result(*this);
+		result -= matrix;
+
+		return result;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T> Matrix<R, C, T>::operator*(T scalar) const noexcept
+	{
+		Matrix<R, C, T> result(*this);
+		result *= scalar;
+
+		return result;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T> Matrix<R, C, T>::operator/(T scalar) const noexcept
+	{
+		Matrix<R, C, T> result(*this);
+		result /= scalar;
+
+		return result;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::operator+=(Matrix<R, C, T> const& matrix) noexcept
+	{
+		Unroll<C>([&](size_t column)
+		{
+			Unroll<R>([&](size_t row) { m_matrix[column][row] += matrix.m_matrix[column][row]; });
+		});
+
+		return *this;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::operator-=(Matrix<R, C, T> const& matrix) noexcept
+	{
+		Unroll<C>([&](size_t column)
+		{
+			Unroll<R>([&](size_t row) { m_matrix[column][row] -= matrix.m_matrix[column][row]; });
+		});
+
+		return *this;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::operator*=(Matrix<C, C, T> const& matrix) noexcept
+	{
+		MatrixMultiply(*this, *this, matrix);
+
+		return *this;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::operator*=(T scalar) noexcept
+	{
+		Unroll<C>([&](size_t column)
+		{
+			Unroll<R>([&](size_t row) { m_matrix[column][row] *= scalar; });
+		});
+
+		return *this;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T>& Matrix<R, C, T>::operator/=(T scalar) noexcept
+	{
+		_ASSERT(scalar != static_cast<T>(0));
+
+		Unroll<C>([&](size_t column)
+		{
+			Unroll<R>([&](size_t row) { m_matrix[column][row] /= scalar; });
+		});
+
+		return *this;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr bool Matrix<R, C, T>::operator==(Matrix<R, C, T> const& matrix) const noexcept
+	{
+		bool equal = true;
+
+		Unroll<C>([&](size_t column)
+		{
+			Unroll<R>([&](size_t row) { equal = equal && m_matrix[column][row] == matrix.m_matrix[column][row]; });
+		});
+
+		return equal;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr bool Matrix<R, C, T>::operator!=(Matrix<R, C, T> const& matrix) const noexcept
+	{
+		return !(*this == matrix);
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T> operator*(T scalar, Matrix<R, C, T> const& matrix) noexcept
+	{
+		return matrix * scalar;
+	}
+
+	template<size_t R, size_t K, size_t C, math::math_type::NumericType T>
+	inline constexpr void MatrixMultiply(Matrix<R, C, T>& result, Matrix<R, K, T> const& lhs, Matrix<K, C, T> const& rhs) noexcept
+	{
+		/*
+		*	result = lhs * rhs, column c of the result is lhs column 0 * rhs[c][0]
+		*	+ lhs column 1 * rhs[c][1] ... added from left to right. lhs is read
+		*	first & each rhs column before the result column it gives, result
+		*	may be lhs or rhs.
+		*/
+
+#if LIBMATH_SIMD_SSE2
+		if constexpr (R == 4 && std::is_same_v<T, float>)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				if constexpr (K == 4 && C == 4)
+				{
+#ifdef LIBMATH_ENABLE_FMA
+					// Runtime dispatched, the FMA kernel rounds differently from the SSE2 one
+					simd::Matrix4Multiply(&result.m_matrix[0][0], &lhs.m_matrix[0][0], &rhs.m_matrix[0][0]);
+#else
+					// SSE2 is the baseline & AVX gives the same bits, inline the SSE2 kernel rather than calling through the dispatcher
+					simd::Matrix4MultiplySSE2(&result.m_matrix[0][0], &lhs.m_matrix[0][0], &rhs.m_matrix[0][0]);
+#endif
+				}
+				else
+				{
+					__m128 columns[K];
+
+					Unroll<K>([&](size_t k) { columns[k] = _mm_load_ps(lhs.m_matrix[k]); });
+					Unroll<C>([&](size_t c)
+					{
+						__m128 sum = _mm_mul_ps(columns[0], _mm_set1_ps(rhs.m_matrix[c][0]));
+
+						Unroll<K - 1>([&](size_t k) { sum = _mm_add_ps(sum, _mm_mul_ps(columns[k + 1], _mm_set1_ps(rhs.m_matrix[c][k + 1]))); });
+
+						_mm_store_ps(result.m_matrix[c], sum);
+					});
+				}
+
+				return;
+			}
+		}
+#endif
+
+		T left[K][R];
+
+		Unroll<K>([&](size_t k)
+		{
+			Unroll<R>([&](size_t r) { left[k][r] = lhs.m_matrix[k][r]; });
+		});
+
+		Unroll<C>([&](size_t c)
+		{
+			T right[K];
+
+			Unroll<K>([&](size_t k) { right[k] = rhs.m_matrix[c][k]; });
+			Unroll<R>([&](size_t r)
+			{
+				T sum = left[0][r] * right[0];
+
+				Unroll<K - 1>([&](size_t k) { sum += left[k + 1][r] * right[k + 1]; });
+
+				result.m_matrix[c][r] = sum;
+			});
+		});
+	}
+
+	template<size_t R, size_t K, size_t C, math::math_type::NumericType T>
+	inline constexpr Matrix<R, C, T> operator*(Matrix<R, K, T> const& lhs, Matrix<K, C, T> const& rhs) noexcept
+	{
+		Matrix<R, C, T> result{ typename Matrix<R, C, T>::Uninitialised() };
+		MatrixMultiply(result, lhs, rhs);
+
+		return result;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Vector<R, T> operator*(Matrix<R, C, T> const& matrix, Vector<C, T> const& vec) noexcept
+	{
+#if LIBMATH_SIMD_SSE2
+		if constexpr (R == 4 && std::is_same_v<T, float>)
+		{
+			if (!std::is_constant_evaluated())
+			{
+				__m128 sum = _mm_mul_ps(_mm_load_ps(matrix.m_matrix[0]), _mm_set1_ps(vec[0]));
+
+				Unroll<C - 1>([&](size_t c) { sum = _mm_add_ps(sum, _mm_mul_ps(_mm_load_ps(matrix.m_matrix[c + 1]), _mm_set1_ps(vec[c + 1]))); });
+
+				Vector<R, T> result;
+				_mm_store_ps(result.Data(), sum);
+
+				return result;
+			}
+		}
+#endif
+
+		Vector<R, T> result;
+
+		Unroll<R>([&](size_t r)
+		{
+			T sum = matrix.m_matrix[0][r] * vec[0];
+
+			Unroll<C - 1>([&](size_t c) { sum += matrix.m_matrix[c + 1][r] * vec[c + 1]; });
+
+			result[r] = sum;
+		});
+
+		return result;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr Vector<C, T> operator*(Vector<R, T> const& vec, Matrix<R, C, T> const& matrix) noexcept
+	{
+		// Row vector, result[c] is the dot product of vec & column c
+		Vector<C, T> result;
+
+		Unroll<C>([&](size_t c)
+		{
+			T sum = vec[0] * matrix.m_matrix[c][0];
+
+			Unroll<R - 1>([&](size_t r) { sum += vec[r + 1] * matrix.m_matrix[c][r + 1]; });
+
+			result[c] = sum;
+		});
+
+		return result;
+	}
+
+	template<size_t R, size_t C, math::math_type::NumericType T>
+	inline constexpr bool AlmostEqual(Matrix<R, C, T> const& lhs, Matrix<R, C, T> const& rhs) noexcept
+	{
+		// Every element within epsilon, the == of Matrix2, Matrix3 & Matrix4
+		bool equal = true;
+
+		Unroll<C>([&](size_t column)
+		{
+			Unroll<R>([&](size_t row) { equal = equal && math::AlmostEqual(lhs.m_matrix[column][row], rhs.m_matrix[column][row]); });
+		});
+
+		return equal;
+	}
+}
+
+namespace LibMath = math;
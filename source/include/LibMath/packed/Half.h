@@ -0,0 +1,211 @@
+#pragma once
+
+#include "../Arithmetic.h"
+#include "../Parallel.h"
+#include "../simd/Simd.h"
+#include "../vector/Vector3.h"
+#include "../vector/Vector4.h"
+
+#include <bit>
+#include <cstdint>
+#include <span>
+
+/*
+*	------- Half -------
+*	IEEE 754 binary16 storage: 1 sign, 5 exponent & 10 mantissa bits.
+*	Normal values range from 6.1e-5 to 65504 with a relative error
+*	below 2^-11 (4.9e-4), smaller values are denormals with an absolute
+*	error below 2^-25 (3e-8).
+*
+*	Float to half rounds to nearest even, values from 65520 up become
+*	infinity & NaN stays NaN (0x7e00). Half to float is exact.
+*
+*	Pack & Unpack convert spans of floats, Vector3<float> or
+*	Vector4<float> (3 or 4 halves per vector). The SSE2 kernels convert
+*	4 floats per iteration with integer operations & give the same bits
+*	as the scalar conversion, large spans are split across threads.
+*
+*	Constructor
+*	- Void				DONE	(0)
+*	- Float				DONE
+*
+*	Functions
+*	- FromBits			DONE
+*	- Bits				DONE
+*	- Pack				DONE	(float, Vector3 & Vector4 spans)
+*	- Unpack			DONE	(float, Vector3 & Vector4 spans)
+*
+*	Operators
+*	- Float				DONE
+*	- Equality			DONE	(bitwise)
+*	- Inverse equality	DONE	(bitwise)
+*/
+
+namespace math
+{
+	class Half
+	{
+	public:
+		constexpr				Half(void);
+		constexpr explicit		Half(float value) noexcept;
+
+								~Half(void) = default;
+
+		static constexpr Half	FromBits(uint16_t bits) noexcept;
+		constexpr uint16_t		Bits(void) const noexcept;
+
+		constexpr explicit		operator float(void) const noexcept;
+		constexpr bool			operator==(Half const& half) const noexcept;
+		constexpr bool			operator!=(Half const& half) const noexcept;
+
+	private:
+		uint16_t	m_bits;
+	};
+
+	inline void Pack(std::span<float const> values, std::span<Half> result);
+	inline void Pack(std::span<Vector3<float> const> vectors, std::span<Half> result);
+	inline void Pack(std::span<Vector4<float> const> vectors, std::span<Half> result);
+	inline void Unpack(std::span<Half const> values, std::span<float> result);
+	inline void Unpack(std::span<Half const> values, std::span<Vector3<float>> result);
+	inline void Unpack(std::span<Half const> values, std::span<Vector4<float>> result);
+
+	inline constexpr Half::Half(void)
+		: m_bits(0)
+	{
+	}
+
+	inline constexpr Half::Half(float value) noexcept
+	{
+		const uint32_t bits = std::bit_cast<uint32_t>(value);
+		const uint32_t sign = bits & 0x80000000u;
+		const uint32_t absolute = bits ^ sign;
+
+		uint32_t result;
+
+		if (absolute >= 0x47800000u)
+		{
+			// 65536 & above, infinity or NaN
+			result = (absolute > 0x7f800000u) ? 0x7e00u : 0x7c00u;
+		}
+		else if (absolute < 0x38800000u)
+		{
+			// Below 2^-14, adding 0.5 aligns the denormal mantissa with the float mantissa & rounds it to nearest even
+			result = std::bit_cast<uint32_t>(std::bit_cast<float>(absolute) + 0.5f) - 0x3f000000u;
+		}
+		else
+		{
+			// Rebias the exponent & round the 13 dropped mantissa bits to nearest even, a carry rounds up to the next exponent (or infinity)
+			const uint32_t odd = (absolute >> 13) & 1u;
+
+			result = (absolute + 0xc8000fffu + odd) >> 13;
+		}
+
+		m_bits = static_cast<uint16_t>(result | (sign >> 16));
+	}
+
+	inline constexpr Half Half::FromBits(uint16_t bits) noexcept
+	{
+		Half half;
+		half.m_bits = bits;
+
+		return half;
+	}
+
+	inline constexpr uint16_t Half::Bits(void) const noexcept
+	{
+		return m_bits;
+	}
+
+	inline constexpr Half::operator float(void) const noexcept
+	{
+		// Exponent & mantissa shifted into place, then the exponent is rebiased from 15 to 127
+		const uint32_t exponent = m_bits & 0x7c00u;
+
+		uint32_t result = (static_cast<uint32_t>(m_bits & 0x7fffu) << 13) + 0x38000000u;
+
+		if (exponent == 0x7c00u)
+		{
+			// Infinity or NaN, exponent 255
+			result += 0x38000000u;
+		}
+		else if (exponent == 0)
+		{
+			// Zero or denormal, renormalised by the float subtraction (2^-14 is the implicit 1 added to the exponent)
+			result = std::bit_cast<uint32_t>(std::bit_cast<float>(result + 0x00800000u) - std::bit_cast<float>(0x38800000u));
+		}
+
+		return std::bit_cast<float>(result | (static_cast<uint32_t>(m_bits & 0x8000u) << 16));
+	}
+
+	inline constexpr bool Half::operator==(Half const& half) const noexcept
+	{
+		return m_bits == half.m_bits;
+	}
+
+	inline constexpr bool Half::operator!=(Half const& half) const noexcept
+	{
+		return m_bits != half.m_bits;
+	}
+
+	inline void Pack(std::span<float const> values, std::span<Half> result)
+	{
+		_ASSERT(result.size() >= values.size());
+
+		static_assert(sizeof(Half) == sizeof(uint16_t));
+
+		ParallelFor(values.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			simd::FloatToHalf(reinterpret_cast<uint16_t*>(result.data() + begin), values.data() + begin, end - begin);
+#else
+			for (size_t i = begin; i < end; ++i)
+				result[i] = Half(values[i]);
+#endif
+		});
+	}
+
+	inline void Pack(std::span<Vector3<float> const> vectors, std::span<Half> result)
+	{
+		static_assert(sizeof(Vector3<float>) == 3 * sizeof(float));
+
+		Pack(std::span<float const>(reinterpret_cast<float const*>(vectors.data()), vectors.size() * 3), result);
+	}
+
+	inline void Pack(std::span<Vector4<float> const> vectors, std::span<Half> result)
+	{
+		static_assert(sizeof(Vector4<float>) == 4 * sizeof(float));
+
+		Pack(std::span<float const>(reinterpret_cast<float const*>(vectors.data()), vectors.size() * 4), result);
+	}
+
+	inline void Unpack(std::span<Half const> values, std::span<float> result)
+	{
+		_ASSERT(result.size() >= values.size());
+
+		ParallelFor(values.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			simd::HalfToFloat(result.data() + begin, reinterpret_cast<uint16_t const*>(values.data() + begin), end - begin);
+#else
+			for (size_t i = begin; i < end; ++i)
+				result[i] = static_cast<float>(values[i]);
+#endif
+		});
+	}
+
+	inline void Unpack(std::span<Half const> values, std::span<Vector3<float>> result)
+	{
+		_ASSERT(values.size() % 3 == 0);
+
+		Unpack(values, std::span<float>(reinterpret_cast<float*>(result.data()), result.size() * 3));
+	}
+
+	inline void Unpack(std::span<Half const> values, std::span<Vector4<float>> result)
+	{
+		_ASSERT(values.size() % 4 == 0);
+
+		Unpack(values, std::span<float>(reinterpret_cast<float*>(result.data()), result.size() * 4));
+	}
+}
+
+namespace LibMath = math;
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "../Arithmetic.h"
+#include "../Parallel.h"
+#include "../simd/Simd.h"
+#include "../vector/Vector3.h"
+#include "Snorm16.h"
+
+#include <span>
+
+/*
+*	------- Octahedral32 -------
+*	Unit vector in 4 bytes: the vector is projected onto the octahedron
+*	|x| + |y| + |z| = 1, the lower half is folded over the diagonals &
+*	the (u, v) coordinates are stored as 2 Snorm16.
+*
+*	Decoding unfolds the lower half & normalises, the decoded vector is
+*	unit length. The angle between a unit vector & its decoded value is
+*	below 7e-5 radians (0.004 degrees). Inputs are expected to be unit
+*	length, a zero vector has no direction & decodes to an arbitrary one.
+*
+*	Pack & Unpack convert spans of Vector3<float>. The SSE2 kernels
+*	encode or decode 4 vectors per iteration with the operations of the
+*	scalar code in the same order & give the same results bit for bit,
+*	large spans are split across threads.
+*
+*	Constructor
+*	- Void				DONE	(0, 0, 1)
+*	- Vector3			DONE
+*	- Snorm16 pair		DONE	(stored u & v)
+*
+*	Functions
+*	- U					DONE
+*	- V					DONE
+*	- Pack				DONE	(span)
+*	- Unpack			DONE	(span)
+*
+*	Operators
+*	- Vector3			DONE
+*	- Equality			DONE
+*	- Inverse equality	DONE
+*/
+
+namespace math
+{
+	class Octahedral32
+	{
+	public:
+		constexpr					Octahedral32(void);
+		constexpr explicit			Octahedral32(Vector3<float> const& unitVector) noexcept;
+		constexpr					Octahedral32(Snorm16 u, Snorm16 v) noexcept;
+
+									~Octahedral32(void) = default;
+
+		constexpr Snorm16			U(void) const noexcept;
+		constexpr Snorm16			V(void) const noexcept;
+
+		constexpr explicit			operator Vector3<float>(void) const;
+		constexpr bool				operator==(Octahedral32 const& octahedral) const noexcept;
+		constexpr bool				operator!=(Octahedral32 const& octahedral) const noexcept;
+
+	private:
+		Snorm16	m_u;
+		Snorm16	m_v;
+	};
+
+	inline void Pack(std::span<Vector3<float> const> unitVectors, std::span<Octahedral32> result);
+	inline void Unpack(std::span<Octahedral32 const> values, std::span<Vector3<float>> result);
+
+	inline constexpr Octahedral32::Octahedral32(void)
+		: m_u(), m_v()
+	{
+	}
+
+	inline constexpr Octahedral32::Octahedral32(Vector3<float> const& unitVector) noexcept
+	{
+		const float length = (math::Abs(unitVector[0]) + math::Abs(unitVector[1])) + math::Abs(unitVector[2]);
+
+		float u = unitVector[0] / length;
+		float v = unitVector[1] / length;
+
+		// Lower half folded over the diagonals, (u, v) moves to (1 - |v|, 1 - |u|) with the signs of (u, v)
+		if (unitVector[2] < 0.0f)
+		{
+			const float foldedU = 1.0f - math::Abs(v);
+			const float foldedV = 1.0f - math::Abs(u);
+
+			u = (u >= 0.0f) ? foldedU : -foldedU;
+			v = (v >= 0.0f) ? foldedV : -foldedV;
+		}
+
+		m_u = Snorm16(u);
+		m_v = Snorm16(v);
+	}
+
+	inline constexpr Octahedral32::Octahedral32(Snorm16 u, Snorm16 v) noexcept
+		: m_u(u), m_v(v)
+	{
+	}
+
+	inline constexpr Snorm16 Octahedral32::U(void) const noexcept
+	{
+		return m_u;
+	}
+
+	inline constexpr Snorm16 Octahedral32::V(void) const noexcept
+	{
+		return m_v;
+	}
+
+	inline constexpr Octahedral32::operator Vector3<float>(void) const
+	{
+		float x = static_cast<float>(m_u);
+		float y = static_cast<float>(m_v);
+		const float z = (1.0f - math::Abs(x)) - math::Abs(y);
+
+		// z < 0 is the folded lower half, moving x & y towards 0 by -z unfolds it
+		const float fold = math::Max(-z, 0.0f);
+
+		x = (x >= 0.0f) ? x - fold : x + fold;
+		y = (y >= 0.0f) ? y - fold : y + fold;
+
+		const float length = math::Sqrt((x * x + y * y) + z * z);
+
+		return Vector3<float>(x / length, y / length, z / length);
+	}
+
+	inline constexpr bool Octahedral32::operator==(Octahedral32 const& octahedral) const noexcept
+	{
+		return m_u == octahedral.m_u && m_v == octahedral.m_v;
+	}
+
+	inline constexpr bool Octahedral32::operator!=(Octahedral32 const& octahedral) const noexcept
+	{
+		return !(*this == octahedral);
+	}
+
+	inline void Pack(std::span<Vector3<float> const> unitVectors, std::span<Octahedral32> result)
+	{
+		_ASSERT(result.size() >= unitVectors.size());
+
+		static_assert(sizeof(Octahedral32) == 2 * sizeof(int16_t));
+		static_assert(sizeof(Vector3<float>) == 3 * sizeof(float));
+
+		ParallelFor(unitVectors.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			simd::OctahedralEncode(reinterpret_cast<int16_t*>(result.data() + begin), reinterpret_cast<float const*>(unitVectors.data() + begin), end - begin);
+#else
+			for (size_t i = begin; i < end; ++i)
+				result[i] = Octahedral32(unitVectors[i]);
+#endif
+		});
+	}
+
+	inline void Unpack(std::span<Octahedral32 const> values, std::span<Vector3<float>> result)
+	{
+		_ASSERT(result.size() >= values.size());
+
+		ParallelFor(values.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			simd::OctahedralDecode(reinterpret_cast<float*>(result.data() + begin), reinterpret_cast<int16_t const*>(values.data() + begin), end - begin);
+#else
+			for (size_t i = begin; i < end; ++i)
+				result[i] = static_cast<Vector3<float>>(values[i]);
+#endif
+		});
+	}
+}
+
+namespace LibMath = math;
@@ -0,0 +1,266 @@
+#pragma once
+
+#include "../Arithmetic.h"
+#include "../Parallel.h"
+#include "../Quaternion.h"
+#include "../simd/Simd.h"
+#include "Snorm16.h"
+
+#include <cstdint>
+#include <span>
+
+/*
+*	------- PackedQuaternion<ComponentBits> -------
+*	Unit quaternion compressed with the smallest three method: the
+*	component with the largest magnitude is dropped & rebuilt from the
+*	other 3 as sqrt(1 - a^2 - b^2 - c^2). The quaternion is negated when
+*	that component is negative (q & -q are the same rotation), the other
+*	3 are then within [-1 / sqrt(2), 1 / sqrt(2)] & stored with ComponentBits
+*	each.
+*
+*	Bit layout, 2 bit index of the dropped component (x, y, z, w in
+*	memory order) above the 3 remaining components in x, y, z, w order,
+*	the first one highest. Stored in 16 bit words, lowest bits first.
+*
+*	- Quaternion32: 10 bits per component, 4 bytes. Stored components
+*	  within 6.9e-4, the rebuilt one within 3 times that, rotation angle
+*	  error below 0.005 radians (0.29 degrees)
+*	- Quaternion48: 15 bits per component, 6 bytes. Stored components
+*	  within 2.2e-5, the rebuilt one within 3 times that, rotation angle
+*	  error below 1.5e-4 radians (0.009 degrees)
+*
+*	Inputs are expected to be unit length, normalise first.
+*
+*	Pack & Unpack convert spans of Quaternion<float>. The SSE2 kernels
+*	encode or decode 4 quaternions per iteration with the operations of
+*	the scalar code in the same order & give the same results bit for
+*	bit, large spans are split across threads.
+*
+*	Constructor
+*	- Void				DONE	(identity)
+*	- Quaternion		DONE
+*
+*	Functions
+*	- FromBits			DONE
+*	- Bits				DONE
+*	- Pack				DONE	(span)
+*	- Unpack			DONE	(span)
+*
+*	Operators
+*	- Quaternion		DONE
+*	- Equality			DONE
+*	- Inverse equality	DONE
+*/
+
+#define SMALLEST_THREE_SCALE 0.707106781f	// 1 / sqrt(2), maps the 3 smallest components to [-0.5, 0.5]
+
+namespace math
+{
+	template<unsigned int ComponentBits>
+	class PackedQuaternion
+	{
+		static_assert(ComponentBits == 10 || ComponentBits == 15, "PackedQuaternion stores 10 (32 bit) or 15 (48 bit) bits per component");
+
+	public:
+		static constexpr size_t				WordCount = (3 * ComponentBits + 2 + 15) / 16;
+		// Even so 0 is the middle code & decodes exactly
+		static constexpr float				Range = static_cast<float>((1u << ComponentBits) - 2);
+
+		constexpr							PackedQuaternion(void);
+		constexpr explicit					PackedQuaternion(Quaternion<float> const& unitQuaternion) noexcept;
+
+											~PackedQuaternion(void) = default;
+
+		static constexpr PackedQuaternion	FromBits(uint64_t bits) noexcept;
+		constexpr uint64_t					Bits(void) const noexcept;
+
+		constexpr explicit					operator Quaternion<float>(void) const;
+		constexpr bool						operator==(PackedQuaternion const& quat) const noexcept;
+		constexpr bool						operator!=(PackedQuaternion const& quat) const noexcept;
+
+	private:
+		uint16_t	m_words[WordCount];
+	};
+
+	using Quaternion32 = PackedQuaternion<10>;
+	using Quaternion48 = PackedQuaternion<15>;
+
+	inline void Pack(std::span<Quaternion<float> const> unitQuaternions, std::span<Quaternion32> result);
+	inline void Pack(std::span<Quaternion<float> const> unitQuaternions, std::span<Quaternion48> result);
+	inline void Unpack(std::span<Quaternion32 const> values, std::span<Quaternion<float>> result);
+	inline void Unpack(std::span<Quaternion48 const> values, std::span<Quaternion<float>> result);
+
+	template<unsigned int ComponentBits>
+	inline constexpr PackedQuaternion<ComponentBits>::PackedQuaternion(void)
+		: PackedQuaternion(Quaternion<float>(1.0f, 0.0f, 0.0f, 0.0f))
+	{
+	}
+
+	template<unsigned int ComponentBits>
+	inline constexpr PackedQuaternion<ComponentBits>::PackedQuaternion(Quaternion<float> const& unitQuaternion) noexcept
+	{
+		// x, y, z, w
+		float components[4] = { unitQuaternion[1], unitQuaternion[2], unitQuaternion[3], unitQuaternion[0] };
+
+		// First largest magnitude on ties
+		unsigned int largest = 0;
+		float largestMagnitude = math::Abs(components[0]);
+
+		for (unsigned int i = 1; i < 4; ++i)
+		{
+			if (math::Abs(components[i]) > largestMagnitude)
+			{
+				largest = i;
+				largestMagnitude = math::Abs(components[i]);
+			}
+		}
+
+		const bool negate = components[largest] < 0.0f;
+
+		uint64_t bits = largest;
+
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			if (i == largest)
+				continue;
+
+			const float component = negate ? -components[i] : components[i];
+			const float scaled = math::Min(math::Max((component * SMALLEST_THREE_SCALE + 0.5f) * Range, 0.0f), Range);
+
+			bits = (bits << ComponentBits) | static_cast<uint64_t>((scaled + SNORM_ROUND_MAGIC) - SNORM_ROUND_MAGIC);
+		}
+
+		for (size_t i = 0; i < WordCount; ++i)
+			m_words[i] = static_cast<uint16_t>(bits >> (16 * i));
+	}
+
+	template<unsigned int ComponentBits>
+	inline constexpr PackedQuaternion<ComponentBits> PackedQuaternion<ComponentBits>::FromBits(uint64_t bits) noexcept
+	{
+		PackedQuaternion<ComponentBits> quat;
+
+		for (size_t i = 0; i < WordCount; ++i)
+			quat.m_words[i] = static_cast<uint16_t>(bits >> (16 * i));
+
+		return quat;
+	}
+
+	template<unsigned int ComponentBits>
+	inline constexpr uint64_t PackedQuaternion<ComponentBits>::Bits(void) const noexcept
+	{
+		uint64_t bits = 0;
+
+		for (size_t i = 0; i < WordCount; ++i)
+			bits |= static_cast<uint64_t>(m_words[i]) << (16 * i);
+
+		return bits;
+	}
+
+	template<unsigned int ComponentBits>
+	inline constexpr PackedQuaternion<ComponentBits>::operator Quaternion<float>(void) const
+	{
+		const uint64_t bits = Bits();
+		const unsigned int largest = static_cast<unsigned int>(bits >> (3 * ComponentBits)) & 3u;
+		const uint64_t mask = (1u << ComponentBits) - 1;
+
+		float smallest[3];
+
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			const float quantised = static_cast<float>((bits >> (ComponentBits * (2 - i))) & mask);
+
+			smallest[i] = (quantised / Range - 0.5f) / SMALLEST_THREE_SCALE;
+		}
+
+		float components[4];
+
+		for (unsigned int i = 0, next = 0; i < 4; ++i)
+		{
+			if (i != largest)
+				components[i] = smallest[next++];
+		}
+
+		components[largest] = math::Sqrt(math::Max(1.0f - ((smallest[0] * smallest[0] + smallest[1] * smallest[1]) + smallest[2] * smallest[2]), 0.0f));
+
+		return Quaternion<float>(components[3], components[0], components[1], components[2]);
+	}
+
+	template<unsigned int ComponentBits>
+	inline constexpr bool PackedQuaternion<ComponentBits>::operator==(PackedQuaternion<ComponentBits> const& quat) const noexcept
+	{
+		return Bits() == quat.Bits();
+	}
+
+	template<unsigned int ComponentBits>
+	inline constexpr bool PackedQuaternion<ComponentBits>::operator!=(PackedQuaternion<ComponentBits> const& quat) const noexcept
+	{
+		return Bits() != quat.Bits();
+	}
+
+	inline void Pack(std::span<Quaternion<float> const> unitQuaternions, std::span<Quaternion32> result)
+	{
+		_ASSERT(result.size() >= unitQuaternions.size());
+
+		static_assert(sizeof(Quaternion<float>) == 4 * sizeof(float));
+		static_assert(sizeof(Quaternion32) == sizeof(uint32_t));
+
+		ParallelFor(unitQuaternions.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			simd::QuaternionEncode32(reinterpret_cast<uint16_t*>(result.data() + begin), reinterpret_cast<float const*>(unitQuaternions.data() + begin), end - begin);
+#else
+			for (size_t i = begin; i < end; ++i)
+				result[i] = Quaternion32(unitQuaternions[i]);
+#endif
+		});
+	}
+
+	inline void Pack(std::span<Quaternion<float> const> unitQuaternions, std::span<Quaternion48> result)
+	{
+		_ASSERT(result.size() >= unitQuaternions.size());
+
+		static_assert(sizeof(Quaternion48) == 3 * sizeof(uint16_t));
+
+		ParallelFor(unitQuaternions.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			simd::QuaternionEncode48(reinterpret_cast<uint16_t*>(result.data() + begin), reinterpret_cast<float const*>(unitQuaternions.data() + begin), end - begin);
+#else
+			for (size_t i = begin; i < end; ++i)
+				result[i] = Quaternion48(unitQuaternions[i]);
+#endif
+		});
+	}
+
+	inline void Unpack(std::span<Quaternion32 const> values, std::span<Quaternion<float>> result)
+	{
+		_ASSERT(result.size() >= values.size());
+
+		ParallelFor(values.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			simd::QuaternionDecode32(reinterpret_cast<float*>(result.data() + begin), reinterpret_cast<uint16_t const*>(values.data() + begin), end - begin);
+#else
+			for (size_t i = begin; i < end; ++i)
+				result[i] = static_cast<Quaternion<float>>(values[i]);
+#endif
+		});
+	}
+
+	inline void Unpack(std::span<Quaternion48 const> values, std::span<Quaternion<float>> result)
+	{
+		_ASSERT(result.size() >= values.size());
+
+		ParallelFor(values.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			simd::QuaternionDecode48(reinterpret_cast<float*>(result.data() + begin), reinterpret_cast<uint16_t const*>(values.data() + begin), end - begin);
+#else
+			for (size_t i = begin; i < end; ++i)
+				result[i] = static_cast<Quaternion<float>>(values[i]);
+#endif
+		});
+	}
+}
+
+namespace LibMath = math;
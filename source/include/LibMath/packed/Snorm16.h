@@ -0,0 +1,173 @@
+#pragma once
+
+#include "../Arithmetic.h"
+#include "../Parallel.h"
+#include "../simd/Simd.h"
+#include "../vector/Vector3.h"
+#include "../vector/Vector4.h"
+
+#include <cstdint>
+#include <span>
+
+/*
+*	------- Snorm16 -------
+*	Signed normalised 16 bit integer, value * 32767 rounded to nearest
+*	even. Values are clamped to [-1, 1] (NaN becomes -1), a value in
+*	range decodes within 0.5 / 32767 plus the float rounding of the
+*	division (1.54e-5). -32768 decodes to -1 like -32767.
+*
+*	Pack & Unpack convert spans of floats, Vector3<float> or
+*	Vector4<float> (3 or 4 values per vector). The SSE2 kernels convert
+*	4 floats per iteration & give the same values as the scalar
+*	conversion, large spans are split across threads.
+*
+*	Constructor
+*	- Void				DONE	(0)
+*	- Float				DONE
+*
+*	Functions
+*	- FromBits			DONE
+*	- Bits				DONE
+*	- Pack				DONE	(float, Vector3 & Vector4 spans)
+*	- Unpack			DONE	(float, Vector3 & Vector4 spans)
+*
+*	Operators
+*	- Float				DONE
+*	- Equality			DONE
+*	- Inverse equality	DONE
+*/
+
+// Adding & subtracting 1.5 * 2^23 rounds a float below 2^22 to an integer, nearest even
+#define SNORM_ROUND_MAGIC 12582912.0f
+
+namespace math
+{
+	class Snorm16
+	{
+	public:
+		constexpr					Snorm16(void);
+		constexpr explicit			Snorm16(float value) noexcept;
+
+									~Snorm16(void) = default;
+
+		static constexpr Snorm16	FromBits(int16_t bits) noexcept;
+		constexpr int16_t			Bits(void) const noexcept;
+
+		constexpr explicit			operator float(void) const noexcept;
+		constexpr bool				operator==(Snorm16 const& snorm) const noexcept;
+		constexpr bool				operator!=(Snorm16 const& snorm) const noexcept;
+
+	private:
+		int16_t	m_bits;
+	};
+
+	inline void Pack(std::span<float const> values, std::span<Snorm16> result);
+	inline void Pack(std::span<Vector3<float> const> vectors, std::span<Snorm16> result);
+	inline void Pack(std::span<Vector4<float> const> vectors, std::span<Snorm16> result);
+	inline void Unpack(std::span<Snorm16 const> values, std::span<float> result);
+	inline void Unpack(std::span<Snorm16 const> values, std::span<Vector3<float>> result);
+	inline void Unpack(std::span<Snorm16 const> values, std::span<Vector4<float>> result);
+
+	inline constexpr Snorm16::Snorm16(void)
+		: m_bits(0)
+	{
+	}
+
+	inline constexpr Snorm16::Snorm16(float value) noexcept
+	{
+		// Max first so NaN is clamped to -1, same operand order as _mm_max_ps & _mm_min_ps
+		const float clamped = math::Min(math::Max(value, -1.0f), 1.0f);
+
+		m_bits = static_cast<int16_t>((clamped * 32767.0f + SNORM_ROUND_MAGIC) - SNORM_ROUND_MAGIC);
+	}
+
+	inline constexpr Snorm16 Snorm16::FromBits(int16_t bits) noexcept
+	{
+		Snorm16 snorm;
+		snorm.m_bits = bits;
+
+		return snorm;
+	}
+
+	inline constexpr int16_t Snorm16::Bits(void) const noexcept
+	{
+		return m_bits;
+	}
+
+	inline constexpr Snorm16::operator float(void) const noexcept
+	{
+		return math::Max(static_cast<float>(m_bits) / 32767.0f, -1.0f);
+	}
+
+	inline constexpr bool Snorm16::operator==(Snorm16 const& snorm) const noexcept
+	{
+		return m_bits == snorm.m_bits;
+	}
+
+	inline constexpr bool Snorm16::operator!=(Snorm16 const& snorm) const noexcept
+	{
+		return m_bits != snorm.m_bits;
+	}
+
+	inline void Pack(std::span<float const> values, std::span<Snorm16> result)
+	{
+		_ASSERT(result.size() >= values.size());
+
+		static_assert(sizeof(Snorm16) == sizeof(int16_t));
+
+		ParallelFor(values.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			simd::FloatToSnorm16(reinterpret_cast<int16_t*>(result.data() + begin), values.data() + begin, end - begin);
+#else
+			for (size_t i = begin; i < end; ++i)
+				result[i] = Snorm16(values[i]);
+#endif
+		});
+	}
+
+	inline void Pack(std::span<Vector3<float> const> vectors, std::span<Snorm16> result)
+	{
+		static_assert(sizeof(Vector3<float>) == 3 * sizeof(float));
+
+		Pack(std::span<float const>(reinterpret_cast<float const*>(vectors.data()), vectors.size() * 3), result);
+	}
+
+	inline void Pack(std::span<Vector4<float> const> vectors, std::span<Snorm16> result)
+	{
+		static_assert(sizeof(Vector4<float>) == 4 * sizeof(float));
+
+		Pack(std::span<float const>(reinterpret_cast<float const*>(vectors.data()), vectors.size() * 4), result);
+	}
+
+	inline void Unpack(std::span<Snorm16 const> values, std::span<float> result)
+	{
+		_ASSERT(result.size() >= values.size());
+
+		ParallelFor(values.size(), [&](size_t begin, size_t end)
+		{
+#if LIBMATH_SIMD_SSE2
+			simd::Snorm16ToFloat(result.data() + begin, reinterpret_cast<int16_t const*>(values.data() + begin), end - begin);
+#else
+			for (size_t i = begin; i < end; ++i)
+				result[i] = static_cast<float>(values[i]);
+#endif
+		});
+	}
+
+	inline void Unpack(std::span<Snorm16 const> values, std::span<Vector3<float>> result)
+	{
+		_ASSERT(values.size() % 3 == 0);
+
+		Unpack(values, std::span<float>(reinterpret_cast<float*>(result.data()), result.size() * 3));
+	}
+
+	inline void Unpack(std::span<Snorm16 const> values, std::span<Vector4<float>> result)
+	{
+		_ASSERT(values.size() % 4 == 0);
+
+		Unpack(values, std::span<float>(reinterpret_cast<float*>(result.data()), result.size() * 4));
+	}
+}
+
+namespace LibMath = math;
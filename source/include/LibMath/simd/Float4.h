@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Simd.h"
+
+#include <limits>
+
+/*
+*	Helpers shared by the __m128 backed Vector4<float> & Quaternion<float>
+*	& the inlined Matrix4<float> product
+*
+*	Lanes hold (x, y, z, w). Reductions add the lanes from left to right,
+*	((x + y) + z) + w, the same order as the scalar code so results match
+*	the generic template bit for bit.
+*
+*	RSqrt4 is the exception, it refines the hardware estimate with one
+*	Newton-Raphson step & is only used by the Precision::Fast paths.
+*	The estimate differs between CPU vendors, with LIBMATH_DETERMINISTIC
+*	RSqrt4 returns 1 / sqrt(value) (the exact path) instead.
+*/
+
+#if LIBMATH_SIMD_SSE2
+namespace math
+{
+	namespace simd
+	{
+		template<int Lane>
+		inline __m128 Splat(__m128 value) noexcept
+		{
+			return _mm_shuffle_ps(value, value, _MM_SHUFFLE(Lane, Lane, Lane, Lane));
+		}
+
+		// Sum of all lanes, returned in every lane
+		inline __m128 HorizontalAdd(__m128 value) noexcept
+		{
+			__m128 sum = _mm_add_ss(value, Splat<1>(value));
+			sum = _mm_add_ss(sum, Splat<2>(value));
+			sum = _mm_add_ss(sum, Splat<3>(value));
+
+			return Splat<0>(sum);
+		}
+
+		inline __m128 Dot4(__m128 lhs, __m128 rhs) noexcept
+		{
+			return HorizontalAdd(_mm_mul_ps(lhs, rhs));
+		}
+
+		// Cross product of the x, y, z lanes, (y1 * z2 - z1 * y2, ...) like Vector3::Cross, w is 0 for finite inputs
+		inline __m128 Cross4(__m128 lhs, __m128 rhs) noexcept
+		{
+			const __m128 lhsYZX = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 lhsZXY = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 1, 0, 2));
+			const __m128 rhsYZX = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 0, 2, 1));
+			const __m128 rhsZXY = _mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(3, 1, 0, 2));
+
+			return _mm_sub_ps(_mm_mul_ps(lhsYZX, rhsZXY), _mm_mul_ps(lhsZXY, rhsYZX));
+		}
+
+		inline __m128 Abs4(__m128 value) noexcept
+		{
+			return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+		}
+
+		// Lane wise math::AlmostEqual, true when all 4 lanes are within epsilon
+		inline bool AlmostEqual4(__m128 lhs, __m128 rhs) noexcept
+		{
+			const __m128 delta = Abs4(_mm_sub_ps(rhs, lhs));
+			const __m128 inRange = _mm_cmple_ps(delta, _mm_set1_ps(std::numeric_limits<float>::epsilon()));
+
+			return _mm_movemask_ps(inRange) == 0xF;
+		}
+
+		inline bool AnyZero4(__m128 value) noexcept
+		{
+			return _mm_movemask_ps(_mm_cmpeq_ps(value, _mm_setzero_ps())) != 0;
+		}
+
+		// 1 / sqrt(value) within 5 ulp for positive normal floats, 0 & infinity give NaN
+		inline __m128 RSqrt4(__m128 value) noexcept
+		{
+#ifdef LIBMATH_DETERMINISTIC
+			return _mm_div_ps(_mm_set1_ps(1.0f), _mm_sqrt_ps(value));
+#else
+			const __m128 estimate = _mm_rsqrt_ps(value);
+			const __m128 halfValue = _mm_mul_ps(value, _mm_set1_ps(0.5f));
+
+			// estimate * (1.5 - value / 2 * estimate^2)
+			const __m128 correction = _mm_sub_ps(_mm_set1_ps(1.5f), _mm_mul_ps(halfValue, _mm_mul_ps(estimate, estimate)));
+
+			return _mm_mul_ps(estimate, correction);
+#endif
+		}
+
+		// Column major 4x4 product with the column order of the generic Matrix4 code, the result may alias either operand.
+		// The SSE2 entry of the runtime dispatched Matrix4Multiply
+		inline void Matrix4MultiplySSE2(float* result, float const* lhs, float const* rhs) noexcept
+		{
+			const __m128 column0 = _mm_loadu_ps(lhs);
+			const __m128 column1 = _mm_loadu_ps(lhs + 4);
+			const __m128 column2 = _mm_loadu_ps(lhs + 8);
+			const __m128 column3 = _mm_loadu_ps(lhs + 12);
+
+			for (int j = 0; j < 4; ++j)
+			{
+				// Column j is read before being written so the result can alias rhs
+				const __m128 rhsColumn = _mm_loadu_ps(rhs + j * 4);
+
+				__m128 sum = _mm_mul_ps(column0, Splat<0>(rhsColumn));
+				sum = _mm_add_ps(sum, _mm_mul_ps(column1, Splat<1>(rhsColumn)));
+				sum = _mm_add_ps(sum, _mm_mul_ps(column2, Splat<2>(rhsColumn)));
+				sum = _mm_add_ps(sum, _mm_mul_ps(column3, Splat<3>(rhsColumn)));
+
+				_mm_storeu_ps(result + j * 4, sum);
+			}
+		}
+	}
+}
+#endif
+
+namespace LibMath = math;
@@ -0,0 +1,472 @@
+#pragma once
+
+#include "../Macros.h"
+#include "Float4.h"
+
+#include <cmath>
+#include <span>
+
+/*
+*	------- Quaternion<float> -------
+*	SSE2 specialisation, the quaternion lives in one 16 byte aligned
+*	__m128 register. Lanes are stored as (x, y, z, w) so the imaginary
+*	part can be used as a vector directly, operator[] keeps the
+*	w, x, y, z index order of the generic Quaternion.
+*
+*	Intrinsics can't run in a constant expression, every constexpr
+*	function has a scalar path on m_values used at compile time.
+*
+*	Included at the end of Quaternion.h, do not include directly.
+*/
+
+#if LIBMATH_SIMD_SSE2
+namespace math
+{
+	template<>
+	class alignas(16) Quaternion<float>
+	{
+	public:
+		constexpr							Quaternion(void);
+		constexpr							Quaternion(float value);
+		constexpr							Quaternion(float w, float x, float y, float z);
+		constexpr							Quaternion(float w, Vector3<float> const& imaginary);
+		explicit							Quaternion(__m128 value);
+
+											~Quaternion(void) = default;
+
+		static constexpr Quaternion<float>	AngleAxis(float angleRad, math::Vector3<float> axis, Precision precision = Precision::Exact);
+		static constexpr Quaternion<float>	FromMatrix3(Matrix3<float> const& matrix);
+		static constexpr Quaternion<float>	FromMatrix4(Matrix4<float> const& matrix);
+		static constexpr Quaternion<float>	FromEuler(Radian<float> const& first, Radian<float> const& second, Radian<float> const& third, EulerOrder order = EulerOrder::XYZ, Precision precision = Precision::Exact);
+		static constexpr Quaternion<float>	FromEuler(Degree<float> const& first, Degree<float> const& second, Degree<float> const& third, EulerOrder order = EulerOrder::XYZ, Precision precision = Precision::Exact);
+		static void							FromMatrix3(std::span<Matrix3<float> const> matrices, std::span<Quaternion<float>> result);
+		static void							FromMatrix4(std::span<Matrix4<float> const> matrices, std::span<Quaternion<float>> result);
+		static void							FromEuler(std::span<Vector3<float> const> angles, std::span<Quaternion<float>> result, EulerOrder order = EulerOrder::XYZ, Precision precision = Precision::Exact);
+		static void							ToEuler(std::span<Quaternion<float> const> quaternions, std::span<Vector3<float>> angles, EulerOrder order = EulerOrder::XYZ);
+
+		constexpr bool						IsPure(void) const;
+		constexpr bool						IsUnit(void) const;
+		constexpr Quaternion<float>&		Conjugate(void);
+		constexpr Quaternion<float>			Rotate(float angle, Vector3<float> const& axis, Precision precision = Precision::Exact) const;
+		constexpr float						Magnitude(Precision precision = Precision::Exact) const;
+		constexpr float						Dot(void) const;
+		constexpr float						Dot(Quaternion<float> const& quat) const;
+		constexpr Quaternion<float>&		Normalize(Precision precision = Precision::Exact);
+		constexpr Quaternion<float>			Inverse(void) const;
+		constexpr Vector3<float>			RotateVector(Vector3<float> const& vec3) const;
+		void								RotateVector(std::span<Vector3<float> const> vectors, std::span<Vector3<float>> result) const;
+		constexpr void						ToEuler(Radian<float>& first, Radian<float>& second, Radian<float>& third, EulerOrder order = EulerOrder::XYZ) const;
+		constexpr void						ToEuler(Degree<float>& first, Degree<float>& second, Degree<float>& third, EulerOrder order = EulerOrder::XYZ) const;
+
+		__m128								Register(void) const noexcept;
+
+		constexpr Quaternion<float>			operator+(Quaternion<float> const& quat) const noexcept;
+		constexpr Quaternion<float>			operator-(Quaternion<float> const& quat) const noexcept;
+		constexpr Quaternion<float>			operator*(Quaternion<float> const& quat) const noexcept;
+		constexpr Quaternion<float>			operator/(Quaternion<float> const& quat) const noexcept;
+		constexpr Quaternion<float>			operator*(float value) const noexcept;
+		constexpr Quaternion<float>			operator/(float value) const noexcept;
+		constexpr Quaternion<float>&		operator+=(Quaternion<float> const& quat) noexcept;
+		constexpr Quaternion<float>&		operator-=(Quaternion<float> const& quat) noexcept;
+		constexpr Quaternion<float>&		operator*=(Quaternion<float> const& quat) noexcept;
+		constexpr Quaternion<float>&		operator*=(float value) noexcept;
+		constexpr Quaternion<float>&		operator/=(float value) noexcept;
+		constexpr bool						operator==(Quaternion<float> const& quat) const noexcept;
+		constexpr bool						operator!=(Quaternion<float> const& quat) const noexcept;
+		constexpr float						operator[](unsigned int index) const;
+		constexpr float&					operator[](unsigned int index);
+
+	private:
+		// Maps the w, x, y, z index to the x, y, z, w lane
+		static constexpr unsigned int		Lane(unsigned int index) noexcept;
+
+		union
+		{
+			__m128	m_register;
+			float	m_values[4];
+		};
+	};
+
+	inline constexpr Quaternion<float>::Quaternion(void)
+		: m_values{ 0.0f, 0.0f, 0.0f, 0.0f }
+	{
+	}
+
+	inline constexpr Quaternion<float>::Quaternion(float value)
+		: m_values{ value, value, value, value }
+	{
+	}
+
+	inline constexpr Quaternion<float>::Quaternion(float w, float x, float y, float z)
+		: m_values{ x, y, z, w }
+	{
+	}
+
+	inline constexpr Quaternion<float>::Quaternion(float w, Vector3<float> const& imaginary)
+		: m_values{ imaginary[0], imaginary[1], imaginary[2], w }
+	{
+	}
+
+	inline Quaternion<float>::Quaternion(__m128 value)
+		: m_register(value)
+	{
+	}
+
+	inline constexpr Quaternion<float> Quaternion<float>::AngleAxis(float angleRad, math::Vector3<float> axis, Precision precision)
+	{
+		float sinHalfAngle;
+		float cosHalfAngle;
+		math::SinCos(angleRad * 0.5f, sinHalfAngle, cosHalfAngle, precision);
+
+		return Quaternion<float>(cosHalfAngle, axis[0] * sinHalfAngle, axis[1] * sinHalfAngle, axis[2] * sinHalfAngle);
+	}
+
+	inline constexpr Quaternion<float> Quaternion<float>::FromMatrix3(Matrix3<float> const& matrix)
+	{
+		return quaternion::FromMatrix3(matrix);
+	}
+
+	inline constexpr Quaternion<float> Quaternion<float>::FromEuler(Radian<float> const& first, Radian<float> const& second, Radian<float> const& third, EulerOrder order, Precision precision)
+	{
+		return quaternion::FromEuler(first.Value(), second.Value(), third.Value(), order, precision);
+	}
+
+	inline constexpr Quaternion<float> Quaternion<float>::FromEuler(Degree<float> const& first, Degree<float> const& second, Degree<float> const& third, EulerOrder order, Precision precision)
+	{
+		constexpr float degToRad = static_cast<float>(0.0174532925199432957692369076848861271L);
+
+		return quaternion::FromEuler(first.Value() * degToRad, second.Value() * degToRad, third.Value() * degToRad, order, precision);
+	}
+
+	inline void Quaternion<float>::FromMatrix3(std::span<Matrix3<float> const> matrices, std::span<Quaternion<float>> result)
+	{
+		quaternion::FromMatrix3(matrices, result);
+	}
+
+	inline void Quaternion<float>::FromEuler(std::span<Vector3<float> const> angles, std::span<Quaternion<float>> result, EulerOrder order, Precision precision)
+	{
+		quaternion::FromEuler(angles, result, order, precision);
+	}
+
+	inline void Quaternion<float>::ToEuler(std::span<Quaternion<float> const> quaternions, std::span<Vector3<float>> angles, EulerOrder order)
+	{
+		quaternion::ToEuler(quaternions, angles, order);
+	}
+
+	inline constexpr bool Quaternion<float>::IsPure(void) const
+	{
+		return m_values[3] == 0.0f;
+	}
+
+	inline constexpr bool Quaternion<float>::IsUnit(void) const
+	{
+		return Magnitude() == 1.0f;
+	}
+
+	inline constexpr Quaternion<float>& Quaternion<float>::Conjugate(void)
+	{
+		// Flip the sign of x, y & z
+		if (std::is_constant_evaluated())
+		{
+			m_values[0] = -m_values[0];
+			m_values[1] = -m_values[1];
+			m_values[2] = -m_values[2];
+
+			return *this;
+		}
+
+		m_register = _mm_xor_ps(m_register, _mm_setr_ps(-0.0f, -0.0f, -0.0f, 0.0f));
+
+		return *this;
+	}
+
+	inline constexpr Quaternion<float> Quaternion<float>::Rotate(float angle, Vector3<float> const& axis, Precision precision) const
+	{
+		/*
+			Rotation Quaternion
+
+			|axe| cos (theta / 2), axe * sin(theta / 2)
+
+			Every component is overwritten, only the magnitude of this quaternion is kept
+		*/
+
+		float sinAngle;
+		float cosAngle;
+		math::SinCos(Degree<float>(angle * 0.5f), sinAngle, cosAngle, precision);
+
+		return Quaternion<float>(Magnitude() * cosAngle, axis[0] * sinAngle, axis[1] * sinAngle, axis[2] * sinAngle);
+	}
+
+	inline constexpr float Quaternion<float>::Magnitude(Precision precision) const
+	{
+		if (std::is_constant_evaluated() || precision == Precision::Fast)
+			return math::Sqrt(Dot(), precision);
+
+		return _mm_cvtss_f32(_mm_sqrt_ss(simd::Dot4(m_register, m_register)));
+	}
+
+	inline constexpr float Quaternion<float>::Dot(void) const
+	{
+		return Dot(*this);
+	}
+
+	inline constexpr float Quaternion<float>::Dot(Quaternion<float> const& quat) const
+	{
+		if (std::is_constant_evaluated())
+			return m_values[0] * quat.m_values[0] + m_values[1] * quat.m_values[1] + m_values[2] * quat.m_values[2] + m_values[3] * quat.m_values[3];
+
+		return _mm_cvtss_f32(simd::Dot4(m_register, quat.m_register));
+	}
+
+	inline constexpr Quaternion<float>& Quaternion<float>::Normalize(Precision precision)
+	{
+		if (std::is_constant_evaluated())
+			return *this *= 1.0f / Magnitude();
+
+		if (precision == Precision::Fast)
+		{
+			m_register = _mm_mul_ps(m_register, simd::RSqrt4(simd::Dot4(m_register, m_register)));
+
+			return *this;
+		}
+
+		const __m128 magnitude = _mm_sqrt_ps(simd::Dot4(m_register, m_register));
+
+		m_register = _mm_mul_ps(m_register, _mm_div_ps(_mm_set1_ps(1.0f), magnitude));
+
+		return *this;
+	}
+
+	inline constexpr Quaternion<float> Quaternion<float>::Inverse(void) const
+	{
+		if (std::is_constant_evaluated())
+			return Quaternion<float>(*this).Conjugate() * (1.0f / Dot());
+
+		Quaternion<float> result(*this);
+		const __m128 denom = _mm_div_ps(_mm_set1_ps(1.0f), simd::Dot4(m_register, m_register));
+
+		result.Conjugate();
+		result.m_register = _mm_mul_ps(result.m_register, denom);
+
+		return result;
+	}
+
+	inline constexpr Vector3<float> Quaternion<float>::RotateVector(Vector3<float> const& vec3) const
+	{
+		// t = 2 (u x v), v + w * t + u x t, see Quaternion<T>::RotateVector
+		if (std::is_constant_evaluated())
+		{
+			const Vector3<float> imaginary(m_values[0], m_values[1], m_values[2]);
+			const Vector3<float> t = imaginary.Cross(vec3) * 2.0f;
+
+			return vec3 + t * m_values[3] + imaginary.Cross(t);
+		}
+
+		const __m128 vector = _mm_setr_ps(vec3[0], vec3[1], vec3[2], 0.0f);
+
+		const __m128 t = _mm_mul_ps(simd::Cross4(m_register, vector), _mm_set1_ps(2.0f));
+		const __m128 result = _mm_add_ps(_mm_add_ps(vector, _mm_mul_ps(t, simd::Splat<3>(m_register))), simd::Cross4(m_register, t));
+
+		alignas(16) float values[4];
+		_mm_store_ps(values, result);
+
+		return Vector3<float>(values[0], values[1], values[2]);
+	}
+
+	inline void Quaternion<float>::RotateVector(std::span<Vector3<float> const> vectors, std::span<Vector3<float>> result) const
+	{
+		_ASSERT(result.size() >= vectors.size());
+
+		static_assert(sizeof(Vector3<float>) == 3 * sizeof(float));
+
+		ParallelFor(vectors.size(), [&](size_t begin, size_t end)
+		{
+			simd::QuaternionRotateVector3(reinterpret_cast<float*>(result.data() + begin), reinterpret_cast<float const*>(vectors.data() + begin), end - begin, m_values);
+		});
+	}
+
+	inline constexpr void Quaternion<float>::ToEuler(Radian<float>& first, Radian<float>& second, Radian<float>& third, EulerOrder order) const
+	{
+		quaternion::ToEuler(*this, first.Value(), second.Value(), third.Value(), order);
+	}
+
+	inline constexpr void Quaternion<float>::ToEuler(Degree<float>& first, Degree<float>& second, Degree<float>& third, EulerOrder order) const
+	{
+		constexpr float radToDeg = static_cast<float>(57.2957795130823208767981548141051703L);
+
+		quaternion::ToEuler(*this, first.Value(), second.Value(), third.Value(), order);
+
+		first.Value() *= radToDeg;
+		second.Value() *= radToDeg;
+		third.Value() *= radToDeg;
+	}
+
+	inline __m128 Quaternion<float>::Register(void) const noexcept
+	{
+		return m_register;
+	}
+
+	inline constexpr Quaternion<float> Quaternion<float>::operator+(Quaternion<float> const& quat) const noexcept
+	{
+		if (std::is_constant_evaluated())
+			return Quaternion<float>(m_values[3] + quat.m_values[3], m_values[0] + quat.m_values[0], m_values[1] + quat.m_values[1], m_values[2] + quat.m_values[2]);
+
+		return Quaternion<float>(_mm_add_ps(m_register, quat.m_register));
+	}
+
+	inline constexpr Quaternion<float> Quaternion<float>::operator-(Quaternion<float> const& quat) const noexcept
+	{
+		if (std::is_constant_evaluated())
+			return Quaternion<float>(m_values[3] - quat.m_values[3], m_values[0] - quat.m_values[0], m_values[1] - quat.m_values[1], m_values[2] - quat.m_values[2]);
+
+		return Quaternion<float>(_mm_sub_ps(m_register, quat.m_register));
+	}
+
+	inline constexpr Quaternion<float> Quaternion<float>::operator*(Quaternion<float> const& quat) const noexcept
+	{
+		/*
+		*	Hamilton product, one column of the product matrix per lhs lane:
+		*	result = w1 * ( x2,  y2,  z2,  w2)
+		*	       + x1 * ( w2, -z2,  y2, -x2)
+		*	       + y1 * ( z2,  w2, -x2, -y2)
+		*	       + z1 * (-y2,  x2,  w2, -z2)
+		*/
+
+		if (std::is_constant_evaluated())
+		{
+			const float x1 = m_values[0], y1 = m_values[1], z1 = m_values[2], w1 = m_values[3];
+			const float x2 = quat.m_values[0], y2 = quat.m_values[1], z2 = quat.m_values[2], w2 = quat.m_values[3];
+
+			return Quaternion<float>(
+				w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2,
+				w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2,
+				w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2,
+				w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2
+			);
+		}
+
+		const __m128 rhs = quat.m_register;
+
+		const __m128 columnX = _mm_xor_ps(_mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(0, 1, 2, 3)), _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+		const __m128 columnY = _mm_xor_ps(_mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(0.0f, 0.0f, -0.0f, -0.0f));
+		const __m128 columnZ = _mm_xor_ps(_mm_shuffle_ps(rhs, rhs, _MM_SHUFFLE(2, 3, 0, 1)), _mm_setr_ps(-0.0f, 0.0f, 0.0f, -0.0f));
+
+		__m128 result = _mm_mul_ps(simd::Splat<3>(m_register), rhs);
+		result = _mm_add_ps(result, _mm_mul_ps(simd::Splat<0>(m_register), columnX));
+		result = _mm_add_ps(result, _mm_mul_ps(simd::Splat<1>(m_register), columnY));
+		result = _mm_add_ps(result, _mm_mul_ps(simd::Splat<2>(m_register), columnZ));
+
+		return Quaternion<float>(result);
+	}
+
+	inline constexpr Quaternion<float> Quaternion<float>::operator/(Quaternion<float> const& quat) const noexcept
+	{
+		return *this * quat.Inverse();
+	}
+
+	inline constexpr Quaternion<float> Quaternion<float>::operator*(float value) const noexcept
+	{
+		if (std::is_constant_evaluated())
+			return Quaternion<float>(m_values[3] * value, m_values[0] * value, m_values[1] * value, m_values[2] * value);
+
+		return Quaternion<float>(_mm_mul_ps(m_register, _mm_set1_ps(value)));
+	}
+
+	inline constexpr Quaternion<float> Quaternion<float>::operator/(float value) const noexcept
+	{
+		_ASSERT(value != 0);
+
+		if (std::is_constant_evaluated())
+			return Quaternion<float>(m_values[3] / value, m_values[0] / value, m_values[1] / value, m_values[2] / value);
+
+		return Quaternion<float>(_mm_div_ps(m_register, _mm_set1_ps(value)));
+	}
+
+	inline constexpr Quaternion<float>& Quaternion<float>::operator+=(Quaternion<float> const& quat) noexcept
+	{
+		if (std::is_constant_evaluated())
+			return *this = *this + quat;
+
+		m_register = _mm_add_ps(m_register, quat.m_register);
+
+		return *this;
+	}
+
+	inline constexpr Quaternion<float>& Quaternion<float>::operator-=(Quaternion<float> const& quat) noexcept
+	{
+		if (std::is_constant_evaluated())
+			return *this = *this - quat;
+
+		m_register = _mm_sub_ps(m_register, quat.m_register);
+
+		return *this;
+	}
+
+	inline constexpr Quaternion<float>& Quaternion<float>::operator*=(Quaternion<float> const& quat) noexcept
+	{
+		return *this = *this * quat;
+	}
+
+	inline constexpr Quaternion<float>& Quaternion<float>::operator*=(float value) noexcept
+	{
+		if (std::is_constant_evaluated())
+			return *this = *this * value;
+
+		m_register = _mm_mul_ps(m_register, _mm_set1_ps(value));
+
+		return *this;
+	}
+
+	inline constexpr Quaternion<float>& Quaternion<float>::operator/=(float value) noexcept
+	{
+		_ASSERT(value != 0);
+
+		if (std::is_constant_evaluated())
+			return *this = *this / value;
+
+		m_register = _mm_div_ps(m_register, _mm_set1_ps(value));
+
+		return *this;
+	}
+
+	inline constexpr bool Quaternion<float>::operator==(Quaternion<float> const& quat) const noexcept
+	{
+		if (std::is_constant_evaluated())
+		{
+			return
+				math::AlmostEqual(m_values[0], quat.m_values[0]) &&
+				math::AlmostEqual(m_values[1], quat.m_values[1]) &&
+				math::AlmostEqual(m_values[2], quat.m_values[2]) &&
+				math::AlmostEqual(m_values[3], quat.m_values[3]);
+		}
+
+		return simd::AlmostEqual4(m_register, quat.m_register);
+	}
+
+	inline constexpr bool Quaternion<float>::operator!=(Quaternion<float> const& quat) const noexcept
+	{
+		return !(*this == quat);
+	}
+
+	inline constexpr float Quaternion<float>::operator[](unsigned int index) const
+	{
+		_ASSERT(index < 4);
+
+		return m_values[Lane(index)];
+	}
+
+	inline constexpr float& Quaternion<float>::operator[](unsigned int index)
+	{
+		_ASSERT(index < 4);
+
+		return m_values[Lane(index)];
+	}
+
+	inline constexpr unsigned int Quaternion<float>::Lane(unsigned int index) noexcept
+	{
+		return (index + 3) & 3;
+	}
+}
+#endif
+
+namespace LibMath = math;
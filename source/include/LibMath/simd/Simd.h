@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+*	================= SIMD Config =================
+*
+*	SSE2 is used as the baseline for the float specialisations
+*	on x86 & x64. Wider kernels (AVX, AVX2 + FMA) are compiled
+*	into the library & selected at startup via cpuid.
+*
+*	Defining 'LIBMATH_DISABLE_SIMD' forces the scalar code path.
+*
+*	Fused multiply-add kernels round differently from the scalar
+*	code (& glm), they are only selected when the library is
+*	built with 'LIBMATH_ENABLE_FMA'.
+*
+*	'LIBMATH_DETERMINISTIC' replaces the rsqrt estimate (vendor
+*	dependent) with 1 / sqrt & never selects the FMA kernels, see
+*	Deterministic.h.
+*	=================================================
+*/
+
+#if !defined(LIBMATH_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+	#define LIBMATH_SIMD_SSE2 1
+	#include <immintrin.h>
+#else
+	#define LIBMATH_SIMD_SSE2 0
+#endif
+
+// Per function instruction set attributes, MSVC allows intrinsics without them
+#if LIBMATH_SIMD_SSE2 && (defined(__GNUC__) || defined(__clang__))
+	#define LIBMATH_TARGET_AVX			__attribute__((target("avx")))
+	#define LIBMATH_TARGET_AVX2_FMA		__attribute__((target("avx2,fma")))
+#else
+	#define LIBMATH_TARGET_AVX
+	#define LIBMATH_TARGET_AVX2_FMA
+#endif
+
+namespace math
+{
+	namespace simd
+	{
+		// Ordered from narrowest to widest
+		enum class InstructionSet
+		{
+			Scalar = 0,
+			SSE2,
+			AVX,
+			AVX2_FMA
+		};
+
+		InstructionSet	DetectInstructionSet(void) noexcept;
+		InstructionSet	ActiveInstructionSet(void) noexcept;
+		bool			SetInstructionSet(InstructionSet instructionSet) noexcept;
+
+		// Column major 4x4 float kernels, matrices are 16 contiguous floats. The product may alias either operand
+		void			Matrix4Multiply(float* result, float const* lhs, float const* rhs) noexcept;
+		bool			Matrix4Inverse(float* result, float const* matrix) noexcept;
+
+		// Transform N packed vectors (3 or 4 floats each), the result may alias the input
+		void			Matrix4TransformVector3(float* result, float const* vectors, size_t count, float const* matrix, float w) noexcept;
+		void			Matrix4TransformVector4(float* result, float const* vectors, size_t count, float const* matrix) noexcept;
+
+		// N matrices to & from packed translations & scales (3 floats each) & rotations stored as (x, y, z, w), see Matrix4.h.
+		// Decompose returns the number of matrices with shear, a zero scale or a projective last row
+		void			Matrix4ComposeTRS(float* result, float const* translations, float const* rotations, float const* scales, size_t count) noexcept;
+		size_t			Matrix4Decompose(float* translations, float* rotations, float* scales, float const* matrices, size_t count) noexcept;
+
+		// N 3x3 (9 floats) or 4x4 matrices to the rotations stored as (x, y, z, w) of Quaternion::FromMatrix3 & FromMatrix4
+		void			Matrix3ToQuaternion(float* rotations, float const* matrices, size_t count) noexcept;
+		void			Matrix4ToQuaternion(float* rotations, float const* matrices, size_t count) noexcept;
+
+		// Element wise square root & reciprocal square root of N floats, the result may alias the input.
+		// The fast variants use the rsqrt estimate + 1 Newton-Raphson step (see Arithmetic.h)
+		void			Sqrt(float* result, float const* values, size_t count) noexcept;
+		void			SqrtFast(float* result, float const* values, size_t count) noexcept;
+		void			RSqrt(float* result, float const* values, size_t count) noexcept;
+		void			RSqrtFast(float* result, float const* values, size_t count) noexcept;
+
+		// Sine & cosine of N angles multiplied by scale (1 for radians, pi / 180 for degrees).
+		// Medium & fast tiers of math::SinCos (see Trigonometry.h), sin may alias the angles
+		void			SinCos(float* sin, float* cos, float const* angles, size_t count, float scale) noexcept;
+		void			SinCosFast(float* sin, float* cos, float const* angles, size_t count, float scale) noexcept;
+
+		// Rotate N packed Vector3 by a unit quaternion stored as (x, y, z, w), the result may alias the input
+		void			QuaternionRotateVector3(float* result, float const* vectors, size_t count, float const* quaternion) noexcept;
+
+		// Frustum cull N spheres (center & radius) or boxes (center & half extents) stored as contiguous lanes against
+		// 6 planes stored as (normal x, y, z, distance). Writes offset + index of every visible object, returns how many
+		size_t			FrustumCullSpheres(uint32_t* visible, float const* x, float const* y, float const* z, float const* radii, size_t count, float const* planes, uint32_t offset) noexcept;
+		size_t			FrustumCullBoxes(uint32_t* visible, float const* x, float const* y, float const* z, float const* extentX, float const* extentY, float const* extentZ, size_t count, float const* planes, uint32_t offset) noexcept;
+
+		// Distance along one ray stored as (origin x, y, z, direction x, y, z) to N boxes (min & max), spheres, planes (normal
+		// & distance) or triangles stored as contiguous lanes, infinity for missed shapes. Returns the number of hits
+		size_t			RayIntersectBoxes(float* distances, float const* ray, float const* minX, float const* minY, float const* minZ, float const* maxX, float const* maxY, float const* maxZ, size_t count) noexcept;
+		size_t			RayIntersectSpheres(float* distances, float const* ray, float const* x, float const* y, float const* z, float const* radii, size_t count) noexcept;
+		size_t			RayIntersectPlanes(float* distances, float const* ray, float const* normalX, float const* normalY, float const* normalZ, float const* planeDistances, size_t count) noexcept;
+		size_t			RayIntersectTriangles(float* distances, float const* ray, float const* x0, float const* y0, float const* z0, float const* x1, float const* y1, float const* z1, float const* x2, float const* y2, float const* z2, size_t count) noexcept;
+
+		// IEEE binary16 to & from N floats, rounded to nearest even (see packed/Half.h). Snorm16 to & from N floats (see packed/Snorm16.h)
+		void			FloatToHalf(uint16_t* result, float const* values, size_t count) noexcept;
+		void			HalfToFloat(float* result, uint16_t const* values, size_t count) noexcept;
+		void			FloatToSnorm16(int16_t* result, float const* values, size_t count) noexcept;
+		void			Snorm16ToFloat(float* result, int16_t const* values, size_t count) noexcept;
+
+		// N packed unit Vector3 to & from octahedral (u, v) Snorm16 pairs (see packed/Octahedral.h)
+		void			OctahedralEncode(int16_t* result, float const* vectors, size_t count) noexcept;
+		void			OctahedralDecode(float* result, int16_t const* values, size_t count) noexcept;
+
+		// N unit quaternions stored as (x, y, z, w) to & from smallest three encodings of 2 (32 bit) or 3 (48 bit) 16 bit words
+		// (see packed/PackedQuaternion.h)
+		void			QuaternionEncode32(uint16_t* result, float const* quaternions, size_t count) noexcept;
+		void			QuaternionDecode32(float* result, uint16_t const* values, size_t count) noexcept;
+		void			QuaternionEncode48(uint16_t* result, float const* quaternions, size_t count) noexcept;
+		void			QuaternionDecode48(float* result, uint16_t const* values, size_t count) noexcept;
+
+		// Sweep N boxes stored as 6 contiguous lanes of N floats (min x, y, z, max x, y, z) sorted by min x, x being the sweep
+		// axis. Writes (first, second) with first < second from indices for every overlapping pair until pairCapacity pairs
+		// are written, pairs of one box in increasing sorted order. Returns the number of overlapping pairs
+		size_t			SweepAndPruneOverlaps(uint32_t* pairs, size_t pairCapacity, float const* bounds, uint32_t const* indices, size_t count) noexcept;
+	}
+}
+
+namespace LibMath = math;
@@ -3,10 +3,14 @@
 #include "../VariableType.hpp"
 #include "../Macros.h"
 #include "../Arithmetic.h"
+#include "../Trigonometry.h"
+#include "VectorN.h"
 
 #include <cmath>
 /* 
 *	------- Vector2 -------
+*	Thin wrapper over Vector<2, T>, the arithmetic is forwarded to it.
+*
 *	Static Functions:
 *	- Up			DONE
 *	- Down			DONE
@@ -43,126 +47,132 @@
 namespace math
 {
 	template<math::math_type::NumericType T>
-	class Vector2
+	class Vector2 : public Vector<2, T>
 	{
 	public:
-		constexpr			Vector2(void);
-		constexpr			Vector2(T const& scalar);
-		constexpr			Vector2(T const& x, T const& y);
-
-		constexpr			~Vector2(void) = default;
-
-		static Vector2<T>	Up(void) noexcept;
-		static Vector2<T>	Down(void) noexcept;
-		static Vector2<T>	Left(void) noexcept;
-		static Vector2<T>	Right(void) noexcept;
-		static Vector2<T>	Zero(void) noexcept;
-
-		T					Cross(Vector2<T> const& vec2) const;
-		T					Dot(Vector2<T> const& vec2) const;
-		T					Magnitude(void) const;
-		Vector2<T>&			Normalize(void);
-		Vector2<T>&			Normal(void);
-		T					AngleFrom(Vector2<T> const& vec2) const;
-		bool				IsUnit(void) const;
-		Vector2<T>&			Reflect(Vector2<T> const& vec2);
-		Vector2<T>&			Project(Vector2<T> const& vec2);
-
-		void				Translate(Vector2<T> const& vec2);
-		void				Rotate(T const& deg);
-		void				Scale(Vector2<T> const& vec2);
-
-		Vector2<T>			operator+(Vector2<T> const& vec2);
-		Vector2<T>			operator-(Vector2<T> const& vec2);
-		Vector2<T>			operator*(Vector2<T> const& vec2);
-		Vector2<T>			operator/(Vector2<T> const& vec2);
-		Vector2<T>			operator*(T value);
-		Vector2<T>			operator/(T value);
-		Vector2<T>&			operator-(void);
-		Vector2<T>&			operator+=(Vector2<T> const& vec2);
-		Vector2<T>&			operator-=(Vector2<T> const& vec2);
-		Vector2<T>&			operator*=(Vector2<T> const& vec2);
-		Vector2<T>&			operator/=(Vector2<T> const& vec2);
-		bool				operator==(Vector2<T> const& vec2) const;
-		bool				operator!=(Vector2<T> const& vec2) const;
-		T					operator[](int const& index) const;
-		T&					operator[](int const& index);
+		constexpr					Vector2(void);
+		constexpr					Vector2(T const& scalar);
+		constexpr					Vector2(T const& x, T const& y);
+		constexpr explicit			Vector2(Vector<2, T> const& vec);
+
+		constexpr					~Vector2(void) = default;
+
+		static constexpr Vector2<T>	Up(void) noexcept;
+		static constexpr Vector2<T>	Down(void) noexcept;
+		static constexpr Vector2<T>	Left(void) noexcept;
+		static constexpr Vector2<T>	Right(void) noexcept;
+		static constexpr Vector2<T>	Zero(void) noexcept;
+
+		constexpr T					Cross(Vector2<T> const& vec2) const;
+		constexpr T					Dot(Vector2<T> const& vec2) const;
+		constexpr T					Magnitude(Precision precision = Precision::Exact) const;
+		constexpr Vector2<T>&		Normalize(Precision precision = Precision::Exact);
+		constexpr Vector2<T>&		Normal(void);
+		constexpr T					AngleFrom(Vector2<T> const& vec2) const;
+		constexpr bool				IsUnit(void) const;
+		constexpr Vector2<T>&		Reflect(Vector2<T> const& vec2);
+		constexpr Vector2<T>&		Project(Vector2<T> const& vec2);
+
+		constexpr void				Translate(Vector2<T> const& vec2);
+		constexpr void				Rotate(T const& deg, Precision precision = Precision::Exact);
+		constexpr void				Scale(Vector2<T> const& vec2);
+
+		constexpr Vector2<T>		operator+(Vector2<T> const& vec2);
+		constexpr Vector2<T>		operator-(Vector2<T> const& vec2);
+		constexpr Vector2<T>		operator*(Vector2<T> const& vec2);
+		constexpr Vector2<T>		operator/(Vector2<T> const& vec2);
+		constexpr Vector2<T>		operator*(T value);
+		constexpr Vector2<T>		operator/(T value);
+		constexpr Vector2<T>&		operator-(void);
+		constexpr Vector2<T>&		operator+=(Vector2<T> const& vec2);
+		constexpr Vector2<T>&		operator-=(Vector2<T> const& vec2);
+		constexpr Vector2<T>&		operator*=(Vector2<T> const& vec2);
+		constexpr Vector2<T>&		operator/=(Vector2<T> const& vec2);
+		constexpr bool				operator==(Vector2<T> const& vec2) const;
+		constexpr bool				operator!=(Vector2<T> const& vec2) const;
+		constexpr T					operator[](int const& index) const;
+		constexpr T&				operator[](int const& index);
 
 	private:
-		T m_x;
-		T m_y;
+		using Vector<2, T>::m_values;
 	};
 
 	template<math::math_type::NumericType T>
 	inline constexpr Vector2<T>::Vector2(void)
-		: m_x((T) 0), m_y((T) 0)
+		: Vector<2, T>()
 	{
 	}
 
 	// Constructors
 	template<math_type::NumericType T>
 	inline constexpr math::Vector2<T>::Vector2(T const& scalar)
-		: m_x(scalar), m_y(scalar)
+		: Vector<2, T>(scalar)
 	{
 	}
 
 	template<math_type::NumericType T>
 	inline constexpr math::Vector2<T>::Vector2(T const& x, T const& y)
-		: m_x(x), m_y(y)
+		: Vector<2, T>(x, y)
+	{
+	}
+
+	template<math_type::NumericType T>
+	inline constexpr math::Vector2<T>::Vector2(Vector<2, T> const& vec)
+		: Vector<2, T>(vec)
 	{
 	}
 
 	// Static Functions
 	template<math_type::NumericType T>
-	inline math::Vector2<T> math::Vector2<T>::Up(void) noexcept
+	inline constexpr math::Vector2<T> math::Vector2<T>::Up(void) noexcept
 	{
 		return Vector2(0.0f, 1.0f);
 	}
 
 	template<math_type::NumericType T>
-	inline math::Vector2<T> math::Vector2<T>::Down(void) noexcept
+	inline constexpr math::Vector2<T> math::Vector2<T>::Down(void) noexcept
 	{
 		return Vector2(0.0f, -1.0f);
 	}
 
 	template<math_type::NumericType T>
-	inline math::Vector2<T> math::Vector2<T>::Left(void) noexcept
+	inline constexpr math::Vector2<T> math::Vector2<T>::Left(void) noexcept
 	{
 		return Vector2<T>(-1.0f, 0.0f);
 	}
 
 	template<math_type::NumericType T>
-	inline math::Vector2<T> math::Vector2<T>::Right(void) noexcept
+	inline constexpr math::Vector2<T> math::Vector2<T>::Right(void) noexcept
 	{
 		return Vector2<T>(1.0f, 0.0f);
 	}
 
 	template<math_type::NumericType T>
-	inline math::Vector2<T> math::Vector2<T>::Zero(void) noexcept
+	inline constexpr math::Vector2<T> math::Vector2<T>::Zero(void) noexcept
 	{
 		return Vector2(0.0f, 0.0f);
 	}
 
 	template<math::math_type::NumericType T>
-	T math::Vector2<T>::Cross(math::Vector2<T> const& vec2) const
+	inline constexpr T math::Vector2<T>::Cross(math::Vector2<T> const& vec2) const
 	{
-		return (m_x * vec2.m_y) - (m_y * vec2.m_x);
+		return (m_values[0] * vec2.m_values[1]) - (m_values[1] * vec2.m_values[0]);
 	}
 
 	template<math::math_type::NumericType T>
-	T math::Vector2<T>::Dot(math::Vector2<T> const& vec2) const
-	{	
-		return (m_x * vec2.m_x) + (m_y * vec2.m_y);
+	inline constexpr T math::Vector2<T>::Dot(math::Vector2<T> const& vec2) const
+	{
+		return Vector<2, T>::Dot(vec2);
 	}
 
 	template<math::math_type::NumericType T>
-	T math::Vector2<T>::Magnitude(void) const
+	inline constexpr T math::Vector2<T>::Magnitude(Precision precision) const
 	{
-		return (T) std::sqrtf(Dot(*this));
+		return Vector<2, T>::Magnitude(precision);
 	}
 
 	template<math::math_type::NumericType T>
-	math::Vector2<T>& Vector2<T>::Normalize(void)
+	inline constexpr math::Vector2<T>& Vector2<T>::Normalize(Precision precision)
 	{
 		/*
 		*	Formula:
@@ -173,26 +183,23 @@ namespace math
 		*	mag	  -> Magnitude of the vector
 		*/
 
-		const T denominator = 1.0f / Magnitude();
-
-		m_x *= denominator;
-		m_y *= denominator;
+		Vector<2, T>::Normalize(precision);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	math::Vector2<T>& math::Vector2<T>::Normal(void)
+	inline constexpr math::Vector2<T>& math::Vector2<T>::Normal(void)
 	{
-		T tmp = -m_y;
-		m_y = m_x;
-		m_x = tmp;
+		T tmp = -m_values[1];
+		m_values[1] = m_values[0];
+		m_values[0] = tmp;
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	T math::Vector2<T>::AngleFrom(Vector2<T> const& vec2) const
+	inline constexpr T math::Vector2<T>::AngleFrom(Vector2<T> const& vec2) const
 	{
 		/*
 			*	Get the angle between two vectors
@@ -211,17 +218,17 @@ namespace math
 		const T magnitude2 = vec2.Magnitude();
 
 		// Calculate angle
-		return acosf(Dot(vec2) / (magnitude1 * magnitude2));
+		return math::Acos(Dot(vec2) / (magnitude1 * magnitude2));
 	}
 
 	template<math::math_type::NumericType T>
-	bool math::Vector2<T>::IsUnit(void) const
+	inline constexpr bool math::Vector2<T>::IsUnit(void) const
 	{
 		return (static_cast<float>(Magnitude()) == 1.0f);
 	}
 
 	template<math::math_type::NumericType T>
-	Vector2<T>& Vector2<T>::Reflect(Vector2<T> const& vec2)
+	inline constexpr Vector2<T>& Vector2<T>::Reflect(Vector2<T> const& vec2)
 	{
 		/*
 		*	Formula:
@@ -243,174 +250,161 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	Vector2<T>& Vector2<T>::Project(Vector2<T> const& vec2)
+	inline constexpr Vector2<T>& Vector2<T>::Project(Vector2<T> const& vec2)
 	{
 		// Calculate coefficient
 		const T projectionCoefficient = Dot(vec2) / vec2.Dot(vec2);
 
 		// Project each component of vector onto the other vector
-		m_x = vec2.m_x * projectionCoefficient;
-		m_y = vec2.m_y * projectionCoefficient;
+		m_values[0] = vec2.m_values[0] * projectionCoefficient;
+		m_values[1] = vec2.m_values[1] * projectionCoefficient;
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	void math::Vector2<T>::Translate(Vector2<T> const& vec2)
+	inline constexpr void math::Vector2<T>::Translate(Vector2<T> const& vec2)
 	{
 		*this += vec2;
 	}
 
 	template<math::math_type::NumericType T>
-	void Vector2<T>::Rotate(T const& deg)
+	inline constexpr void Vector2<T>::Rotate(T const& deg, Precision precision)
 	{
 		// Calculate cos & sin angle value
-		const T sinAngle = sinf(deg);
-		const T cosAngle = cosf(deg);
+		T sinAngle;
+		T cosAngle;
+		math::SinCos(deg, sinAngle, cosAngle, precision);
 
 		// Store current x value in order for y rotation calculation to be correct
-		const T prevX = m_x;
+		const T prevX = m_values[0];
 
 		// Calculate rotated vector
-		m_x = m_x * cosAngle - m_y * sinAngle;
-		m_y = prevX * sinAngle + m_y * cosAngle;
+		m_values[0] = m_values[0] * cosAngle - m_values[1] * sinAngle;
+		m_values[1] = prevX * sinAngle + m_values[1] * cosAngle;
 	}
 
 	template<math::math_type::NumericType T>
-	void Vector2<T>::Scale(Vector2<T> const& vec2)
+	inline constexpr void Vector2<T>::Scale(Vector2<T> const& vec2)
 	{
 		*this *= vec2;
 	}
 
 	template<math::math_type::NumericType T>
-	math::Vector2<T> math::Vector2<T>::operator+(Vector2<T> const& vec2)
+	inline constexpr math::Vector2<T> math::Vector2<T>::operator+(Vector2<T> const& vec2)
 	{
-		return Vector2<T>(
-			m_x + vec2.m_x,
-			m_y + vec2.m_y
-		);
+		Vector2<T> result(*this);
+
+		return result += vec2;
 	}
 
 	template<math::math_type::NumericType T>
-	math::Vector2<T> math::Vector2<T>::operator-(Vector2<T> const& vec2)
+	inline constexpr math::Vector2<T> math::Vector2<T>::operator-(Vector2<T> const& vec2)
 	{
-		return Vector2<T>(
-			m_x - vec2.m_x,
-			m_y - vec2.m_y
-		);
+		Vector2<T> result(*this);
+
+		return result -= vec2;
 	}
 
 	template<math::math_type::NumericType T>
-	Vector2<T> Vector2<T>::operator*(Vector2<T> const& vec2)
+	inline constexpr Vector2<T> Vector2<T>::operator*(Vector2<T> const& vec2)
 	{
-		return Vector2<T>(
-			m_x * vec2.m_x,
-			m_y * vec2.m_y
-		);
+		Vector2<T> result(*this);
+
+		return result *= vec2;
 	}
 
 	template<math::math_type::NumericType T>
-	math::Vector2<T> math::Vector2<T>::operator/(Vector2<T> const& vec2)
+	inline constexpr math::Vector2<T> math::Vector2<T>::operator/(Vector2<T> const& vec2)
 	{
-		_ASSERT(vec2.m_x != 0.0f);
-		_ASSERT(vec2.m_y != 0.0f);
+		Vector2<T> result(*this);
 
-		return Vector2<T>(
-			m_x / vec2.m_x,
-			m_y / vec2.m_y
-		);
+		return result /= vec2;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector2<T> Vector2<T>::operator*(T value)
+	inline constexpr Vector2<T> Vector2<T>::operator*(T value)
 	{
-		return Vector2<T>(
-			m_x * value,
-			m_y * value
-		);
+		Vector2<T> result(*this);
+		result.Vector<2, T>::operator*=(value);
+
+		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector2<T> Vector2<T>::operator/(T value)
+	inline constexpr Vector2<T> Vector2<T>::operator/(T value)
 	{
-		_ASSERT(value != 0);
+		Vector2<T> result(*this);
+		result.Vector<2, T>::operator/=(value);
 
-		return Vector2<T>(
-			m_x / value,
-			m_y / value
-		);
+		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector2<T>& Vector2<T>::operator-(void)
+	inline constexpr Vector2<T>& Vector2<T>::operator-(void)
 	{
-		m_x = -m_x;
-		m_y = -m_y;
+		Vector<2, T>::operator=(Vector<2, T>::operator-());
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	Vector2<T>& Vector2<T>::operator+=(Vector2<T> const& vec2)
+	inline constexpr Vector2<T>& Vector2<T>::operator+=(Vector2<T> const& vec2)
 	{
-		*this = *this + vec2;
+		Vector<2, T>::operator+=(vec2);
 
 		return *this;
 	}
 	template<math::math_type::NumericType T>
-	Vector2<T>& Vector2<T>::operator-=(Vector2<T> const& vec2)
+	inline constexpr Vector2<T>& Vector2<T>::operator-=(Vector2<T> const& vec2)
 	{
-		*this = *this - vec2;
+		Vector<2, T>::operator-=(vec2);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	Vector2<T>& Vector2<T>::operator*=(Vector2<T> const& vec2)
+	inline constexpr Vector2<T>& Vector2<T>::operator*=(Vector2<T> const& vec2)
 	{
-		*this = *this * vec2;
+		Vector<2, T>::operator*=(vec2);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	Vector2<T>& Vector2<T>::operator/=(Vector2<T> const& vec2)
+	inline constexpr Vector2<T>& Vector2<T>::operator/=(Vector2<T> const& vec2)
 	{
-		*this = *this / vec2;
+		Vector<2, T>::operator/=(vec2);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	bool Vector2<T>::operator==(Vector2<T> const& vec2) const
+	inline constexpr bool Vector2<T>::operator==(Vector2<T> const& vec2) const
 	{
-		return
-			math::AlmostEqual(m_x, vec2.m_x) &&
-			math::AlmostEqual(m_y, vec2.m_y);
+		return math::AlmostEqual(*this, vec2);
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Vector2<T>::operator!=(Vector2<T> const& vec2) const
+	inline constexpr bool Vector2<T>::operator!=(Vector2<T> const& vec2) const
 	{
-		return
-			!(math::AlmostEqual(m_x, vec2.m_x) &&
-			  math::AlmostEqual(m_y, vec2.m_y));
+		return !math::AlmostEqual(*this, vec2);
 	}
 
 	template<math::math_type::NumericType T>
-	T Vector2<T>::operator[](int const& index) const
+	inline constexpr T Vector2<T>::operator[](int const& index) const
 	{
 		_ASSERT(index >= 0 && index <= 1);
 
-		return reinterpret_cast<const T*>(this)[index];
+		return m_values[index];
 	}
 
 	template<math::math_type::NumericType T>
-	T& Vector2<T>::operator[](int const& index)
+	inline constexpr T& Vector2<T>::operator[](int const& index)
 	{
 		_ASSERT(index >= 0 && index <= 1);
 
-		return reinterpret_cast<T*>(this)[index];
+		return m_values[index];
 	}
 }
 
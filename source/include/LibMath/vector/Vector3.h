@@ -2,7 +2,9 @@
 
 #include "../VariableType.hpp"
 #include "../Arithmetic.h"
+#include "../Trigonometry.h"
 #include "../matrix/Matrix3.h"
+#include "VectorN.h"
 
 #include <cmath>
 #include <limits>
@@ -11,6 +13,8 @@
 
 /*
 *	------- Vector3 -------
+*	Thin wrapper over Vector<3, T>, the arithmetic is forwarded to it.
+*
 *	Static Functions:
 *	- Up			DONE
 *	- Down			DONE
@@ -46,117 +50,122 @@
 namespace math
 {
 	template<math::math_type::NumericType T>
-	class Vector3
+	class Vector3 : public Vector<3, T>
 	{
 	public:
-		SPECIFIER				Vector3(void);
-		SPECIFIER				Vector3(T const& scalar);
-		SPECIFIER				Vector3(T const& x, T const& y, T const& z);
-
-								~Vector3(void) = default;
-
-		static	  Vector3<T>	Up(void) noexcept;
-		static	  Vector3<T>	Down(void) noexcept;
-		static	  Vector3<T>	Left(void) noexcept;
-		static	  Vector3<T>	Right(void) noexcept;
-		static	  Vector3<T>	Forward(void) noexcept;
-		static	  Vector3<T>	Backward(void) noexcept;
-		static	  Vector3<T>	Zero(void) noexcept;
-
-		SPECIFIER Vector3<T>	Cross(Vector3<T> const& vec3) const;
-		SPECIFIER T				Dot(Vector3<T> const& vec3) const;
-		SPECIFIER T				Magnitude(void) const;
-		SPECIFIER T				MagnitudeSquared(void) const;
-		SPECIFIER Vector3<T>&	Normalize(void);
-		SPECIFIER T				AngleFrom(Vector3<T> vec3) const;
-		SPECIFIER bool			IsUnit(void) const;
-		SPECIFIER bool			IsShorterThan(Vector3<T> vec3) const;
-		SPECIFIER bool			IsLongerThan(Vector3<T> vec3) const;
-		SPECIFIER Vector3<T>&	Reflect(Vector3<T> const& vec3);
-		SPECIFIER Vector3<T>&	Project(Vector3<T> const& vec3);
-
-		SPECIFIER Vector3<T>&	Translate(Vector3<T> const& vec3);
-		SPECIFIER Vector3<T>&	Rotate(T const& angleDeg, Vector3 const& axis);
-		SPECIFIER Vector3<T>&	Scale(Vector3<T> const& vec3);
+		SPECIFIER					Vector3(void);
+		SPECIFIER					Vector3(T const& scalar);
+		SPECIFIER					Vector3(T const& x, T const& y, T const& z);
+		SPECIFIER explicit			Vector3(Vector<3, T> const& vec);
+
+									~Vector3(void) = default;
+
+		static SPECIFIER Vector3<T>	Up(void) noexcept;
+		static SPECIFIER Vector3<T>	Down(void) noexcept;
+		static SPECIFIER Vector3<T>	Left(void) noexcept;
+		static SPECIFIER Vector3<T>	Right(void) noexcept;
+		static SPECIFIER Vector3<T>	Forward(void) noexcept;
+		static SPECIFIER Vector3<T>	Backward(void) noexcept;
+		static SPECIFIER Vector3<T>	Zero(void) noexcept;
+
+		SPECIFIER Vector3<T>		Cross(Vector3<T> const& vec3) const;
+		SPECIFIER T					Dot(Vector3<T> const& vec3) const;
+		SPECIFIER T					Magnitude(Precision precision = Precision::Exact) const;
+		SPECIFIER T					MagnitudeSquared(void) const;
+		SPECIFIER Vector3<T>&		Normalize(Precision precision = Precision::Exact);
+		SPECIFIER T					AngleFrom(Vector3<T> vec3) const;
+		SPECIFIER bool				IsUnit(void) const;
+		SPECIFIER bool				IsShorterThan(Vector3<T> vec3) const;
+		SPECIFIER bool				IsLongerThan(Vector3<T> vec3) const;
+		SPECIFIER Vector3<T>&		Reflect(Vector3<T> const& vec3);
+		SPECIFIER Vector3<T>&		Project(Vector3<T> const& vec3);
+
+		SPECIFIER Vector3<T>&		Translate(Vector3<T> const& vec3);
+		SPECIFIER Vector3<T>&		Rotate(T const& angleDeg, Vector3 const& axis, Precision precision = Precision::Exact);
+		SPECIFIER Vector3<T>&		Scale(Vector3<T> const& vec3);
 
 		// Operators
-		Vector3<T>				operator+(Vector3<T> const& vec3) const;
-		Vector3<T>				operator-(Vector3<T> const& vec3) const;
-		Vector3<T>				operator*(Vector3<T> const& vec3) const;
-		Vector3<T>				operator/(Vector3<T> const& vec3) const;
-		Vector3<T>				operator*(T value) const;
-		Vector3<T>				operator/(T value) const;
-		Vector3<T>&				operator-(void);
-		Vector3<T>&				operator+=(Vector3<T> const& vec3);
-		Vector3<T>&				operator-=(Vector3<T> const& vec3);
-		Vector3<T>&				operator*=(Vector3<T> const& vec3);
-		Vector3<T>&				operator/=(Vector3<T> const& vec3);
-		bool					operator==(Vector3<T> const& vec3) const;
-		bool					operator!=(Vector3<T> const& vec3) const;
-		T&						operator[](unsigned int index);
-		T						operator[](unsigned int index) const;
+		SPECIFIER Vector3<T>		operator+(Vector3<T> const& vec3) const;
+		SPECIFIER Vector3<T>		operator-(Vector3<T> const& vec3) const;
+		SPECIFIER Vector3<T>		operator*(Vector3<T> const& vec3) const;
+		SPECIFIER Vector3<T>		operator/(Vector3<T> const& vec3) const;
+		SPECIFIER Vector3<T>		operator*(T value) const;
+		SPECIFIER Vector3<T>		operator/(T value) const;
+		SPECIFIER Vector3<T>&		operator-(void);
+		SPECIFIER Vector3<T>&		operator+=(Vector3<T> const& vec3);
+		SPECIFIER Vector3<T>&		operator-=(Vector3<T> const& vec3);
+		SPECIFIER Vector3<T>&		operator*=(Vector3<T> const& vec3);
+		SPECIFIER Vector3<T>&		operator/=(Vector3<T> const& vec3);
+		SPECIFIER bool				operator==(Vector3<T> const& vec3) const;
+		SPECIFIER bool				operator!=(Vector3<T> const& vec3) const;
+		SPECIFIER T&				operator[](unsigned int index);
+		SPECIFIER T					operator[](unsigned int index) const;
 	private:
-		T m_x;
-		T m_y;
-		T m_z;
+		using Vector<3, T>::m_values;
 	};
 
 	template<math::math_type::NumericType T>
 	SPECIFIER Vector3<T>::Vector3(void)
-		: m_x((T) 0.0f), m_y((T) 0.0f), m_z((T) 0.0f)
+		: Vector<3, T>()
 	{
 	}
 
 	template<math::math_type::NumericType T>
 	SPECIFIER Vector3<T>::Vector3(T const& scalar)
-		: m_x(scalar), m_y(scalar), m_z(scalar)
+		: Vector<3, T>(scalar)
 	{
 	}
 
 	template<math::math_type::NumericType T>
 	SPECIFIER Vector3<T>::Vector3(T const& x, T const& y, T const& z)
-		: m_x(x), m_y(y), m_z(z)
+		: Vector<3, T>(x, y, z)
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	SPECIFIER Vector3<T>::Vector3(Vector<3, T> const& vec)
+		: Vector<3, T>(vec)
 	{
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::Up(void) noexcept
+	SPECIFIER Vector3<T> Vector3<T>::Up(void) noexcept
 	{
 		return Vector3<T>(0.0f, 1.0f, 0.0f);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::Down(void) noexcept
+	SPECIFIER Vector3<T> Vector3<T>::Down(void) noexcept
 	{
 		return Vector3<T>(0.0f, -1.0f, 0.0f);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::Left(void) noexcept
+	SPECIFIER Vector3<T> Vector3<T>::Left(void) noexcept
 	{
 		return Vector3<T>(-1.0f, 0.0f, 0.0f);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::Right(void) noexcept
+	SPECIFIER Vector3<T> Vector3<T>::Right(void) noexcept
 	{
 		return Vector3<T>(1.0f, 0.0f, 0.0f);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::Forward(void) noexcept
+	SPECIFIER Vector3<T> Vector3<T>::Forward(void) noexcept
 	{
 		return Vector3<T>(0.0f, 0.0f, 1.0f);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::Backward(void) noexcept
+	SPECIFIER Vector3<T> Vector3<T>::Backward(void) noexcept
 	{
 		return Vector3<T>(0.0f, 0.0f, -1.0f);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::Zero(void) noexcept
+	SPECIFIER Vector3<T> Vector3<T>::Zero(void) noexcept
 	{
 		return Vector3<T>(0.0f, 0.0f, 0.0f);
 	}
@@ -164,39 +173,33 @@ namespace math
 	template<math::math_type::NumericType T>
 	SPECIFIER Vector3<T> Vector3<T>::Cross(Vector3<T> const& vec3) const
 	{
-		return Vector3<T>
-		(
-			(m_y * vec3.m_z) - (m_z * vec3.m_y),
-			(m_z * vec3.m_x) - (m_x * vec3.m_z),
-			(m_x * vec3.m_y) - (m_y * vec3.m_x)
-		);
+		return Vector3<T>(Vector<3, T>::Cross(vec3));
 	}
 
 	template<math::math_type::NumericType T>
 	SPECIFIER T Vector3<T>::Dot(Vector3<T> const& vec3) const
 	{
-		// x^2 + y^2 + z^2
-		return static_cast<T>((m_x * vec3.m_x) + (m_y * vec3.m_y) + (m_z * vec3.m_z));
+		return Vector<3, T>::Dot(vec3);
 	}
 
 	template<math::math_type::NumericType T>
-	SPECIFIER T Vector3<T>::Magnitude(void) const
+	SPECIFIER T Vector3<T>::Magnitude(Precision precision) const
 	{
-		return std::sqrt(Dot(*this));
+		return Vector<3, T>::Magnitude(precision);
 	}
 
 	template<math::math_type::NumericType T>
 	SPECIFIER T Vector3<T>::MagnitudeSquared(void) const
 	{
-		return static_cast<T>((m_x * m_x) + (m_y * m_y) + (m_z * m_z));
+		return Vector<3, T>::MagnitudeSquared();
 	}
 
 	template<math::math_type::NumericType T>
-	SPECIFIER Vector3<T>& Vector3<T>::Normalize(void)
+	SPECIFIER Vector3<T>& Vector3<T>::Normalize(Precision precision)
 	{
-		const T denom =  1.0f / Magnitude();
+		Vector<3, T>::Normalize(precision);
 
-		return *this *= denom;
+		return *this;
 	}
 
 	template<math::math_type::NumericType T>
@@ -216,7 +219,7 @@ namespace math
 		T magnitude2 = vec3.Magnitude();
 
 		// Calculate angle
-		T theta = acosf(Dot(vec3) / (magnitude1 * magnitude2));
+		T theta = math::Acos(Dot(vec3) / (magnitude1 * magnitude2));
 
 		// Return angle in radian
 		return theta;
@@ -269,9 +272,9 @@ namespace math
 		const T projectionCoefficient = Dot(vec3) / vec3.Dot(vec3);
 
 		// Set all vector component values
-		m_x = vec3.m_x * projectionCoefficient;
-		m_y = vec3.m_y * projectionCoefficient;
-		m_z = vec3.m_z * projectionCoefficient;
+		m_values[0] = vec3.m_values[0] * projectionCoefficient;
+		m_values[1] = vec3.m_values[1] * projectionCoefficient;
+		m_values[2] = vec3.m_values[2] * projectionCoefficient;
 
 		return *this;
 	}
@@ -283,11 +286,12 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	SPECIFIER Vector3<T>& Vector3<T>::Rotate(T const& angleDeg, Vector3<T> const& axis)
+	SPECIFIER Vector3<T>& Vector3<T>::Rotate(T const& angleDeg, Vector3<T> const& axis, Precision precision)
 	{
 		// Calculate sin & cos angle
-		const T cosTheta = cosf(angleDeg * DEG2RAD);
-		const T sinTheta = sinf(angleDeg * DEG2RAD);
+		T sinTheta;
+		T cosTheta;
+		math::SinCos(Degree<T>(angleDeg), sinTheta, cosTheta, precision);
 		const T oneMinusCos = 1.0f - cosTheta;
 
 		// Calculate rotation axis & normalize
@@ -297,16 +301,17 @@ namespace math
 		// Rotate via matrix
 		T	matrixValues[9] =
 		{
-			cosTheta + normalizedAxis.m_x * normalizedAxis.m_x * oneMinusCos,						normalizedAxis.m_x * normalizedAxis.m_y * oneMinusCos - normalizedAxis.m_z * sinTheta,		normalizedAxis.m_x * normalizedAxis.m_z * oneMinusCos + normalizedAxis.m_y * sinTheta,
-			normalizedAxis.m_y * normalizedAxis.m_x * oneMinusCos + normalizedAxis.m_z * sinTheta,	cosTheta + normalizedAxis.m_y * normalizedAxis.m_y * oneMinusCos,							normalizedAxis.m_y * normalizedAxis.m_z * oneMinusCos - normalizedAxis.m_x * sinTheta,
-			normalizedAxis.m_z * normalizedAxis.m_x * oneMinusCos - normalizedAxis.m_y * sinTheta,	normalizedAxis.m_z * normalizedAxis.m_y * oneMinusCos + normalizedAxis.m_x * sinTheta,		cosTheta + normalizedAxis.m_z * normalizedAxis.m_z * oneMinusCos
+			cosTheta + normalizedAxis.m_values[0] * normalizedAxis.m_values[0] * oneMinusCos,						normalizedAxis.m_values[0] * normalizedAxis.m_values[1] * oneMinusCos - normalizedAxis.m_values[2] * sinTheta,		normalizedAxis.m_values[0] * normalizedAxis.m_values[2] * oneMinusCos + normalizedAxis.m_values[1] * sinTheta,
+			normalizedAxis.m_values[1] * normalizedAxis.m_values[0] * oneMinusCos + normalizedAxis.m_values[2] * sinTheta,	cosTheta + normalizedAxis.m_values[1] * normalizedAxis.m_values[1] * oneMinusCos,							normalizedAxis.m_values[1] * normalizedAxis.m_values[2] * oneMinusCos - normalizedAxis.m_values[0] * sinTheta,
+			normalizedAxis.m_values[2] * normalizedAxis.m_values[0] * oneMinusCos - normalizedAxis.m_values[1] * sinTheta,	normalizedAxis.m_values[2] * normalizedAxis.m_values[1] * oneMinusCos + normalizedAxis.m_values[0] * sinTheta,		cosTheta + normalizedAxis.m_values[2] * normalizedAxis.m_values[2] * oneMinusCos
 		};
 
-		// Initialize & assign values via array
-		Matrix3<T> rotationMatrix(matrixValues);
+		// Rotate vector, the array is row major
+		const Vector3<T> vec3(*this);
 
-		// Rotate vector
-		*this = rotationMatrix * *this;
+		m_values[0] = matrixValues[0] * vec3.m_values[0] + matrixValues[1] * vec3.m_values[1] + matrixValues[2] * vec3.m_values[2];
+		m_values[1] = matrixValues[3] * vec3.m_values[0] + matrixValues[4] * vec3.m_values[1] + matrixValues[5] * vec3.m_values[2];
+		m_values[2] = matrixValues[6] * vec3.m_values[0] + matrixValues[7] * vec3.m_values[1] + matrixValues[8] * vec3.m_values[2];
 
 		return *this;
 	}
@@ -318,145 +323,121 @@ namespace math
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::operator+(Vector3 const& vec3) const
+	SPECIFIER Vector3<T> Vector3<T>::operator+(Vector3 const& vec3) const
 	{
-		return Vector3<T>(
-			m_x + vec3.m_x,
-			m_y + vec3.m_y,
-			m_z + vec3.m_z
-		);
+		Vector3<T> result(*this);
+
+		return result += vec3;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::operator-(Vector3 const& vec3) const
+	SPECIFIER Vector3<T> Vector3<T>::operator-(Vector3 const& vec3) const
 	{
-		return Vector3(
-			m_x - vec3.m_x,
-			m_y - vec3.m_y,
-			m_z - vec3.m_z
-		);
+		Vector3<T> result(*this);
+
+		return result -= vec3;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::operator*(Vector3 const& vec3) const
+	SPECIFIER Vector3<T> Vector3<T>::operator*(Vector3 const& vec3) const
 	{
-		return Vector3(
-			m_x * vec3.m_x,
-			m_y * vec3.m_y,
-			m_z * vec3.m_z
-		);
+		Vector3<T> result(*this);
+
+		return result *= vec3;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::operator/(Vector3 const& vec3) const
+	SPECIFIER Vector3<T> Vector3<T>::operator/(Vector3 const& vec3) const
 	{
-		_ASSERT(vec3.m_x != 0.0f);
-		_ASSERT(vec3.m_y != 0.0f);
-		_ASSERT(vec3.m_z != 0.0f);
+		Vector3<T> result(*this);
 
-		return Vector3(
-			m_x / vec3.m_x,
-			m_y / vec3.m_y,
-			m_z / vec3.m_z
-		);
+		return result /= vec3;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::operator*(T value) const
+	SPECIFIER Vector3<T> Vector3<T>::operator*(T value) const
 	{
-		return Vector3<T>(
-			m_x * value,
-			m_y * value,
-			m_z * value
-		);
+		Vector3<T> result(*this);
+		result.Vector<3, T>::operator*=(value);
+
+		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T> Vector3<T>::operator/(T value) const
+	SPECIFIER Vector3<T> Vector3<T>::operator/(T value) const
 	{
-		_ASSERT(value != 0.0f);
+		Vector3<T> result(*this);
+		result.Vector<3, T>::operator/=(value);
 
-		return Vector3(
-			m_x / value,
-			m_y / value,
-			m_z / value
-		);
+		return result;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T>& Vector3<T>::operator-(void)
+	SPECIFIER Vector3<T>& Vector3<T>::operator-(void)
 	{
-		m_x = -m_x;
-		m_y = -m_y;
-		m_z = -m_z;
+		Vector<3, T>::operator=(Vector<3, T>::operator-());
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T>& Vector3<T>::operator+=(Vector3 const& vec3)
+	SPECIFIER Vector3<T>& Vector3<T>::operator+=(Vector3 const& vec3)
 	{
-		*this = *this + vec3;
+		Vector<3, T>::operator+=(vec3);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T>& Vector3<T>::operator-=(Vector3 const& vec3)
+	SPECIFIER Vector3<T>& Vector3<T>::operator-=(Vector3 const& vec3)
 	{
-		*this = *this - vec3;
+		Vector<3, T>::operator-=(vec3);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T>& Vector3<T>::operator*=(Vector3 const& vec3)
+	SPECIFIER Vector3<T>& Vector3<T>::operator*=(Vector3 const& vec3)
 	{
-		*this = *this * vec3;
+		Vector<3, T>::operator*=(vec3);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector3<T>& Vector3<T>::operator/=(Vector3 const& vec3)
+	SPECIFIER Vector3<T>& Vector3<T>::operator/=(Vector3 const& vec3)
 	{
-		*this = *this / vec3;
+		Vector<3, T>::operator/=(vec3);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Vector3<T>::operator==(Vector3 const& vec3) const
+	SPECIFIER bool Vector3<T>::operator==(Vector3 const& vec3) const
 	{
-		return
-			math::AlmostEqual(m_x, vec3.m_x) &&
-			math::AlmostEqual(m_y, vec3.m_y) &&
-			math::AlmostEqual(m_z, vec3.m_z);
+		return math::AlmostEqual(*this, vec3);
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Vector3<T>::operator!=(Vector3 const& vec3) const
+	SPECIFIER bool Vector3<T>::operator!=(Vector3 const& vec3) const
 	{
-		return
-			!(math::AlmostEqual(m_x, vec3.m_x) &&
-			  math::AlmostEqual(m_y, vec3.m_y) &&
-			  math::AlmostEqual(m_z, vec3.m_z));
+		return !math::AlmostEqual(*this, vec3);
 	}
 
 	template<math::math_type::NumericType T>
-	inline T& Vector3<T>::operator[](unsigned int index)
+	SPECIFIER T& Vector3<T>::operator[](unsigned int index)
 	{
-		_ASSERT(index < 4);
+		_ASSERT(index < 3);
 
-		return reinterpret_cast<T*>(this)[index];
+		return m_values[index];
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Vector3<T>::operator[](unsigned int index) const
+	SPECIFIER T Vector3<T>::operator[](unsigned int index) const
 	{
-		_ASSERT(index < 4);
+		_ASSERT(index < 3);
 
-		return reinterpret_cast<const T*>(this)[index];
+		return m_values[index];
 	}
 }
 
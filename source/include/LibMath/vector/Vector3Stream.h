@@ -0,0 +1,461 @@
+#pragma once
+
+#include "../VariableType.hpp"
+#include "../simd/Simd.h"
+#include "../simd/Float4.h"
+#include "Vector3.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+/*
+*	------- Vector3Stream -------
+*	Structure of arrays storage for N Vector3, each component
+*	lives in its own lane so bulk operations can be vectorised.
+*
+*	Vector3StreamView does not own its lanes, lanes may be strided
+*	so an existing Vector3 array can be viewed in place (stride 3).
+*	Vector3Stream owns its lanes, each lane is 64 byte aligned.
+*
+*	Float streams with contiguous lanes use SSE2, results are
+*	identical to calling the Vector3 function on each element.
+*
+*	Functions:
+*	- Size			DONE
+*	- Get			DONE
+*	- Set			DONE
+*	- Load			DONE
+*	- Store			DONE
+*	- Dot			DONE
+*	- Cross			DONE
+*	- Magnitude		DONE
+*	- Normalize		DONE
+*	- Scale			DONE
+*	- Translate		DONE
+*/
+
+namespace math
+{
+	template<math::math_type::NumericType T>
+	class Vector3StreamView
+	{
+	public:
+								Vector3StreamView(void) = default;
+								Vector3StreamView(T* x, T* y, T* z, size_t size, size_t stride = 1);
+								Vector3StreamView(Vector3<T>* vectors, size_t size);
+
+								~Vector3StreamView(void) = default;
+
+		size_t					Size(void) const noexcept;
+		size_t					Stride(void) const noexcept;
+		bool					IsContiguous(void) const noexcept;
+		T*						X(void) const noexcept;
+		T*						Y(void) const noexcept;
+		T*						Z(void) const noexcept;
+
+		Vector3<T>				Get(size_t index) const;
+		void					Set(size_t index, Vector3<T> const& vec3);
+		void					Load(Vector3<T> const* vectors);
+		void					Store(Vector3<T>* vectors) const;
+
+		void					Dot(Vector3StreamView<T> const& stream, T* result) const;
+		void					Cross(Vector3StreamView<T> const& stream, Vector3StreamView<T> result) const;
+		void					Magnitude(T* result, Precision precision = Precision::Exact) const;
+		void					MagnitudeSquared(T* result) const;
+		Vector3StreamView<T>&	Normalize(Precision precision = Precision::Exact);
+		Vector3StreamView<T>&	Scale(T scale);
+		Vector3StreamView<T>&	Scale(Vector3<T> const& vec3);
+		Vector3StreamView<T>&	Translate(Vector3<T> const& vec3);
+
+	protected:
+		T*		m_x = nullptr;
+		T*		m_y = nullptr;
+		T*		m_z = nullptr;
+		size_t	m_size = 0;
+		size_t	m_stride = 1;
+	};
+
+	template<math::math_type::NumericType T>
+	class Vector3Stream : public Vector3StreamView<T>
+	{
+	public:
+		static constexpr size_t	Alignment = 64;
+
+								Vector3Stream(void) = default;
+		explicit				Vector3Stream(size_t size);
+								Vector3Stream(Vector3<T> const* vectors, size_t size);
+								Vector3Stream(Vector3Stream<T> const& stream);
+								Vector3Stream(Vector3Stream<T>&& stream) noexcept;
+
+								~Vector3Stream(void);
+
+		Vector3StreamView<T>	View(void) const noexcept;
+
+		Vector3Stream<T>&		operator=(Vector3Stream<T> const& stream);
+		Vector3Stream<T>&		operator=(Vector3Stream<T>&& stream) noexcept;
+
+	private:
+		void					Allocate(size_t size);
+		void					Release(void) noexcept;
+
+		T* m_data = nullptr;
+	};
+
+	template<math::math_type::NumericType T>
+	inline Vector3StreamView<T>::Vector3StreamView(T* x, T* y, T* z, size_t size, size_t stride)
+		: m_x(x), m_y(y), m_z(z), m_size(size), m_stride(stride)
+	{
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3StreamView<T>::Vector3StreamView(Vector3<T>* vectors, size_t size)
+		: m_size(size), m_stride(3)
+	{
+		// Vector3 is 3 tightly packed components, view it in place
+		static_assert(sizeof(Vector3<T>) == 3 * sizeof(T) && std::is_standard_layout_v<Vector3<T>>);
+
+		T* components = reinterpret_cast<T*>(vectors);
+
+		m_x = components;
+		m_y = components + 1;
+		m_z = components + 2;
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t Vector3StreamView<T>::Size(void) const noexcept
+	{
+		return m_size;
+	}
+
+	template<math::math_type::NumericType T>
+	inline size_t Vector3StreamView<T>::Stride(void) const noexcept
+	{
+		return m_stride;
+	}
+
+	template<math::math_type::NumericType T>
+	inline bool Vector3StreamView<T>::IsContiguous(void) const noexcept
+	{
+		return m_stride == 1;
+	}
+
+	template<math::math_type::NumericType T>
+	inline T* Vector3StreamView<T>::X(void) const noexcept
+	{
+		return m_x;
+	}
+
+	template<math::math_type::NumericType T>
+	inline T* Vector3StreamView<T>::Y(void) const noexcept
+	{
+		return m_y;
+	}
+
+	template<math::math_type::NumericType T>
+	inline T* Vector3StreamView<T>::Z(void) const noexcept
+	{
+		return m_z;
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3<T> Vector3StreamView<T>::Get(size_t index) const
+	{
+		_ASSERT(index < m_size);
+
+		const size_t offset = index * m_stride;
+
+		return Vector3<T>(m_x[offset], m_y[offset], m_z[offset]);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Vector3StreamView<T>::Set(size_t index, Vector3<T> const& vec3)
+	{
+		_ASSERT(index < m_size);
+
+		const size_t offset = index * m_stride;
+
+		m_x[offset] = vec3[0];
+		m_y[offset] = vec3[1];
+		m_z[offset] = vec3[2];
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Vector3StreamView<T>::Load(Vector3<T> const* vectors)
+	{
+		for (size_t i = 0; i < m_size; ++i)
+			Set(i, vectors[i]);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Vector3StreamView<T>::Store(Vector3<T>* vectors) const
+	{
+		for (size_t i = 0; i < m_size; ++i)
+			vectors[i] = Get(i);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Vector3StreamView<T>::Dot(Vector3StreamView<T> const& stream, T* result) const
+	{
+		_ASSERT(stream.m_size == m_size);
+
+		size_t i = 0;
+
+#if LIBMATH_SIMD_SSE2
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (IsContiguous() && stream.IsContiguous())
+			{
+				for (; i + 4 <= m_size; i += 4)
+				{
+					const __m128 x = _mm_mul_ps(_mm_loadu_ps(m_x + i), _mm_loadu_ps(stream.m_x + i));
+					const __m128 y = _mm_mul_ps(_mm_loadu_ps(m_y + i), _mm_loadu_ps(stream.m_y + i));
+					const __m128 z = _mm_mul_ps(_mm_loadu_ps(m_z + i), _mm_loadu_ps(stream.m_z + i));
+
+					_mm_storeu_ps(result + i, _mm_add_ps(_mm_add_ps(x, y), z));
+				}
+			}
+		}
+#endif
+
+		for (; i < m_size; ++i)
+		{
+			const size_t lhs = i * m_stride;
+			const size_t rhs = i * stream.m_stride;
+
+			result[i] = (m_x[lhs] * stream.m_x[rhs]) + (m_y[lhs] * stream.m_y[rhs]) + (m_z[lhs] * stream.m_z[rhs]);
+		}
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Vector3StreamView<T>::Cross(Vector3StreamView<T> const& stream, Vector3StreamView<T> result) const
+	{
+		_ASSERT(stream.m_size == m_size && result.m_size == m_size);
+
+		size_t i = 0;
+
+#if LIBMATH_SIMD_SSE2
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (IsContiguous() && stream.IsContiguous() && result.IsContiguous())
+			{
+				for (; i + 4 <= m_size; i += 4)
+				{
+					const __m128 lhsX = _mm_loadu_ps(m_x + i);
+					const __m128 lhsY = _mm_loadu_ps(m_y + i);
+					const __m128 lhsZ = _mm_loadu_ps(m_z + i);
+					const __m128 rhsX = _mm_loadu_ps(stream.m_x + i);
+					const __m128 rhsY = _mm_loadu_ps(stream.m_y + i);
+					const __m128 rhsZ = _mm_loadu_ps(stream.m_z + i);
+
+					_mm_storeu_ps(result.m_x + i, _mm_sub_ps(_mm_mul_ps(lhsY, rhsZ), _mm_mul_ps(lhsZ, rhsY)));
+					_mm_storeu_ps(result.m_y + i, _mm_sub_ps(_mm_mul_ps(lhsZ, rhsX), _mm_mul_ps(lhsX, rhsZ)));
+					_mm_storeu_ps(result.m_z + i, _mm_sub_ps(_mm_mul_ps(lhsX, rhsY), _mm_mul_ps(lhsY, rhsX)));
+				}
+			}
+		}
+#endif
+
+		// Read each element before writing, result may alias either input
+		for (; i < m_size; ++i)
+			result.Set(i, Get(i).Cross(stream.Get(i)));
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Vector3StreamView<T>::Magnitude(T* result, Precision precision) const
+	{
+		MagnitudeSquared(result);
+
+		math::Sqrt<T>(std::span<T const>(result, m_size), std::span<T>(result, m_size), precision);
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Vector3StreamView<T>::MagnitudeSquared(T* result) const
+	{
+		Dot(*this, result);
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3StreamView<T>& Vector3StreamView<T>::Normalize(Precision precision)
+	{
+		size_t i = 0;
+
+#if LIBMATH_SIMD_SSE2
+		if constexpr (std::is_same_v<T, float>)
+		{
+			if (IsContiguous())
+			{
+				const __m128 one = _mm_set1_ps(1.0f);
+
+				for (; i + 4 <= m_size; i += 4)
+				{
+					const __m128 x = _mm_loadu_ps(m_x + i);
+					const __m128 y = _mm_loadu_ps(m_y + i);
+					const __m128 z = _mm_loadu_ps(m_z + i);
+
+					// Same rounding as Vector3::Normalize, 1 / sqrt then multiply
+					const __m128 magnitudeSquared = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+					const __m128 denom = (precision == Precision::Fast) ? simd::RSqrt4(magnitudeSquared) : _mm_div_ps(one, _mm_sqrt_ps(magnitudeSquared));
+
+					_mm_storeu_ps(m_x + i, _mm_mul_ps(x, denom));
+					_mm_storeu_ps(m_y + i, _mm_mul_ps(y, denom));
+					_mm_storeu_ps(m_z + i, _mm_mul_ps(z, denom));
+				}
+			}
+		}
+#endif
+
+		for (; i < m_size; ++i)
+			Set(i, Get(i).Normalize(precision));
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3StreamView<T>& Vector3StreamView<T>::Scale(T scale)
+	{
+		return Scale(Vector3<T>(scale));
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3StreamView<T>& Vector3StreamView<T>::Scale(Vector3<T> const& vec3)
+	{
+		const T components[3] = {vec3[0], vec3[1], vec3[2]};
+		T* const lanes[3] = {m_x, m_y, m_z};
+
+		// One pass per lane, each loop is a single stream the compiler can vectorise
+		for (int lane = 0; lane < 3; ++lane)
+		{
+			T* values = lanes[lane];
+
+			for (size_t i = 0; i < m_size; ++i)
+				values[i * m_stride] *= components[lane];
+		}
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3StreamView<T>& Vector3StreamView<T>::Translate(Vector3<T> const& vec3)
+	{
+		const T components[3] = {vec3[0], vec3[1], vec3[2]};
+		T* const lanes[3] = {m_x, m_y, m_z};
+
+		for (int lane = 0; lane < 3; ++lane)
+		{
+			T* values = lanes[lane];
+
+			for (size_t i = 0; i < m_size; ++i)
+				values[i * m_stride] += components[lane];
+		}
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3Stream<T>::Vector3Stream(size_t size)
+	{
+		Allocate(size);
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3Stream<T>::Vector3Stream(Vector3<T> const* vectors, size_t size)
+	{
+		Allocate(size);
+		this->Load(vectors);
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3Stream<T>::Vector3Stream(Vector3Stream<T> const& stream)
+		: Vector3StreamView<T>()
+	{
+		*this = stream;
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3Stream<T>::Vector3Stream(Vector3Stream<T>&& stream) noexcept
+	{
+		*this = std::move(stream);
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3Stream<T>::~Vector3Stream(void)
+	{
+		Release();
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3StreamView<T> Vector3Stream<T>::View(void) const noexcept
+	{
+		return Vector3StreamView<T>(this->m_x, this->m_y, this->m_z, this->m_size);
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3Stream<T>& Vector3Stream<T>::operator=(Vector3Stream<T> const& stream)
+	{
+		if (this == &stream)
+			return *this;
+
+		Release();
+		Allocate(stream.m_size);
+
+		std::copy_n(stream.m_x, stream.m_size, this->m_x);
+		std::copy_n(stream.m_y, stream.m_size, this->m_y);
+		std::copy_n(stream.m_z, stream.m_size, this->m_z);
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline Vector3Stream<T>& Vector3Stream<T>::operator=(Vector3Stream<T>&& stream) noexcept
+	{
+		if (this == &stream)
+			return *this;
+
+		Release();
+
+		static_cast<Vector3StreamView<T>&>(*this) = stream;
+		m_data = stream.m_data;
+
+		static_cast<Vector3StreamView<T>&>(stream) = Vector3StreamView<T>();
+		stream.m_data = nullptr;
+
+		return *this;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Vector3Stream<T>::Allocate(size_t size)
+	{
+		// Pad each lane to a multiple of the alignment so every lane starts aligned
+		constexpr size_t laneElements = Alignment / sizeof(T);
+		const size_t laneSize = (size + laneElements - 1) / laneElements * laneElements;
+
+		if (laneSize != 0)
+		{
+			m_data = static_cast<T*>(::operator new(3 * laneSize * sizeof(T), std::align_val_t(Alignment)));
+			std::fill_n(m_data, 3 * laneSize, static_cast<T>(0));
+		}
+
+		this->m_x = m_data;
+		this->m_y = m_data + laneSize;
+		this->m_z = m_data + 2 * laneSize;
+		this->m_size = size;
+		this->m_stride = 1;
+	}
+
+	template<math::math_type::NumericType T>
+	inline void Vector3Stream<T>::Release(void) noexcept
+	{
+		if (m_data != nullptr)
+			::operator delete(m_data, std::align_val_t(Alignment));
+
+		static_cast<Vector3StreamView<T>&>(*this) = Vector3StreamView<T>();
+		m_data = nullptr;
+	}
+}
+
+namespace LibMath = math;
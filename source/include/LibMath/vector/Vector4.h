@@ -2,12 +2,17 @@
 
 #include "../VariableType.hpp"
 #include "../Arithmetic.h"
+#include "VectorN.h"
 
 #include <cmath>
 #include <limits>
 
 /*
 *	------- Vector4 -------
+*	Thin wrapper over Vector<4, T>, the arithmetic is forwarded to it.
+*	Vector4<float> is 16 byte aligned & uses the SSE2 paths of
+*	Vector<4, float>, Register & the __m128 constructor expose them.
+*
 *	Static Functions:
 *	- Zero			DONE
 * 
@@ -29,289 +34,277 @@
 namespace math
 {
 	template<math::math_type::NumericType T>
-	class Vector4
+	class Vector4 : public Vector<4, T>
 	{
 	public:
-							Vector4(void);
-							Vector4(T scalar);
-							Vector4(T x, T y, T z, T w);
-
-							~Vector4(void) = default;
-
-		static Vector4<T>	Zero(void) noexcept;
-
-		T					Magnitude(void) const;
-		T					Dot(Vector4<T> const& vec4) const;
-		Vector4<T>&			Normalize(void);
-		bool				IsShorterThan(Vector4<T> const& vec4) const;
-		bool				IsLongerThan(Vector4<T> const& vec4) const;
-
-		Vector4<T>&			Translate(Vector4<T> vec4);
-		Vector4<T>&			Scale(Vector4<T> scale);
-
-		Vector4<T>			operator+(Vector4<T> const vec4) const;
-		Vector4<T>			operator-(Vector4<T> const vec4) const;
-		Vector4<T>			operator*(Vector4<T> const vec4) const;
-		Vector4<T>			operator/(Vector4<T> const vec4) const;
-		Vector4<T>			operator*(T value) const;
-		Vector4<T>			operator/(T value) const;
-		Vector4<T>&			operator-(void);
-		Vector4<T>&			operator+=(Vector4<T> const& vec4);
-		Vector4<T>&			operator-=(Vector4<T> const& vec4);
-		Vector4<T>&			operator*=(Vector4<T> const& vec4);
-		Vector4<T>&			operator/=(Vector4<T> const& vec4);
-		Vector4<T>&			operator*=(T value);
-		Vector4<T>&			operator/=(T value);
-		bool				operator==(Vector4<T> vec4) const;
-		bool				operator!=(Vector4<T> vec4) const;
-		T					operator[](unsigned int index) const;
-		T&					operator[](unsigned int index);
+		constexpr					Vector4(void);
+		constexpr					Vector4(T scalar);
+		constexpr					Vector4(T x, T y, T z, T w);
+		constexpr explicit			Vector4(Vector<4, T> const& vec);
+
+#if LIBMATH_SIMD_SSE2
+		explicit					Vector4(__m128 value) requires (std::is_same_v<T, float>);
+#endif
+
+									~Vector4(void) = default;
+
+		static constexpr Vector4<T>	Zero(void) noexcept;
+
+		constexpr T					Magnitude(Precision precision = Precision::Exact) const;
+		constexpr T					Dot(Vector4<T> const& vec4) const;
+		constexpr Vector4<T>&		Normalize(Precision precision = Precision::Exact);
+		constexpr bool				IsShorterThan(Vector4<T> const& vec4) const;
+		constexpr bool				IsLongerThan(Vector4<T> const& vec4) const;
+
+		constexpr Vector4<T>&		Translate(Vector4<T> vec4);
+		constexpr Vector4<T>&		Scale(Vector4<T> scale);
+
+#if LIBMATH_SIMD_SSE2
+		__m128						Register(void) const noexcept requires (std::is_same_v<T, float>);
+#endif
+
+		constexpr Vector4<T>		operator+(Vector4<T> const vec4) const;
+		constexpr Vector4<T>		operator-(Vector4<T> const vec4) const;
+		constexpr Vector4<T>		operator*(Vector4<T> const vec4) const;
+		constexpr Vector4<T>		operator/(Vector4<T> const vec4) const;
+		constexpr Vector4<T>		operator*(T value) const;
+		constexpr Vector4<T>		operator/(T value) const;
+		constexpr Vector4<T>&		operator-(void);
+		constexpr Vector4<T>&		operator+=(Vector4<T> const& vec4);
+		constexpr Vector4<T>&		operator-=(Vector4<T> const& vec4);
+		constexpr Vector4<T>&		operator*=(Vector4<T> const& vec4);
+		constexpr Vector4<T>&		operator/=(Vector4<T> const& vec4);
+		constexpr Vector4<T>&		operator*=(T value);
+		constexpr Vector4<T>&		operator/=(T value);
+		constexpr bool				operator==(Vector4<T> vec4) const;
+		constexpr bool				operator!=(Vector4<T> vec4) const;
+		constexpr T					operator[](unsigned int index) const;
+		constexpr T&				operator[](unsigned int index);
 
 	private:
-		T m_x;
-		T m_y;
-		T m_z;
-		T m_w;
+		using Vector<4, T>::m_values;
 	};
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>::Vector4(void)
-		: m_x((T) 0.0f), m_y((T) 0.0f), m_z((T) 0.0f), m_w((T) 0.0f)
+	inline constexpr Vector4<T>::Vector4(void)
+		: Vector<4, T>()
 	{
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>::Vector4(T scalar)
-		: m_x(scalar), m_y(scalar), m_z(scalar), m_w(scalar)
+	inline constexpr Vector4<T>::Vector4(T scalar)
+		: Vector<4, T>(scalar)
 	{
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>::Vector4(T x, T y, T z, T w)
-		: m_x(x), m_y(y), m_z(z), m_w(w)
+	inline constexpr Vector4<T>::Vector4(T x, T y, T z, T w)
+		: Vector<4, T>(x, y, z, w)
 	{
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T> Vector4<T>::Zero(void) noexcept
+	inline constexpr Vector4<T>::Vector4(Vector<4, T> const& vec)
+		: Vector<4, T>(vec)
 	{
-		T zero = static_cast<T>(0.0f);
+	}
+
+#if LIBMATH_SIMD_SSE2
+	template<math::math_type::NumericType T>
+	inline Vector4<T>::Vector4(__m128 value) requires (std::is_same_v<T, float>)
+	{
+		_mm_store_ps(m_values, value);
+	}
+#endif
 
-		return Vector4<T>(zero, zero, zero, zero);
+	template<math::math_type::NumericType T>
+	inline constexpr Vector4<T> Vector4<T>::Zero(void) noexcept
+	{
+		return Vector4<T>();
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Vector4<T>::Magnitude(void) const
+	inline constexpr T Vector4<T>::Magnitude(Precision precision) const
 	{
-		return (T) std::sqrt(Dot(*this));
+		return Vector<4, T>::Magnitude(precision);
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Vector4<T>::Dot(Vector4<T> const& vec4) const
+	inline constexpr T Vector4<T>::Dot(Vector4<T> const& vec4) const
 	{
-		return static_cast<T>((m_x * vec4.m_x) + (m_y * vec4.m_y) + (m_z * vec4.m_z)) + (m_w * vec4.m_w);
+		return Vector<4, T>::Dot(vec4);
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>& Vector4<T>::Normalize(void)
+	inline constexpr Vector4<T>& Vector4<T>::Normalize(Precision precision)
 	{
-		const T denom = 1.0f / Magnitude();
+		Vector<4, T>::Normalize(precision);
 
-		return *this *= denom;
+		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Vector4<T>::IsShorterThan(Vector4<T> const& vec4) const
+	inline constexpr bool Vector4<T>::IsShorterThan(Vector4<T> const& vec4) const
 	{
 		return Magnitude() < vec4.Magnitude();
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Vector4<T>::IsLongerThan(Vector4<T> const& vec4) const
+	inline constexpr bool Vector4<T>::IsLongerThan(Vector4<T> const& vec4) const
 	{
 		return Magnitude() > vec4.Magnitude();
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>& Vector4<T>::Translate(Vector4<T> vec4)
+	inline constexpr Vector4<T>& Vector4<T>::Translate(Vector4<T> vec4)
 	{
 		return *this += vec4;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>& Vector4<T>::Scale(Vector4<T> scale)
+	inline constexpr Vector4<T>& Vector4<T>::Scale(Vector4<T> scale)
 	{
 		return *this *= scale;
 	}
 
+#if LIBMATH_SIMD_SSE2
 	template<math::math_type::NumericType T>
-	inline math::Vector4<T> Vector4<T>::operator+(Vector4<T> const vec4) const
+	inline __m128 Vector4<T>::Register(void) const noexcept requires (std::is_same_v<T, float>)
 	{
-		return Vector4<T>(
-			m_x + vec4.m_x,
-			m_y + vec4.m_y,
-			m_z + vec4.m_z,
-			m_w + vec4.m_w
-		);
+		return _mm_load_ps(m_values);
 	}
+#endif
 
 	template<math::math_type::NumericType T>
-	inline math::Vector4<T> Vector4<T>::operator-(Vector4<T> const vec4) const
+	inline constexpr math::Vector4<T> Vector4<T>::operator+(Vector4<T> const vec4) const
 	{
-		return Vector4<T>(
-			m_x - vec4.m_x,
-			m_y - vec4.m_y,
-			m_z - vec4.m_z,
-			m_w - vec4.m_w
-		);
+		Vector4<T> result(*this);
+
+		return result += vec4;
 	}
 
 	template<math::math_type::NumericType T>
-	inline math::Vector4<T> Vector4<T>::operator*(Vector4<T> const vec4) const
+	inline constexpr math::Vector4<T> Vector4<T>::operator-(Vector4<T> const vec4) const
 	{
-		return Vector4<T>(
-			m_x * vec4.m_x,
-			m_y * vec4.m_y,
-			m_z * vec4.m_z,
-			m_w * vec4.m_w
-		);
+		Vector4<T> result(*this);
+
+		return result -= vec4;
 	}
 
 	template<math::math_type::NumericType T>
-	inline math::Vector4<T> Vector4<T>::operator/(Vector4<T> const vec4) const
+	inline constexpr math::Vector4<T> Vector4<T>::operator*(Vector4<T> const vec4) const
 	{
-		_ASSERT(vec4.m_x != (T) 0.0f);
-		_ASSERT(vec4.m_y != (T) 0.0f);
-		_ASSERT(vec4.m_z != (T) 0.0f);
-		_ASSERT(vec4.m_w != (T) 0.0f);
+		Vector4<T> result(*this);
 
-		return Vector4<T>(
-			m_x / vec4.m_x,
-			m_y / vec4.m_y,
-			m_z / vec4.m_z,
-			m_w / vec4.m_w
-		);
+		return result *= vec4;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T> Vector4<T>::operator*(T value) const
+	inline constexpr math::Vector4<T> Vector4<T>::operator/(Vector4<T> const vec4) const
 	{
-		return Vector4<T>(
-			m_x * value,
-			m_y * value,
-			m_z * value,
-			m_w * value
-		);
+		Vector4<T> result(*this);
+
+		return result /= vec4;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T> Vector4<T>::operator/(T value) const
+	inline constexpr Vector4<T> Vector4<T>::operator*(T value) const
 	{
-		_ASSERT(value != 0);
+		Vector4<T> result(*this);
 
-		return Vector4<T>(
-			m_x / value,
-			m_y / value,
-			m_z / value,
-			m_w / value
-		);
+		return result *= value;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>& Vector4<T>::operator-(void)
+	inline constexpr Vector4<T> Vector4<T>::operator/(T value) const
 	{
-		m_x = -m_x;
-		m_y = -m_y;
-		m_z = -m_z;
-		m_w = -m_w;
+		Vector4<T> result(*this);
 
-		return *this;
+		return result /= value;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>& Vector4<T>::operator+=(Vector4<T> const& vec4)
+	inline constexpr Vector4<T>& Vector4<T>::operator-(void)
 	{
-		*this = *this + vec4;
+		Vector<4, T>::operator=(Vector<4, T>::operator-());
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>& Vector4<T>::operator-=(Vector4<T> const& vec4)
+	inline constexpr Vector4<T>& Vector4<T>::operator+=(Vector4<T> const& vec4)
 	{
-		*this = *this - vec4;
+		Vector<4, T>::operator+=(vec4);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>& Vector4<T>::operator*=(Vector4<T> const& vec4)
+	inline constexpr Vector4<T>& Vector4<T>::operator-=(Vector4<T> const& vec4)
 	{
-		*this = *this * vec4;
+		Vector<4, T>::operator-=(vec4);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>& Vector4<T>::operator/=(Vector4<T> const& vec4)
+	inline constexpr Vector4<T>& Vector4<T>::operator*=(Vector4<T> const& vec4)
 	{
-		*this = *this / vec4;
+		Vector<4, T>::operator*=(vec4);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>& Vector4<T>::operator*=(T value)
+	inline constexpr Vector4<T>& Vector4<T>::operator/=(Vector4<T> const& vec4)
 	{
-		*this = *this * value;
+		Vector<4, T>::operator/=(vec4);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline Vector4<T>& Vector4<T>::operator/=(T value)
+	inline constexpr Vector4<T>& Vector4<T>::operator*=(T value)
 	{
-		*this = *this / value;
+		Vector<4, T>::operator*=(value);
 
 		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Vector4<T>::operator==(Vector4<T> vec4) const
+	inline constexpr Vector4<T>& Vector4<T>::operator/=(T value)
 	{
-		bool xEqual = math::AlmostEqual(m_x, vec4.m_x);
-		bool yEqual = math::AlmostEqual(m_y, vec4.m_y);
-		bool zEqual = math::AlmostEqual(m_z, vec4.m_z);
-		bool wEqual = math::AlmostEqual(m_w, vec4.m_w);
+		Vector<4, T>::operator/=(value);
 
-		return xEqual && yEqual && zEqual && wEqual;
+		return *this;
 	}
 
 	template<math::math_type::NumericType T>
-	inline bool Vector4<T>::operator!=(Vector4<T> vec4) const
+	inline constexpr bool Vector4<T>::operator==(Vector4<T> vec4) const
 	{
-		bool xEqual = math::AlmostEqual(m_x, vec4.m_x);
-		bool yEqual = math::AlmostEqual(m_y, vec4.m_y);
-		bool zEqual = math::AlmostEqual(m_z, vec4.m_z);
-		bool wEqual = math::AlmostEqual(m_w, vec4.m_w);
+		return math::AlmostEqual(*this, vec4);
+	}
 
-		return !(xEqual && yEqual && zEqual && wEqual);
+	template<math::math_type::NumericType T>
+	inline constexpr bool Vector4<T>::operator!=(Vector4<T> vec4) const
+	{
+		return !math::AlmostEqual(*this, vec4);
 	}
 
 	template<math::math_type::NumericType T>
-	inline T Vector4<T>::operator[](unsigned int index) const
+	inline constexpr T Vector4<T>::operator[](unsigned int index) const
 	{
 		_ASSERT(index < 4);
 
-		return reinterpret_cast<const T*>(this)[index];
+		return m_values[index];
 	}
 
 	template<math::math_type::NumericType T>
-	inline T& Vector4<T>::operator[](unsigned int index)
+	inline constexpr T& Vector4<T>::operator[](unsigned int index)
 	{
 		_ASSERT(index < 4);
 
-		return reinterpret_cast<T*>(this)[index];
+		return m_values[index];
 	}
 }
 
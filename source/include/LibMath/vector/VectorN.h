@@ -0,0 +1,448 @@
+#pragma once
+
+#include "../VariableType.hpp"
+#include "../Arithmetic.h"
+#include "../simd/Simd.h"
+#include "../simd/Float4.h"
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+/*
+*	------- Vector<N, T> -------
+*	N component vector, every loop is unrolled at compile time.
+*
+*	Vector2, Vector3 & Vector4 derive from Vector<2 / 3 / 4, T> & forward
+*	their arithmetic here, they convert to it implicitly & back
+*	explicitly. Vector<4, float> is 16 byte aligned & its operators use
+*	SSE2, results are the same as the scalar code (Dot adds from left
+*	to right).
+*
+*	Functions:
+*	- Zero				DONE
+*	- Data				DONE
+*	- Dot				DONE
+*	- Cross				DONE	(N = 3)
+*	- Magnitude			DONE
+*	- MagnitudeSquared	DONE
+*	- Normalize			DONE
+*
+*	Operators:
+*	- Add		(+, +=)				DONE
+*	- Subtract	(-, -=)				DONE
+*	- Multiply	(*, *=)				DONE	(component wise & scalar)
+*	- Divide	(/, /=)				DONE	(component wise & scalar)
+*	- Negate	(-)					DONE
+*	- Compare	(==, !=)			DONE
+*	- Index		(index operator)	DONE
+*	- AlmostEqual					DONE	(free function, per component)
+*/
+
+namespace math
+{
+	// Calls function(0), function(1) ... function(Count - 1), expanded at compile time
+	template<size_t Count, typename Function>
+	inline constexpr void Unroll(Function&& function)
+	{
+		[&]<size_t... Index>(std::index_sequence<Index...>)
+		{
+			(function(Index), ...);
+		}(std::make_index_sequence<Count>());
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	class alignas((N == 4 && std::is_same_v<T, float>) ? 16 : alignof(T)) Vector
+	{
+		static_assert(N > 0, "Vector needs at least one component");
+
+	public:
+		static constexpr size_t		Size = N;
+
+		constexpr					Vector(void);
+		constexpr explicit			Vector(T scalar);
+
+		template<std::convertible_to<T>... Components> requires (sizeof...(Components) == N && N > 1)
+		constexpr					Vector(Components... components);
+
+		constexpr					Vector(Vector<N - 1, T> const& vec, T last) requires (N > 1);
+
+									~Vector(void) = default;
+
+		static constexpr Vector		Zero(void) noexcept;
+
+		constexpr T*				Data(void) noexcept;
+		constexpr T const*			Data(void) const noexcept;
+
+		constexpr T					Dot(Vector const& vec) const noexcept;
+		constexpr Vector			Cross(Vector const& vec) const noexcept requires (N == 3);
+		constexpr T					Magnitude(Precision precision = Precision::Exact) const;
+		constexpr T					MagnitudeSquared(void) const noexcept;
+		constexpr Vector&			Normalize(Precision precision = Precision::Exact);
+
+		constexpr Vector			operator+(Vector const& vec) const noexcept;
+		constexpr Vector			operator-(Vector const& vec) const noexcept;
+		constexpr Vector			operator*(Vector const& vec) const noexcept;
+		constexpr Vector			operator/(Vector const& vec) const noexcept;
+		constexpr Vector			operator*(T value) const noexcept;
+		constexpr Vector			operator/(T value) const noexcept;
+		constexpr Vector			operator-(void) const noexcept;
+		constexpr Vector&			operator+=(Vector const& vec) noexcept;
+		constexpr Vector&			operator-=(Vector const& vec) noexcept;
+		constexpr Vector&			operator*=(Vector const& vec) noexcept;
+		constexpr Vector&			operator/=(Vector const& vec) noexcept;
+		constexpr Vector&			operator*=(T value) noexcept;
+		constexpr Vector&			operator/=(T value) noexcept;
+		constexpr bool				operator==(Vector const& vec) const noexcept;
+		constexpr bool				operator!=(Vector const& vec) const noexcept;
+		constexpr T					operator[](size_t index) const;
+		constexpr T&				operator[](size_t index);
+
+		static constexpr bool		IsPacked(void) noexcept;
+
+	protected:
+		// Named component access for Vector2, Vector3 & Vector4
+		T	m_values[N];
+	};
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T>::Vector(void)
+		: m_values{}
+	{
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T>::Vector(T scalar)
+	{
+		Unroll<N>([&](size_t i) { m_values[i] = scalar; });
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	template<std::convertible_to<T>... Components> requires (sizeof...(Components) == N && N > 1)
+	inline constexpr Vector<N, T>::Vector(Components... components)
+		: m_values{ static_cast<T>(components)... }
+	{
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T>::Vector(Vector<N - 1, T> const& vec, T last) requires (N > 1)
+	{
+		Unroll<N - 1>([&](size_t i) { m_values[i] = vec[i]; });
+		m_values[N - 1] = last;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T> Vector<N, T>::Zero(void) noexcept
+	{
+		return Vector<N, T>();
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr T* Vector<N, T>::Data(void) noexcept
+	{
+		return m_values;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr T const* Vector<N, T>::Data(void) const noexcept
+	{
+		return m_values;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr T Vector<N, T>::Dot(Vector<N, T> const& vec) const noexcept
+	{
+#if LIBMATH_SIMD_SSE2
+		if constexpr (IsPacked())
+		{
+			if (!std::is_constant_evaluated())
+				return _mm_cvtss_f32(simd::Dot4(_mm_load_ps(m_values), _mm_load_ps(vec.m_values)));
+		}
+#endif
+
+		// Added from left to right, x * x + y * y + ...
+		T result = m_values[0] * vec.m_values[0];
+
+		Unroll<N - 1>([&](size_t i) { result += m_values[i + 1] * vec.m_values[i + 1]; });
+
+		return result;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T> Vector<N, T>::Cross(Vector<N, T> const& vec) const noexcept requires (N == 3)
+	{
+		return Vector<N, T>(
+			(m_values[1] * vec.m_values[2]) - (m_values[2] * vec.m_values[1]),
+			(m_values[2] * vec.m_values[0]) - (m_values[0] * vec.m_values[2]),
+			(m_values[0] * vec.m_values[1]) - (m_values[1] * vec.m_values[0])
+		);
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr T Vector<N, T>::Magnitude(Precision precision) const
+	{
+		return math::Sqrt(Dot(*this), precision);
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr T Vector<N, T>::MagnitudeSquared(void) const noexcept
+	{
+		return Dot(*this);
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T>& Vector<N, T>::Normalize(Precision precision)
+	{
+		const T denom = (precision == Precision::Fast) ? math::RSqrt(Dot(*this), precision) : static_cast<T>(1) / Magnitude();
+
+		return *this *= denom;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T> Vector<N, T>::operator+(Vector<N, T> const& vec) const noexcept
+	{
+		Vector<N, T> result(*this);
+
+		return result += vec;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T> Vector<N, T>::operator-(Vector<N, T> const& vec) const noexcept
+	{
+		Vector<N, T> result(*this);
+
+		return result -= vec;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T> Vector<N, T>::operator*(Vector<N, T> const& vec) const noexcept
+	{
+		Vector<N, T> result(*this);
+
+		return result *= vec;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T> Vector<N, T>::operator/(Vector<N, T> const& vec) const noexcept
+	{
+		Vector<N, T> result(*this);
+
+		return result /= vec;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T> Vector<N, T>::operator*(T value) const noexcept
+	{
+		Vector<N, T> result(*this);
+
+		return result *= value;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T> Vector<N, T>::operator/(T value) const noexcept
+	{
+		Vector<N, T> result(*this);
+
+		return result /= value;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T> Vector<N, T>::operator-(void) const noexcept
+	{
+		Vector<N, T> result;
+
+		Unroll<N>([&](size_t i) { result.m_values[i] = -m_values[i]; });
+
+		return result;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T>& Vector<N, T>::operator+=(Vector<N, T> const& vec) noexcept
+	{
+#if LIBMATH_SIMD_SSE2
+		if constexpr (IsPacked())
+		{
+			if (!std::is_constant_evaluated())
+			{
+				_mm_store_ps(m_values, _mm_add_ps(_mm_load_ps(m_values), _mm_load_ps(vec.m_values)));
+				return *this;
+			}
+		}
+#endif
+
+		Unroll<N>([&](size_t i) { m_values[i] += vec.m_values[i]; });
+
+		return *this;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T>& Vector<N, T>::operator-=(Vector<N, T> const& vec) noexcept
+	{
+#if LIBMATH_SIMD_SSE2
+		if constexpr (IsPacked())
+		{
+			if (!std::is_constant_evaluated())
+			{
+				_mm_store_ps(m_values, _mm_sub_ps(_mm_load_ps(m_values), _mm_load_ps(vec.m_values)));
+				return *this;
+			}
+		}
+#endif
+
+		Unroll<N>([&](size_t i) { m_values[i] -= vec.m_values[i]; });
+
+		return *this;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T>& Vector<N, T>::operator*=(Vector<N, T> const& vec) noexcept
+	{
+#if LIBMATH_SIMD_SSE2
+		if constexpr (IsPacked())
+		{
+			if (!std::is_constant_evaluated())
+			{
+				_mm_store_ps(m_values, _mm_mul_ps(_mm_load_ps(m_values), _mm_load_ps(vec.m_values)));
+				return *this;
+			}
+		}
+#endif
+
+		Unroll<N>([&](size_t i) { m_values[i] *= vec.m_values[i]; });
+
+		return *this;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T>& Vector<N, T>::operator/=(Vector<N, T> const& vec) noexcept
+	{
+#if LIBMATH_SIMD_SSE2
+		if constexpr (IsPacked())
+		{
+			if (!std::is_constant_evaluated())
+			{
+				_ASSERT(!simd::AnyZero4(_mm_load_ps(vec.m_values)));
+
+				_mm_store_ps(m_values, _mm_div_ps(_mm_load_ps(m_values), _mm_load_ps(vec.m_values)));
+				return *this;
+			}
+		}
+#endif
+
+		Unroll<N>([&](size_t i)
+		{
+			_ASSERT(vec.m_values[i] != static_cast<T>(0));
+
+			m_values[i] /= vec.m_values[i];
+		});
+
+		return *this;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T>& Vector<N, T>::operator*=(T value) noexcept
+	{
+#if LIBMATH_SIMD_SSE2
+		if constexpr (IsPacked())
+		{
+			if (!std::is_constant_evaluated())
+			{
+				_mm_store_ps(m_values, _mm_mul_ps(_mm_load_ps(m_values), _mm_set1_ps(value)));
+				return *this;
+			}
+		}
+#endif
+
+		Unroll<N>([&](size_t i) { m_values[i] *= value; });
+
+		return *this;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T>& Vector<N, T>::operator/=(T value) noexcept
+	{
+		_ASSERT(value != static_cast<T>(0));
+
+#if LIBMATH_SIMD_SSE2
+		if constexpr (IsPacked())
+		{
+			if (!std::is_constant_evaluated())
+			{
+				_mm_store_ps(m_values, _mm_div_ps(_mm_load_ps(m_values), _mm_set1_ps(value)));
+				return *this;
+			}
+		}
+#endif
+
+		Unroll<N>([&](size_t i) { m_values[i] /= value; });
+
+		return *this;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr bool Vector<N, T>::operator==(Vector<N, T> const& vec) const noexcept
+	{
+		bool equal = true;
+
+		Unroll<N>([&](size_t i) { equal = equal && m_values[i] == vec.m_values[i]; });
+
+		return equal;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr bool Vector<N, T>::operator!=(Vector<N, T> const& vec) const noexcept
+	{
+		return !(*this == vec);
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr T Vector<N, T>::operator[](size_t index) const
+	{
+		_ASSERT(index < N);
+
+		return m_values[index];
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr T& Vector<N, T>::operator[](size_t index)
+	{
+		_ASSERT(index < N);
+
+		return m_values[index];
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr bool Vector<N, T>::IsPacked(void) noexcept
+	{
+		// 4 floats fill one aligned __m128
+		return N == 4 && std::is_same_v<T, float>;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr Vector<N, T> operator*(T value, Vector<N, T> const& vec) noexcept
+	{
+		return vec * value;
+	}
+
+	template<size_t N, math::math_type::NumericType T>
+	inline constexpr bool AlmostEqual(Vector<N, T> const& lhs, Vector<N, T> const& rhs) noexcept
+	{
+		// Every component within epsilon, the == of Vector2, Vector3 & Vector4
+#if LIBMATH_SIMD_SSE2
+		if constexpr (Vector<N, T>::IsPacked())
+		{
+			if (!std::is_constant_evaluated())
+				return simd::AlmostEqual4(_mm_load_ps(lhs.Data()), _mm_load_ps(rhs.Data()));
+		}
+#endif
+
+		bool equal = true;
+
+		Unroll<N>([&](size_t i) { equal = equal && math::AlmostEqual(lhs[i], rhs[i]); });
+
+		return equal;
+	}
+}
+
+namespace LibMath = math;
@@ -0,0 +1,138 @@
+#include "Parallel.h"
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	struct ParallelJob
+	{
+		math::parallel::RangeFunction	m_rangeFunction;
+		void*							m_function;
+		size_t							m_count;
+		size_t							m_batchSize;
+		size_t							m_rangeCount;
+
+		// Next range to run, ranges are claimed by the workers & the calling thread
+		std::atomic<size_t>				m_nextRange = 0;
+
+		// Workers holding a pointer to the job, guarded by the pool mutex
+		size_t							m_workers = 0;
+
+		void RunRanges(void) noexcept
+		{
+			for (size_t range = m_nextRange.fetch_add(1); range < m_rangeCount; range = m_nextRange.fetch_add(1))
+			{
+				const size_t begin = range * m_batchSize;
+
+				m_rangeFunction(m_function, begin, std::min(begin + m_batchSize, m_count));
+			}
+		}
+
+		bool Claimed(void) const noexcept
+		{
+			return m_nextRange.load(std::memory_order_relaxed) >= m_rangeCount;
+		}
+	};
+
+	class ThreadPool
+	{
+	public:
+		~ThreadPool(void)
+		{
+			{
+				std::lock_guard lock(m_mutex);
+				m_stop = true;
+			}
+
+			m_jobAdded.notify_all();
+
+			for (std::thread& worker : m_workers)
+				worker.join();
+		}
+
+		void Run(ParallelJob& job)
+		{
+			{
+				std::lock_guard lock(m_mutex);
+
+				// Workers are only added, a larger SetParallelThreadCount grows the pool on its next use
+				while (m_workers.size() < job.m_rangeCount - 1)
+					m_workers.emplace_back(&ThreadPool::WorkerLoop, this);
+
+				m_jobs.push_back(&job);
+			}
+
+			m_jobAdded.notify_all();
+
+			// The calling thread runs ranges until none are left, it never waits on a range nobody started
+			job.RunRanges();
+
+			std::unique_lock lock(m_mutex);
+
+			const auto it = std::find(m_jobs.begin(), m_jobs.end(), &job);
+
+			if (it != m_jobs.end())
+				m_jobs.erase(it);
+
+			m_jobDone.wait(lock, [&job]() { return job.m_workers == 0; });
+		}
+
+	private:
+		void WorkerLoop(void)
+		{
+			std::unique_lock lock(m_mutex);
+
+			for (;;)
+			{
+				// Fully claimed jobs are dropped, their calling thread waits for the workers still running them
+				while (!m_jobs.empty() && m_jobs.front()->Claimed())
+					m_jobs.pop_front();
+
+				if (m_stop)
+					return;
+
+				if (m_jobs.empty())
+				{
+					m_jobAdded.wait(lock);
+					continue;
+				}
+
+				ParallelJob& job = *m_jobs.front();
+				++job.m_workers;
+
+				lock.unlock();
+				job.RunRanges();
+				lock.lock();
+
+				if (--job.m_workers == 0)
+					m_jobDone.notify_all();
+			}
+		}
+
+		std::mutex					m_mutex;
+		std::condition_variable		m_jobAdded;
+		std::condition_variable		m_jobDone;
+		std::deque<ParallelJob*>	m_jobs;
+		std::vector<std::thread>	m_workers;
+		bool						m_stop = false;
+	};
+
+	ThreadPool& Pool(void)
+	{
+		// Started on the first ParallelFor that needs more than one thread
+		static ThreadPool pool;
+
+		return pool;
+	}
+}
+
+void math::parallel::Run(RangeFunction rangeFunction, void* function, size_t count, size_t batchSize, size_t rangeCount)
+{
+	ParallelJob job = { rangeFunction, function, count, batchSize, rangeCount };
+
+	Pool().Run(job);
+}
@@ -0,0 +1,270 @@
+#include "simd/Simd.h"
+#include "simd/Float4.h"
+#include "Arithmetic.h"
+
+#include <cmath>
+#include <limits>
+
+/*
+*	Sqrt & reciprocal sqrt float kernels
+*
+*	The exact kernels use the correctly rounded sqrt instruction,
+*	results are identical to std::sqrt & 1.0f / std::sqrt.
+*
+*	The fast kernels evaluate the same operations as simd::RSqrt4 lane
+*	by lane so every instruction set returns the same values as the
+*	single value math::RSqrt. x * rsqrt(x) is NaN for 0 & infinity,
+*	the fast sqrt keeps the input for those lanes instead.
+*
+*	The scalar fast kernels call the single value functions, without
+*	SSE2 those are the exact result.
+*/
+
+namespace
+{
+	using ArithmeticKernel = void (*)(float*, float const*, size_t) noexcept;
+
+	void SqrtScalar(float* result, float const* values, size_t count) noexcept
+	{
+		for (size_t i = 0; i < count; ++i)
+			result[i] = std::sqrt(values[i]);
+	}
+
+	void SqrtFastScalar(float* result, float const* values, size_t count) noexcept
+	{
+		for (size_t i = 0; i < count; ++i)
+			result[i] = math::Sqrt(values[i], math::Precision::Fast);
+	}
+
+	void RSqrtScalar(float* result, float const* values, size_t count) noexcept
+	{
+		for (size_t i = 0; i < count; ++i)
+			result[i] = 1.0f / std::sqrt(values[i]);
+	}
+
+	void RSqrtFastScalar(float* result, float const* values, size_t count) noexcept
+	{
+		for (size_t i = 0; i < count; ++i)
+			result[i] = math::RSqrt(values[i], math::Precision::Fast);
+	}
+
+#if LIBMATH_SIMD_SSE2
+	// Lanes equal to 0 or infinity, their fast sqrt is the input itself
+	inline __m128 SqrtSpecialMask4(__m128 value) noexcept
+	{
+		const __m128 isZero = _mm_cmpeq_ps(value, _mm_setzero_ps());
+		const __m128 isInfinity = _mm_cmpeq_ps(value, _mm_set1_ps(std::numeric_limits<float>::infinity()));
+
+		return _mm_or_ps(isZero, isInfinity);
+	}
+
+	inline __m128 SqrtFast4(__m128 value) noexcept
+	{
+		const __m128 root = _mm_mul_ps(value, math::simd::RSqrt4(value));
+		const __m128 special = SqrtSpecialMask4(value);
+
+		return _mm_or_ps(_mm_andnot_ps(special, root), _mm_and_ps(special, value));
+	}
+
+	void SqrtSSE2(float* result, float const* values, size_t count) noexcept
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(result + i, _mm_sqrt_ps(_mm_loadu_ps(values + i)));
+
+		for (; i < count; ++i)
+			_mm_store_ss(result + i, _mm_sqrt_ss(_mm_load_ss(values + i)));
+	}
+
+	void SqrtFastSSE2(float* result, float const* values, size_t count) noexcept
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(result + i, SqrtFast4(_mm_loadu_ps(values + i)));
+
+		for (; i < count; ++i)
+			_mm_store_ss(result + i, SqrtFast4(_mm_load_ss(values + i)));
+	}
+
+	void RSqrtSSE2(float* result, float const* values, size_t count) noexcept
+	{
+		const __m128 one = _mm_set1_ps(1.0f);
+
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(result + i, _mm_div_ps(one, _mm_sqrt_ps(_mm_loadu_ps(values + i))));
+
+		for (; i < count; ++i)
+			_mm_store_ss(result + i, _mm_div_ss(one, _mm_sqrt_ss(_mm_load_ss(values + i))));
+	}
+
+	void RSqrtFastSSE2(float* result, float const* values, size_t count) noexcept
+	{
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+			_mm_storeu_ps(result + i, math::simd::RSqrt4(_mm_loadu_ps(values + i)));
+
+		for (; i < count; ++i)
+			_mm_store_ss(result + i, math::simd::RSqrt4(_mm_load_ss(values + i)));
+	}
+
+	// 8 lane version of simd::RSqrt4, same operation order
+	LIBMATH_TARGET_AVX
+	inline __m256 RSqrt8(__m256 value) noexcept
+	{
+#ifdef LIBMATH_DETERMINISTIC
+		return _mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_sqrt_ps(value));
+#else
+		const __m256 estimate = _mm256_rsqrt_ps(value);
+		const __m256 halfValue = _mm256_mul_ps(value, _mm256_set1_ps(0.5f));
+		const __m256 correction = _mm256_sub_ps(_mm256_set1_ps(1.5f), _mm256_mul_ps(halfValue, _mm256_mul_ps(estimate, estimate)));
+
+		return _mm256_mul_ps(estimate, correction);
+#endif
+	}
+
+	LIBMATH_TARGET_AVX
+	void SqrtAVX(float* result, float const* values, size_t count) noexcept
+	{
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(result + i, _mm256_sqrt_ps(_mm256_loadu_ps(values + i)));
+
+		SqrtSSE2(result + i, values + i, count - i);
+	}
+
+	LIBMATH_TARGET_AVX
+	void SqrtFastAVX(float* result, float const* values, size_t count) noexcept
+	{
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 infinity = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 value = _mm256_loadu_ps(values + i);
+			const __m256 root = _mm256_mul_ps(value, RSqrt8(value));
+			const __m256 special = _mm256_or_ps(_mm256_cmp_ps(value, zero, _CMP_EQ_OQ), _mm256_cmp_ps(value, infinity, _CMP_EQ_OQ));
+
+			_mm256_storeu_ps(result + i, _mm256_blendv_ps(root, value, special));
+		}
+
+		SqrtFastSSE2(result + i, values + i, count - i);
+	}
+
+	LIBMATH_TARGET_AVX
+	void RSqrtAVX(float* result, float const* values, size_t count) noexcept
+	{
+		const __m256 one = _mm256_set1_ps(1.0f);
+
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(result + i, _mm256_div_ps(one, _mm256_sqrt_ps(_mm256_loadu_ps(values + i))));
+
+		RSqrtSSE2(result + i, values + i, count - i);
+	}
+
+	LIBMATH_TARGET_AVX
+	void RSqrtFastAVX(float* result, float const* values, size_t count) noexcept
+	{
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+			_mm256_storeu_ps(result + i, RSqrt8(_mm256_loadu_ps(values + i)));
+
+		RSqrtFastSSE2(result + i, values + i, count - i);
+	}
+
+	// Indexed by math::simd::InstructionSet, nothing to fuse so AVX2 + FMA reuses the AVX kernels
+	constexpr ArithmeticKernel g_sqrtKernels[] =
+	{
+		&SqrtScalar,
+		&SqrtSSE2,
+		&SqrtAVX,
+		&SqrtAVX
+	};
+
+	constexpr ArithmeticKernel g_sqrtFastKernels[] =
+	{
+		&SqrtFastScalar,
+		&SqrtFastSSE2,
+		&SqrtFastAVX,
+		&SqrtFastAVX
+	};
+
+	constexpr ArithmeticKernel g_rsqrtKernels[] =
+	{
+		&RSqrtScalar,
+		&RSqrtSSE2,
+		&RSqrtAVX,
+		&RSqrtAVX
+	};
+
+	constexpr ArithmeticKernel g_rsqrtFastKernels[] =
+	{
+		&RSqrtFastScalar,
+		&RSqrtFastSSE2,
+		&RSqrtFastAVX,
+		&RSqrtFastAVX
+	};
+#else
+	constexpr ArithmeticKernel g_sqrtKernels[] =
+	{
+		&SqrtScalar,
+		&SqrtScalar,
+		&SqrtScalar,
+		&SqrtScalar
+	};
+
+	constexpr ArithmeticKernel g_sqrtFastKernels[] =
+	{
+		&SqrtFastScalar,
+		&SqrtFastScalar,
+		&SqrtFastScalar,
+		&SqrtFastScalar
+	};
+
+	constexpr ArithmeticKernel g_rsqrtKernels[] =
+	{
+		&RSqrtScalar,
+		&RSqrtScalar,
+		&RSqrtScalar,
+		&RSqrtScalar
+	};
+
+	constexpr ArithmeticKernel g_rsqrtFastKernels[] =
+	{
+		&RSqrtFastScalar,
+		&RSqrtFastScalar,
+		&RSqrtFastScalar,
+		&RSqrtFastScalar
+	};
+#endif
+}
+
+void math::simd::Sqrt(float* result, float const* values, size_t count) noexcept
+{
+	g_sqrtKernels[static_cast<int>(ActiveInstructionSet())](result, values, count);
+}
+
+void math::simd::SqrtFast(float* result, float const* values, size_t count) noexcept
+{
+	g_sqrtFastKernels[static_cast<int>(ActiveInstructionSet())](result, values, count);
+}
+
+void math::simd::RSqrt(float* result, float const* values, size_t count) noexcept
+{
+	g_rsqrtKernels[static_cast<int>(ActiveInstructionSet())](result, values, count);
+}
+
+void math::simd::RSqrtFast(float* result, float const* values, size_t count) noexcept
+{
+	g_rsqrtFastKernels[static_cast<int>(ActiveInstructionSet())](result, values, count);
+}
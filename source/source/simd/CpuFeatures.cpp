@@ -0,0 +1,116 @@
+#include "simd/Simd.h"
+
+#include <atomic>
+
+#if LIBMATH_SIMD_SSE2
+	#ifdef _MSC_VER
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
+namespace
+{
+#if LIBMATH_SIMD_SSE2
+	void CpuId(unsigned int registers[4], unsigned int leaf, unsigned int subLeaf) noexcept
+	{
+#ifdef _MSC_VER
+		int values[4];
+		__cpuidex(values, static_cast<int>(leaf), static_cast<int>(subLeaf));
+
+		for (int i = 0; i < 4; ++i)
+			registers[i] = static_cast<unsigned int>(values[i]);
+#else
+		__cpuid_count(leaf, subLeaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+	}
+
+	unsigned long long ExtendedControlRegister(void) noexcept
+	{
+#ifdef _MSC_VER
+		return _xgetbv(0);
+#else
+		unsigned int eax = 0;
+		unsigned int edx = 0;
+
+		__asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+
+		return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+	}
+#endif
+
+	math::simd::InstructionSet HighestAllowedInstructionSet(void) noexcept
+	{
+		const math::simd::InstructionSet detected = math::simd::DetectInstructionSet();
+
+#if !defined(LIBMATH_ENABLE_FMA) || defined(LIBMATH_DETERMINISTIC)
+		// Fused kernels change rounding, fall back to the widest non fused kernel
+		if (detected == math::simd::InstructionSet::AVX2_FMA)
+			return math::simd::InstructionSet::AVX;
+#endif
+
+		return detected;
+	}
+
+	// Zero initialised (scalar) until the dynamic initialisation below runs
+	std::atomic<math::simd::InstructionSet> g_activeInstructionSet = HighestAllowedInstructionSet();
+}
+
+math::simd::InstructionSet math::simd::DetectInstructionSet(void) noexcept
+{
+#if LIBMATH_SIMD_SSE2
+	unsigned int registers[4] = {0, 0, 0, 0};
+
+	// Leaf 0 returns the highest supported leaf
+	CpuId(registers, 0, 0);
+	const unsigned int maxLeaf = registers[0];
+
+	if (maxLeaf < 1)
+		return InstructionSet::Scalar;
+
+	CpuId(registers, 1, 0);
+	const unsigned int featuresEcx = registers[2];
+	const unsigned int featuresEdx = registers[3];
+
+	const bool sse2 = (featuresEdx & (1u << 26)) != 0;
+	const bool fma = (featuresEcx & (1u << 12)) != 0;
+	const bool osxsave = (featuresEcx & (1u << 27)) != 0;
+	const bool avx = (featuresEcx & (1u << 28)) != 0;
+
+	if (!sse2)
+		return InstructionSet::Scalar;
+
+	// The OS must save the xmm & ymm registers on context switch for AVX to be usable
+	if (!avx || !osxsave || (ExtendedControlRegister() & 0x6) != 0x6)
+		return InstructionSet::SSE2;
+
+	bool avx2 = false;
+
+	if (maxLeaf >= 7)
+	{
+		CpuId(registers, 7, 0);
+		avx2 = (registers[1] & (1u << 5)) != 0;
+	}
+
+	return (avx2 && fma) ? InstructionSet::AVX2_FMA : InstructionSet::AVX;
+#else
+	return InstructionSet::Scalar;
+#endif
+}
+
+math::simd::InstructionSet math::simd::ActiveInstructionSet(void) noexcept
+{
+	return g_activeInstructionSet.load(std::memory_order_relaxed);
+}
+
+bool math::simd::SetInstructionSet(InstructionSet instructionSet) noexcept
+{
+	if (instructionSet > HighestAllowedInstructionSet())
+		return false;
+
+	g_activeInstructionSet.store(instructionSet, std::memory_order_relaxed);
+
+	return true;
+}
@@ -0,0 +1,989 @@
+#include "simd/Simd.h"
+#include "geometry/Ray.h"
+
+#include <bit>
+#include <limits>
+
+/*
+*	Geometry float kernels
+*
+*	Frustum culling tests every object against the 6 planes, an object
+*	is culled when dot(normal, center) + distance < -radius for one of
+*	them. The radius of a box is its half extents projected onto the
+*	absolute plane normal.
+*
+*	SIMD kernels test 4 (SSE2) or 8 (AVX) objects per iteration with
+*	the operations of the scalar kernel in the same order, visible
+*	indices are written without branches from the lane mask.
+*
+*	Ray intersection kernels test one ray against 4 (SSE2) or 8 (AVX)
+*	shapes per iteration, every lane evaluates the operations of
+*	Ray::Intersect in the same order. The scalar kernels call
+*	Ray::Intersect directly.
+*
+*	The sweep and prune kernels test one box against the next 4 (SSE2)
+*	or 8 (AVX) boxes of the sorted lanes, a box stops once one of them
+*	starts past its max. Pairs are found in the order of the scalar
+*	kernel.
+*/
+
+namespace
+{
+	using FrustumCullSpheresKernel = size_t (*)(uint32_t*, float const*, float const*, float const*, float const*, size_t, float const*, uint32_t) noexcept;
+	using FrustumCullBoxesKernel = size_t (*)(uint32_t*, float const*, float const*, float const*, float const*, float const*, float const*, size_t, float const*, uint32_t) noexcept;
+
+	using RayIntersectBoxesKernel = size_t (*)(float*, float const*, float const*, float const*, float const*, float const*, float const*, float const*, size_t) noexcept;
+	using RayIntersectSpheresKernel = size_t (*)(float*, float const*, float const*, float const*, float const*, float const*, size_t) noexcept;
+	using RayIntersectPlanesKernel = size_t (*)(float*, float const*, float const*, float const*, float const*, float const*, size_t) noexcept;
+	using RayIntersectTrianglesKernel = size_t (*)(float*, float const*, float const*, float const*, float const*, float const*, float const*, float const*, float const*, float const*, float const*, size_t) noexcept;
+
+	using SweepAndPruneOverlapsKernel = size_t (*)(uint32_t*, size_t, float const*, uint32_t const*, size_t) noexcept;
+
+	constexpr int g_planeCount = 6;
+	constexpr float g_infinity = std::numeric_limits<float>::infinity();
+	constexpr float g_epsilon = std::numeric_limits<float>::epsilon();
+
+	size_t FrustumCullSpheresScalar(uint32_t* visible, float const* x, float const* y, float const* z, float const* radii, size_t count, float const* planes, uint32_t offset) noexcept
+	{
+		size_t visibleCount = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			bool inside = true;
+
+			for (int side = 0; side < g_planeCount && inside; ++side)
+			{
+				float const* plane = planes + side * 4;
+				const float distance = ((plane[0] * x[i]) + (plane[1] * y[i]) + (plane[2] * z[i])) + plane[3];
+
+				inside = !(distance < -radii[i]);
+			}
+
+			if (inside)
+				visible[visibleCount++] = offset + static_cast<uint32_t>(i);
+		}
+
+		return visibleCount;
+	}
+
+	size_t FrustumCullBoxesScalar(uint32_t* visible, float const* x, float const* y, float const* z, float const* extentX, float const* extentY, float const* extentZ, size_t count, float const* planes, uint32_t offset) noexcept
+	{
+		float absNormals[g_planeCount * 3];
+
+		for (int side = 0; side < g_planeCount; ++side)
+		{
+			for (int axis = 0; axis < 3; ++axis)
+				absNormals[side * 3 + axis] = (planes[side * 4 + axis] < 0.0f) ? -planes[side * 4 + axis] : planes[side * 4 + axis];
+		}
+
+		size_t visibleCount = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			bool inside = true;
+
+			for (int side = 0; side < g_planeCount && inside; ++side)
+			{
+				float const* plane = planes + side * 4;
+				float const* absNormal = absNormals + side * 3;
+
+				const float radius = (absNormal[0] * extentX[i]) + (absNormal[1] * extentY[i]) + (absNormal[2] * extentZ[i]);
+				const float distance = ((plane[0] * x[i]) + (plane[1] * y[i]) + (plane[2] * z[i])) + plane[3];
+
+				inside = !(distance < -radius);
+			}
+
+			if (inside)
+				visible[visibleCount++] = offset + static_cast<uint32_t>(i);
+		}
+
+		return visibleCount;
+	}
+
+	size_t RayIntersectBoxesScalar(float* distances, float const* ray, float const* minX, float const* minY, float const* minZ, float const* maxX, float const* maxY, float const* maxZ, size_t count) noexcept
+	{
+		const math::Ray<float> query(math::Vector3<float>(ray[0], ray[1], ray[2]), math::Vector3<float>(ray[3], ray[4], ray[5]));
+
+		size_t hitCount = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const math::AABB<float> box(math::Vector3<float>(minX[i], minY[i], minZ[i]), math::Vector3<float>(maxX[i], maxY[i], maxZ[i]));
+
+			if (query.Intersect(box, distances[i]))
+				++hitCount;
+			else
+				distances[i] = g_infinity;
+		}
+
+		return hitCount;
+	}
+
+	size_t RayIntersectSpheresScalar(float* distances, float const* ray, float const* x, float const* y, float const* z, float const* radii, size_t count) noexcept
+	{
+		const math::Ray<float> query(math::Vector3<float>(ray[0], ray[1], ray[2]), math::Vector3<float>(ray[3], ray[4], ray[5]));
+
+		size_t hitCount = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (query.Intersect(math::Sphere<float>(math::Vector3<float>(x[i], y[i], z[i]), radii[i]), distances[i]))
+				++hitCount;
+			else
+				distances[i] = g_infinity;
+		}
+
+		return hitCount;
+	}
+
+	size_t RayIntersectPlanesScalar(float* distances, float const* ray, float const* normalX, float const* normalY, float const* normalZ, float const* planeDistances, size_t count) noexcept
+	{
+		const math::Ray<float> query(math::Vector3<float>(ray[0], ray[1], ray[2]), math::Vector3<float>(ray[3], ray[4], ray[5]));
+
+		size_t hitCount = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (query.Intersect(math::Plane<float>(normalX[i], normalY[i], normalZ[i], planeDistances[i]), distances[i]))
+				++hitCount;
+			else
+				distances[i] = g_infinity;
+		}
+
+		return hitCount;
+	}
+
+	size_t RayIntersectTrianglesScalar(float* distances, float const* ray, float const* x0, float const* y0, float const* z0, float const* x1, float const* y1, float const* z1, float const* x2, float const* y2, float const* z2, size_t count) noexcept
+	{
+		const math::Ray<float> query(math::Vector3<float>(ray[0], ray[1], ray[2]), math::Vector3<float>(ray[3], ray[4], ray[5]));
+
+		size_t hitCount = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const math::Triangle<float> triangle(math::Vector3<float>(x0[i], y0[i], z0[i]), math::Vector3<float>(x1[i], y1[i], z1[i]), math::Vector3<float>(x2[i], y2[i], z2[i]));
+
+			if (query.Intersect(triangle, distances[i]))
+				++hitCount;
+			else
+				distances[i] = g_infinity;
+		}
+
+		return hitCount;
+	}
+
+	// The pair is only written while the buffer has room, it is always counted
+	inline size_t StorePair(uint32_t* pairs, size_t pairCapacity, size_t pairCount, uint32_t first, uint32_t second) noexcept
+	{
+		if (pairCount < pairCapacity)
+		{
+			pairs[pairCount * 2] = (first < second) ? first : second;
+			pairs[pairCount * 2 + 1] = (first < second) ? second : first;
+		}
+
+		return pairCount + 1;
+	}
+
+	// Pairs of box with the boxes from begin on, until one starts past its max on the sweep axis
+	size_t SweepAndPruneBox(uint32_t* pairs, size_t pairCapacity, size_t pairCount, float const* bounds, uint32_t const* indices, size_t count, size_t box, size_t begin) noexcept
+	{
+		float const* minX = bounds;
+		float const* minY = bounds + count;
+		float const* minZ = bounds + count * 2;
+		float const* maxX = bounds + count * 3;
+		float const* maxY = bounds + count * 4;
+		float const* maxZ = bounds + count * 5;
+
+		for (size_t j = begin; j < count && minX[j] <= maxX[box]; ++j)
+		{
+			if (minY[j] <= maxY[box] && maxY[j] >= minY[box] && minZ[j] <= maxZ[box] && maxZ[j] >= minZ[box])
+				pairCount = StorePair(pairs, pairCapacity, pairCount, indices[box], indices[j]);
+		}
+
+		return pairCount;
+	}
+
+	size_t SweepAndPruneOverlapsScalar(uint32_t* pairs, size_t pairCapacity, float const* bounds, uint32_t const* indices, size_t count) noexcept
+	{
+		size_t pairCount = 0;
+
+		for (size_t i = 0; i < count; ++i)
+			pairCount = SweepAndPruneBox(pairs, pairCapacity, pairCount, bounds, indices, count, i, i + 1);
+
+		return pairCount;
+	}
+
+#if LIBMATH_SIMD_SSE2
+	// Every lane is written, the count only advances for visible lanes
+	template<int LaneCount>
+	inline size_t WriteVisible(uint32_t* visible, size_t visibleCount, int visibleMask, uint32_t index) noexcept
+	{
+		for (int lane = 0; lane < LaneCount; ++lane)
+		{
+			visible[visibleCount] = index + static_cast<uint32_t>(lane);
+			visibleCount += static_cast<size_t>((visibleMask >> lane) & 1);
+		}
+
+		return visibleCount;
+	}
+
+	size_t FrustumCullSpheresSSE2(uint32_t* visible, float const* x, float const* y, float const* z, float const* radii, size_t count, float const* planes, uint32_t offset) noexcept
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+
+		__m128 plane[g_planeCount][4];
+
+		for (int side = 0; side < g_planeCount; ++side)
+		{
+			for (int component = 0; component < 4; ++component)
+				plane[side][component] = _mm_set1_ps(planes[side * 4 + component]);
+		}
+
+		size_t visibleCount = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 centerX = _mm_loadu_ps(x + i);
+			const __m128 centerY = _mm_loadu_ps(y + i);
+			const __m128 centerZ = _mm_loadu_ps(z + i);
+			const __m128 negativeRadius = _mm_xor_ps(_mm_loadu_ps(radii + i), signMask);
+
+			__m128 outside = _mm_setzero_ps();
+
+			for (int side = 0; side < g_planeCount; ++side)
+			{
+				const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(plane[side][0], centerX), _mm_mul_ps(plane[side][1], centerY)), _mm_mul_ps(plane[side][2], centerZ));
+				const __m128 distance = _mm_add_ps(dot, plane[side][3]);
+
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negativeRadius));
+			}
+
+			visibleCount = WriteVisible<4>(visible, visibleCount, ~_mm_movemask_ps(outside), offset + static_cast<uint32_t>(i));
+		}
+
+		return visibleCount + FrustumCullSpheresScalar(visible + visibleCount, x + i, y + i, z + i, radii + i, count - i, planes, offset + static_cast<uint32_t>(i));
+	}
+
+	size_t FrustumCullBoxesSSE2(uint32_t* visible, float const* x, float const* y, float const* z, float const* extentX, float const* extentY, float const* extentZ, size_t count, float const* planes, uint32_t offset) noexcept
+	{
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+
+		__m128 plane[g_planeCount][4];
+		__m128 absNormal[g_planeCount][3];
+
+		for (int side = 0; side < g_planeCount; ++side)
+		{
+			for (int component = 0; component < 4; ++component)
+				plane[side][component] = _mm_set1_ps(planes[side * 4 + component]);
+
+			for (int axis = 0; axis < 3; ++axis)
+				absNormal[side][axis] = _mm_andnot_ps(signMask, plane[side][axis]);
+		}
+
+		size_t visibleCount = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 centerX = _mm_loadu_ps(x + i);
+			const __m128 centerY = _mm_loadu_ps(y + i);
+			const __m128 centerZ = _mm_loadu_ps(z + i);
+			const __m128 halfX = _mm_loadu_ps(extentX + i);
+			const __m128 halfY = _mm_loadu_ps(extentY + i);
+			const __m128 halfZ = _mm_loadu_ps(extentZ + i);
+
+			__m128 outside = _mm_setzero_ps();
+
+			for (int side = 0; side < g_planeCount; ++side)
+			{
+				const __m128 radius = _mm_add_ps(_mm_add_ps(_mm_mul_ps(absNormal[side][0], halfX), _mm_mul_ps(absNormal[side][1], halfY)), _mm_mul_ps(absNormal[side][2], halfZ));
+				const __m128 dot = _mm_add_ps(_mm_add_ps(_mm_mul_ps(plane[side][0], centerX), _mm_mul_ps(plane[side][1], centerY)), _mm_mul_ps(plane[side][2], centerZ));
+				const __m128 distance = _mm_add_ps(dot, plane[side][3]);
+
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, _mm_xor_ps(radius, signMask)));
+			}
+
+			visibleCount = WriteVisible<4>(visible, visibleCount, ~_mm_movemask_ps(outside), offset + static_cast<uint32_t>(i));
+		}
+
+		return visibleCount + FrustumCullBoxesScalar(visible + visibleCount, x + i, y + i, z + i, extentX + i, extentY + i, extentZ + i, count - i, planes, offset + static_cast<uint32_t>(i));
+	}
+
+	// Lanes of value where the mask is set, infinity elsewhere
+	inline __m128 SelectDistance4(__m128 hit, __m128 value) noexcept
+	{
+		return _mm_or_ps(_mm_and_ps(hit, value), _mm_andnot_ps(hit, _mm_set1_ps(g_infinity)));
+	}
+
+	inline __m128 Dot4(__m128 x1, __m128 y1, __m128 z1, __m128 x2, __m128 y2, __m128 z2) noexcept
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(x1, x2), _mm_mul_ps(y1, y2)), _mm_mul_ps(z1, z2));
+	}
+
+	size_t RayIntersectBoxesSSE2(float* distances, float const* ray, float const* minX, float const* minY, float const* minZ, float const* maxX, float const* maxY, float const* maxZ, size_t count) noexcept
+	{
+		const __m128 originX = _mm_set1_ps(ray[0]);
+		const __m128 originY = _mm_set1_ps(ray[1]);
+		const __m128 originZ = _mm_set1_ps(ray[2]);
+		const __m128 inverseX = _mm_set1_ps(1.0f / ray[3]);
+		const __m128 inverseY = _mm_set1_ps(1.0f / ray[4]);
+		const __m128 inverseZ = _mm_set1_ps(1.0f / ray[5]);
+
+		size_t hitCount = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 t1X = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(minX + i), originX), inverseX);
+			const __m128 t2X = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(maxX + i), originX), inverseX);
+			const __m128 t1Y = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(minY + i), originY), inverseY);
+			const __m128 t2Y = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(maxY + i), originY), inverseY);
+			const __m128 t1Z = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(minZ + i), originZ), inverseZ);
+			const __m128 t2Z = _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(maxZ + i), originZ), inverseZ);
+
+			const __m128 tNear = _mm_max_ps(_mm_max_ps(_mm_max_ps(_mm_min_ps(t1X, t2X), _mm_min_ps(t1Y, t2Y)), _mm_min_ps(t1Z, t2Z)), _mm_setzero_ps());
+			const __m128 tFar = _mm_min_ps(_mm_min_ps(_mm_max_ps(t1X, t2X), _mm_max_ps(t1Y, t2Y)), _mm_max_ps(t1Z, t2Z));
+			const __m128 hit = _mm_cmple_ps(tNear, tFar);
+
+			_mm_storeu_ps(distances + i, SelectDistance4(hit, tNear));
+			hitCount += static_cast<size_t>(std::popcount(static_cast<unsigned int>(_mm_movemask_ps(hit))));
+		}
+
+		return hitCount + RayIntersectBoxesScalar(distances + i, ray, minX + i, minY + i, minZ + i, maxX + i, maxY + i, maxZ + i, count - i);
+	}
+
+	size_t RayIntersectSpheresSSE2(float* distances, float const* ray, float const* x, float const* y, float const* z, float const* radii, size_t count) noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 originX = _mm_set1_ps(ray[0]);
+		const __m128 originY = _mm_set1_ps(ray[1]);
+		const __m128 originZ = _mm_set1_ps(ray[2]);
+		const __m128 directionX = _mm_set1_ps(ray[3]);
+		const __m128 directionY = _mm_set1_ps(ray[4]);
+		const __m128 directionZ = _mm_set1_ps(ray[5]);
+		const __m128 a = Dot4(directionX, directionY, directionZ, directionX, directionY, directionZ);
+
+		size_t hitCount = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 offsetX = _mm_sub_ps(originX, _mm_loadu_ps(x + i));
+			const __m128 offsetY = _mm_sub_ps(originY, _mm_loadu_ps(y + i));
+			const __m128 offsetZ = _mm_sub_ps(originZ, _mm_loadu_ps(z + i));
+			const __m128 radius = _mm_loadu_ps(radii + i);
+
+			const __m128 b = Dot4(offsetX, offsetY, offsetZ, directionX, directionY, directionZ);
+			const __m128 c = _mm_sub_ps(Dot4(offsetX, offsetY, offsetZ, offsetX, offsetY, offsetZ), _mm_mul_ps(radius, radius));
+			const __m128 discriminant = _mm_sub_ps(_mm_mul_ps(b, b), _mm_mul_ps(a, c));
+
+			const __m128 away = _mm_and_ps(_mm_cmpgt_ps(c, zero), _mm_cmpgt_ps(b, zero));
+			const __m128 miss = _mm_or_ps(away, _mm_cmplt_ps(discriminant, zero));
+			const __m128 t = _mm_max_ps(_mm_div_ps(_mm_sub_ps(_mm_xor_ps(b, signMask), _mm_sqrt_ps(discriminant)), a), zero);
+
+			_mm_storeu_ps(distances + i, SelectDistance4(_mm_xor_ps(miss, _mm_castsi128_ps(_mm_set1_epi32(-1))), t));
+			hitCount += 4 - static_cast<size_t>(std::popcount(static_cast<unsigned int>(_mm_movemask_ps(miss))));
+		}
+
+		return hitCount + RayIntersectSpheresScalar(distances + i, ray, x + i, y + i, z + i, radii + i, count - i);
+	}
+
+	size_t RayIntersectPlanesSSE2(float* distances, float const* ray, float const* normalX, float const* normalY, float const* normalZ, float const* planeDistances, size_t count) noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 epsilon = _mm_set1_ps(g_epsilon);
+		const __m128 originX = _mm_set1_ps(ray[0]);
+		const __m128 originY = _mm_set1_ps(ray[1]);
+		const __m128 originZ = _mm_set1_ps(ray[2]);
+		const __m128 directionX = _mm_set1_ps(ray[3]);
+		const __m128 directionY = _mm_set1_ps(ray[4]);
+		const __m128 directionZ = _mm_set1_ps(ray[5]);
+
+		size_t hitCount = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 x = _mm_loadu_ps(normalX + i);
+			const __m128 y = _mm_loadu_ps(normalY + i);
+			const __m128 z = _mm_loadu_ps(normalZ + i);
+
+			const __m128 denominator = Dot4(x, y, z, directionX, directionY, directionZ);
+			const __m128 signedDistance = _mm_add_ps(Dot4(x, y, z, originX, originY, originZ), _mm_loadu_ps(planeDistances + i));
+			const __m128 t = _mm_div_ps(_mm_xor_ps(signedDistance, signMask), denominator);
+
+			const __m128 parallel = _mm_cmple_ps(_mm_andnot_ps(signMask, denominator), epsilon);
+			const __m128 miss = _mm_or_ps(parallel, _mm_cmplt_ps(t, zero));
+
+			_mm_storeu_ps(distances + i, SelectDistance4(_mm_xor_ps(miss, _mm_castsi128_ps(_mm_set1_epi32(-1))), t));
+			hitCount += 4 - static_cast<size_t>(std::popcount(static_cast<unsigned int>(_mm_movemask_ps(miss))));
+		}
+
+		return hitCount + RayIntersectPlanesScalar(distances + i, ray, normalX + i, normalY + i, normalZ + i, planeDistances + i, count - i);
+	}
+
+	size_t RayIntersectTrianglesSSE2(float* distances, float const* ray, float const* x0, float const* y0, float const* z0, float const* x1, float const* y1, float const* z1, float const* x2, float const* y2, float const* z2, size_t count) noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 epsilon = _mm_set1_ps(g_epsilon);
+		const __m128 originX = _mm_set1_ps(ray[0]);
+		const __m128 originY = _mm_set1_ps(ray[1]);
+		const __m128 originZ = _mm_set1_ps(ray[2]);
+		const __m128 directionX = _mm_set1_ps(ray[3]);
+		const __m128 directionY = _mm_set1_ps(ray[4]);
+		const __m128 directionZ = _mm_set1_ps(ray[5]);
+
+		size_t hitCount = 0;
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 vertexX = _mm_loadu_ps(x0 + i);
+			const __m128 vertexY = _mm_loadu_ps(y0 + i);
+			const __m128 vertexZ = _mm_loadu_ps(z0 + i);
+
+			const __m128 edge1X = _mm_sub_ps(_mm_loadu_ps(x1 + i), vertexX);
+			const __m128 edge1Y = _mm_sub_ps(_mm_loadu_ps(y1 + i), vertexY);
+			const __m128 edge1Z = _mm_sub_ps(_mm_loadu_ps(z1 + i), vertexZ);
+			const __m128 edge2X = _mm_sub_ps(_mm_loadu_ps(x2 + i), vertexX);
+			const __m128 edge2Y = _mm_sub_ps(_mm_loadu_ps(y2 + i), vertexY);
+			const __m128 edge2Z = _mm_sub_ps(_mm_loadu_ps(z2 + i), vertexZ);
+
+			// p = direction x edge2
+			const __m128 pX = _mm_sub_ps(_mm_mul_ps(directionY, edge2Z), _mm_mul_ps(directionZ, edge2Y));
+			const __m128 pY = _mm_sub_ps(_mm_mul_ps(directionZ, edge2X), _mm_mul_ps(directionX, edge2Z));
+			const __m128 pZ = _mm_sub_ps(_mm_mul_ps(directionX, edge2Y), _mm_mul_ps(directionY, edge2X));
+
+			const __m128 determinant = Dot4(edge1X, edge1Y, edge1Z, pX, pY, pZ);
+			const __m128 inverseDeterminant = _mm_div_ps(one, determinant);
+
+			const __m128 sX = _mm_sub_ps(originX, vertexX);
+			const __m128 sY = _mm_sub_ps(originY, vertexY);
+			const __m128 sZ = _mm_sub_ps(originZ, vertexZ);
+			const __m128 u = _mm_mul_ps(Dot4(sX, sY, sZ, pX, pY, pZ), inverseDeterminant);
+
+			// q = s x edge1
+			const __m128 qX = _mm_sub_ps(_mm_mul_ps(sY, edge1Z), _mm_mul_ps(sZ, edge1Y));
+			const __m128 qY = _mm_sub_ps(_mm_mul_ps(sZ, edge1X), _mm_mul_ps(sX, edge1Z));
+			const __m128 qZ = _mm_sub_ps(_mm_mul_ps(sX, edge1Y), _mm_mul_ps(sY, edge1X));
+
+			const __m128 v = _mm_mul_ps(Dot4(directionX, directionY, directionZ, qX, qY, qZ), inverseDeterminant);
+			const __m128 t = _mm_mul_ps(Dot4(edge2X, edge2Y, edge2Z, qX, qY, qZ), inverseDeterminant);
+
+			__m128 miss = _mm_cmple_ps(_mm_andnot_ps(signMask, determinant), epsilon);
+			miss = _mm_or_ps(miss, _mm_or_ps(_mm_cmplt_ps(u, zero), _mm_cmpgt_ps(u, one)));
+			miss = _mm_or_ps(miss, _mm_or_ps(_mm_cmplt_ps(v, zero), _mm_cmpgt_ps(_mm_add_ps(u, v), one)));
+			miss = _mm_or_ps(miss, _mm_cmplt_ps(t, zero));
+
+			_mm_storeu_ps(distances + i, SelectDistance4(_mm_xor_ps(miss, _mm_castsi128_ps(_mm_set1_epi32(-1))), t));
+			hitCount += 4 - static_cast<size_t>(std::popcount(static_cast<unsigned int>(_mm_movemask_ps(miss))));
+		}
+
+		return hitCount + RayIntersectTrianglesScalar(distances + i, ray, x0 + i, y0 + i, z0 + i, x1 + i, y1 + i, z1 + i, x2 + i, y2 + i, z2 + i, count - i);
+	}
+
+	// 8 lane versions of SelectDistance4 & Dot4
+	size_t SweepAndPruneOverlapsSSE2(uint32_t* pairs, size_t pairCapacity, float const* bounds, uint32_t const* indices, size_t count) noexcept
+	{
+		float const* minX = bounds;
+		float const* minY = bounds + count;
+		float const* minZ = bounds + count * 2;
+		float const* maxX = bounds + count * 3;
+		float const* maxY = bounds + count * 4;
+		float const* maxZ = bounds + count * 5;
+
+		size_t pairCount = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const __m128 boxMaxX = _mm_set1_ps(maxX[i]);
+			const __m128 boxMinY = _mm_set1_ps(minY[i]);
+			const __m128 boxMaxY = _mm_set1_ps(maxY[i]);
+			const __m128 boxMinZ = _mm_set1_ps(minZ[i]);
+			const __m128 boxMaxZ = _mm_set1_ps(maxZ[i]);
+
+			size_t j = i + 1;
+			bool open = true;
+
+			// Sorted by min x, the lanes still on the sweep axis are always the first ones
+			for (; open && j + 4 <= count; j += 4)
+			{
+				const __m128 onAxis = _mm_cmple_ps(_mm_loadu_ps(minX + j), boxMaxX);
+				const __m128 overlapY = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(minY + j), boxMaxY), _mm_cmpge_ps(_mm_loadu_ps(maxY + j), boxMinY));
+				const __m128 overlapZ = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(minZ + j), boxMaxZ), _mm_cmpge_ps(_mm_loadu_ps(maxZ + j), boxMinZ));
+
+				open = _mm_movemask_ps(onAxis) == 0xF;
+
+				for (int overlaps = _mm_movemask_ps(_mm_and_ps(onAxis, _mm_and_ps(overlapY, overlapZ))); overlaps != 0; overlaps &= overlaps - 1)
+					pairCount = StorePair(pairs, pairCapacity, pairCount, indices[i], indices[j + std::countr_zero(static_cast<unsigned>(overlaps))]);
+			}
+
+			if (open)
+				pairCount = SweepAndPruneBox(pairs, pairCapacity, pairCount, bounds, indices, count, i, j);
+		}
+
+		return pairCount;
+	}
+
+	LIBMATH_TARGET_AVX
+	inline __m256 SelectDistance8(__m256 hit, __m256 value) noexcept
+	{
+		return _mm256_or_ps(_mm256_and_ps(hit, value), _mm256_andnot_ps(hit, _mm256_set1_ps(g_infinity)));
+	}
+
+	LIBMATH_TARGET_AVX
+	inline __m256 Dot8(__m256 x1, __m256 y1, __m256 z1, __m256 x2, __m256 y2, __m256 z2) noexcept
+	{
+		return _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x1, x2), _mm256_mul_ps(y1, y2)), _mm256_mul_ps(z1, z2));
+	}
+
+	LIBMATH_TARGET_AVX
+	size_t RayIntersectBoxesAVX(float* distances, float const* ray, float const* minX, float const* minY, float const* minZ, float const* maxX, float const* maxY, float const* maxZ, size_t count) noexcept
+	{
+		const __m256 originX = _mm256_set1_ps(ray[0]);
+		const __m256 originY = _mm256_set1_ps(ray[1]);
+		const __m256 originZ = _mm256_set1_ps(ray[2]);
+		const __m256 inverseX = _mm256_set1_ps(1.0f / ray[3]);
+		const __m256 inverseY = _mm256_set1_ps(1.0f / ray[4]);
+		const __m256 inverseZ = _mm256_set1_ps(1.0f / ray[5]);
+
+		size_t hitCount = 0;
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 t1X = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(minX + i), originX), inverseX);
+			const __m256 t2X = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(maxX + i), originX), inverseX);
+			const __m256 t1Y = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(minY + i), originY), inverseY);
+			const __m256 t2Y = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(maxY + i), originY), inverseY);
+			const __m256 t1Z = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(minZ + i), originZ), inverseZ);
+			const __m256 t2Z = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(maxZ + i), originZ), inverseZ);
+
+			const __m256 tNear = _mm256_max_ps(_mm256_max_ps(_mm256_max_ps(_mm256_min_ps(t1X, t2X), _mm256_min_ps(t1Y, t2Y)), _mm256_min_ps(t1Z, t2Z)), _mm256_setzero_ps());
+			const __m256 tFar = _mm256_min_ps(_mm256_min_ps(_mm256_max_ps(t1X, t2X), _mm256_max_ps(t1Y, t2Y)), _mm256_max_ps(t1Z, t2Z));
+			const __m256 hit = _mm256_cmp_ps(tNear, tFar, _CMP_LE_OQ);
+
+			_mm256_storeu_ps(distances + i, SelectDistance8(hit, tNear));
+			hitCount += static_cast<size_t>(std::popcount(static_cast<unsigned int>(_mm256_movemask_ps(hit))));
+		}
+
+		return hitCount + RayIntersectBoxesSSE2(distances + i, ray, minX + i, minY + i, minZ + i, maxX + i, maxY + i, maxZ + i, count - i);
+	}
+
+	LIBMATH_TARGET_AVX
+	size_t RayIntersectSpheresAVX(float* distances, float const* ray, float const* x, float const* y, float const* z, float const* radii, size_t count) noexcept
+	{
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		const __m256 originX = _mm256_set1_ps(ray[0]);
+		const __m256 originY = _mm256_set1_ps(ray[1]);
+		const __m256 originZ = _mm256_set1_ps(ray[2]);
+		const __m256 directionX = _mm256_set1_ps(ray[3]);
+		const __m256 directionY = _mm256_set1_ps(ray[4]);
+		const __m256 directionZ = _mm256_set1_ps(ray[5]);
+		const __m256 a = Dot8(directionX, directionY, directionZ, directionX, directionY, directionZ);
+
+		size_t hitCount = 0;
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 offsetX = _mm256_sub_ps(originX, _mm256_loadu_ps(x + i));
+			const __m256 offsetY = _mm256_sub_ps(originY, _mm256_loadu_ps(y + i));
+			const __m256 offsetZ = _mm256_sub_ps(originZ, _mm256_loadu_ps(z + i));
+			const __m256 radius = _mm256_loadu_ps(radii + i);
+
+			const __m256 b = Dot8(offsetX, offsetY, offsetZ, directionX, directionY, directionZ);
+			const __m256 c = _mm256_sub_ps(Dot8(offsetX, offsetY, offsetZ, offsetX, offsetY, offsetZ), _mm256_mul_ps(radius, radius));
+			const __m256 discriminant = _mm256_sub_ps(_mm256_mul_ps(b, b), _mm256_mul_ps(a, c));
+
+			const __m256 away = _mm256_and_ps(_mm256_cmp_ps(c, zero, _CMP_GT_OQ), _mm256_cmp_ps(b, zero, _CMP_GT_OQ));
+			const __m256 miss = _mm256_or_ps(away, _mm256_cmp_ps(discriminant, zero, _CMP_LT_OQ));
+			const __m256 t = _mm256_max_ps(_mm256_div_ps(_mm256_sub_ps(_mm256_xor_ps(b, signMask), _mm256_sqrt_ps(discriminant)), a), zero);
+
+			_mm256_storeu_ps(distances + i, SelectDistance8(_mm256_xor_ps(miss, _mm256_castsi256_ps(_mm256_set1_epi32(-1))), t));
+			hitCount += 8 - static_cast<size_t>(std::popcount(static_cast<unsigned int>(_mm256_movemask_ps(miss))));
+		}
+
+		return hitCount + RayIntersectSpheresSSE2(distances + i, ray, x + i, y + i, z + i, radii + i, count - i);
+	}
+
+	LIBMATH_TARGET_AVX
+	size_t RayIntersectPlanesAVX(float* distances, float const* ray, float const* normalX, float const* normalY, float const* normalZ, float const* planeDistances, size_t count) noexcept
+	{
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		const __m256 epsilon = _mm256_set1_ps(g_epsilon);
+		const __m256 originX = _mm256_set1_ps(ray[0]);
+		const __m256 originY = _mm256_set1_ps(ray[1]);
+		const __m256 originZ = _mm256_set1_ps(ray[2]);
+		const __m256 directionX = _mm256_set1_ps(ray[3]);
+		const __m256 directionY = _mm256_set1_ps(ray[4]);
+		const __m256 directionZ = _mm256_set1_ps(ray[5]);
+
+		size_t hitCount = 0;
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 x = _mm256_loadu_ps(normalX + i);
+			const __m256 y = _mm256_loadu_ps(normalY + i);
+			const __m256 z = _mm256_loadu_ps(normalZ + i);
+
+			const __m256 denominator = Dot8(x, y, z, directionX, directionY, directionZ);
+			const __m256 signedDistance = _mm256_add_ps(Dot8(x, y, z, originX, originY, originZ), _mm256_loadu_ps(planeDistances + i));
+			const __m256 t = _mm256_div_ps(_mm256_xor_ps(signedDistance, signMask), denominator);
+
+			const __m256 parallel = _mm256_cmp_ps(_mm256_andnot_ps(signMask, denominator), epsilon, _CMP_LE_OQ);
+			const __m256 miss = _mm256_or_ps(parallel, _mm256_cmp_ps(t, zero, _CMP_LT_OQ));
+
+			_mm256_storeu_ps(distances + i, SelectDistance8(_mm256_xor_ps(miss, _mm256_castsi256_ps(_mm256_set1_epi32(-1))), t));
+			hitCount += 8 - static_cast<size_t>(std::popcount(static_cast<unsigned int>(_mm256_movemask_ps(miss))));
+		}
+
+		return hitCount + RayIntersectPlanesSSE2(distances + i, ray, normalX + i, normalY + i, normalZ + i, planeDistances + i, count - i);
+	}
+
+	LIBMATH_TARGET_AVX
+	size_t RayIntersectTrianglesAVX(float* distances, float const* ray, float const* x0, float const* y0, float const* z0, float const* x1, float const* y1, float const* z1, float const* x2, float const* y2, float const* z2, size_t count) noexcept
+	{
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		const __m256 epsilon = _mm256_set1_ps(g_epsilon);
+		const __m256 originX = _mm256_set1_ps(ray[0]);
+		const __m256 originY = _mm256_set1_ps(ray[1]);
+		const __m256 originZ = _mm256_set1_ps(ray[2]);
+		const __m256 directionX = _mm256_set1_ps(ray[3]);
+		const __m256 directionY = _mm256_set1_ps(ray[4]);
+		const __m256 directionZ = _mm256_set1_ps(ray[5]);
+
+		size_t hitCount = 0;
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 vertexX = _mm256_loadu_ps(x0 + i);
+			const __m256 vertexY = _mm256_loadu_ps(y0 + i);
+			const __m256 vertexZ = _mm256_loadu_ps(z0 + i);
+
+			const __m256 edge1X = _mm256_sub_ps(_mm256_loadu_ps(x1 + i), vertexX);
+			const __m256 edge1Y = _mm256_sub_ps(_mm256_loadu_ps(y1 + i), vertexY);
+			const __m256 edge1Z = _mm256_sub_ps(_mm256_loadu_ps(z1 + i), vertexZ);
+			const __m256 edge2X = _mm256_sub_ps(_mm256_loadu_ps(x2 + i), vertexX);
+			const __m256 edge2Y = _mm256_sub_ps(_mm256_loadu_ps(y2 + i), vertexY);
+			const __m256 edge2Z = _mm256_sub_ps(_mm256_loadu_ps(z2 + i), vertexZ);
+
+			// p = direction x edge2
+			const __m256 pX = _mm256_sub_ps(_mm256_mul_ps(directionY, edge2Z), _mm256_mul_ps(directionZ, edge2Y));
+			const __m256 pY = _mm256_sub_ps(_mm256_mul_ps(directionZ, edge2X), _mm256_mul_ps(directionX, edge2Z));
+			const __m256 pZ = _mm256_sub_ps(_mm256_mul_ps(directionX, edge2Y), _mm256_mul_ps(directionY, edge2X));
+
+			const __m256 determinant = Dot8(edge1X, edge1Y, edge1Z, pX, pY, pZ);
+			const __m256 inverseDeterminant = _mm256_div_ps(one, determinant);
+
+			const __m256 sX = _mm256_sub_ps(originX, vertexX);
+			const __m256 sY = _mm256_sub_ps(originY, vertexY);
+			const __m256 sZ = _mm256_sub_ps(originZ, vertexZ);
+			const __m256 u = _mm256_mul_ps(Dot8(sX, sY, sZ, pX, pY, pZ), inverseDeterminant);
+
+			// q = s x edge1
+			const __m256 qX = _mm256_sub_ps(_mm256_mul_ps(sY, edge1Z), _mm256_mul_ps(sZ, edge1Y));
+			const __m256 qY = _mm256_sub_ps(_mm256_mul_ps(sZ, edge1X), _mm256_mul_ps(sX, edge1Z));
+			const __m256 qZ = _mm256_sub_ps(_mm256_mul_ps(sX, edge1Y), _mm256_mul_ps(sY, edge1X));
+
+			const __m256 v = _mm256_mul_ps(Dot8(directionX, directionY, directionZ, qX, qY, qZ), inverseDeterminant);
+			const __m256 t = _mm256_mul_ps(Dot8(edge2X, edge2Y, edge2Z, qX, qY, qZ), inverseDeterminant);
+
+			__m256 miss = _mm256_cmp_ps(_mm256_andnot_ps(signMask, determinant), epsilon, _CMP_LE_OQ);
+			miss = _mm256_or_ps(miss, _mm256_or_ps(_mm256_cmp_ps(u, zero, _CMP_LT_OQ), _mm256_cmp_ps(u, one, _CMP_GT_OQ)));
+			miss = _mm256_or_ps(miss, _mm256_or_ps(_mm256_cmp_ps(v, zero, _CMP_LT_OQ), _mm256_cmp_ps(_mm256_add_ps(u, v), one, _CMP_GT_OQ)));
+			miss = _mm256_or_ps(miss, _mm256_cmp_ps(t, zero, _CMP_LT_OQ));
+
+			_mm256_storeu_ps(distances + i, SelectDistance8(_mm256_xor_ps(miss, _mm256_castsi256_ps(_mm256_set1_epi32(-1))), t));
+			hitCount += 8 - static_cast<size_t>(std::popcount(static_cast<unsigned int>(_mm256_movemask_ps(miss))));
+		}
+
+		return hitCount + RayIntersectTrianglesSSE2(distances + i, ray, x0 + i, y0 + i, z0 + i, x1 + i, y1 + i, z1 + i, x2 + i, y2 + i, z2 + i, count - i);
+	}
+
+	LIBMATH_TARGET_AVX
+	size_t FrustumCullSpheresAVX(uint32_t* visible, float const* x, float const* y, float const* z, float const* radii, size_t count, float const* planes, uint32_t offset) noexcept
+	{
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+		__m256 plane[g_planeCount][4];
+
+		for (int side = 0; side < g_planeCount; ++side)
+		{
+			for (int component = 0; component < 4; ++component)
+				plane[side][component] = _mm256_set1_ps(planes[side * 4 + component]);
+		}
+
+		size_t visibleCount = 0;
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 centerX = _mm256_loadu_ps(x + i);
+			const __m256 centerY = _mm256_loadu_ps(y + i);
+			const __m256 centerZ = _mm256_loadu_ps(z + i);
+			const __m256 negativeRadius = _mm256_xor_ps(_mm256_loadu_ps(radii + i), signMask);
+
+			__m256 outside = _mm256_setzero_ps();
+
+			for (int side = 0; side < g_planeCount; ++side)
+			{
+				const __m256 dot = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(plane[side][0], centerX), _mm256_mul_ps(plane[side][1], centerY)), _mm256_mul_ps(plane[side][2], centerZ));
+				const __m256 distance = _mm256_add_ps(dot, plane[side][3]);
+
+				outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, negativeRadius, _CMP_LT_OQ));
+			}
+
+			visibleCount = WriteVisible<8>(visible, visibleCount, ~_mm256_movemask_ps(outside), offset + static_cast<uint32_t>(i));
+		}
+
+		return visibleCount + FrustumCullSpheresSSE2(visible + visibleCount, x + i, y + i, z + i, radii + i, count - i, planes, offset + static_cast<uint32_t>(i));
+	}
+
+	LIBMATH_TARGET_AVX
+	size_t FrustumCullBoxesAVX(uint32_t* visible, float const* x, float const* y, float const* z, float const* extentX, float const* extentY, float const* extentZ, size_t count, float const* planes, uint32_t offset) noexcept
+	{
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+
+		__m256 plane[g_planeCount][4];
+		__m256 absNormal[g_planeCount][3];
+
+		for (int side = 0; side < g_planeCount; ++side)
+		{
+			for (int component = 0; component < 4; ++component)
+				plane[side][component] = _mm256_set1_ps(planes[side * 4 + component]);
+
+			for (int axis = 0; axis < 3; ++axis)
+				absNormal[side][axis] = _mm256_andnot_ps(signMask, plane[side][axis]);
+		}
+
+		size_t visibleCount = 0;
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 centerX = _mm256_loadu_ps(x + i);
+			const __m256 centerY = _mm256_loadu_ps(y + i);
+			const __m256 centerZ = _mm256_loadu_ps(z + i);
+			const __m256 halfX = _mm256_loadu_ps(extentX + i);
+			const __m256 halfY = _mm256_loadu_ps(extentY + i);
+			const __m256 halfZ = _mm256_loadu_ps(extentZ + i);
+
+			__m256 outside = _mm256_setzero_ps();
+
+			for (int side = 0; side < g_planeCount; ++side)
+			{
+				const __m256 radius = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(absNormal[side][0], halfX), _mm256_mul_ps(absNormal[side][1], halfY)), _mm256_mul_ps(absNormal[side][2], halfZ));
+				const __m256 dot = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(plane[side][0], centerX), _mm256_mul_ps(plane[side][1], centerY)), _mm256_mul_ps(plane[side][2], centerZ));
+				const __m256 distance = _mm256_add_ps(dot, plane[side][3]);
+
+				outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, _mm256_xor_ps(radius, signMask), _CMP_LT_OQ));
+			}
+
+			visibleCount = WriteVisible<8>(visible, visibleCount, ~_mm256_movemask_ps(outside), offset + static_cast<uint32_t>(i));
+		}
+
+		return visibleCount + FrustumCullBoxesSSE2(visible + visibleCount, x + i, y + i, z + i, extentX + i, extentY + i, extentZ + i, count - i, planes, offset + static_cast<uint32_t>(i));
+	}
+
+	LIBMATH_TARGET_AVX
+	size_t SweepAndPruneOverlapsAVX(uint32_t* pairs, size_t pairCapacity, float const* bounds, uint32_t const* indices, size_t count) noexcept
+	{
+		float const* minX = bounds;
+		float const* minY = bounds + count;
+		float const* minZ = bounds + count * 2;
+		float const* maxX = bounds + count * 3;
+		float const* maxY = bounds + count * 4;
+		float const* maxZ = bounds + count * 5;
+
+		size_t pairCount = 0;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const __m256 boxMaxX = _mm256_set1_ps(maxX[i]);
+			const __m256 boxMinY = _mm256_set1_ps(minY[i]);
+			const __m256 boxMaxY = _mm256_set1_ps(maxY[i]);
+			const __m256 boxMinZ = _mm256_set1_ps(minZ[i]);
+			const __m256 boxMaxZ = _mm256_set1_ps(maxZ[i]);
+
+			size_t j = i + 1;
+			bool open = true;
+
+			// Sorted by min x, the lanes still on the sweep axis are always the first ones
+			for (; open && j + 8 <= count; j += 8)
+			{
+				const __m256 onAxis = _mm256_cmp_ps(_mm256_loadu_ps(minX + j), boxMaxX, _CMP_LE_OQ);
+				const __m256 overlapY = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(minY + j), boxMaxY, _CMP_LE_OQ), _mm256_cmp_ps(_mm256_loadu_ps(maxY + j), boxMinY, _CMP_GE_OQ));
+				const __m256 overlapZ = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(minZ + j), boxMaxZ, _CMP_LE_OQ), _mm256_cmp_ps(_mm256_loadu_ps(maxZ + j), boxMinZ, _CMP_GE_OQ));
+
+				open = _mm256_movemask_ps(onAxis) == 0xFF;
+
+				for (int overlaps = _mm256_movemask_ps(_mm256_and_ps(onAxis, _mm256_and_ps(overlapY, overlapZ))); overlaps != 0; overlaps &= overlaps - 1)
+					pairCount = StorePair(pairs, pairCapacity, pairCount, indices[i], indices[j + std::countr_zero(static_cast<unsigned>(overlaps))]);
+			}
+
+			if (open)
+				pairCount = SweepAndPruneBox(pairs, pairCapacity, pairCount, bounds, indices, count, i, j);
+		}
+
+		return pairCount;
+	}
+
+	// Indexed by math::simd::InstructionSet, multiply & add are not fused so AVX2 + FMA reuses the AVX kernels
+	constexpr FrustumCullSpheresKernel g_frustumCullSpheresKernels[] =
+	{
+		&FrustumCullSpheresScalar,
+		&FrustumCullSpheresSSE2,
+		&FrustumCullSpheresAVX,
+		&FrustumCullSpheresAVX
+	};
+
+	constexpr FrustumCullBoxesKernel g_frustumCullBoxesKernels[] =
+	{
+		&FrustumCullBoxesScalar,
+		&FrustumCullBoxesSSE2,
+		&FrustumCullBoxesAVX,
+		&FrustumCullBoxesAVX
+	};
+
+	constexpr RayIntersectBoxesKernel g_rayIntersectBoxesKernels[] =
+	{
+		&RayIntersectBoxesScalar,
+		&RayIntersectBoxesSSE2,
+		&RayIntersectBoxesAVX,
+		&RayIntersectBoxesAVX
+	};
+
+	constexpr RayIntersectSpheresKernel g_rayIntersectSpheresKernels[] =
+	{
+		&RayIntersectSpheresScalar,
+		&RayIntersectSpheresSSE2,
+		&RayIntersectSpheresAVX,
+		&RayIntersectSpheresAVX
+	};
+
+	constexpr RayIntersectPlanesKernel g_rayIntersectPlanesKernels[] =
+	{
+		&RayIntersectPlanesScalar,
+		&RayIntersectPlanesSSE2,
+		&RayIntersectPlanesAVX,
+		&RayIntersectPlanesAVX
+	};
+
+	constexpr RayIntersectTrianglesKernel g_rayIntersectTrianglesKernels[] =
+	{
+		&RayIntersectTrianglesScalar,
+		&RayIntersectTrianglesSSE2,
+		&RayIntersectTrianglesAVX,
+		&RayIntersectTrianglesAVX
+	};
+	constexpr SweepAndPruneOverlapsKernel g_sweepAndPruneOverlapsKernels[] =
+	{
+		&SweepAndPruneOverlapsScalar,
+		&SweepAndPruneOverlapsSSE2,
+		&SweepAndPruneOverlapsAVX,
+		&SweepAndPruneOverlapsAVX
+	};
+#else
+	constexpr FrustumCullSpheresKernel g_frustumCullSpheresKernels[] =
+	{
+		&FrustumCullSpheresScalar,
+		&FrustumCullSpheresScalar,
+		&FrustumCullSpheresScalar,
+		&FrustumCullSpheresScalar
+	};
+
+	constexpr FrustumCullBoxesKernel g_frustumCullBoxesKernels[] =
+	{
+		&FrustumCullBoxesScalar,
+		&FrustumCullBoxesScalar,
+		&FrustumCullBoxesScalar,
+		&FrustumCullBoxesScalar
+	};
+
+	constexpr RayIntersectBoxesKernel g_rayIntersectBoxesKernels[] =
+	{
+		&RayIntersectBoxesScalar,
+		&RayIntersectBoxesScalar,
+		&RayIntersectBoxesScalar,
+		&RayIntersectBoxesScalar
+	};
+
+	constexpr RayIntersectSpheresKernel g_rayIntersectSpheresKernels[] =
+	{
+		&RayIntersectSpheresScalar,
+		&RayIntersectSpheresScalar,
+		&RayIntersectSpheresScalar,
+		&RayIntersectSpheresScalar
+	};
+
+	constexpr RayIntersectPlanesKernel g_rayIntersectPlanesKernels[] =
+	{
+		&RayIntersectPlanesScalar,
+		&RayIntersectPlanesScalar,
+		&RayIntersectPlanesScalar,
+		&RayIntersectPlanesScalar
+	};
+
+	constexpr RayIntersectTrianglesKernel g_rayIntersectTrianglesKernels[] =
+	{
+		&RayIntersectTrianglesScalar,
+		&RayIntersectTrianglesScalar,
+		&RayIntersectTrianglesScalar,
+		&RayIntersectTrianglesScalar
+	};
+	constexpr SweepAndPruneOverlapsKernel g_sweepAndPruneOverlapsKernels[] =
+	{
+		&SweepAndPruneOverlapsScalar,
+		&SweepAndPruneOverlapsScalar,
+		&SweepAndPruneOverlapsScalar,
+		&SweepAndPruneOverlapsScalar
+	};
+#endif
+}
+
+size_t math::simd::FrustumCullSpheres(uint32_t* visible, float const* x, float const* y, float const* z, float const* radii, size_t count, float const* planes, uint32_t offset) noexcept
+{
+	return g_frustumCullSpheresKernels[static_cast<int>(ActiveInstructionSet())](visible, x, y, z, radii, count, planes, offset);
+}
+
+size_t math::simd::FrustumCullBoxes(uint32_t* visible, float const* x, float const* y, float const* z, float const* extentX, float const* extentY, float const* extentZ, size_t count, float const* planes, uint32_t offset) noexcept
+{
+	return g_frustumCullBoxesKernels[static_cast<int>(ActiveInstructionSet())](visible, x, y, z, extentX, extentY, extentZ, count, planes, offset);
+}
+
+size_t math::simd::RayIntersectBoxes(float* distances, float const* ray, float const* minX, float const* minY, float const* minZ, float const* maxX, float const* maxY, float const* maxZ, size_t count) noexcept
+{
+	return g_rayIntersectBoxesKernels[static_cast<int>(ActiveInstructionSet())](distances, ray, minX, minY, minZ, maxX, maxY, maxZ, count);
+}
+
+size_t math::simd::RayIntersectSpheres(float* distances, float const* ray, float const* x, float const* y, float const* z, float const* radii, size_t count) noexcept
+{
+	return g_rayIntersectSpheresKernels[static_cast<int>(ActiveInstructionSet())](distances, ray, x, y, z, radii, count);
+}
+
+size_t math::simd::RayIntersectPlanes(float* distances, float const* ray, float const* normalX, float const* normalY, float const* normalZ, float const* planeDistances, size_t count) noexcept
+{
+	return g_rayIntersectPlanesKernels[static_cast<int>(ActiveInstructionSet())](distances, ray, normalX, normalY, normalZ, planeDistances, count);
+}
+
+size_t math::simd::RayIntersectTriangles(float* distances, float const* ray, float const* x0, float const* y0, float const* z0, float const* x1, float const* y1, float const* z1, float const* x2, float const* y2, float const* z2, size_t count) noexcept
+{
+	return g_rayIntersectTrianglesKernels[static_cast<int>(ActiveInstructionSet())](distances, ray, x0, y0, z0, x1, y1, z1, x2, y2, z2, count);
+}
+
+size_t math::simd::SweepAndPruneOverlaps(uint32_t* pairs, size_t pairCapacity, float const* bounds, uint32_t const* indices, size_t count) noexcept
+{
+	return g_sweepAndPruneOverlapsKernels[static_cast<int>(ActiveInstructionSet())](pairs, pairCapacity, bounds, indices, count);
+}
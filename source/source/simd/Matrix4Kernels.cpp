@@ -0,0 +1,944 @@
+#include "simd/Simd.h"
+#include "simd/Float4.h"
+#include "matrix/Matrix4.h"
+
+#include <bit>
+
+/*
+*	Matrix4 float kernels
+*
+*	Every kernel keeps the column order of the generic Matrix4 code:
+*	result column j = lhs column 0 * rhs[j][0] + ... + lhs column 3 * rhs[j][3]
+*	summed from left to right, so the non fused kernels are bit-for-bit
+*	identical to the scalar implementation.
+*
+*	The inverse kernels expand the determinant with 2x2 sub determinants
+*	shared between the cofactors, the SSE2 kernel evaluates the exact same
+*	operations lane by lane.
+*
+*	The transform kernels apply one matrix to N packed vectors with the
+*	same column order, column 0 * x + column 1 * y + column 2 * z + column 3 * w.
+*
+*	The TRS kernels call Matrix4::ComposeTRS & Matrix4::Decompose in the
+*	scalar version. The SSE2 kernels transpose 4 matrices (or 4 sets of
+*	translation, rotation & scale) to one register per element, every lane
+*	evaluates the scalar operations in the same order with the branches of
+*	Shepperd's method turned into masks, results are bit for bit identical.
+*	Matrix3ToQuaternion & Matrix4ToQuaternion (Quaternion::FromMatrix3 &
+*	FromMatrix4) share the rotation part of the Decompose kernel, 3x3
+*	matrices are gathered element by element.
+*/
+
+namespace
+{
+	using Matrix4MultiplyKernel = void (*)(float*, float const*, float const*) noexcept;
+	using Matrix4InverseKernel = bool (*)(float*, float const*) noexcept;
+	using Matrix4TransformVector3Kernel = void (*)(float*, float const*, size_t, float const*, float) noexcept;
+	using Matrix4TransformVector4Kernel = void (*)(float*, float const*, size_t, float const*) noexcept;
+	using Matrix4ComposeTRSKernel = void (*)(float*, float const*, float const*, float const*, size_t) noexcept;
+	using Matrix4DecomposeKernel = size_t (*)(float*, float*, float*, float const*, size_t) noexcept;
+	using MatrixToQuaternionKernel = void (*)(float*, float const*, size_t) noexcept;
+
+	void Matrix4MultiplyScalar(float* result, float const* lhs, float const* rhs) noexcept
+	{
+		// Use a temporary so the result can alias either operand
+		float tmp[16];
+
+		for (int j = 0; j < 4; ++j)
+		{
+			for (int i = 0; i < 4; ++i)
+			{
+				tmp[j * 4 + i] =
+					lhs[i] * rhs[j * 4] +
+					lhs[4 + i] * rhs[j * 4 + 1] +
+					lhs[8 + i] * rhs[j * 4 + 2] +
+					lhs[12 + i] * rhs[j * 4 + 3];
+			}
+		}
+
+		for (int i = 0; i < 16; ++i)
+			result[i] = tmp[i];
+	}
+
+	bool Matrix4InverseScalar(float* result, float const* matrix) noexcept
+	{
+		float const (*m)[4] = reinterpret_cast<float const (*)[4]>(matrix);
+
+		// 2x2 sub determinants of the lower rows, each one is shared by several cofactors
+		const float coef00 = m[2][2] * m[3][3] - m[3][2] * m[2][3];
+		const float coef02 = m[1][2] * m[3][3] - m[3][2] * m[1][3];
+		const float coef03 = m[1][2] * m[2][3] - m[2][2] * m[1][3];
+		const float coef04 = m[2][1] * m[3][3] - m[3][1] * m[2][3];
+		const float coef06 = m[1][1] * m[3][3] - m[3][1] * m[1][3];
+		const float coef07 = m[1][1] * m[2][3] - m[2][1] * m[1][3];
+		const float coef08 = m[2][1] * m[3][2] - m[3][1] * m[2][2];
+		const float coef10 = m[1][1] * m[3][2] - m[3][1] * m[1][2];
+		const float coef11 = m[1][1] * m[2][2] - m[2][1] * m[1][2];
+		const float coef12 = m[2][0] * m[3][3] - m[3][0] * m[2][3];
+		const float coef14 = m[1][0] * m[3][3] - m[3][0] * m[1][3];
+		const float coef15 = m[1][0] * m[2][3] - m[2][0] * m[1][3];
+		const float coef16 = m[2][0] * m[3][2] - m[3][0] * m[2][2];
+		const float coef18 = m[1][0] * m[3][2] - m[3][0] * m[1][2];
+		const float coef19 = m[1][0] * m[2][2] - m[2][0] * m[1][2];
+		const float coef20 = m[2][0] * m[3][1] - m[3][0] * m[2][1];
+		const float coef22 = m[1][0] * m[3][1] - m[3][0] * m[1][1];
+		const float coef23 = m[1][0] * m[2][1] - m[2][0] * m[1][1];
+
+		// Adjugate, one column at a time
+		float adjugate[4][4] =
+		{
+			{
+				 (m[1][1] * coef00 - m[1][2] * coef04 + m[1][3] * coef08),
+				-(m[0][1] * coef00 - m[0][2] * coef04 + m[0][3] * coef08),
+				 (m[0][1] * coef02 - m[0][2] * coef06 + m[0][3] * coef10),
+				-(m[0][1] * coef03 - m[0][2] * coef07 + m[0][3] * coef11)
+			},
+			{
+				-(m[1][0] * coef00 - m[1][2] * coef12 + m[1][3] * coef16),
+				 (m[0][0] * coef00 - m[0][2] * coef12 + m[0][3] * coef16),
+				-(m[0][0] * coef02 - m[0][2] * coef14 + m[0][3] * coef18),
+				 (m[0][0] * coef03 - m[0][2] * coef15 + m[0][3] * coef19)
+			},
+			{
+				 (m[1][0] * coef04 - m[1][1] * coef12 + m[1][3] * coef20),
+				-(m[0][0] * coef04 - m[0][1] * coef12 + m[0][3] * coef20),
+				 (m[0][0] * coef06 - m[0][1] * coef14 + m[0][3] * coef22),
+				-(m[0][0] * coef07 - m[0][1] * coef15 + m[0][3] * coef23)
+			},
+			{
+				-(m[1][0] * coef08 - m[1][1] * coef16 + m[1][2] * coef20),
+				 (m[0][0] * coef08 - m[0][1] * coef16 + m[0][2] * coef20),
+				-(m[0][0] * coef10 - m[0][1] * coef18 + m[0][2] * coef22),
+				 (m[0][0] * coef11 - m[0][1] * coef19 + m[0][2] * coef23)
+			}
+		};
+
+		// Determinant from the first row & the first adjugate column
+		const float determinant =
+			(m[0][0] * adjugate[0][0] + m[0][1] * adjugate[1][0]) +
+			(m[0][2] * adjugate[2][0] + m[0][3] * adjugate[3][0]);
+
+		if (determinant == 0.0f)
+			return false;
+
+		const float oneOverDeterminant = 1.0f / determinant;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+				result[i * 4 + j] = adjugate[i][j] * oneOverDeterminant;
+		}
+
+		return true;
+	}
+
+	void Matrix4TransformVector3Scalar(float* result, float const* vectors, size_t count, float const* matrix, float w) noexcept
+	{
+		for (size_t n = 0; n < count; ++n)
+		{
+			const float x = vectors[n * 3];
+			const float y = vectors[n * 3 + 1];
+			const float z = vectors[n * 3 + 2];
+
+			for (int i = 0; i < 3; ++i)
+				result[n * 3 + i] = matrix[i] * x + matrix[4 + i] * y + matrix[8 + i] * z + matrix[12 + i] * w;
+		}
+	}
+
+	void Matrix4TransformVector4Scalar(float* result, float const* vectors, size_t count, float const* matrix) noexcept
+	{
+		for (size_t n = 0; n < count; ++n)
+		{
+			const float x = vectors[n * 4];
+			const float y = vectors[n * 4 + 1];
+			const float z = vectors[n * 4 + 2];
+			const float w = vectors[n * 4 + 3];
+
+			for (int i = 0; i < 4; ++i)
+				result[n * 4 + i] = matrix[i] * x + matrix[4 + i] * y + matrix[8 + i] * z + matrix[12 + i] * w;
+		}
+	}
+
+	void Matrix4ComposeTRSScalar(float* result, float const* translations, float const* rotations, float const* scales, size_t count) noexcept
+	{
+		for (size_t n = 0; n < count; ++n)
+		{
+			float const* translation = translations + n * 3;
+			float const* rotation = rotations + n * 4;
+			float const* scale = scales + n * 3;
+
+			const math::Matrix4<float> matrix = math::Matrix4<float>::ComposeTRS(
+				math::Vector3<float>(translation[0], translation[1], translation[2]),
+				math::Quaternion<float>(rotation[3], rotation[0], rotation[1], rotation[2]),
+				math::Vector3<float>(scale[0], scale[1], scale[2])
+			);
+
+			for (int i = 0; i < 4; ++i)
+			{
+				for (int j = 0; j < 4; ++j)
+					result[n * 16 + i * 4 + j] = matrix.m_matrix[i][j];
+			}
+		}
+	}
+
+	size_t Matrix4DecomposeScalar(float* translations, float* rotations, float* scales, float const* matrices, size_t count) noexcept
+	{
+		size_t failures = 0;
+
+		for (size_t n = 0; n < count; ++n)
+		{
+			const math::Matrix4<float> matrix(matrices + n * 16);
+
+			math::Vector3<float> translation;
+			math::Quaternion<float> rotation;
+			math::Vector3<float> scale;
+
+			if (!matrix.Decompose(translation, rotation, scale))
+				++failures;
+
+			for (int i = 0; i < 3; ++i)
+			{
+				translations[n * 3 + i] = translation[i];
+				rotations[n * 4 + i] = rotation[i + 1];
+				scales[n * 3 + i] = scale[i];
+			}
+
+			rotations[n * 4 + 3] = rotation[0];
+		}
+
+		return failures;
+	}
+
+	void StoreQuaternion(float* rotation, math::Quaternion<float> const& quat) noexcept
+	{
+		rotation[0] = quat[1];
+		rotation[1] = quat[2];
+		rotation[2] = quat[3];
+		rotation[3] = quat[0];
+	}
+
+	void Matrix3ToQuaternionScalar(float* rotations, float const* matrices, size_t count) noexcept
+	{
+		for (size_t n = 0; n < count; ++n)
+		{
+			math::Matrix3<float> matrix;
+
+			for (int i = 0; i < 3; ++i)
+			{
+				for (int j = 0; j < 3; ++j)
+					matrix.m_matrix[i][j] = matrices[n * 9 + i * 3 + j];
+			}
+
+			StoreQuaternion(rotations + n * 4, math::Quaternion<float>::FromMatrix3(matrix));
+		}
+	}
+
+	void Matrix4ToQuaternionScalar(float* rotations, float const* matrices, size_t count) noexcept
+	{
+		for (size_t n = 0; n < count; ++n)
+			StoreQuaternion(rotations + n * 4, math::Quaternion<float>::FromMatrix4(math::Matrix4<float>(matrices + n * 16)));
+	}
+
+#if LIBMATH_SIMD_SSE2
+	LIBMATH_TARGET_AVX
+	void Matrix4MultiplyAVX(float* result, float const* lhs, float const* rhs) noexcept
+	{
+		// Duplicate each lhs column in both 128 bit lanes to compute 2 result columns at once
+		const __m128 lhsColumn0 = _mm_loadu_ps(lhs);
+		const __m128 lhsColumn1 = _mm_loadu_ps(lhs + 4);
+		const __m128 lhsColumn2 = _mm_loadu_ps(lhs + 8);
+		const __m128 lhsColumn3 = _mm_loadu_ps(lhs + 12);
+
+		const __m256 column0 = _mm256_insertf128_ps(_mm256_castps128_ps256(lhsColumn0), lhsColumn0, 1);
+		const __m256 column1 = _mm256_insertf128_ps(_mm256_castps128_ps256(lhsColumn1), lhsColumn1, 1);
+		const __m256 column2 = _mm256_insertf128_ps(_mm256_castps128_ps256(lhsColumn2), lhsColumn2, 1);
+		const __m256 column3 = _mm256_insertf128_ps(_mm256_castps128_ps256(lhsColumn3), lhsColumn3, 1);
+
+		for (int j = 0; j < 4; j += 2)
+		{
+			// rhs columns j & j + 1, permute broadcasts an element within each lane
+			const __m256 rhsColumns = _mm256_loadu_ps(rhs + j * 4);
+
+			__m256 sum = _mm256_mul_ps(column0, _mm256_permute_ps(rhsColumns, 0x00));
+			sum = _mm256_add_ps(sum, _mm256_mul_ps(column1, _mm256_permute_ps(rhsColumns, 0x55)));
+			sum = _mm256_add_ps(sum, _mm256_mul_ps(column2, _mm256_permute_ps(rhsColumns, 0xAA)));
+			sum = _mm256_add_ps(sum, _mm256_mul_ps(column3, _mm256_permute_ps(rhsColumns, 0xFF)));
+
+			_mm256_storeu_ps(result + j * 4, sum);
+		}
+	}
+
+	LIBMATH_TARGET_AVX2_FMA
+	void Matrix4MultiplyFMA(float* result, float const* lhs, float const* rhs) noexcept
+	{
+		const __m128 lhsColumn0 = _mm_loadu_ps(lhs);
+		const __m128 lhsColumn1 = _mm_loadu_ps(lhs + 4);
+		const __m128 lhsColumn2 = _mm_loadu_ps(lhs + 8);
+		const __m128 lhsColumn3 = _mm_loadu_ps(lhs + 12);
+
+		const __m256 column0 = _mm256_insertf128_ps(_mm256_castps128_ps256(lhsColumn0), lhsColumn0, 1);
+		const __m256 column1 = _mm256_insertf128_ps(_mm256_castps128_ps256(lhsColumn1), lhsColumn1, 1);
+		const __m256 column2 = _mm256_insertf128_ps(_mm256_castps128_ps256(lhsColumn2), lhsColumn2, 1);
+		const __m256 column3 = _mm256_insertf128_ps(_mm256_castps128_ps256(lhsColumn3), lhsColumn3, 1);
+
+		for (int j = 0; j < 4; j += 2)
+		{
+			const __m256 rhsColumns = _mm256_loadu_ps(rhs + j * 4);
+
+			__m256 sum = _mm256_mul_ps(column0, _mm256_permute_ps(rhsColumns, 0x00));
+			sum = _mm256_fmadd_ps(column1, _mm256_permute_ps(rhsColumns, 0x55), sum);
+			sum = _mm256_fmadd_ps(column2, _mm256_permute_ps(rhsColumns, 0xAA), sum);
+			sum = _mm256_fmadd_ps(column3, _mm256_permute_ps(rhsColumns, 0xFF), sum);
+
+			_mm256_storeu_ps(result + j * 4, sum);
+		}
+	}
+
+	// (m2[a], m2[a], m1[a], m1[a]) * (m3[b], m3[b], m3[b], m2[b]) - (m3[a], m3[a], m3[a], m2[a]) * (m2[b], m2[b], m1[b], m1[b])
+	template<int A, int B>
+	__m128 SubDeterminants(__m128 column1, __m128 column2, __m128 column3) noexcept
+	{
+		const __m128 upperA = _mm_shuffle_ps(column3, column2, _MM_SHUFFLE(A, A, A, A));
+		const __m128 upperB = _mm_shuffle_ps(column3, column2, _MM_SHUFFLE(B, B, B, B));
+
+		const __m128 lowerA = _mm_shuffle_ps(column2, column1, _MM_SHUFFLE(A, A, A, A));
+		const __m128 lowerB = _mm_shuffle_ps(column2, column1, _MM_SHUFFLE(B, B, B, B));
+
+		const __m128 product0 = _mm_mul_ps(lowerA, _mm_shuffle_ps(upperB, upperB, _MM_SHUFFLE(2, 0, 0, 0)));
+		const __m128 product1 = _mm_mul_ps(_mm_shuffle_ps(upperA, upperA, _MM_SHUFFLE(2, 0, 0, 0)), lowerB);
+
+		return _mm_sub_ps(product0, product1);
+	}
+
+	// (m1[row], m0[row], m0[row], m0[row])
+	template<int Row>
+	__m128 SplatRow(__m128 column0, __m128 column1) noexcept
+	{
+		const __m128 tmp = _mm_shuffle_ps(column1, column0, _MM_SHUFFLE(Row, Row, Row, Row));
+
+		return _mm_shuffle_ps(tmp, tmp, _MM_SHUFFLE(2, 2, 2, 0));
+	}
+
+	bool Matrix4InverseSSE2(float* result, float const* matrix) noexcept
+	{
+		const __m128 column0 = _mm_loadu_ps(matrix);
+		const __m128 column1 = _mm_loadu_ps(matrix + 4);
+		const __m128 column2 = _mm_loadu_ps(matrix + 8);
+		const __m128 column3 = _mm_loadu_ps(matrix + 12);
+
+		const __m128 factor0 = SubDeterminants<2, 3>(column1, column2, column3);
+		const __m128 factor1 = SubDeterminants<1, 3>(column1, column2, column3);
+		const __m128 factor2 = SubDeterminants<1, 2>(column1, column2, column3);
+		const __m128 factor3 = SubDeterminants<0, 3>(column1, column2, column3);
+		const __m128 factor4 = SubDeterminants<0, 2>(column1, column2, column3);
+		const __m128 factor5 = SubDeterminants<0, 1>(column1, column2, column3);
+
+		const __m128 row0 = SplatRow<0>(column0, column1);
+		const __m128 row1 = SplatRow<1>(column0, column1);
+		const __m128 row2 = SplatRow<2>(column0, column1);
+		const __m128 row3 = SplatRow<3>(column0, column1);
+
+		const __m128 signA = _mm_set_ps(-1.0f, 1.0f, -1.0f, 1.0f);
+		const __m128 signB = _mm_set_ps(1.0f, -1.0f, 1.0f, -1.0f);
+
+		// Adjugate columns
+		__m128 adjugate0 = _mm_sub_ps(_mm_mul_ps(row1, factor0), _mm_mul_ps(row2, factor1));
+		adjugate0 = _mm_mul_ps(_mm_add_ps(adjugate0, _mm_mul_ps(row3, factor2)), signA);
+
+		__m128 adjugate1 = _mm_sub_ps(_mm_mul_ps(row0, factor0), _mm_mul_ps(row2, factor3));
+		adjugate1 = _mm_mul_ps(_mm_add_ps(adjugate1, _mm_mul_ps(row3, factor4)), signB);
+
+		__m128 adjugate2 = _mm_sub_ps(_mm_mul_ps(row0, factor1), _mm_mul_ps(row1, factor3));
+		adjugate2 = _mm_mul_ps(_mm_add_ps(adjugate2, _mm_mul_ps(row3, factor5)), signA);
+
+		__m128 adjugate3 = _mm_sub_ps(_mm_mul_ps(row0, factor2), _mm_mul_ps(row1, factor4));
+		adjugate3 = _mm_mul_ps(_mm_add_ps(adjugate3, _mm_mul_ps(row2, factor5)), signB);
+
+		// First element of each adjugate column
+		const __m128 adjugate01 = _mm_shuffle_ps(adjugate0, adjugate1, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 adjugate23 = _mm_shuffle_ps(adjugate2, adjugate3, _MM_SHUFFLE(0, 0, 0, 0));
+		const __m128 firstRow = _mm_shuffle_ps(adjugate01, adjugate23, _MM_SHUFFLE(2, 0, 2, 0));
+
+		// (x + y) + (z + w)
+		const __m128 products = _mm_mul_ps(column0, firstRow);
+		const __m128 pairs = _mm_add_ps(products, _mm_shuffle_ps(products, products, _MM_SHUFFLE(2, 3, 0, 1)));
+		const __m128 determinant = _mm_add_ps(pairs, _mm_shuffle_ps(pairs, pairs, _MM_SHUFFLE(1, 0, 3, 2)));
+
+		if (_mm_cvtss_f32(determinant) == 0.0f)
+			return false;
+
+		const __m128 oneOverDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), determinant);
+
+		_mm_storeu_ps(result, _mm_mul_ps(adjugate0, oneOverDeterminant));
+		_mm_storeu_ps(result + 4, _mm_mul_ps(adjugate1, oneOverDeterminant));
+		_mm_storeu_ps(result + 8, _mm_mul_ps(adjugate2, oneOverDeterminant));
+		_mm_storeu_ps(result + 12, _mm_mul_ps(adjugate3, oneOverDeterminant));
+
+		return true;
+	}
+
+	void Matrix4TransformVector3SSE2(float* result, float const* vectors, size_t count, float const* matrix, float w) noexcept
+	{
+		const __m128 column0 = _mm_loadu_ps(matrix);
+		const __m128 column1 = _mm_loadu_ps(matrix + 4);
+		const __m128 column2 = _mm_loadu_ps(matrix + 8);
+		const __m128 column3 = _mm_mul_ps(_mm_loadu_ps(matrix + 12), _mm_set1_ps(w));
+
+		for (size_t n = 0; n < count; ++n)
+		{
+			float const* vector = vectors + n * 3;
+			float* output = result + n * 3;
+
+			__m128 sum = _mm_mul_ps(column0, _mm_set1_ps(vector[0]));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column1, _mm_set1_ps(vector[1])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column2, _mm_set1_ps(vector[2])));
+			sum = _mm_add_ps(sum, column3);
+
+			// Store exactly 3 floats, a 16 byte store would overwrite the next input
+			_mm_storel_pi(reinterpret_cast<__m64*>(output), sum);
+			_mm_store_ss(output + 2, _mm_movehl_ps(sum, sum));
+		}
+	}
+
+	void Matrix4TransformVector4SSE2(float* result, float const* vectors, size_t count, float const* matrix) noexcept
+	{
+		const __m128 column0 = _mm_loadu_ps(matrix);
+		const __m128 column1 = _mm_loadu_ps(matrix + 4);
+		const __m128 column2 = _mm_loadu_ps(matrix + 8);
+		const __m128 column3 = _mm_loadu_ps(matrix + 12);
+
+		for (size_t n = 0; n < count; ++n)
+		{
+			const __m128 vector = _mm_loadu_ps(vectors + n * 4);
+
+			__m128 sum = _mm_mul_ps(column0, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0)));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column1, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1))));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column2, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2))));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column3, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 3, 3, 3))));
+
+			_mm_storeu_ps(result + n * 4, sum);
+		}
+	}
+
+	LIBMATH_TARGET_AVX
+	void Matrix4TransformVector4AVX(float* result, float const* vectors, size_t count, float const* matrix) noexcept
+	{
+		// Each 128 bit lane holds one vector, 2 vectors per iteration
+		const __m256 column0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(matrix));
+		const __m256 column1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(matrix + 4));
+		const __m256 column2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(matrix + 8));
+		const __m256 column3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(matrix + 12));
+
+		size_t n = 0;
+
+		for (; n + 2 <= count; n += 2)
+		{
+			const __m256 vector = _mm256_loadu_ps(vectors + n * 4);
+
+			__m256 sum = _mm256_mul_ps(column0, _mm256_permute_ps(vector, _MM_SHUFFLE(0, 0, 0, 0)));
+			sum = _mm256_add_ps(sum, _mm256_mul_ps(column1, _mm256_permute_ps(vector, _MM_SHUFFLE(1, 1, 1, 1))));
+			sum = _mm256_add_ps(sum, _mm256_mul_ps(column2, _mm256_permute_ps(vector, _MM_SHUFFLE(2, 2, 2, 2))));
+			sum = _mm256_add_ps(sum, _mm256_mul_ps(column3, _mm256_permute_ps(vector, _MM_SHUFFLE(3, 3, 3, 3))));
+
+			_mm256_storeu_ps(result + n * 4, sum);
+		}
+
+		Matrix4TransformVector4SSE2(result + n * 4, vectors + n * 4, count - n, matrix);
+	}
+
+	inline __m128 Select(__m128 mask, __m128 ifTrue, __m128 ifFalse) noexcept
+	{
+		return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+	}
+
+	// a.x * b.x + a.y * b.y + a.z * b.z, 4 lanes
+	inline __m128 Dot3(__m128 const (&a)[4], __m128 const (&b)[4]) noexcept
+	{
+		return _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[0], b[0]), _mm_mul_ps(a[1], b[1])), _mm_mul_ps(a[2], b[2]));
+	}
+
+	// Column 'column' of 4 consecutive matrices to one register per row
+	inline void LoadColumn(__m128 (&rows)[4], float const* matrices, int column) noexcept
+	{
+		rows[0] = _mm_loadu_ps(matrices + column * 4);
+		rows[1] = _mm_loadu_ps(matrices + 16 + column * 4);
+		rows[2] = _mm_loadu_ps(matrices + 32 + column * 4);
+		rows[3] = _mm_loadu_ps(matrices + 48 + column * 4);
+
+		_MM_TRANSPOSE4_PS(rows[0], rows[1], rows[2], rows[3]);
+	}
+
+	// Column 'column' of 4 consecutive 3x3 matrices, the 4th row is 0
+	inline void LoadColumn3(__m128 (&rows)[4], float const* matrices, int column) noexcept
+	{
+		for (int row = 0; row < 3; ++row)
+			rows[row] = _mm_setr_ps(matrices[column * 3 + row], matrices[9 + column * 3 + row], matrices[18 + column * 3 + row], matrices[27 + column * 3 + row]);
+
+		rows[3] = _mm_setzero_ps();
+	}
+
+	inline void StoreColumn(float* matrices, int column, __m128 row0, __m128 row1, __m128 row2, __m128 row3) noexcept
+	{
+		_MM_TRANSPOSE4_PS(row0, row1, row2, row3);
+
+		_mm_storeu_ps(matrices + column * 4, row0);
+		_mm_storeu_ps(matrices + 16 + column * 4, row1);
+		_mm_storeu_ps(matrices + 32 + column * 4, row2);
+		_mm_storeu_ps(matrices + 48 + column * 4, row3);
+	}
+
+	// (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3) to x, y & z registers
+	inline void LoadVector3(__m128& x, __m128& y, __m128& z, float const* vectors) noexcept
+	{
+		const __m128 packed0 = _mm_loadu_ps(vectors);
+		const __m128 packed1 = _mm_loadu_ps(vectors + 4);
+		const __m128 packed2 = _mm_loadu_ps(vectors + 8);
+
+		x = _mm_shuffle_ps(packed0, _mm_shuffle_ps(packed1, packed2, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		y = _mm_shuffle_ps(_mm_shuffle_ps(packed0, packed1, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(packed1, packed2, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		z = _mm_shuffle_ps(_mm_shuffle_ps(packed0, packed1, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(packed2, packed2, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	inline void StoreVector3(float* vectors, __m128 x, __m128 y, __m128 z) noexcept
+	{
+		const __m128 xyLow = _mm_unpacklo_ps(x, y);
+		const __m128 xyHigh = _mm_unpackhi_ps(x, y);
+
+		_mm_storeu_ps(vectors, _mm_shuffle_ps(xyLow, _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+		_mm_storeu_ps(vectors + 4, _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), xyHigh, _MM_SHUFFLE(1, 0, 2, 0)));
+		_mm_storeu_ps(vectors + 8, _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+	}
+
+	// Column lengths, the x scale is negated for a negative determinant
+	inline void ColumnScales(__m128& scaleX, __m128& scaleY, __m128& scaleZ, __m128 const (&column0)[4], __m128 const (&column1)[4], __m128 const (&column2)[4]) noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+
+		scaleX = _mm_sqrt_ps(Dot3(column0, column0));
+		scaleY = _mm_sqrt_ps(Dot3(column1, column1));
+		scaleZ = _mm_sqrt_ps(Dot3(column2, column2));
+
+		const __m128 cross[4] =
+		{
+			_mm_sub_ps(_mm_mul_ps(column1[1], column2[2]), _mm_mul_ps(column1[2], column2[1])),
+			_mm_sub_ps(_mm_mul_ps(column1[2], column2[0]), _mm_mul_ps(column1[0], column2[2])),
+			_mm_sub_ps(_mm_mul_ps(column1[0], column2[1]), _mm_mul_ps(column1[1], column2[0])),
+			zero
+		};
+
+		scaleX = _mm_xor_ps(scaleX, _mm_and_ps(_mm_cmplt_ps(Dot3(column0, cross), zero), _mm_set1_ps(-0.0f)));
+	}
+
+	// quaternion::FromScaledBasis lane by lane: the columns divided by the scales (axes) & Shepperd's method, identity where nonZero is clear
+	inline void ScaledBasisRotation(__m128& x, __m128& y, __m128& z, __m128& w, __m128 (&axis0)[4], __m128 (&axis1)[4], __m128 (&axis2)[4],
+		__m128 const (&column0)[4], __m128 const (&column1)[4], __m128 const (&column2)[4], __m128 scaleX, __m128 scaleY, __m128 scaleZ, __m128 nonZero) noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 two = _mm_set1_ps(2.0f);
+		const __m128 quarter = _mm_set1_ps(0.25f);
+		const __m128 signBit = _mm_set1_ps(-0.0f);
+
+		for (int i = 0; i < 3; ++i)
+		{
+			axis0[i] = _mm_div_ps(column0[i], scaleX);
+			axis1[i] = _mm_div_ps(column1[i], scaleY);
+			axis2[i] = _mm_div_ps(column2[i], scaleZ);
+		}
+
+		axis0[3] = axis1[3] = axis2[3] = zero;
+
+		// Shepperd's method, the branch of each lane as a mask
+		const __m128 m00 = axis0[0];
+		const __m128 m11 = axis1[1];
+		const __m128 m22 = axis2[2];
+
+		const __m128 caseW = _mm_cmpgt_ps(_mm_add_ps(_mm_add_ps(m00, m11), m22), zero);
+		const __m128 caseX = _mm_andnot_ps(caseW, _mm_and_ps(_mm_cmpgt_ps(m00, m11), _mm_cmpgt_ps(m00, m22)));
+		const __m128 caseY = _mm_andnot_ps(_mm_or_ps(caseW, caseX), _mm_cmpgt_ps(m11, m22));
+		const __m128 caseZ = _mm_andnot_ps(_mm_or_ps(_mm_or_ps(caseW, caseX), caseY), _mm_castsi128_ps(_mm_set1_epi32(-1)));
+
+		// 1 +- m00 +- m11 +- m22, adding a negated value is the same as subtracting it
+		const __m128 diagonal = _mm_add_ps(_mm_add_ps(_mm_add_ps(one,
+			_mm_xor_ps(m00, _mm_and_ps(_mm_or_ps(caseY, caseZ), signBit))),
+			_mm_xor_ps(m11, _mm_and_ps(_mm_or_ps(caseX, caseZ), signBit))),
+			_mm_xor_ps(m22, _mm_and_ps(_mm_or_ps(caseX, caseY), signBit)));
+
+		const __m128 fourQ = _mm_mul_ps(_mm_sqrt_ps(diagonal), two);
+		const __m128 largest = _mm_mul_ps(fourQ, quarter);
+
+		const __m128 wx = _mm_sub_ps(axis1[2], axis2[1]);
+		const __m128 wy = _mm_sub_ps(axis2[0], axis0[2]);
+		const __m128 wz = _mm_sub_ps(axis0[1], axis1[0]);
+		const __m128 xy = _mm_add_ps(axis1[0], axis0[1]);
+		const __m128 xz = _mm_add_ps(axis2[0], axis0[2]);
+		const __m128 yz = _mm_add_ps(axis2[1], axis1[2]);
+
+		w = Select(caseW, largest, _mm_div_ps(Select(caseX, wx, Select(caseY, wy, wz)), fourQ));
+		x = Select(caseX, largest, _mm_div_ps(Select(caseW, wx, Select(caseY, xy, xz)), fourQ));
+		y = Select(caseY, largest, _mm_div_ps(Select(caseW, wy, Select(caseX, xy, yz)), fourQ));
+		z = Select(caseZ, largest, _mm_div_ps(Select(caseW, wz, Select(caseX, xz, yz)), fourQ));
+
+		const __m128 lengthSquared = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(w, w), _mm_mul_ps(x, x)), _mm_mul_ps(y, y)), _mm_mul_ps(z, z));
+		__m128 inverseLength = _mm_div_ps(one, _mm_sqrt_ps(lengthSquared));
+
+		inverseLength = _mm_xor_ps(inverseLength, _mm_and_ps(_mm_cmplt_ps(w, zero), signBit));
+
+		// Identity rotation for a zero scale
+		w = Select(nonZero, _mm_mul_ps(w, inverseLength), one);
+		x = _mm_and_ps(nonZero, _mm_mul_ps(x, inverseLength));
+		y = _mm_and_ps(nonZero, _mm_mul_ps(y, inverseLength));
+		z = _mm_and_ps(nonZero, _mm_mul_ps(z, inverseLength));
+	}
+
+	// Rotations of 3 transposed columns to 4 quaternions stored as (x, y, z, w)
+	inline void StoreRotations(float* rotations, __m128 const (&column0)[4], __m128 const (&column1)[4], __m128 const (&column2)[4]) noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+
+		__m128 scaleX, scaleY, scaleZ;
+		ColumnScales(scaleX, scaleY, scaleZ, column0, column1, column2);
+
+		const __m128 nonZero = _mm_and_ps(_mm_and_ps(_mm_cmpneq_ps(scaleX, zero), _mm_cmpneq_ps(scaleY, zero)), _mm_cmpneq_ps(scaleZ, zero));
+
+		__m128 axis0[4], axis1[4], axis2[4];
+		__m128 x, y, z, w;
+
+		ScaledBasisRotation(x, y, z, w, axis0, axis1, axis2, column0, column1, column2, scaleX, scaleY, scaleZ, nonZero);
+
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+
+		_mm_storeu_ps(rotations, x);
+		_mm_storeu_ps(rotations + 4, y);
+		_mm_storeu_ps(rotations + 8, z);
+		_mm_storeu_ps(rotations + 12, w);
+	}
+
+	void Matrix4ComposeTRSSSE2(float* result, float const* translations, float const* rotations, float const* scales, size_t count) noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 two = _mm_set1_ps(2.0f);
+
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			__m128 tx, ty, tz;
+			__m128 sx, sy, sz;
+
+			LoadVector3(tx, ty, tz, translations + n * 3);
+			LoadVector3(sx, sy, sz, scales + n * 3);
+
+			__m128 x = _mm_loadu_ps(rotations + n * 4);
+			__m128 y = _mm_loadu_ps(rotations + n * 4 + 4);
+			__m128 z = _mm_loadu_ps(rotations + n * 4 + 8);
+			__m128 w = _mm_loadu_ps(rotations + n * 4 + 12);
+
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			const __m128 xx = _mm_mul_ps(x, x);
+			const __m128 yy = _mm_mul_ps(y, y);
+			const __m128 zz = _mm_mul_ps(z, z);
+			const __m128 xy = _mm_mul_ps(x, y);
+			const __m128 xz = _mm_mul_ps(x, z);
+			const __m128 yz = _mm_mul_ps(y, z);
+			const __m128 wx = _mm_mul_ps(w, x);
+			const __m128 wy = _mm_mul_ps(w, y);
+			const __m128 wz = _mm_mul_ps(w, z);
+
+			float* output = result + n * 16;
+
+			StoreColumn(output, 0,
+				_mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(yy, zz))), sx),
+				_mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xy, wz)), sx),
+				_mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xz, wy)), sx),
+				zero);
+
+			StoreColumn(output, 1,
+				_mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(xy, wz)), sy),
+				_mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, zz))), sy),
+				_mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(yz, wx)), sy),
+				zero);
+
+			StoreColumn(output, 2,
+				_mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(xz, wy)), sz),
+				_mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(yz, wx)), sz),
+				_mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(xx, yy))), sz),
+				zero);
+
+			StoreColumn(output, 3, tx, ty, tz, one);
+		}
+
+		Matrix4ComposeTRSScalar(result + n * 16, translations + n * 3, rotations + n * 4, scales + n * 3, count - n);
+	}
+
+	size_t Matrix4DecomposeSSE2(float* translations, float* rotations, float* scales, float const* matrices, size_t count) noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 signBit = _mm_set1_ps(-0.0f);
+		const __m128 tolerance = _mm_set1_ps(INNACURATE_EPSILON);
+
+		size_t failures = 0;
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			float const* input = matrices + n * 16;
+
+			__m128 column0[4], column1[4], column2[4], column3[4];
+
+			LoadColumn(column0, input, 0);
+			LoadColumn(column1, input, 1);
+			LoadColumn(column2, input, 2);
+			LoadColumn(column3, input, 3);
+
+			__m128 scaleX, scaleY, scaleZ;
+			ColumnScales(scaleX, scaleY, scaleZ, column0, column1, column2);
+
+			const __m128 nonZero = _mm_and_ps(_mm_and_ps(_mm_cmpneq_ps(scaleX, zero), _mm_cmpneq_ps(scaleY, zero)), _mm_cmpneq_ps(scaleZ, zero));
+
+			__m128 axis0[4], axis1[4], axis2[4];
+			__m128 x, y, z, w;
+
+			ScaledBasisRotation(x, y, z, w, axis0, axis1, axis2, column0, column1, column2, scaleX, scaleY, scaleZ, nonZero);
+
+			// Shear & projection
+			const __m128 orthogonal = _mm_and_ps(_mm_and_ps(
+				_mm_cmple_ps(_mm_andnot_ps(signBit, Dot3(axis0, axis1)), tolerance),
+				_mm_cmple_ps(_mm_andnot_ps(signBit, Dot3(axis0, axis2)), tolerance)),
+				_mm_cmple_ps(_mm_andnot_ps(signBit, Dot3(axis1, axis2)), tolerance));
+
+			const __m128 affine = _mm_and_ps(
+				_mm_and_ps(_mm_cmpeq_ps(column0[3], zero), _mm_cmpeq_ps(column1[3], zero)),
+				_mm_and_ps(_mm_cmpeq_ps(column2[3], zero), _mm_cmpeq_ps(column3[3], one)));
+
+			const __m128 valid = _mm_and_ps(_mm_and_ps(nonZero, orthogonal), affine);
+
+			failures += 4 - std::popcount(static_cast<unsigned int>(_mm_movemask_ps(valid)));
+
+			StoreVector3(translations + n * 3, column3[0], column3[1], column3[2]);
+			StoreVector3(scales + n * 3, scaleX, scaleY, scaleZ);
+
+			_MM_TRANSPOSE4_PS(x, y, z, w);
+
+			_mm_storeu_ps(rotations + n * 4, x);
+			_mm_storeu_ps(rotations + n * 4 + 4, y);
+			_mm_storeu_ps(rotations + n * 4 + 8, z);
+			_mm_storeu_ps(rotations + n * 4 + 12, w);
+		}
+
+		return failures + Matrix4DecomposeScalar(translations + n * 3, rotations + n * 4, scales + n * 3, matrices + n * 16, count - n);
+	}
+
+	void Matrix3ToQuaternionSSE2(float* rotations, float const* matrices, size_t count) noexcept
+	{
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			__m128 column0[4], column1[4], column2[4];
+
+			LoadColumn3(column0, matrices + n * 9, 0);
+			LoadColumn3(column1, matrices + n * 9, 1);
+			LoadColumn3(column2, matrices + n * 9, 2);
+
+			StoreRotations(rotations + n * 4, column0, column1, column2);
+		}
+
+		Matrix3ToQuaternionScalar(rotations + n * 4, matrices + n * 9, count - n);
+	}
+
+	void Matrix4ToQuaternionSSE2(float* rotations, float const* matrices, size_t count) noexcept
+	{
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			__m128 column0[4], column1[4], column2[4];
+
+			LoadColumn(column0, matrices + n * 16, 0);
+			LoadColumn(column1, matrices + n * 16, 1);
+			LoadColumn(column2, matrices + n * 16, 2);
+
+			StoreRotations(rotations + n * 4, column0, column1, column2);
+		}
+
+		Matrix4ToQuaternionScalar(rotations + n * 4, matrices + n * 16, count - n);
+	}
+
+	// Indexed by math::simd::InstructionSet
+	constexpr Matrix4MultiplyKernel g_matrix4MultiplyKernels[] =
+	{
+		&Matrix4MultiplyScalar,
+		&math::simd::Matrix4MultiplySSE2,
+		&Matrix4MultiplyAVX,
+		&Matrix4MultiplyFMA
+	};
+
+	// A 4x4 inverse does not fill 256 bit registers, the wider sets reuse the SSE2 kernel
+	constexpr Matrix4InverseKernel g_matrix4InverseKernels[] =
+	{
+		&Matrix4InverseScalar,
+		&Matrix4InverseSSE2,
+		&Matrix4InverseSSE2,
+		&Matrix4InverseSSE2
+	};
+
+	// Vector3 loads & stores are scalar, wider registers do not help
+	constexpr Matrix4TransformVector3Kernel g_matrix4TransformVector3Kernels[] =
+	{
+		&Matrix4TransformVector3Scalar,
+		&Matrix4TransformVector3SSE2,
+		&Matrix4TransformVector3SSE2,
+		&Matrix4TransformVector3SSE2
+	};
+
+	// Multiply & add are not fused so the AVX kernel is reused for AVX2 + FMA
+	constexpr Matrix4TransformVector4Kernel g_matrix4TransformVector4Kernels[] =
+	{
+		&Matrix4TransformVector4Scalar,
+		&Matrix4TransformVector4SSE2,
+		&Matrix4TransformVector4AVX,
+		&Matrix4TransformVector4AVX
+	};
+
+	// 3 float strides & a transpose per block of 4, wider registers do not pay for theirs
+	constexpr Matrix4ComposeTRSKernel g_matrix4ComposeTRSKernels[] =
+	{
+		&Matrix4ComposeTRSScalar,
+		&Matrix4ComposeTRSSSE2,
+		&Matrix4ComposeTRSSSE2,
+		&Matrix4ComposeTRSSSE2
+	};
+
+	constexpr Matrix4DecomposeKernel g_matrix4DecomposeKernels[] =
+	{
+		&Matrix4DecomposeScalar,
+		&Matrix4DecomposeSSE2,
+		&Matrix4DecomposeSSE2,
+		&Matrix4DecomposeSSE2
+	};
+
+	constexpr MatrixToQuaternionKernel g_matrix3ToQuaternionKernels[] =
+	{
+		&Matrix3ToQuaternionScalar,
+		&Matrix3ToQuaternionSSE2,
+		&Matrix3ToQuaternionSSE2,
+		&Matrix3ToQuaternionSSE2
+	};
+
+	constexpr MatrixToQuaternionKernel g_matrix4ToQuaternionKernels[] =
+	{
+		&Matrix4ToQuaternionScalar,
+		&Matrix4ToQuaternionSSE2,
+		&Matrix4ToQuaternionSSE2,
+		&Matrix4ToQuaternionSSE2
+	};
+#else
+	constexpr Matrix4MultiplyKernel g_matrix4MultiplyKernels[] =
+	{
+		&Matrix4MultiplyScalar,
+		&Matrix4MultiplyScalar,
+		&Matrix4MultiplyScalar,
+		&Matrix4MultiplyScalar
+	};
+
+	constexpr Matrix4InverseKernel g_matrix4InverseKernels[] =
+	{
+		&Matrix4InverseScalar,
+		&Matrix4InverseScalar,
+		&Matrix4InverseScalar,
+		&Matrix4InverseScalar
+	};
+
+	constexpr Matrix4TransformVector3Kernel g_matrix4TransformVector3Kernels[] =
+	{
+		&Matrix4TransformVector3Scalar,
+		&Matrix4TransformVector3Scalar,
+		&Matrix4TransformVector3Scalar,
+		&Matrix4TransformVector3Scalar
+	};
+
+	constexpr Matrix4TransformVector4Kernel g_matrix4TransformVector4Kernels[] =
+	{
+		&Matrix4TransformVector4Scalar,
+		&Matrix4TransformVector4Scalar,
+		&Matrix4TransformVector4Scalar,
+		&Matrix4TransformVector4Scalar
+	};
+
+	constexpr Matrix4ComposeTRSKernel g_matrix4ComposeTRSKernels[] =
+	{
+		&Matrix4ComposeTRSScalar,
+		&Matrix4ComposeTRSScalar,
+		&Matrix4ComposeTRSScalar,
+		&Matrix4ComposeTRSScalar
+	};
+
+	constexpr Matrix4DecomposeKernel g_matrix4DecomposeKernels[] =
+	{
+		&Matrix4DecomposeScalar,
+		&Matrix4DecomposeScalar,
+		&Matrix4DecomposeScalar,
+		&Matrix4DecomposeScalar
+	};
+
+	constexpr MatrixToQuaternionKernel g_matrix3ToQuaternionKernels[] =
+	{
+		&Matrix3ToQuaternionScalar,
+		&Matrix3ToQuaternionScalar,
+		&Matrix3ToQuaternionScalar,
+		&Matrix3ToQuaternionScalar
+	};
+
+	constexpr MatrixToQuaternionKernel g_matrix4ToQuaternionKernels[] =
+	{
+		&Matrix4ToQuaternionScalar,
+		&Matrix4ToQuaternionScalar,
+		&Matrix4ToQuaternionScalar,
+		&Matrix4ToQuaternionScalar
+	};
+#endif
+}
+
+void math::simd::Matrix4Multiply(float* result, float const* lhs, float const* rhs) noexcept
+{
+	g_matrix4MultiplyKernels[static_cast<int>(ActiveInstructionSet())](result, lhs, rhs);
+}
+
+bool math::simd::Matrix4Inverse(float* result, float const* matrix) noexcept
+{
+	return g_matrix4InverseKernels[static_cast<int>(ActiveInstructionSet())](result, matrix);
+}
+
+void math::simd::Matrix4TransformVector3(float* result, float const* vectors, size_t count, float const* matrix, float w) noexcept
+{
+	g_matrix4TransformVector3Kernels[static_cast<int>(ActiveInstructionSet())](result, vectors, count, matrix, w);
+}
+
+void math::simd::Matrix4TransformVector4(float* result, float const* vectors, size_t count, float const* matrix) noexcept
+{
+	g_matrix4TransformVector4Kernels[static_cast<int>(ActiveInstructionSet())](result, vectors, count, matrix);
+}
+
+void math::simd::Matrix4ComposeTRS(float* result, float const* translations, float const* rotations, float const* scales, size_t count) noexcept
+{
+	g_matrix4ComposeTRSKernels[static_cast<int>(ActiveInstructionSet())](result, translations, rotations, scales, count);
+}
+
+size_t math::simd::Matrix4Decompose(float* translations, float* rotations, float* scales, float const* matrices, size_t count) noexcept
+{
+	return g_matrix4DecomposeKernels[static_cast<int>(ActiveInstructionSet())](translations, rotations, scales, matrices, count);
+}
+
+void math::simd::Matrix3ToQuaternion(float* rotations, float const* matrices, size_t count) noexcept
+{
+	g_matrix3ToQuaternionKernels[static_cast<int>(ActiveInstructionSet())](rotations, matrices, count);
+}
+
+void math::simd::Matrix4ToQuaternion(float* rotations, float const* matrices, size_t count) noexcept
+{
+	g_matrix4ToQuaternionKernels[static_cast<int>(ActiveInstructionSet())](rotations, matrices, count);
+}
@@ -0,0 +1,581 @@
+#include "simd/Simd.h"
+#include "packed/Half.h"
+#include "packed/Octahedral.h"
+#include "packed/PackedQuaternion.h"
+#include "packed/Snorm16.h"
+
+#include <bit>
+
+/*
+*	Packed storage kernels
+*
+*	The scalar kernels call the constexpr conversions of Half, Snorm16,
+*	Octahedral32 & PackedQuaternion. The SSE2 kernels convert 4 values
+*	per iteration, every lane evaluates the operations of the scalar
+*	code in the same order with branches turned into masks, results are
+*	bit for bit identical.
+*
+*	Half conversions only need integer operations & 1 float add, F16C
+*	is not required. Wider registers do not pay for the packing of 16
+*	bit lanes, every instruction set uses the SSE2 kernels.
+*/
+
+namespace
+{
+	using FloatToHalfKernel = void (*)(uint16_t*, float const*, size_t) noexcept;
+	using HalfToFloatKernel = void (*)(float*, uint16_t const*, size_t) noexcept;
+	using FloatToSnorm16Kernel = void (*)(int16_t*, float const*, size_t) noexcept;
+	using Snorm16ToFloatKernel = void (*)(float*, int16_t const*, size_t) noexcept;
+	using OctahedralEncodeKernel = void (*)(int16_t*, float const*, size_t) noexcept;
+	using OctahedralDecodeKernel = void (*)(float*, int16_t const*, size_t) noexcept;
+	using QuaternionEncodeKernel = void (*)(uint16_t*, float const*, size_t) noexcept;
+	using QuaternionDecodeKernel = void (*)(float*, uint16_t const*, size_t) noexcept;
+
+	void FloatToHalfScalar(uint16_t* result, float const* values, size_t count) noexcept
+	{
+		for (size_t n = 0; n < count; ++n)
+			result[n] = math::Half(values[n]).Bits();
+	}
+
+	void HalfToFloatScalar(float* result, uint16_t const* values, size_t count) noexcept
+	{
+		for (size_t n = 0; n < count; ++n)
+			result[n] = static_cast<float>(math::Half::FromBits(values[n]));
+	}
+
+	void FloatToSnorm16Scalar(int16_t* result, float const* values, size_t count) noexcept
+	{
+		for (size_t n = 0; n < count; ++n)
+			result[n] = math::Snorm16(values[n]).Bits();
+	}
+
+	void Snorm16ToFloatScalar(float* result, int16_t const* values, size_t count) noexcept
+	{
+		for (size_t n = 0; n < count; ++n)
+			result[n] = static_cast<float>(math::Snorm16::FromBits(values[n]));
+	}
+
+	void OctahedralEncodeScalar(int16_t* result, float const* vectors, size_t count) noexcept
+	{
+		for (size_t n = 0; n < count; ++n)
+		{
+			const math::Octahedral32 octahedral(math::Vector3<float>(vectors[n * 3], vectors[n * 3 + 1], vectors[n * 3 + 2]));
+
+			result[n * 2] = octahedral.U().Bits();
+			result[n * 2 + 1] = octahedral.V().Bits();
+		}
+	}
+
+	void OctahedralDecodeScalar(float* result, int16_t const* values, size_t count) noexcept
+	{
+		for (size_t n = 0; n < count; ++n)
+		{
+			const math::Octahedral32 octahedral(math::Snorm16::FromBits(values[n * 2]), math::Snorm16::FromBits(values[n * 2 + 1]));
+			const math::Vector3<float> vector = static_cast<math::Vector3<float>>(octahedral);
+
+			result[n * 3] = vector[0];
+			result[n * 3 + 1] = vector[1];
+			result[n * 3 + 2] = vector[2];
+		}
+	}
+
+	template<unsigned int ComponentBits>
+	void QuaternionEncodeScalar(uint16_t* result, float const* quaternions, size_t count) noexcept
+	{
+		constexpr size_t wordCount = math::PackedQuaternion<ComponentBits>::WordCount;
+
+		for (size_t n = 0; n < count; ++n)
+		{
+			float const* quaternion = quaternions + n * 4;
+			const uint64_t bits = math::PackedQuaternion<ComponentBits>(math::Quaternion<float>(quaternion[3], quaternion[0], quaternion[1], quaternion[2])).Bits();
+
+			for (size_t i = 0; i < wordCount; ++i)
+				result[n * wordCount + i] = static_cast<uint16_t>(bits >> (16 * i));
+		}
+	}
+
+	template<unsigned int ComponentBits>
+	void QuaternionDecodeScalar(float* result, uint16_t const* values, size_t count) noexcept
+	{
+		constexpr size_t wordCount = math::PackedQuaternion<ComponentBits>::WordCount;
+
+		for (size_t n = 0; n < count; ++n)
+		{
+			uint64_t bits = 0;
+
+			for (size_t i = 0; i < wordCount; ++i)
+				bits |= static_cast<uint64_t>(values[n * wordCount + i]) << (16 * i);
+
+			const math::Quaternion<float> quaternion = static_cast<math::Quaternion<float>>(math::PackedQuaternion<ComponentBits>::FromBits(bits));
+
+			result[n * 4] = quaternion[1];
+			result[n * 4 + 1] = quaternion[2];
+			result[n * 4 + 2] = quaternion[3];
+			result[n * 4 + 3] = quaternion[0];
+		}
+	}
+
+#if LIBMATH_SIMD_SSE2
+	inline __m128i Select(__m128i mask, __m128i ifTrue, __m128i ifFalse) noexcept
+	{
+		return _mm_or_si128(_mm_and_si128(mask, ifTrue), _mm_andnot_si128(mask, ifFalse));
+	}
+
+	inline __m128 Select(__m128 mask, __m128 ifTrue, __m128 ifFalse) noexcept
+	{
+		return _mm_or_ps(_mm_and_ps(mask, ifTrue), _mm_andnot_ps(mask, ifFalse));
+	}
+
+	inline __m128 Abs(__m128 value) noexcept
+	{
+		return _mm_andnot_ps(_mm_set1_ps(-0.0f), value);
+	}
+
+	// 4 int32 holding 16 bit values to 4 packed 16 bit lanes in the low 64 bits, sign extended so packs does not saturate
+	inline __m128i Pack16(__m128i values) noexcept
+	{
+		const __m128i extended = _mm_srai_epi32(_mm_slli_epi32(values, 16), 16);
+
+		return _mm_packs_epi32(extended, extended);
+	}
+
+	// Snorm16(value) without the final narrowing, 4 int32 in [-32767, 32767]
+	inline __m128i EncodeSnorm16(__m128 values) noexcept
+	{
+		const __m128 magic = _mm_set1_ps(SNORM_ROUND_MAGIC);
+		const __m128 clamped = _mm_min_ps(_mm_max_ps(values, _mm_set1_ps(-1.0f)), _mm_set1_ps(1.0f));
+
+		return _mm_cvttps_epi32(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(clamped, _mm_set1_ps(32767.0f)), magic), magic));
+	}
+
+	inline __m128 DecodeSnorm16(__m128i values) noexcept
+	{
+		return _mm_max_ps(_mm_div_ps(_mm_cvtepi32_ps(values), _mm_set1_ps(32767.0f)), _mm_set1_ps(-1.0f));
+	}
+
+	void FloatToHalfSSE2(uint16_t* result, float const* values, size_t count) noexcept
+	{
+		const __m128i signMask = _mm_set1_epi32(static_cast<int>(0x80000000u));
+
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			const __m128i bits = _mm_castps_si128(_mm_loadu_ps(values + n));
+			const __m128i sign = _mm_and_si128(bits, signMask);
+			const __m128i absolute = _mm_xor_si128(bits, sign);
+
+			// absolute is below 2^31, signed compares are fine
+			const __m128i isInfinityOrNaN = _mm_cmpgt_epi32(absolute, _mm_set1_epi32(0x477fffff));
+			const __m128i isNaN = _mm_cmpgt_epi32(absolute, _mm_set1_epi32(0x7f800000));
+			const __m128i isDenormal = _mm_cmpgt_epi32(_mm_set1_epi32(0x38800000), absolute);
+
+			const __m128i special = Select(isNaN, _mm_set1_epi32(0x7e00), _mm_set1_epi32(0x7c00));
+			const __m128i denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(absolute), _mm_set1_ps(0.5f))), _mm_set1_epi32(0x3f000000));
+
+			const __m128i odd = _mm_and_si128(_mm_srli_epi32(absolute, 13), _mm_set1_epi32(1));
+			const __m128i normal = _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(absolute, _mm_set1_epi32(static_cast<int>(0xc8000fffu))), odd), 13);
+
+			const __m128i half = _mm_or_si128(Select(isInfinityOrNaN, special, Select(isDenormal, denormal, normal)), _mm_srli_epi32(sign, 16));
+
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(result + n), Pack16(half));
+		}
+
+		FloatToHalfScalar(result + n, values + n, count - n);
+	}
+
+	void HalfToFloatSSE2(float* result, uint16_t const* values, size_t count) noexcept
+	{
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			const __m128i half = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<__m128i const*>(values + n)), _mm_setzero_si128());
+			const __m128i exponent = _mm_and_si128(half, _mm_set1_epi32(0x7c00));
+			const __m128i bits = _mm_add_epi32(_mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x7fff)), 13), _mm_set1_epi32(0x38000000));
+
+			const __m128i infinityOrNaN = _mm_add_epi32(bits, _mm_set1_epi32(0x38000000));
+			const __m128i denormal = _mm_castps_si128(_mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(bits, _mm_set1_epi32(0x00800000))), _mm_castsi128_ps(_mm_set1_epi32(0x38800000))));
+
+			const __m128i isInfinityOrNaN = _mm_cmpeq_epi32(exponent, _mm_set1_epi32(0x7c00));
+			const __m128i isDenormal = _mm_cmpeq_epi32(exponent, _mm_setzero_si128());
+
+			const __m128i single = Select(isInfinityOrNaN, infinityOrNaN, Select(isDenormal, denormal, bits));
+
+			_mm_storeu_ps(result + n, _mm_castsi128_ps(_mm_or_si128(single, _mm_slli_epi32(_mm_and_si128(half, _mm_set1_epi32(0x8000)), 16))));
+		}
+
+		HalfToFloatScalar(result + n, values + n, count - n);
+	}
+
+	void FloatToSnorm16SSE2(int16_t* result, float const* values, size_t count) noexcept
+	{
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(result + n), Pack16(EncodeSnorm16(_mm_loadu_ps(values + n))));
+
+		FloatToSnorm16Scalar(result + n, values + n, count - n);
+	}
+
+	void Snorm16ToFloatSSE2(float* result, int16_t const* values, size_t count) noexcept
+	{
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			const __m128i packed = _mm_loadl_epi64(reinterpret_cast<__m128i const*>(values + n));
+
+			_mm_storeu_ps(result + n, DecodeSnorm16(_mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16)));
+		}
+
+		Snorm16ToFloatScalar(result + n, values + n, count - n);
+	}
+
+	void OctahedralEncodeSSE2(int16_t* result, float const* vectors, size_t count) noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 signBit = _mm_set1_ps(-0.0f);
+
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			float const* input = vectors + n * 3;
+
+			// (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3) to x, y & z registers
+			const __m128 packed0 = _mm_loadu_ps(input);
+			const __m128 packed1 = _mm_loadu_ps(input + 4);
+			const __m128 packed2 = _mm_loadu_ps(input + 8);
+
+			const __m128 x = _mm_shuffle_ps(packed0, _mm_shuffle_ps(packed1, packed2, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+			const __m128 y = _mm_shuffle_ps(_mm_shuffle_ps(packed0, packed1, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(packed1, packed2, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+			const __m128 z = _mm_shuffle_ps(_mm_shuffle_ps(packed0, packed1, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(packed2, packed2, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+			const __m128 length = _mm_add_ps(_mm_add_ps(Abs(x), Abs(y)), Abs(z));
+			const __m128 u = _mm_div_ps(x, length);
+			const __m128 v = _mm_div_ps(y, length);
+
+			const __m128 foldedU = _mm_sub_ps(one, Abs(v));
+			const __m128 foldedV = _mm_sub_ps(one, Abs(u));
+			const __m128 isLower = _mm_cmplt_ps(z, zero);
+
+			const __m128 resultU = Select(isLower, Select(_mm_cmpge_ps(u, zero), foldedU, _mm_xor_ps(foldedU, signBit)), u);
+			const __m128 resultV = Select(isLower, Select(_mm_cmpge_ps(v, zero), foldedV, _mm_xor_ps(foldedV, signBit)), v);
+
+			// (u0 v0 u1 v1 u2 v2 u3 v3)
+			const __m128i encodedU = EncodeSnorm16(resultU);
+			const __m128i encodedV = EncodeSnorm16(resultV);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(result + n * 2), _mm_packs_epi32(_mm_unpacklo_epi32(encodedU, encodedV), _mm_unpackhi_epi32(encodedU, encodedV)));
+		}
+
+		OctahedralEncodeScalar(result + n * 2, vectors + n * 3, count - n);
+	}
+
+	void OctahedralDecodeSSE2(float* result, int16_t const* values, size_t count) noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 signBit = _mm_set1_ps(-0.0f);
+
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			// (u0 v0 u1 v1) & (u2 v2 u3 v3) to u & v registers
+			const __m128i packed = _mm_loadu_si128(reinterpret_cast<__m128i const*>(values + n * 2));
+			const __m128 low = DecodeSnorm16(_mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16));
+			const __m128 high = DecodeSnorm16(_mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16));
+
+			__m128 x = _mm_shuffle_ps(low, high, _MM_SHUFFLE(2, 0, 2, 0));
+			__m128 y = _mm_shuffle_ps(low, high, _MM_SHUFFLE(3, 1, 3, 1));
+			const __m128 z = _mm_sub_ps(_mm_sub_ps(one, Abs(x)), Abs(y));
+
+			const __m128 fold = _mm_max_ps(_mm_xor_ps(z, signBit), zero);
+
+			x = Select(_mm_cmpge_ps(x, zero), _mm_sub_ps(x, fold), _mm_add_ps(x, fold));
+			y = Select(_mm_cmpge_ps(y, zero), _mm_sub_ps(y, fold), _mm_add_ps(y, fold));
+
+			const __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+			const __m128 rx = _mm_div_ps(x, length);
+			const __m128 ry = _mm_div_ps(y, length);
+			const __m128 rz = _mm_div_ps(z, length);
+
+			// Back to packed Vector3
+			float* output = result + n * 3;
+
+			const __m128 xyLow = _mm_unpacklo_ps(rx, ry);
+			const __m128 xyHigh = _mm_unpackhi_ps(rx, ry);
+
+			_mm_storeu_ps(output, _mm_shuffle_ps(xyLow, _mm_shuffle_ps(rz, rx, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+			_mm_storeu_ps(output + 4, _mm_shuffle_ps(_mm_shuffle_ps(ry, rz, _MM_SHUFFLE(1, 1, 1, 1)), xyHigh, _MM_SHUFFLE(1, 0, 2, 0)));
+			_mm_storeu_ps(output + 8, _mm_shuffle_ps(_mm_shuffle_ps(rz, rx, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(ry, rz, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+		}
+
+		OctahedralDecodeScalar(result + n * 3, values + n * 2, count - n);
+	}
+
+	// Index of the largest magnitude component & the 3 others quantised, 4 quaternions per register
+	template<unsigned int ComponentBits>
+	inline void EncodeSmallestThree(float const* quaternions, __m128i& index, __m128i& first, __m128i& second, __m128i& third) noexcept
+	{
+		const __m128 zero = _mm_setzero_ps();
+		const __m128 range = _mm_set1_ps(math::PackedQuaternion<ComponentBits>::Range);
+		const __m128 magic = _mm_set1_ps(SNORM_ROUND_MAGIC);
+
+		__m128 x = _mm_loadu_ps(quaternions);
+		__m128 y = _mm_loadu_ps(quaternions + 4);
+		__m128 z = _mm_loadu_ps(quaternions + 8);
+		__m128 w = _mm_loadu_ps(quaternions + 12);
+
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+
+		// First largest magnitude on ties, strictly greater replaces it
+		__m128 largestMagnitude = Abs(x);
+		__m128 largest = x;
+		index = _mm_setzero_si128();
+
+		const __m128 components[3] = { y, z, w };
+
+		for (int i = 0; i < 3; ++i)
+		{
+			const __m128 isLarger = _mm_cmpgt_ps(Abs(components[i]), largestMagnitude);
+
+			largestMagnitude = Select(isLarger, Abs(components[i]), largestMagnitude);
+			largest = Select(isLarger, components[i], largest);
+			index = Select(_mm_castps_si128(isLarger), _mm_set1_epi32(i + 1), index);
+		}
+
+		// q & -q are the same rotation, the dropped component is made positive
+		const __m128 negate = _mm_and_ps(_mm_cmplt_ps(largest, zero), _mm_set1_ps(-0.0f));
+
+		x = _mm_xor_ps(x, negate);
+		y = _mm_xor_ps(y, negate);
+		z = _mm_xor_ps(z, negate);
+		w = _mm_xor_ps(w, negate);
+
+		const __m128i isFirst = _mm_cmpeq_epi32(index, _mm_setzero_si128());
+		const __m128i beforeThird = _mm_cmplt_epi32(index, _mm_set1_epi32(2));
+		const __m128i beforeFourth = _mm_cmplt_epi32(index, _mm_set1_epi32(3));
+
+		const __m128 smallest[3] =
+		{
+			Select(_mm_castsi128_ps(isFirst), y, x),
+			Select(_mm_castsi128_ps(beforeThird), z, y),
+			Select(_mm_castsi128_ps(beforeFourth), w, z)
+		};
+
+		__m128i quantised[3];
+
+		for (int i = 0; i < 3; ++i)
+		{
+			const __m128 scaled = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(smallest[i], _mm_set1_ps(SMALLEST_THREE_SCALE)), _mm_set1_ps(0.5f)), range), zero), range);
+
+			quantised[i] = _mm_cvttps_epi32(_mm_sub_ps(_mm_add_ps(scaled, magic), magic));
+		}
+
+		first = quantised[0];
+		second = quantised[1];
+		third = quantised[2];
+	}
+
+	// Rebuilds 4 quaternions from the index of the dropped component & the 3 others, stored as (x, y, z, w)
+	template<unsigned int ComponentBits>
+	inline void DecodeSmallestThree(float* result, __m128i index, __m128i first, __m128i second, __m128i third) noexcept
+	{
+		const __m128 range = _mm_set1_ps(math::PackedQuaternion<ComponentBits>::Range);
+		const __m128 scale = _mm_set1_ps(SMALLEST_THREE_SCALE);
+		const __m128 half = _mm_set1_ps(0.5f);
+
+		const __m128 a = _mm_div_ps(_mm_sub_ps(_mm_div_ps(_mm_cvtepi32_ps(first), range), half), scale);
+		const __m128 b = _mm_div_ps(_mm_sub_ps(_mm_div_ps(_mm_cvtepi32_ps(second), range), half), scale);
+		const __m128 c = _mm_div_ps(_mm_sub_ps(_mm_div_ps(_mm_cvtepi32_ps(third), range), half), scale);
+
+		const __m128 sum = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a, a), _mm_mul_ps(b, b)), _mm_mul_ps(c, c));
+		const __m128 largest = _mm_sqrt_ps(_mm_max_ps(_mm_sub_ps(_mm_set1_ps(1.0f), sum), _mm_setzero_ps()));
+
+		const __m128 is0 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_setzero_si128()));
+		const __m128 is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(1)));
+		const __m128 is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(2)));
+		const __m128 is3 = _mm_castsi128_ps(_mm_cmpeq_epi32(index, _mm_set1_epi32(3)));
+
+		// The 3 stored components fill the other lanes in order
+		__m128 x = Select(is0, largest, a);
+		__m128 y = Select(is0, a, Select(is1, largest, b));
+		__m128 z = Select(_mm_or_ps(is0, is1), b, Select(is2, largest, c));
+		__m128 w = Select(is3, largest, c);
+
+		_MM_TRANSPOSE4_PS(x, y, z, w);
+
+		_mm_storeu_ps(result, x);
+		_mm_storeu_ps(result + 4, y);
+		_mm_storeu_ps(result + 8, z);
+		_mm_storeu_ps(result + 12, w);
+	}
+
+	void QuaternionEncode32SSE2(uint16_t* result, float const* quaternions, size_t count) noexcept
+	{
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			__m128i index, first, second, third;
+			EncodeSmallestThree<10>(quaternions + n * 4, index, first, second, third);
+
+			// index << 30 | first << 20 | second << 10 | third, little endian words
+			const __m128i bits = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(index, 30), _mm_slli_epi32(first, 20)), _mm_or_si128(_mm_slli_epi32(second, 10), third));
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(result + n * 2), bits);
+		}
+
+		QuaternionEncodeScalar<10>(result + n * 2, quaternions + n * 4, count - n);
+	}
+
+	void QuaternionDecode32SSE2(float* result, uint16_t const* values, size_t count) noexcept
+	{
+		const __m128i mask = _mm_set1_epi32(0x3ff);
+
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			const __m128i bits = _mm_loadu_si128(reinterpret_cast<__m128i const*>(values + n * 2));
+
+			DecodeSmallestThree<10>(result + n * 4,
+				_mm_srli_epi32(bits, 30),
+				_mm_and_si128(_mm_srli_epi32(bits, 20), mask),
+				_mm_and_si128(_mm_srli_epi32(bits, 10), mask),
+				_mm_and_si128(bits, mask)
+			);
+		}
+
+		QuaternionDecodeScalar<10>(result + n * 4, values + n * 2, count - n);
+	}
+
+	void QuaternionEncode48SSE2(uint16_t* result, float const* quaternions, size_t count) noexcept
+	{
+		const __m128i wordMask = _mm_set1_epi32(0xffff);
+
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			__m128i index, first, second, third;
+			EncodeSmallestThree<15>(quaternions + n * 4, index, first, second, third);
+
+			// 48 bits index << 45 | first << 30 | second << 15 | third split into 16 bit words
+			alignas(16) uint32_t words[3][4];
+
+			_mm_store_si128(reinterpret_cast<__m128i*>(words[0]), _mm_and_si128(_mm_or_si128(third, _mm_slli_epi32(second, 15)), wordMask));
+			_mm_store_si128(reinterpret_cast<__m128i*>(words[1]), _mm_and_si128(_mm_or_si128(_mm_srli_epi32(second, 1), _mm_slli_epi32(first, 14)), wordMask));
+			_mm_store_si128(reinterpret_cast<__m128i*>(words[2]), _mm_or_si128(_mm_srli_epi32(first, 2), _mm_slli_epi32(index, 13)));
+
+			for (size_t i = 0; i < 4; ++i)
+			{
+				result[(n + i) * 3] = static_cast<uint16_t>(words[0][i]);
+				result[(n + i) * 3 + 1] = static_cast<uint16_t>(words[1][i]);
+				result[(n + i) * 3 + 2] = static_cast<uint16_t>(words[2][i]);
+			}
+		}
+
+		QuaternionEncodeScalar<15>(result + n * 3, quaternions + n * 4, count - n);
+	}
+
+	void QuaternionDecode48SSE2(float* result, uint16_t const* values, size_t count) noexcept
+	{
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			uint16_t const* input = values + n * 3;
+
+			const __m128i word0 = _mm_setr_epi32(input[0], input[3], input[6], input[9]);
+			const __m128i word1 = _mm_setr_epi32(input[1], input[4], input[7], input[10]);
+			const __m128i word2 = _mm_setr_epi32(input[2], input[5], input[8], input[11]);
+
+			DecodeSmallestThree<15>(result + n * 4,
+				_mm_srli_epi32(word2, 13),
+				_mm_or_si128(_mm_srli_epi32(word1, 14), _mm_slli_epi32(_mm_and_si128(word2, _mm_set1_epi32(0x1fff)), 2)),
+				_mm_or_si128(_mm_srli_epi32(word0, 15), _mm_slli_epi32(_mm_and_si128(word1, _mm_set1_epi32(0x3fff)), 1)),
+				_mm_and_si128(word0, _mm_set1_epi32(0x7fff))
+			);
+		}
+
+		QuaternionDecodeScalar<15>(result + n * 4, values + n * 3, count - n);
+	}
+
+	constexpr FloatToHalfKernel g_floatToHalfKernels[] = { &FloatToHalfScalar, &FloatToHalfSSE2, &FloatToHalfSSE2, &FloatToHalfSSE2 };
+	constexpr HalfToFloatKernel g_halfToFloatKernels[] = { &HalfToFloatScalar, &HalfToFloatSSE2, &HalfToFloatSSE2, &HalfToFloatSSE2 };
+	constexpr FloatToSnorm16Kernel g_floatToSnorm16Kernels[] = { &FloatToSnorm16Scalar, &FloatToSnorm16SSE2, &FloatToSnorm16SSE2, &FloatToSnorm16SSE2 };
+	constexpr Snorm16ToFloatKernel g_snorm16ToFloatKernels[] = { &Snorm16ToFloatScalar, &Snorm16ToFloatSSE2, &Snorm16ToFloatSSE2, &Snorm16ToFloatSSE2 };
+	constexpr OctahedralEncodeKernel g_octahedralEncodeKernels[] = { &OctahedralEncodeScalar, &OctahedralEncodeSSE2, &OctahedralEncodeSSE2, &OctahedralEncodeSSE2 };
+	constexpr OctahedralDecodeKernel g_octahedralDecodeKernels[] = { &OctahedralDecodeScalar, &OctahedralDecodeSSE2, &OctahedralDecodeSSE2, &OctahedralDecodeSSE2 };
+	constexpr QuaternionEncodeKernel g_quaternionEncode32Kernels[] = { &QuaternionEncodeScalar<10>, &QuaternionEncode32SSE2, &QuaternionEncode32SSE2, &QuaternionEncode32SSE2 };
+	constexpr QuaternionDecodeKernel g_quaternionDecode32Kernels[] = { &QuaternionDecodeScalar<10>, &QuaternionDecode32SSE2, &QuaternionDecode32SSE2, &QuaternionDecode32SSE2 };
+	constexpr QuaternionEncodeKernel g_quaternionEncode48Kernels[] = { &QuaternionEncodeScalar<15>, &QuaternionEncode48SSE2, &QuaternionEncode48SSE2, &QuaternionEncode48SSE2 };
+	constexpr QuaternionDecodeKernel g_quaternionDecode48Kernels[] = { &QuaternionDecodeScalar<15>, &QuaternionDecode48SSE2, &QuaternionDecode48SSE2, &QuaternionDecode48SSE2 };
+#else
+	constexpr FloatToHalfKernel g_floatToHalfKernels[] = { &FloatToHalfScalar, &FloatToHalfScalar, &FloatToHalfScalar, &FloatToHalfScalar };
+	constexpr HalfToFloatKernel g_halfToFloatKernels[] = { &HalfToFloatScalar, &HalfToFloatScalar, &HalfToFloatScalar, &HalfToFloatScalar };
+	constexpr FloatToSnorm16Kernel g_floatToSnorm16Kernels[] = { &FloatToSnorm16Scalar, &FloatToSnorm16Scalar, &FloatToSnorm16Scalar, &FloatToSnorm16Scalar };
+	constexpr Snorm16ToFloatKernel g_snorm16ToFloatKernels[] = { &Snorm16ToFloatScalar, &Snorm16ToFloatScalar, &Snorm16ToFloatScalar, &Snorm16ToFloatScalar };
+	constexpr OctahedralEncodeKernel g_octahedralEncodeKernels[] = { &OctahedralEncodeScalar, &OctahedralEncodeScalar, &OctahedralEncodeScalar, &OctahedralEncodeScalar };
+	constexpr OctahedralDecodeKernel g_octahedralDecodeKernels[] = { &OctahedralDecodeScalar, &OctahedralDecodeScalar, &OctahedralDecodeScalar, &OctahedralDecodeScalar };
+	constexpr QuaternionEncodeKernel g_quaternionEncode32Kernels[] = { &QuaternionEncodeScalar<10>, &QuaternionEncodeScalar<10>, &QuaternionEncodeScalar<10>, &QuaternionEncodeScalar<10> };
+	constexpr QuaternionDecodeKernel g_quaternionDecode32Kernels[] = { &QuaternionDecodeScalar<10>, &QuaternionDecodeScalar<10>, &QuaternionDecodeScalar<10>, &QuaternionDecodeScalar<10> };
+	constexpr QuaternionEncodeKernel g_quaternionEncode48Kernels[] = { &QuaternionEncodeScalar<15>, &QuaternionEncodeScalar<15>, &QuaternionEncodeScalar<15>, &QuaternionEncodeScalar<15> };
+	constexpr QuaternionDecodeKernel g_quaternionDecode48Kernels[] = { &QuaternionDecodeScalar<15>, &QuaternionDecodeScalar<15>, &QuaternionDecodeScalar<15>, &QuaternionDecodeScalar<15> };
+#endif
+}
+
+void math::simd::FloatToHalf(uint16_t* result, float const* values, size_t count) noexcept
+{
+	g_floatToHalfKernels[static_cast<int>(ActiveInstructionSet())](result, values, count);
+}
+
+void math::simd::HalfToFloat(float* result, uint16_t const* values, size_t count) noexcept
+{
+	g_halfToFloatKernels[static_cast<int>(ActiveInstructionSet())](result, values, count);
+}
+
+void math::simd::FloatToSnorm16(int16_t* result, float const* values, size_t count) noexcept
+{
+	g_floatToSnorm16Kernels[static_cast<int>(ActiveInstructionSet())](result, values, count);
+}
+
+void math::simd::Snorm16ToFloat(float* result, int16_t const* values, size_t count) noexcept
+{
+	g_snorm16ToFloatKernels[static_cast<int>(ActiveInstructionSet())](result, values, count);
+}
+
+void math::simd::OctahedralEncode(int16_t* result, float const* vectors, size_t count) noexcept
+{
+	g_octahedralEncodeKernels[static_cast<int>(ActiveInstructionSet())](result, vectors, count);
+}
+
+void math::simd::OctahedralDecode(float* result, int16_t const* values, size_t count) noexcept
+{
+	g_octahedralDecodeKernels[static_cast<int>(ActiveInstructionSet())](result, values, count);
+}
+
+void math::simd::QuaternionEncode32(uint16_t* result, float const* quaternions, size_t count) noexcept
+{
+	g_quaternionEncode32Kernels[static_cast<int>(ActiveInstructionSet())](result, quaternions, count);
+}
+
+void math::simd::QuaternionDecode32(float* result, uint16_t const* values, size_t count) noexcept
+{
+	g_quaternionDecode32Kernels[static_cast<int>(ActiveInstructionSet())](result, values, count);
+}
+
+void math::simd::QuaternionEncode48(uint16_t* result, float const* quaternions, size_t count) noexcept
+{
+	g_quaternionEncode48Kernels[static_cast<int>(ActiveInstructionSet())](result, quaternions, count);
+}
+
+void math::simd::QuaternionDecode48(float* result, uint16_t const* values, size_t count) noexcept
+{
+	g_quaternionDecode48Kernels[static_cast<int>(ActiveInstructionSet())](result, values, count);
+}
@@ -0,0 +1,110 @@
+#include "simd/Simd.h"
+
+/*
+*	Quaternion float kernels
+*
+*	Rotating by a unit quaternion q = (w, u) without building a matrix:
+*	t = 2 * (u x v)
+*	v' = v + w * t + u x t
+*
+*	The SSE2 kernel rotates 4 packed Vector3 per iteration, the vectors
+*	are transposed to x, y, z registers & every lane evaluates the
+*	operations of the scalar kernel in the same order, results are
+*	bit-for-bit identical to Quaternion::RotateVector.
+*/
+
+namespace
+{
+	using QuaternionRotateVector3Kernel = void (*)(float*, float const*, size_t, float const*) noexcept;
+
+	void QuaternionRotateVector3Scalar(float* result, float const* vectors, size_t count, float const* quaternion) noexcept
+	{
+		const float x = quaternion[0];
+		const float y = quaternion[1];
+		const float z = quaternion[2];
+		const float w = quaternion[3];
+
+		for (size_t n = 0; n < count; ++n)
+		{
+			const float vx = vectors[n * 3];
+			const float vy = vectors[n * 3 + 1];
+			const float vz = vectors[n * 3 + 2];
+
+			const float tx = ((y * vz) - (z * vy)) * 2.0f;
+			const float ty = ((z * vx) - (x * vz)) * 2.0f;
+			const float tz = ((x * vy) - (y * vx)) * 2.0f;
+
+			result[n * 3] = (vx + tx * w) + ((y * tz) - (z * ty));
+			result[n * 3 + 1] = (vy + ty * w) + ((z * tx) - (x * tz));
+			result[n * 3 + 2] = (vz + tz * w) + ((x * ty) - (y * tx));
+		}
+	}
+
+#if LIBMATH_SIMD_SSE2
+	void QuaternionRotateVector3SSE2(float* result, float const* vectors, size_t count, float const* quaternion) noexcept
+	{
+		const __m128 x = _mm_set1_ps(quaternion[0]);
+		const __m128 y = _mm_set1_ps(quaternion[1]);
+		const __m128 z = _mm_set1_ps(quaternion[2]);
+		const __m128 w = _mm_set1_ps(quaternion[3]);
+		const __m128 two = _mm_set1_ps(2.0f);
+
+		size_t n = 0;
+
+		for (; n + 4 <= count; n += 4)
+		{
+			float const* input = vectors + n * 3;
+			float* output = result + n * 3;
+
+			// (x0 y0 z0 x1) (y1 z1 x2 y2) (z2 x3 y3 z3) to x, y & z registers
+			const __m128 packed0 = _mm_loadu_ps(input);
+			const __m128 packed1 = _mm_loadu_ps(input + 4);
+			const __m128 packed2 = _mm_loadu_ps(input + 8);
+
+			const __m128 vx = _mm_shuffle_ps(packed0, _mm_shuffle_ps(packed1, packed2, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+			const __m128 vy = _mm_shuffle_ps(_mm_shuffle_ps(packed0, packed1, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(packed1, packed2, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+			const __m128 vz = _mm_shuffle_ps(_mm_shuffle_ps(packed0, packed1, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(packed2, packed2, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+
+			const __m128 tx = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(y, vz), _mm_mul_ps(z, vy)), two);
+			const __m128 ty = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(z, vx), _mm_mul_ps(x, vz)), two);
+			const __m128 tz = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(x, vy), _mm_mul_ps(y, vx)), two);
+
+			const __m128 rx = _mm_add_ps(_mm_add_ps(vx, _mm_mul_ps(tx, w)), _mm_sub_ps(_mm_mul_ps(y, tz), _mm_mul_ps(z, ty)));
+			const __m128 ry = _mm_add_ps(_mm_add_ps(vy, _mm_mul_ps(ty, w)), _mm_sub_ps(_mm_mul_ps(z, tx), _mm_mul_ps(x, tz)));
+			const __m128 rz = _mm_add_ps(_mm_add_ps(vz, _mm_mul_ps(tz, w)), _mm_sub_ps(_mm_mul_ps(x, ty), _mm_mul_ps(y, tx)));
+
+			// Back to packed Vector3, every input is read before the first store so the result may alias
+			const __m128 xyLow = _mm_unpacklo_ps(rx, ry);
+			const __m128 xyHigh = _mm_unpackhi_ps(rx, ry);
+
+			_mm_storeu_ps(output, _mm_shuffle_ps(xyLow, _mm_shuffle_ps(rz, rx, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 1, 0)));
+			_mm_storeu_ps(output + 4, _mm_shuffle_ps(_mm_shuffle_ps(ry, rz, _MM_SHUFFLE(1, 1, 1, 1)), xyHigh, _MM_SHUFFLE(1, 0, 2, 0)));
+			_mm_storeu_ps(output + 8, _mm_shuffle_ps(_mm_shuffle_ps(rz, rx, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(ry, rz, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0)));
+		}
+
+		QuaternionRotateVector3Scalar(result + n * 3, vectors + n * 3, count - n, quaternion);
+	}
+
+	// The 3 float stride needs a transpose per block, wider registers do not pay for theirs
+	constexpr QuaternionRotateVector3Kernel g_quaternionRotateVector3Kernels[] =
+	{
+		&QuaternionRotateVector3Scalar,
+		&QuaternionRotateVector3SSE2,
+		&QuaternionRotateVector3SSE2,
+		&QuaternionRotateVector3SSE2
+	};
+#else
+	constexpr QuaternionRotateVector3Kernel g_quaternionRotateVector3Kernels[] =
+	{
+		&QuaternionRotateVector3Scalar,
+		&QuaternionRotateVector3Scalar,
+		&QuaternionRotateVector3Scalar,
+		&QuaternionRotateVector3Scalar
+	};
+#endif
+}
+
+void math::simd::QuaternionRotateVector3(float* result, float const* vectors, size_t count, float const* quaternion) noexcept
+{
+	g_quaternionRotateVector3Kernels[static_cast<int>(ActiveInstructionSet())](result, vectors, count, quaternion);
+}
@@ -0,0 +1,243 @@
+#include "simd/Simd.h"
+#include "Trigonometry.h"
+
+/*
+*	SinCos float kernels
+*
+*	Every lane evaluates the operations of math::SinCos in the same
+*	order: nearest quadrant, 3 part pi / 2 reduction, both polynomials
+*	with Horner's scheme, then the quadrant swap & sign flips. Results
+*	are bit-for-bit identical to the single angle function.
+*
+*	Blocks with a lane outside the polynomial range (or NaN) run the
+*	single angle function on each lane, it falls back to <cmath>.
+*/
+
+namespace
+{
+	using SinCosKernel = void (*)(float*, float*, float const*, size_t, float) noexcept;
+
+	using Constants = math::trigonometry::SinCosConstants<float>;
+
+	template<bool Fast>
+	void SinCosScalar(float* sin, float* cos, float const* angles, size_t count, float scale) noexcept
+	{
+		const math::Precision precision = Fast ? math::Precision::Fast : math::Precision::Medium;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const float angle = angles[i] * scale;
+
+			math::SinCos(angle, sin[i], cos[i], precision);
+		}
+	}
+
+#if LIBMATH_SIMD_SSE2
+	template<size_t N>
+	inline __m128 Horner4(__m128 z, float const (&c)[N]) noexcept
+	{
+		__m128 result = _mm_set1_ps(c[N - 1]);
+
+		for (size_t i = N - 1; i > 0; --i)
+			result = _mm_add_ps(_mm_set1_ps(c[i - 1]), _mm_mul_ps(z, result));
+
+		return result;
+	}
+
+	template<bool Fast>
+	void SinCosSSE2(float* sin, float* cos, float const* angles, size_t count, float scale) noexcept
+	{
+		const __m128 scaleValue = _mm_set1_ps(scale);
+		const __m128 signMask = _mm_set1_ps(-0.0f);
+		const __m128 half = _mm_set1_ps(0.5f);
+		const __m128 one = _mm_set1_ps(1.0f);
+		const __m128 limit = _mm_set1_ps(Constants::limit);
+		const __m128i oneInt = _mm_set1_epi32(1);
+		const __m128i twoInt = _mm_set1_epi32(2);
+
+		size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			const __m128 x = _mm_mul_ps(_mm_loadu_ps(angles + i), scaleValue);
+
+			// NaN compares false, the block goes through the single angle function
+			if (_mm_movemask_ps(_mm_cmple_ps(_mm_andnot_ps(signMask, x), limit)) != 0xF)
+			{
+				SinCosScalar<Fast>(sin + i, cos + i, angles + i, 4, scale);
+				continue;
+			}
+
+			// Round half away from zero, x * 2 / pi + copysign(0.5, x) truncated
+			const __m128 roundOffset = _mm_or_ps(_mm_and_ps(x, signMask), half);
+			const __m128i quadrant = _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(Constants::twoOverPi)), roundOffset));
+			const __m128 quadrantValue = _mm_cvtepi32_ps(quadrant);
+
+			__m128 r = _mm_sub_ps(x, _mm_mul_ps(quadrantValue, _mm_set1_ps(Constants::halfPi1)));
+			r = _mm_sub_ps(r, _mm_mul_ps(quadrantValue, _mm_set1_ps(Constants::halfPi2)));
+			r = _mm_sub_ps(r, _mm_mul_ps(quadrantValue, _mm_set1_ps(Constants::halfPi3)));
+
+			const __m128 z = _mm_mul_ps(r, r);
+
+			__m128 sinR;
+			__m128 cosR;
+
+			if constexpr (Fast)
+			{
+				sinR = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), Horner4(z, Constants::sinFast)));
+				cosR = _mm_add_ps(one, _mm_mul_ps(z, Horner4(z, Constants::cosFast)));
+			}
+			else
+			{
+				sinR = _mm_add_ps(r, _mm_mul_ps(_mm_mul_ps(r, z), Horner4(z, Constants::sinMedium)));
+				cosR = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(_mm_mul_ps(z, z), Horner4(z, Constants::cosMedium)), _mm_mul_ps(half, z)), one);
+			}
+
+			// Odd quadrants swap sin & cos, bit 1 of quadrant (quadrant + 1 for cos) becomes the sign bit
+			const __m128 swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, oneInt), oneInt));
+			const __m128 sinSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, twoInt), 30));
+			const __m128 cosSign = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, oneInt), twoInt), 30));
+
+			const __m128 sinValue = _mm_or_ps(_mm_and_ps(swap, cosR), _mm_andnot_ps(swap, sinR));
+			const __m128 cosValue = _mm_or_ps(_mm_and_ps(swap, sinR), _mm_andnot_ps(swap, cosR));
+
+			_mm_storeu_ps(sin + i, _mm_xor_ps(sinValue, sinSign));
+			_mm_storeu_ps(cos + i, _mm_xor_ps(cosValue, cosSign));
+		}
+
+		SinCosScalar<Fast>(sin + i, cos + i, angles + i, count - i, scale);
+	}
+
+	template<size_t N>
+	LIBMATH_TARGET_AVX
+	inline __m256 Horner8(__m256 z, float const (&c)[N]) noexcept
+	{
+		__m256 result = _mm256_set1_ps(c[N - 1]);
+
+		for (size_t i = N - 1; i > 0; --i)
+			result = _mm256_add_ps(_mm256_set1_ps(c[i - 1]), _mm256_mul_ps(z, result));
+
+		return result;
+	}
+
+	// AVX has no 256 bit integer instructions, the quadrant masks are built per 128 bit half
+	LIBMATH_TARGET_AVX
+	inline __m256 Combine(__m128i low, __m128i high) noexcept
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_castsi128_ps(low)), _mm_castsi128_ps(high), 1);
+	}
+
+	template<bool Fast>
+	LIBMATH_TARGET_AVX
+	void SinCosAVX(float* sin, float* cos, float const* angles, size_t count, float scale) noexcept
+	{
+		const __m256 scaleValue = _mm256_set1_ps(scale);
+		const __m256 signMask = _mm256_set1_ps(-0.0f);
+		const __m256 half = _mm256_set1_ps(0.5f);
+		const __m256 one = _mm256_set1_ps(1.0f);
+		const __m256 limit = _mm256_set1_ps(Constants::limit);
+		const __m128i oneInt = _mm_set1_epi32(1);
+		const __m128i twoInt = _mm_set1_epi32(2);
+
+		size_t i = 0;
+
+		for (; i + 8 <= count; i += 8)
+		{
+			const __m256 x = _mm256_mul_ps(_mm256_loadu_ps(angles + i), scaleValue);
+
+			if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_andnot_ps(signMask, x), limit, _CMP_LE_OQ)) != 0xFF)
+			{
+				SinCosScalar<Fast>(sin + i, cos + i, angles + i, 8, scale);
+				continue;
+			}
+
+			const __m256 roundOffset = _mm256_or_ps(_mm256_and_ps(x, signMask), half);
+			const __m256i quadrant = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(Constants::twoOverPi)), roundOffset));
+			const __m256 quadrantValue = _mm256_cvtepi32_ps(quadrant);
+
+			__m256 r = _mm256_sub_ps(x, _mm256_mul_ps(quadrantValue, _mm256_set1_ps(Constants::halfPi1)));
+			r = _mm256_sub_ps(r, _mm256_mul_ps(quadrantValue, _mm256_set1_ps(Constants::halfPi2)));
+			r = _mm256_sub_ps(r, _mm256_mul_ps(quadrantValue, _mm256_set1_ps(Constants::halfPi3)));
+
+			const __m256 z = _mm256_mul_ps(r, r);
+
+			__m256 sinR;
+			__m256 cosR;
+
+			if constexpr (Fast)
+			{
+				sinR = _mm256_add_ps(r, _mm256_mul_ps(_mm256_mul_ps(r, z), Horner8(z, Constants::sinFast)));
+				cosR = _mm256_add_ps(one, _mm256_mul_ps(z, Horner8(z, Constants::cosFast)));
+			}
+			else
+			{
+				sinR = _mm256_add_ps(r, _mm256_mul_ps(_mm256_mul_ps(r, z), Horner8(z, Constants::sinMedium)));
+				cosR = _mm256_add_ps(_mm256_sub_ps(_mm256_mul_ps(_mm256_mul_ps(z, z), Horner8(z, Constants::cosMedium)), _mm256_mul_ps(half, z)), one);
+			}
+
+			const __m128i quadrantLow = _mm256_castsi256_si128(quadrant);
+			const __m128i quadrantHigh = _mm256_extractf128_si256(quadrant, 1);
+
+			const __m256 swap = Combine(
+				_mm_cmpeq_epi32(_mm_and_si128(quadrantLow, oneInt), oneInt),
+				_mm_cmpeq_epi32(_mm_and_si128(quadrantHigh, oneInt), oneInt));
+
+			const __m256 sinSign = Combine(
+				_mm_slli_epi32(_mm_and_si128(quadrantLow, twoInt), 30),
+				_mm_slli_epi32(_mm_and_si128(quadrantHigh, twoInt), 30));
+
+			const __m256 cosSign = Combine(
+				_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrantLow, oneInt), twoInt), 30),
+				_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrantHigh, oneInt), twoInt), 30));
+
+			_mm256_storeu_ps(sin + i, _mm256_xor_ps(_mm256_blendv_ps(sinR, cosR, swap), sinSign));
+			_mm256_storeu_ps(cos + i, _mm256_xor_ps(_mm256_blendv_ps(cosR, sinR, swap), cosSign));
+		}
+
+		SinCosSSE2<Fast>(sin + i, cos + i, angles + i, count - i, scale);
+	}
+
+	// Indexed by math::simd::InstructionSet, multiply & add are not fused so AVX2 + FMA reuses the AVX kernel
+	constexpr SinCosKernel g_sinCosKernels[] =
+	{
+		&SinCosScalar<false>,
+		&SinCosSSE2<false>,
+		&SinCosAVX<false>,
+		&SinCosAVX<false>
+	};
+
+	constexpr SinCosKernel g_sinCosFastKernels[] =
+	{
+		&SinCosScalar<true>,
+		&SinCosSSE2<true>,
+		&SinCosAVX<true>,
+		&SinCosAVX<true>
+	};
+#else
+	constexpr SinCosKernel g_sinCosKernels[] =
+	{
+		&SinCosScalar<false>,
+		&SinCosScalar<false>,
+		&SinCosScalar<false>,
+		&SinCosScalar<false>
+	};
+
+	constexpr SinCosKernel g_sinCosFastKernels[] =
+	{
+		&SinCosScalar<true>,
+		&SinCosScalar<true>,
+		&SinCosScalar<true>,
+		&SinCosScalar<true>
+	};
+#endif
+}
+
+void math::simd::SinCos(float* sin, float* cos, float const* angles, size_t count, float scale) noexcept
+{
+	g_sinCosKernels[static_cast<int>(ActiveInstructionSet())](sin, cos, angles, count, scale);
+}
+
+void math::simd::SinCosFast(float* sin, float* cos, float const* angles, size_t count, float scale) noexcept
+{
+	g_sinCosFastKernels[static_cast<int>(ActiveInstructionSet())](sin, cos, angles, count, scale);
+}
@@ -12,6 +12,10 @@
 #define VECTOR_UNIT_TEST			0
 #define TRIGONOMETRY_UNIT_TEST		0
 #define QUATERNION_UNIT_TEST		0
+#define TRANSFORM_UNIT_TEST			0
+#define PACKED_UNIT_TEST			0
+#define FIXED_UNIT_TEST				0
+#define DETERMINISTIC_UNIT_TEST		0
 //==================================
 
 
@@ -50,6 +54,9 @@ int main(int argc, char* argv[])
 #if (RADIAN_UNIT_TEST == 1 || ANGLE_UNIT_TEST == 1 || ALL_UNIT_TEST == 1)
 	arguments.push_back("[radian],");
 #endif
+#if (ANGLE_UNIT_TEST == 1 || ALL_UNIT_TEST == 1)
+	arguments.push_back("[angle],");
+#endif
 #if (MATRIX2_UNIT_TEST == 1 || MATRIX_UNIT_TEST == 1 || ALL_UNIT_TEST == 1)
 	arguments.push_back("[matrix2],");
 #endif
@@ -59,6 +66,9 @@ int main(int argc, char* argv[])
 #if (MATRIX4_UNIT_TEST == 1 || MATRIX_UNIT_TEST == 1 || ALL_UNIT_TEST == 1)
 	arguments.push_back("[matrix4],");
 #endif
+#if (MATRIX_UNIT_TEST == 1 || ALL_UNIT_TEST == 1)
+	arguments.push_back("[matrix],");
+#endif
 #if (VECTOR2_UNIT_TEST == 1 || VECTOR_UNIT_TEST == 1 || ALL_UNIT_TEST == 1)
 	arguments.push_back("[Vector2],");
 #endif
@@ -68,18 +78,33 @@ int main(int argc, char* argv[])
 #if (VECTOR4_UNIT_TEST == 1 || VECTOR_UNIT_TEST == 1 || ALL_UNIT_TEST == 1)
 	arguments.push_back("[Vector4],");
 #endif
+#if (VECTOR_UNIT_TEST == 1 || ALL_UNIT_TEST == 1)
+	arguments.push_back("[vector],");
+#endif
 
 #if ARITHMETIC_UNIT_TEST == 1 || ALL_UNIT_TEST == 1
-	arguments.push_back("Arithmetic");
+	arguments.push_back("Arithmetic,");
 #endif
 #if GEOMETRY_UNIT_TEST == 1 || ALL_UNIT_TEST == 1
-	arguments.push_back("Geometry");
+	arguments.push_back("[geometry],");
 #endif
 #if TRIGONOMETRY_UNIT_TEST == 1 || ALL_UNIT_TEST == 1
-	arguments.push_back("Trigonometry");
+	arguments.push_back("[trigonometry],");
 #endif
 #if QUATERNION_UNIT_TEST == 1 || ALL_UNIT_TEST == 1
-	arguments.push_back("Quaternion");
+	arguments.push_back("[Quaternion],");
+#endif
+#if TRANSFORM_UNIT_TEST == 1 || ALL_UNIT_TEST == 1
+	arguments.push_back("[TransformHierarchy],");
+#endif
+#if PACKED_UNIT_TEST == 1 || ALL_UNIT_TEST == 1
+	arguments.push_back("[packed],");
+#endif
+#if FIXED_UNIT_TEST == 1 || ALL_UNIT_TEST == 1
+	arguments.push_back("[fixed],");
+#endif
+#if DETERMINISTIC_UNIT_TEST == 1 || ALL_UNIT_TEST == 1
+	arguments.push_back("[deterministic],");
 #endif
 
 	return Catch::Session().run((int) arguments.size(), &arguments[0]);
@@ -151,4 +151,13 @@ TEST_CASE("Radian", "[.all][angle][radian]")
 		CHECK((math::Radian(angleValues[3]) / 5.0f).Value() == angleValues[3] / 5.0f);
 		CHECK((math::Radian(angleValues[2]) / -2.45f).Value() == angleValues[2] / -2.45f);
 	}
+}
+
+TEST_CASE("Angle constexpr", "[.all][angle]")
+{
+	STATIC_REQUIRE(math::Degree<float>(400.0f).Wrap().Value() == 40.0f);
+	STATIC_REQUIRE(math::Degree<float>(-90.0f).Wrap().Value() == 270.0f);
+	STATIC_REQUIRE((math::Degree<float>(45.0f) + math::Degree<float>(45.0f)).Value() == 90.0f);
+	STATIC_REQUIRE(math::Radian<float>(TWO_PI + 1.0f).Wrap().Value() < TWO_PI);
+	STATIC_REQUIRE(math::Radian<float>(1.0f) == math::Radian<float>(1.0f));
 }
\ No newline at end of file
@@ -5,7 +5,10 @@
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <glm/common.hpp>
 #include <glm/gtx/integer.hpp>
+#include <cmath>
+#include <cstdint>
 #include <limits>
+#include <vector>
 
 TEST_CASE("Arithmetic", "[.all]")
 {
@@ -87,9 +90,153 @@ TEST_CASE("Arithmetic", "[.all]")
 		CHECK(math::Power(7.0f, 0.0f)					== powf(7.0f, 0.0f));
 	}
 
+	SECTION("Modulo")
+	{
+		CHECK(math::Modulo(7, 3)						== 7 % 3);
+		CHECK(math::Modulo(-7, 3)						== -7 % 3);
+		CHECK(math::Modulo(7.5f, 2.0f)					== std::fmod(7.5f, 2.0f));
+		CHECK(math::Modulo(-7.5f, 2.0f)					== std::fmod(-7.5f, 2.0f));
+	}
+
+	SECTION("Sqrt")
+	{
+		CHECK(math::Sqrt(4.0f)							== glm::sqrt(4.0f));
+		CHECK(math::Sqrt(2.0f)							== glm::sqrt(2.0f));
+		CHECK(math::Sqrt(0.0)							== glm::sqrt(0.0));
+		CHECK(math::Sqrt(123456.789)					== glm::sqrt(123456.789));
+
+		// Unsigned sqrt is the floor of the exact root
+		CHECK(math::Sqrt(0u)							== glm::sqrt(0u));
+		CHECK(math::Sqrt(15u)							== glm::sqrt(15u));
+		CHECK(math::Sqrt(16u)							== glm::sqrt(16u));
+		CHECK(math::Sqrt(4294967295u)					== glm::sqrt(4294967295u));
+		CHECK(math::Sqrt(UINT64_C(18446744073709551615))	== UINT64_C(4294967295));
+
+		for (unsigned int i = 0; i < 100000; i += 7)
+			CHECK(math::Sqrt(i)							== glm::sqrt(i));
+	}
+
 	SECTION("Root")
 	{
-		// TODO: add root function
+		CHECK(math::Root(27.0, 3)						== std::cbrt(27.0));
+		CHECK(math::Root(-8.0f, 3)						== std::cbrt(-8.0f));
+		CHECK(math::Root(2.0f, 2)						== std::sqrt(2.0f));
+		CHECK(math::Root(5.5f, 1)						== 5.5f);
+		CHECK(math::Root(625.0, 4)						== std::pow(625.0, 0.25));
+
+		// Integer roots are truncated
+		CHECK(math::Root(26u, 3)						== 2u);
+		CHECK(math::Root(27u, 3)						== 3u);
+		CHECK(math::Root(-125, 3)						== -5);
+		CHECK(math::Root(1023, 10)						== 1);
+		CHECK(math::Root(1024, 10)						== 2);
+		CHECK(math::Root(UINT64_C(18446744073709551615), 2)	== UINT64_C(4294967295));
+	}
+
+	SECTION("Fast sqrt")
+	{
+		// 1 Newton-Raphson step, reciprocal within 5 ulp & sqrt within 4 ulp
+		constexpr float rsqrtError = 5.0f * std::numeric_limits<float>::epsilon();
+		constexpr float sqrtError = 4.0f * std::numeric_limits<float>::epsilon();
+
+		std::vector<float> values;
+
+		for (float value = std::numeric_limits<float>::min(); value < 1e30f; value *= 1.37f)
+			values.push_back(value);
+
+		for (float const value : values)
+		{
+			const float rsqrt = math::RSqrt(value, math::Precision::Fast);
+			const float sqrt = math::Sqrt(value, math::Precision::Fast);
+
+			CHECK(std::abs(rsqrt - 1.0f / std::sqrt(value)) <= rsqrtError * rsqrt);
+			CHECK(std::abs(sqrt - std::sqrt(value)) <= sqrtError * sqrt);
+			CHECK(math::RSqrt(value)					== 1.0f / std::sqrt(value));
+		}
+
+		CHECK(math::Sqrt(0.0f, math::Precision::Fast)	== 0.0f);
+		CHECK(math::Sqrt(std::numeric_limits<float>::infinity(), math::Precision::Fast) == std::numeric_limits<float>::infinity());
+		CHECK(math::Sqrt(16.0, math::Precision::Fast)	== 4.0);
+		CHECK(math::Sqrt(17u, math::Precision::Fast)	== 4u);
+
+		// Batches match the single value functions for every instruction set
+		std::vector<float> batch(values.size());
+		std::vector<float> expected(values.size());
+
+		for (size_t i = 0; i < values.size(); ++i)
+			expected[i] = math::RSqrt(values[i], math::Precision::Fast);
+
+		math::RSqrt<float>(values, batch, math::Precision::Fast);
+		CHECK(batch == expected);
+
+		for (size_t i = 0; i < values.size(); ++i)
+			expected[i] = math::Sqrt(values[i], math::Precision::Fast);
+
+		math::Sqrt<float>(values, batch, math::Precision::Fast);
+		CHECK(batch == expected);
+
+		for (size_t i = 0; i < values.size(); ++i)
+			expected[i] = math::Sqrt(values[i]);
+
+		math::Sqrt<float>(values, batch);
+		CHECK(batch == expected);
+
+		// In place
+		math::RSqrt<float>(batch, batch);
+
+		for (size_t i = 0; i < values.size(); ++i)
+			CHECK(batch[i]								== math::RSqrt(expected[i]));
+	}
+
+	SECTION("Trigonometry")
+	{
+		CHECK(math::Sin(1.0f)							== glm::sin(1.0f));
+		CHECK(math::Cos(1.0f)							== glm::cos(1.0f));
+		CHECK(math::Tan(1.0f)							== glm::tan(1.0f));
+		CHECK(math::Asin(0.5f)							== glm::asin(0.5f));
+		CHECK(math::Acos(0.5f)							== glm::acos(0.5f));
+		CHECK(math::Atan(2.0f)							== glm::atan(2.0f));
+
+		// Every quadrant & both axes, within 1 ulp of <cmath> in deterministic builds
+		for (float y : { -3.0f, -0.5f, 0.0f, 0.5f, 3.0f })
+		{
+			for (float x : { -2.0f, -0.25f, 0.25f, 2.0f })
+				CHECK(math::AlmostEqual(math::Atan2(y, x), std::atan2(y, x), 4.0f * std::numeric_limits<float>::epsilon()));
+		}
+
+		CHECK(math::Atan2(0.0f, 0.0f)					== 0.0f);
+	}
+
+	SECTION("Constexpr")
+	{
+		// The compile time series must agree with <cmath> to within 1 ulp
+		constexpr float epsilon = std::numeric_limits<float>::epsilon();
+
+		STATIC_REQUIRE(math::Sqrt(4.0f)					== 2.0f);
+		STATIC_REQUIRE(math::Sqrt(2.0)					== 1.4142135623730951);
+		STATIC_REQUIRE(math::Sqrt(99u)					== 9u);
+		STATIC_REQUIRE(math::Root(-27, 3)				== -3);
+		STATIC_REQUIRE(math::Root(8.0, 3)				== 2.0);
+		STATIC_REQUIRE(math::RSqrt(4.0f)				== 0.5f);
+		STATIC_REQUIRE(math::RSqrt(4.0f, math::Precision::Fast)	== 0.5f);
+		STATIC_REQUIRE(math::Modulo(7.5f, 2.0f)			== 1.5f);
+		STATIC_REQUIRE(math::Wrap(28.0f, 0.0f, 5.0f)	== 3.0f);
+		STATIC_REQUIRE(math::AlmostEqual(math::Sin(0.5f), 0.479425539f, epsilon));
+		STATIC_REQUIRE(math::AlmostEqual(math::Cos(0.5f), 0.877582562f, epsilon));
+		STATIC_REQUIRE(math::AlmostEqual(math::Tan(0.5f), 0.546302490f, epsilon));
+		STATIC_REQUIRE(math::AlmostEqual(math::Asin(0.5f), 0.523598776f, epsilon));
+		STATIC_REQUIRE(math::AlmostEqual(math::Acos(0.5f), 1.047197551f, epsilon));
+		STATIC_REQUIRE(math::AlmostEqual(math::Atan(2.0f), 1.107148718f, epsilon));
+		STATIC_REQUIRE(math::AlmostEqual(math::Atan2(1.0f, -2.0f), 2.677945045f, 4.0f * epsilon));
+		STATIC_REQUIRE(math::AlmostEqual(math::Atan2(-3.0, 0.5), -1.4056476493802699, 1e-15));
+
+		constexpr float sqrt2 = math::Sqrt(2.0f);
+		constexpr float sin1 = math::Sin(1.0f);
+		constexpr float acosHalf = math::Acos(0.5f);
+
+		CHECK(math::AlmostEqual(sqrt2, std::sqrt(2.0f), epsilon));
+		CHECK(math::AlmostEqual(sin1, std::sin(1.0f), epsilon));
+		CHECK(math::AlmostEqual(acosHalf, std::acos(0.5f), epsilon));
 	}
 
 	SECTION("Factorial")
@@ -0,0 +1,195 @@
+#include "LibMath/Arithmetic.h"
+#include "LibMath/Deterministic.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Trigonometry.h"
+#include "LibMath/Vector.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+// Bit patterns need strict IEEE evaluation without a * b + c contracted into FMA: guaranteed by
+// LIBMATH_DETERMINISTIC (-ffp-contract=off) & by x86 builds without FMA instructions
+#if defined(LIBMATH_DETERMINISTIC) || (LIBMATH_SIMD_SSE2 && !defined(__FMA__) && !defined(__AVX2__))
+	#define CHECK_GOLDEN_BITS 1
+#else
+	#define CHECK_GOLDEN_BITS 0
+#endif
+
+namespace
+{
+	uint64_t Bits(double value)
+	{
+		return std::bit_cast<uint64_t>(value);
+	}
+
+	uint32_t Bits(float value)
+	{
+		return std::bit_cast<uint32_t>(value);
+	}
+
+	// Distance in ulp to the exact value
+	double UlpError(double value, long double exact)
+	{
+		const double rounded = static_cast<double>(exact);
+		const double ulp = std::nextafter(std::abs(rounded), std::numeric_limits<double>::infinity()) - std::abs(rounded);
+
+		return static_cast<double>(std::abs(static_cast<long double>(value) - exact)) / ulp;
+	}
+
+	double UlpError(float value, long double exact)
+	{
+		const float rounded = static_cast<float>(exact);
+		const float ulp = std::nextafter(std::abs(rounded), std::numeric_limits<float>::infinity()) - std::abs(rounded);
+
+		return static_cast<double>(std::abs(static_cast<long double>(value) - exact) / ulp);
+	}
+}
+
+TEST_CASE("Deterministic", "[.all][deterministic]")
+{
+	namespace deterministic = LibMath::deterministic;
+
+	SECTION("Golden")
+	{
+#if CHECK_GOLDEN_BITS
+		CHECK(Bits(deterministic::Sin(0.5)) == 0x3FDEAEE8744B05F0ull);
+		CHECK(Bits(deterministic::Sin(100.0)) == 0xBFE03425B78C4DB8ull);
+		CHECK(Bits(deterministic::Sin(1.0e12)) == 0xBFE38F03C3D68741ull);
+		CHECK(Bits(deterministic::Cos(-2.5)) == 0xBFE9A2F7EF858B7Dull);
+		CHECK(Bits(deterministic::Tan(1.2)) == 0x400493C43ACB164Cull);
+		CHECK(Bits(deterministic::Asin(0.3)) == 0x3FD380159E14F6FFull);
+		CHECK(Bits(deterministic::Asin(-0.9)) == 0xBFF1EA93705FA172ull);
+		CHECK(Bits(deterministic::Acos(0.75)) == 0x3FE720A392C1D955ull);
+		CHECK(Bits(deterministic::Acos(-0.6)) == 0x4001B6E192EBBE44ull);
+		CHECK(Bits(deterministic::Atan(0.1)) == 0x3FB983E282E2CC4Cull);
+		CHECK(Bits(deterministic::Atan(-7.5)) == 0xBFF7030CF9403197ull);
+		CHECK(Bits(deterministic::Root(10.0, 3)) == 0x40013C484138704Full);
+		CHECK(Bits(deterministic::Root(0.001, 7)) == 0x3FD7DB4A2009C6E2ull);
+
+		CHECK(Bits(static_cast<float>(deterministic::Sin(1.0f))) == 0x3F576AA4u);
+		CHECK(Bits(static_cast<float>(deterministic::Cos(3.0f))) == 0xBF7D7026u);
+		CHECK(Bits(static_cast<float>(deterministic::Tan(-0.7f))) == 0xBF57A036u);
+		CHECK(Bits(static_cast<float>(deterministic::Asin(0.5f))) == 0x3F060A92u);
+		CHECK(Bits(static_cast<float>(deterministic::Acos(-0.25f))) == 0x3FE967AEu);
+		CHECK(Bits(static_cast<float>(deterministic::Atan(2.0f))) == 0x3F8DB70Du);
+#endif
+	}
+
+	SECTION("Constexpr")
+	{
+		// Same bits at compile time & at runtime
+		constexpr double sin = deterministic::Sin(100.0);
+		constexpr double asin = deterministic::Asin(-0.9);
+		constexpr double atan = deterministic::Atan(-7.5);
+		constexpr double root = deterministic::Root(10.0, 3);
+		constexpr double sqrt = deterministic::Sqrt(0.1);
+		constexpr double modulo = deterministic::Modulo(1.0e300, deterministic::twoPi);
+
+		// Runtime copies of the inputs
+		const volatile double inputs[6] = { 100.0, -0.9, -7.5, 10.0, 0.1, 1.0e300 };
+
+		CHECK(Bits(sin) == Bits(deterministic::Sin(inputs[0])));
+		CHECK(Bits(asin) == Bits(deterministic::Asin(inputs[1])));
+		CHECK(Bits(atan) == Bits(deterministic::Atan(inputs[2])));
+		CHECK(Bits(root) == Bits(deterministic::Root(inputs[3], 3)));
+		CHECK(Bits(sqrt) == Bits(std::sqrt(inputs[4])));
+		CHECK(Bits(modulo) == Bits(std::fmod(inputs[5], deterministic::twoPi)));
+
+		STATIC_REQUIRE(deterministic::Sqrt(2.25) == 1.5);
+		STATIC_REQUIRE(deterministic::Modulo(7.5, -2.0) == 1.5);
+		STATIC_REQUIRE(deterministic::Modulo(-7.5, 2.0) == -1.5);
+	}
+
+	SECTION("Accuracy")
+	{
+		for (int i = -4000; i <= 4000; ++i)
+		{
+			const double angle = i * 0.0123;
+			const double value = i / 4000.0;
+			const double ratio = std::ldexp(1.0 + std::abs(i) / 8192.0, i / 200);
+
+			CHECK(UlpError(deterministic::Sin(angle), std::sin(static_cast<long double>(angle))) <= 2.0);
+			CHECK(UlpError(deterministic::Cos(angle), std::cos(static_cast<long double>(angle))) <= 2.0);
+			CHECK(UlpError(deterministic::Asin(value), std::asin(static_cast<long double>(value))) <= 4.0);
+			CHECK(UlpError(deterministic::Acos(value), std::acos(static_cast<long double>(value))) <= 4.0);
+			CHECK(UlpError(deterministic::Atan(ratio), std::atan(static_cast<long double>(ratio))) <= 2.0);
+			CHECK(UlpError(deterministic::Root(ratio, 3), std::cbrt(static_cast<long double>(ratio))) <= 2.0);
+
+			if (std::abs(std::cos(angle)) > 1.0e-3)
+				CHECK(UlpError(deterministic::Tan(angle), std::tan(static_cast<long double>(angle))) <= 4.0);
+
+			// float results are rounded once from double, a half float ulp plus the double error
+			const float angleFloat = static_cast<float>(angle);
+
+			CHECK(UlpError(static_cast<float>(deterministic::Sin(angleFloat)), std::sin(static_cast<long double>(angleFloat))) <= 1.0);
+		}
+
+		CHECK(deterministic::Sin(-0.0) == 0.0);
+		CHECK(std::signbit(deterministic::Sin(-0.0)));
+		CHECK(deterministic::Asin(1.0) == deterministic::halfPiHigh);
+		CHECK(deterministic::Acos(-1.0) == deterministic::piHigh);
+		CHECK(deterministic::Atan(std::numeric_limits<double>::infinity()) == deterministic::halfPiHigh);
+		CHECK(std::isnan(deterministic::Sin(std::numeric_limits<double>::infinity())));
+		CHECK(std::isnan(deterministic::Asin(1.5)));
+		CHECK(std::isnan(deterministic::Atan(std::numeric_limits<double>::quiet_NaN())));
+	}
+
+#ifdef LIBMATH_DETERMINISTIC
+	SECTION("Arithmetic")
+	{
+		// Arithmetic.h routes every floating point call through math::deterministic
+		for (int i = -100; i <= 100; ++i)
+		{
+			const float angle = i * 0.37f;
+			const float value = i / 100.0f;
+
+			CHECK(Bits(LibMath::Sin(angle)) == Bits(static_cast<float>(deterministic::Sin(angle))));
+			CHECK(Bits(LibMath::Cos(angle)) == Bits(static_cast<float>(deterministic::Cos(angle))));
+			CHECK(Bits(LibMath::Tan(angle)) == Bits(static_cast<float>(deterministic::Tan(angle))));
+			CHECK(Bits(LibMath::Asin(value)) == Bits(static_cast<float>(deterministic::Asin(value))));
+			CHECK(Bits(LibMath::Acos(value)) == Bits(static_cast<float>(deterministic::Acos(value))));
+			CHECK(Bits(LibMath::Atan(angle)) == Bits(static_cast<float>(deterministic::Atan(angle))));
+			CHECK(Bits(LibMath::Root(std::abs(angle), 3)) == Bits(static_cast<float>(deterministic::Root(std::abs(angle), 3))));
+			CHECK(Bits(LibMath::Sin(static_cast<double>(angle))) == Bits(deterministic::Sin(angle)));
+
+			float sin = 0.0f;
+			float cos = 0.0f;
+
+			LibMath::SinCos(angle, sin, cos);
+
+			CHECK(Bits(sin) == Bits(LibMath::Sin(angle)));
+			CHECK(Bits(cos) == Bits(LibMath::Cos(angle)));
+		}
+
+		// Exact reciprocal sqrt instead of the vendor specific estimate
+		CHECK(LibMath::RSqrt(2.0f, LibMath::Precision::Fast) == 1.0f / std::sqrt(2.0f));
+
+		STATIC_REQUIRE(LibMath::Sin(0.5) == deterministic::Sin(0.5));
+		STATIC_REQUIRE(LibMath::Sqrt(2.0f) == static_cast<float>(deterministic::Sqrt(2.0)));
+	}
+
+	SECTION("Simulation")
+	{
+		// Rotations, slerp & trigonometry chained over 240 steps, the same bits on every platform
+		LibMath::Quaternion<float> orientation(1.0f, 0.0f, 0.0f, 0.0f);
+		LibMath::Vector3<float> position(1.0f, 0.0f, 0.0f);
+
+		const LibMath::Quaternion<float> target = LibMath::Quaternion<float>::AngleAxis(2.0f, LibMath::Vector3<float>(0.3f, 1.0f, -0.5f));
+
+		for (int i = 0; i < 240; ++i)
+		{
+			orientation = LibMath::Slerp(orientation, target, 0.05f);
+			position = orientation.RotateVector(position) + LibMath::Vector3<float>(LibMath::Sin(i * 0.1f), 0.0f, LibMath::Acos(LibMath::Cos(i * 0.05f))) * 0.01f;
+		}
+
+		CHECK(Bits(position[0]) == 0xBF990DB2u);
+		CHECK(Bits(position[1]) == 0xBF9E9EB7u);
+		CHECK(Bits(position[2]) == 0x3DA34C8Fu);
+		CHECK(Bits(orientation[0]) == 0x3EF859F5u);
+	}
+#endif
+}
@@ -0,0 +1,131 @@
+#include "LibMath/Expression.h"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+TEST_CASE("Expression", "[.all][vector][expression]")
+{
+	using namespace LibMath::expr;
+
+	SECTION("Vector")
+	{
+		LibMath::Vector2<float> vec2A(1.5f, -2.25f);
+		LibMath::Vector2<float> vec2B(0.3f, 7.0f);
+		const LibMath::Vector3<float> vec3A(1.5f, -2.25f, 3.1f);
+		const LibMath::Vector3<float> vec3B(0.3f, 7.0f, -0.7f);
+		const LibMath::Vector3<double> vec3DoubleA(1.5, -2.25, 3.1);
+		const LibMath::Vector3<double> vec3DoubleB(0.3, 7.0, -0.7);
+		const LibMath::Vector4<float> vec4A(1.5f, -2.25f, 3.1f, 0.9f);
+		const LibMath::Vector4<float> vec4B(0.3f, 7.0f, -0.7f, 4.0f);
+
+		// Same order as the chained operators, results match bit for bit
+		CHECK(Evaluate(Lazy(vec2A) + Lazy(vec2B) * 0.1f - vec2A) == (vec2A + vec2B * 0.1f) - vec2A);
+		CHECK(Evaluate(Lazy(vec3A) + Lazy(vec3B) * 0.1f - vec3A) == (vec3A + vec3B * 0.1f) - vec3A);
+		CHECK(Evaluate(Lazy(vec3DoubleA) * vec3DoubleB / 3.0) == vec3DoubleA * vec3DoubleB / 3.0);
+		CHECK(Evaluate(Lazy(vec4A) + Lazy(vec4B) * 0.1f - vec4A) == (vec4A + vec4B * 0.1f) - vec4A);
+		CHECK(Evaluate(Lazy(vec4A) / vec4B - Lazy(vec4A) / 2.0f) == vec4A / vec4B - vec4A / 2.0f);
+
+		// Scalars on either side, negate
+		CHECK(Evaluate(2.0f * Lazy(vec3A)) == vec3A * 2.0f);
+		CHECK(Evaluate(-Lazy(vec3A) + vec3B) == LibMath::Vector3<float>(-vec3A[0], -vec3A[1], -vec3A[2]) + vec3B);
+		CHECK(Evaluate(-(Lazy(vec4A) - vec4B)) == LibMath::Vector4<float>(vec4B[0] - vec4A[0], vec4B[1] - vec4A[1], vec4B[2] - vec4A[2], vec4B[3] - vec4A[3]));
+
+		// Nothing is computed before Evaluate, operands are captured by value
+		LibMath::Vector3<float> vec3C(1.0f);
+		auto const expression = Lazy(vec3C) * 2.0f;
+		vec3C = LibMath::Vector3<float>(5.0f);
+
+		CHECK(Evaluate(expression) == LibMath::Vector3<float>(2.0f));
+	}
+
+	SECTION("Stream")
+	{
+		// Odd size so both the SIMD blocks & the scalar tail are covered
+		constexpr size_t size = 13;
+
+		std::vector<LibMath::Vector3<float>> vectorsA;
+		std::vector<LibMath::Vector3<float>> vectorsB;
+		std::vector<LibMath::Vector3<float>> vectorsC;
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			const float value = static_cast<float>(i);
+
+			vectorsA.emplace_back(value * 0.3f + 1.0f, value - 2.0f, value * 0.7f);
+			vectorsB.emplace_back(3.5f - value, value * 1.1f + 0.5f, 2.0f);
+			vectorsC.emplace_back(value * value, -value, 0.5f);
+		}
+
+		LibMath::Vector3Stream<float> streamA(vectorsA.data(), size);
+		LibMath::Vector3Stream<float> streamB(vectorsB.data(), size);
+		LibMath::Vector3Stream<float> streamC(vectorsC.data(), size);
+		LibMath::Vector3Stream<float> result(size);
+
+		const float step = 0.016f;
+		const LibMath::Vector3<float> offset(1.0f, -2.0f, 0.25f);
+
+		Evaluate(Lazy(streamA) + Lazy(streamB) * step - streamC, result);
+
+		for (size_t i = 0; i < size; ++i)
+			CHECK(result.Get(i) == (vectorsA[i] + vectorsB[i] * step) - vectorsC[i]);
+
+		// Vectors apply to every element
+		Evaluate((Lazy(streamA) - offset) / streamB, result);
+
+		for (size_t i = 0; i < size; ++i)
+			CHECK(result.Get(i) == (vectorsA[i] - offset) / vectorsB[i]);
+
+		// Strided view of the Vector3 array takes the scalar path
+		LibMath::Vector3StreamView<float> viewB(vectorsB.data(), size);
+
+		Evaluate(Lazy(streamA) * viewB + offset, result);
+
+		for (size_t i = 0; i < size; ++i)
+			CHECK(result.Get(i) == vectorsA[i] * vectorsB[i] + offset);
+
+		// Result may be one of the operands
+		Evaluate(Lazy(streamA) + Lazy(streamB) * step, streamA);
+		Evaluate(-Lazy(viewB), viewB);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			CHECK(streamA.Get(i) == vectorsA[i] + LibMath::Vector3<float>(3.5f - static_cast<float>(i), static_cast<float>(i) * 1.1f + 0.5f, 2.0f) * step);
+			CHECK(vectorsB[i] == LibMath::Vector3<float>(static_cast<float>(i) - 3.5f, -(static_cast<float>(i) * 1.1f + 0.5f), -2.0f));
+		}
+	}
+
+	SECTION("Double stream")
+	{
+		constexpr size_t size = 7;
+
+		LibMath::Vector3Stream<double> streamA(size);
+		LibMath::Vector3Stream<double> streamB(size);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			const double value = static_cast<double>(i);
+
+			streamA.Set(i, LibMath::Vector3<double>(value, value * 0.5, -value));
+			streamB.Set(i, LibMath::Vector3<double>(1.0 / (value + 1.0), 2.0, value * 3.0));
+		}
+
+		Evaluate(Lazy(streamA) * 0.25 + streamB, streamA);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			const double value = static_cast<double>(i);
+
+			CHECK(streamA.Get(i) == LibMath::Vector3<double>(value, value * 0.5, -value) * 0.25 + LibMath::Vector3<double>(1.0 / (value + 1.0), 2.0, value * 3.0));
+		}
+	}
+
+	SECTION("Constexpr")
+	{
+		constexpr LibMath::Vector3<float> vec3(1.0f, 2.0f, 3.0f);
+		constexpr LibMath::Vector4<float> vec4(1.0f, 2.0f, 3.0f, 4.0f);
+
+		STATIC_REQUIRE(Evaluate(Lazy(vec3) * 2.0f - vec3) == vec3);
+		STATIC_REQUIRE(Evaluate(Lazy(vec4) * 2.0f - vec4) == vec4);
+	}
+}
@@ -0,0 +1,182 @@
+#include "LibMath/Fixed.h"
+#include "LibMath/Matrix.h"
+#include "LibMath/Quaternion.h"
+#include "LibMath/Vector.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+using Fixed = LibMath::Fixed16_16;
+using FixedTruncate = LibMath::Fixed<16, 16, LibMath::FixedOverflow::Saturate, LibMath::FixedRounding::Truncate>;
+using FixedWrap = LibMath::Fixed<8, 8, LibMath::FixedOverflow::Wrap>;
+
+TEST_CASE("Fixed", "[.all][fixed]")
+{
+	constexpr double lsb = 1.0 / 65536.0;
+
+	SECTION("Conversion")
+	{
+		CHECK(Fixed(1).Raw() == 65536);
+		CHECK(Fixed(-2.5f).Raw() == -163840);
+		CHECK(Fixed(0.1).Raw() == 6554);
+		CHECK(static_cast<float>(Fixed(0.75f)) == 0.75f);
+		CHECK(static_cast<int>(Fixed(-2.75f)) == -2);
+		CHECK(static_cast<int>(Fixed(2.75f)) == 2);
+
+		// Nearest rounds ties up, truncate rounds down
+		CHECK(Fixed(1.5 * lsb).Raw() == 2);
+		CHECK(Fixed(-1.5 * lsb).Raw() == -1);
+		CHECK(FixedTruncate(1.5 * lsb).Raw() == 1);
+		CHECK(FixedTruncate(-1.5 * lsb).Raw() == -2);
+
+		// Saturate clamps, wrap keeps the low bits
+		CHECK(Fixed(40000).Raw() == INT32_MAX);
+		CHECK(Fixed(-1.0e9f).Raw() == INT32_MIN);
+		CHECK(Fixed(std::numeric_limits<float>::quiet_NaN()).Raw() == 0);
+		CHECK(FixedWrap(130).Raw() == -126 * 256);
+		CHECK(FixedWrap(-129.5f).Raw() == 126 * 256 + 128);
+
+		CHECK(std::numeric_limits<Fixed>::epsilon().Raw() == 1);
+		CHECK(std::numeric_limits<Fixed>::max().Raw() == INT32_MAX);
+		CHECK(std::numeric_limits<FixedWrap>::lowest().Raw() == -32768);
+	}
+
+	SECTION("Arithmetic")
+	{
+		CHECK(Fixed(1.5f) + Fixed(2.25f) == Fixed(3.75f));
+		CHECK(Fixed(1.5f) - 2 == Fixed(-0.5f));
+		CHECK(Fixed(1.5f) * Fixed(-2.5f) == Fixed(-3.75f));
+		CHECK(Fixed(7) / Fixed(2) == Fixed(3.5f));
+		CHECK(1.0f / Fixed(3) == Fixed(1.0 / 3.0));
+		CHECK(-Fixed(2.0f) == Fixed(-2.0f));
+		CHECK(Fixed(5.5f) % Fixed(2) == Fixed(1.5f));
+		CHECK(Fixed(-5.5f) % Fixed(2) == Fixed(-1.5f));
+		CHECK(Fixed(0.5f) < 1);
+		CHECK(2 > Fixed(1.5f));
+
+		// Rounding of the product & quotient low bits
+		CHECK((Fixed::FromRaw(3) * Fixed(0.5f)).Raw() == 2);
+		CHECK((FixedTruncate::FromRaw(3) * FixedTruncate(0.5f)).Raw() == 1);
+		CHECK((Fixed::FromRaw(-3) * Fixed(0.5f)).Raw() == -1);
+		CHECK((FixedTruncate::FromRaw(-3) * FixedTruncate(0.5f)).Raw() == -2);
+		CHECK((Fixed(2) / Fixed(3)).Raw() == 43691);
+		CHECK((FixedTruncate(2) / FixedTruncate(3)).Raw() == 43690);
+		CHECK((Fixed(-2) / Fixed(3)).Raw() == -43691);
+
+		// Overflow
+		CHECK(Fixed(30000) + Fixed(30000) == std::numeric_limits<Fixed>::max());
+		CHECK(Fixed(-300) * Fixed(300) == std::numeric_limits<Fixed>::lowest());
+		CHECK(-std::numeric_limits<Fixed>::lowest() == std::numeric_limits<Fixed>::max());
+		CHECK(Fixed(1) / Fixed() == std::numeric_limits<Fixed>::max());
+		CHECK(Fixed(-1) / Fixed() == std::numeric_limits<Fixed>::lowest());
+		CHECK(FixedWrap(100) + FixedWrap(100) == FixedWrap(-56));
+		CHECK(FixedWrap(16) * FixedWrap(16) == FixedWrap(0));
+	}
+
+	SECTION("Functions")
+	{
+		CHECK(math::Sqrt(Fixed(4)) == Fixed(2));
+		CHECK(math::Sqrt(Fixed(2)).Raw() == 92682);
+		CHECK(math::Sqrt(FixedTruncate(2)).Raw() == 92681);
+		CHECK(math::Sqrt(Fixed(-1)) == Fixed());
+		CHECK(math::Sqrt(std::numeric_limits<Fixed>::max()) == Fixed(181.01933598375618));
+
+		CHECK(math::Sin(Fixed()) == Fixed());
+		CHECK(math::Cos(Fixed()) == Fixed(1));
+		CHECK(math::Atan(Fixed(1)) == Fixed(0.7853981633974483));
+		CHECK(math::Asin(Fixed(-1)) == Fixed(-1.5707963267948966));
+		CHECK(math::Acos(Fixed(-1)) == Fixed(3.141592653589793));
+		CHECK(math::Modulo(Fixed(7.5f), Fixed(2)) == Fixed(1.5f));
+
+		// Within half a step of the exact value when rounding to nearest
+		for (int32_t raw = -40 * 65536; raw <= 40 * 65536; raw += 97)
+		{
+			const Fixed value = Fixed::FromRaw(raw);
+			const double angle = static_cast<double>(value);
+
+			CHECK(std::abs(static_cast<double>(math::Sin(value)) - std::sin(angle)) <= lsb * 0.5001);
+			CHECK(std::abs(static_cast<double>(math::Cos(value)) - std::cos(angle)) <= lsb * 0.5001);
+			CHECK(std::abs(static_cast<double>(math::Atan(value)) - std::atan(angle)) <= lsb * 0.5001);
+
+			if (raw >= 0)
+				CHECK(std::abs(static_cast<double>(math::Sqrt(value)) - std::sqrt(angle)) <= lsb * 0.5);
+
+			if (std::abs(angle) <= 1.0)
+			{
+				CHECK(std::abs(static_cast<double>(math::Asin(value)) - std::asin(angle)) <= lsb * 0.5001);
+				CHECK(std::abs(static_cast<double>(math::Acos(value)) - std::acos(angle)) <= lsb * 0.5001);
+			}
+
+			if (std::abs(std::cos(angle)) > 0.1)
+				CHECK(std::abs(static_cast<double>(math::Tan(value)) - std::tan(angle)) <= lsb * 0.5001 * (1.0 + std::tan(angle) * std::tan(angle)));
+		}
+	}
+
+	SECTION("Templates")
+	{
+		LibMath::Vector3<Fixed> vec3(Fixed(1), Fixed(2), Fixed(2));
+
+		CHECK(vec3.Magnitude() == Fixed(3));
+		CHECK(vec3.Dot(LibMath::Vector3<Fixed>(Fixed(2), Fixed(-1), Fixed(0.5f))) == Fixed(1));
+		CHECK(vec3.Cross(LibMath::Vector3<Fixed>::Up()) == LibMath::Vector3<Fixed>(Fixed(-2), Fixed(0), Fixed(1)));
+		CHECK(static_cast<float>(vec3.Normalize()[2]) == Catch::Approx(2.0f / 3.0f).margin(lsb));
+
+		const LibMath::Quaternion<Fixed> quat = LibMath::Quaternion<Fixed>::AngleAxis(Fixed(1.5707963267948966), LibMath::Vector3<Fixed>::Up());
+		const LibMath::Vector3<Fixed> rotated = quat.RotateVector(LibMath::Vector3<Fixed>::Right());
+
+		CHECK(static_cast<float>(rotated[0]) == Catch::Approx(0.0f).margin(4.0 * lsb));
+		CHECK(static_cast<float>(rotated[2]) == Catch::Approx(-1.0f).margin(4.0 * lsb));
+
+		const LibMath::Quaternion<Fixed> halfway = LibMath::Slerp(LibMath::Quaternion<Fixed>(Fixed(1), Fixed(0), Fixed(0), Fixed(0)), quat, Fixed(0.5f));
+
+		CHECK(static_cast<float>(halfway[0]) == Catch::Approx(std::cos(0.3926991f)).margin(8.0 * lsb));
+
+		LibMath::Matrix4<Fixed> matrix = LibMath::Matrix4<Fixed>::Identity();
+		matrix.Scale(Fixed(2));
+		matrix.m_matrix[3][0] = Fixed(5);
+
+		const LibMath::Matrix4<Fixed> product = matrix * matrix;
+
+		CHECK(product.m_matrix[0][0] == Fixed(4));
+		CHECK(product.m_matrix[3][0] == Fixed(15));
+		CHECK(matrix.Determinant() == Fixed(8));
+
+		LibMath::Matrix4<Fixed> inverse = product;
+		inverse.Inverse();
+
+		CHECK((inverse * product).m_matrix[3][0] == Fixed(0));
+		CHECK((inverse * product).m_matrix[1][1] == Fixed(1));
+	}
+
+	SECTION("Deterministic")
+	{
+		// Integer operations only, the same raw values on every platform & compiler
+		LibMath::Vector3<Fixed> position(Fixed(0), Fixed(10), Fixed(0));
+		LibMath::Vector3<Fixed> velocity(Fixed(3), Fixed(0), Fixed(-1.25f));
+
+		const LibMath::Quaternion<Fixed> spin = LibMath::Quaternion<Fixed>::AngleAxis(Fixed(0.1f), LibMath::Vector3<Fixed>::Up());
+		const Fixed step = Fixed(1) / Fixed(60);
+
+		for (int i = 0; i < 600; ++i)
+		{
+			velocity = spin.RotateVector(velocity) + LibMath::Vector3<Fixed>(Fixed(0), Fixed(-9.81f), Fixed(0)) * step;
+			position += velocity * step;
+		}
+
+		CHECK(position[0].Raw() == -39853);
+		CHECK(position[1].Raw() == -31529348);
+		CHECK(position[2].Raw() == -57648);
+	}
+
+	SECTION("Constexpr")
+	{
+		STATIC_REQUIRE(Fixed(1.5f) * Fixed(2) == Fixed(3));
+		STATIC_REQUIRE(math::Sqrt(Fixed(9)) == Fixed(3));
+		STATIC_REQUIRE(math::Sin(Fixed()) == Fixed());
+		STATIC_REQUIRE(LibMath::Vector3<Fixed>(Fixed(3), Fixed(4), Fixed(0)).Magnitude() == Fixed(5));
+	}
+}
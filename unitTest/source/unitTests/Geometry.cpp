@@ -0,0 +1,931 @@
+#include "LibMath/Geometry.h"
+#include "LibMath/simd/Simd.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtx/intersect.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+#define CHECK_PLANE(plane, a, b, c, d)\
+CHECK(plane.Normal()[0] == Catch::Approx(a).margin(1e-6));\
+CHECK(plane.Normal()[1] == Catch::Approx(b).margin(1e-6));\
+CHECK(plane.Normal()[2] == Catch::Approx(c).margin(1e-6));\
+CHECK(plane.Distance() == Catch::Approx(d).margin(1e-5))
+
+TEST_CASE("Plane", "[.all][geometry]")
+{
+	SECTION("Constructor")
+	{
+		const math::Plane<float> plane(math::Vector3<float>(0.0f, 0.0f, 1.0f), math::Vector3<float>(1.0f, 2.0f, 3.0f));
+
+		CHECK_PLANE(plane, 0.0f, 0.0f, 1.0f, -3.0f);
+		CHECK(plane == math::Plane<float>(0.0f, 0.0f, 1.0f, -3.0f));
+		CHECK(plane != math::Plane<float>(math::Vector3<float>(0.0f, 0.0f, 1.0f), 3.0f));
+	}
+
+	SECTION("Functions")
+	{
+		math::Plane<float> plane(0.0f, 3.0f, 4.0f, 10.0f);
+		plane.Normalize();
+
+		CHECK_PLANE(plane, 0.0f, 0.6f, 0.8f, 2.0f);
+		CHECK(plane.SignedDistance(math::Vector3<float>(0.0f)) == Catch::Approx(2.0f));
+		CHECK(plane.SignedDistance(math::Vector3<float>(5.0f, -6.0f, -8.0f)) == Catch::Approx(-8.0f));
+
+		const math::Vector3<float> projected = plane.Project(math::Vector3<float>(1.0f, 2.0f, 3.0f));
+		CHECK(plane.SignedDistance(projected) == Catch::Approx(0.0f).margin(1e-6));
+		CHECK(projected[0] == 1.0f);
+	}
+
+	SECTION("Constexpr")
+	{
+		constexpr math::Plane<double> plane = math::Plane<double>(0.0, 0.0, 2.0, -4.0).Normalize();
+
+		STATIC_REQUIRE(plane.Distance() == -2.0);
+		STATIC_REQUIRE(plane.SignedDistance(math::Vector3<double>(1.0, 1.0, 5.0)) == 3.0);
+	}
+}
+
+TEST_CASE("AABB", "[.all][geometry]")
+{
+	const math::AABB<float> box(math::Vector3<float>(-1.0f, 0.0f, 2.0f), math::Vector3<float>(3.0f, 1.0f, 4.0f));
+
+	SECTION("Functions")
+	{
+		CHECK(box.Center() == math::Vector3<float>(1.0f, 0.5f, 3.0f));
+		CHECK(box.Extents() == math::Vector3<float>(2.0f, 0.5f, 1.0f));
+		CHECK(math::AABB<float>::FromCenter(box.Center(), box.Extents()) == box);
+
+		CHECK(box.Contains(math::Vector3<float>(0.0f, 0.5f, 3.0f)));
+		CHECK(box.Contains(math::Vector3<float>(3.0f, 1.0f, 4.0f)));
+		CHECK_FALSE(box.Contains(math::Vector3<float>(0.0f, 1.5f, 3.0f)));
+
+		// Touching boxes intersect
+		CHECK(box.Intersects(math::AABB<float>(math::Vector3<float>(3.0f, 0.0f, 2.0f), math::Vector3<float>(5.0f, 1.0f, 4.0f))));
+		CHECK_FALSE(box.Intersects(math::AABB<float>(math::Vector3<float>(3.1f, 0.0f, 2.0f), math::Vector3<float>(5.0f, 1.0f, 4.0f))));
+
+		math::AABB<float> extended = box;
+		extended.Extend(math::Vector3<float>(-2.0f, 0.5f, 5.0f)).Extend(math::AABB<float>(math::Vector3<float>(0.0f, -3.0f, 2.0f), math::Vector3<float>(1.0f, 0.0f, 3.0f)));
+
+		CHECK(extended.Min() == math::Vector3<float>(-2.0f, -3.0f, 2.0f));
+		CHECK(extended.Max() == math::Vector3<float>(3.0f, 1.0f, 5.0f));
+	}
+
+	SECTION("Constexpr")
+	{
+		constexpr math::AABB<double> constBox = math::AABB<double>::FromCenter(math::Vector3<double>(1.0), math::Vector3<double>(0.5));
+
+		STATIC_REQUIRE(constBox.Contains(math::Vector3<double>(1.25, 0.75, 1.5)));
+		STATIC_REQUIRE(constBox.Min()[0] == 0.5);
+	}
+}
+
+TEST_CASE("Sphere", "[.all][geometry]")
+{
+	const math::Sphere<float> sphere(math::Vector3<float>(1.0f, 2.0f, 3.0f), 2.0f);
+
+	CHECK(sphere.Contains(math::Vector3<float>(1.0f, 4.0f, 3.0f)));
+	CHECK_FALSE(sphere.Contains(math::Vector3<float>(2.5f, 3.5f, 3.0f)));
+
+	CHECK(sphere.Intersects(math::Sphere<float>(math::Vector3<float>(4.0f, 2.0f, 3.0f), 1.0f)));
+	CHECK_FALSE(sphere.Intersects(math::Sphere<float>(math::Vector3<float>(4.0f, 2.0f, 3.5f), 1.0f)));
+
+	// Closest point of the box is (3, 4, 3), 2.83 away from the center
+	CHECK(sphere.Intersects(math::AABB<float>(math::Vector3<float>(2.5f, 2.5f, 0.0f), math::Vector3<float>(4.0f, 4.0f, 4.0f))));
+	CHECK_FALSE(sphere.Intersects(math::AABB<float>(math::Vector3<float>(3.0f, 4.0f, 0.0f), math::Vector3<float>(4.0f, 5.0f, 4.0f))));
+	CHECK(sphere.Intersects(math::AABB<float>(math::Vector3<float>(-10.0f), math::Vector3<float>(10.0f))));
+}
+
+TEST_CASE("Triangle", "[.all][geometry]")
+{
+	const math::Triangle<float> triangle(math::Vector3<float>(0.0f), math::Vector3<float>(2.0f, 0.0f, 0.0f), math::Vector3<float>(0.0f, 3.0f, 0.0f));
+
+	CHECK(triangle.Normal() == math::Vector3<float>(0.0f, 0.0f, 1.0f));
+	CHECK(triangle.Area() == Catch::Approx(3.0f));
+	CHECK(triangle.Centroid()[0] == Catch::Approx(2.0f / 3.0f));
+	CHECK(triangle.Centroid()[1] == Catch::Approx(1.0f));
+	CHECK(triangle[2] == math::Vector3<float>(0.0f, 3.0f, 0.0f));
+}
+
+TEST_CASE("Ray", "[.all][geometry]")
+{
+	SECTION("Box")
+	{
+		const math::AABB<float> box(math::Vector3<float>(0.0f), math::Vector3<float>(1.0f));
+		float distance = -1.0f;
+
+		CHECK(math::Ray<float>(math::Vector3<float>(-5.0f, 0.5f, 0.5f), math::Vector3<float>(1.0f, 0.0f, 0.0f)).Intersect(box, distance));
+		CHECK(distance == 5.0f);
+
+		CHECK(math::Ray<float>(math::Vector3<float>(2.0f, 3.0f, 0.5f), math::Vector3<float>(-1.0f, -1.0f, 0.0f)).Intersect(box, distance));
+		CHECK(distance == 2.0f);
+
+		// Inside, pointing away & parallel outside a slab
+		CHECK(math::Ray<float>(math::Vector3<float>(0.5f), math::Vector3<float>(0.0f, 1.0f, 0.0f)).Intersect(box, distance));
+		CHECK(distance == 0.0f);
+		CHECK_FALSE(math::Ray<float>(math::Vector3<float>(-5.0f, 0.5f, 0.5f), math::Vector3<float>(-1.0f, 0.0f, 0.0f)).Intersect(box, distance));
+		CHECK_FALSE(math::Ray<float>(math::Vector3<float>(-5.0f, 2.0f, 0.5f), math::Vector3<float>(1.0f, 0.0f, 0.0f)).Intersect(box, distance));
+	}
+
+	SECTION("Sphere")
+	{
+		const math::Sphere<float> sphere(math::Vector3<float>(0.0f), 1.0f);
+		float distance = -1.0f;
+
+		// Distances are in units of the direction length
+		CHECK(math::Ray<float>(math::Vector3<float>(0.0f, 0.0f, -10.0f), math::Vector3<float>(0.0f, 0.0f, 2.0f)).Intersect(sphere, distance));
+		CHECK(distance == 4.5f);
+
+		CHECK(math::Ray<float>(math::Vector3<float>(0.0f, 0.5f, 0.0f), math::Vector3<float>(1.0f, 0.0f, 0.0f)).Intersect(sphere, distance));
+		CHECK(distance == 0.0f);
+
+		CHECK_FALSE(math::Ray<float>(math::Vector3<float>(0.0f, 0.0f, -10.0f), math::Vector3<float>(0.0f, 0.0f, -1.0f)).Intersect(sphere, distance));
+		CHECK_FALSE(math::Ray<float>(math::Vector3<float>(0.0f, 1.5f, -10.0f), math::Vector3<float>(0.0f, 0.0f, 1.0f)).Intersect(sphere, distance));
+	}
+
+	SECTION("Plane")
+	{
+		const math::Plane<float> plane(math::Vector3<float>(0.0f, 1.0f, 0.0f), math::Vector3<float>(0.0f, -1.0f, 0.0f));
+		float distance = -1.0f;
+
+		CHECK(math::Ray<float>(math::Vector3<float>(3.0f, 5.0f, 0.0f), math::Vector3<float>(0.0f, -1.0f, 0.0f)).Intersect(plane, distance));
+		CHECK(distance == 6.0f);
+
+		CHECK_FALSE(math::Ray<float>(math::Vector3<float>(3.0f, 5.0f, 0.0f), math::Vector3<float>(1.0f, 0.0f, 0.0f)).Intersect(plane, distance));
+		CHECK_FALSE(math::Ray<float>(math::Vector3<float>(3.0f, 5.0f, 0.0f), math::Vector3<float>(0.0f, 1.0f, 0.0f)).Intersect(plane, distance));
+	}
+
+	SECTION("Triangle")
+	{
+		const math::Triangle<float> triangle(math::Vector3<float>(-1.0f, -1.0f, 0.0f), math::Vector3<float>(2.0f, -1.0f, 0.0f), math::Vector3<float>(-1.0f, 2.0f, 0.3f));
+		const math::Vector3<float> origin(0.1f, 0.2f, 4.0f);
+		const math::Vector3<float> direction = math::Vector3<float>(-0.1f, 0.05f, -1.0f).Normalize();
+
+		glm::vec2 barycentric;
+		float distanceGLM = 0.0f;
+		const bool hitGLM = glm::intersectRayTriangle(
+			glm::vec3(origin[0], origin[1], origin[2]), glm::vec3(direction[0], direction[1], direction[2]),
+			glm::vec3(-1.0f, -1.0f, 0.0f), glm::vec3(2.0f, -1.0f, 0.0f), glm::vec3(-1.0f, 2.0f, 0.3f),
+			barycentric, distanceGLM
+		);
+
+		float distance = -1.0f;
+
+		REQUIRE(hitGLM);
+		CHECK(math::Ray<float>(origin, direction).Intersect(triangle, distance));
+		CHECK(distance == Catch::Approx(distanceGLM));
+
+		// Double sided, misses beside the triangle & behind the origin
+		CHECK(math::Ray<float>(math::Vector3<float>(0.0f, 0.0f, -4.0f), math::Vector3<float>(0.0f, 0.0f, 1.0f)).Intersect(triangle, distance));
+		CHECK(distance == Catch::Approx(4.1f));
+		CHECK_FALSE(math::Ray<float>(math::Vector3<float>(1.5f, 1.5f, 4.0f), math::Vector3<float>(0.0f, 0.0f, -1.0f)).Intersect(triangle, distance));
+		CHECK_FALSE(math::Ray<float>(origin, math::Vector3<float>(0.0f, 0.0f, 1.0f)).Intersect(triangle, distance));
+		CHECK_FALSE(math::Ray<float>(origin, math::Vector3<float>(1.0f, 0.0f, 0.0f)).Intersect(triangle, distance));
+	}
+
+	SECTION("Constexpr")
+	{
+		constexpr double distance = []()
+		{
+			double result = 0.0;
+			math::Ray<double>(math::Vector3<double>(0.0, 0.0, -3.0), math::Vector3<double>(0.0, 0.0, 1.0)).Intersect(math::Sphere<double>(math::Vector3<double>(0.0), 1.0), result);
+			return result;
+		}();
+
+		STATIC_REQUIRE(distance == 2.0);
+	}
+}
+
+TEST_CASE("Ray batch", "[.all][geometry]")
+{
+	// Shapes scattered around the ray, odd size so every kernel runs its tail
+	constexpr size_t count = 1031;
+	constexpr float infinity = std::numeric_limits<float>::infinity();
+
+	const math::Ray<float> ray(math::Vector3<float>(0.5f, -0.25f, 20.0f), math::Vector3<float>(0.01f, 0.02f, -1.0f));
+
+	std::vector<math::Vector3<float>> mins;
+	std::vector<math::Vector3<float>> maxs;
+	std::vector<math::Vector3<float>> vertices0;
+	std::vector<math::Vector3<float>> vertices1;
+	std::vector<math::Vector3<float>> vertices2;
+	std::vector<math::Vector3<float>> normals;
+	std::vector<float> radii;
+	std::vector<float> planeDistances;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const float value = static_cast<float>(i);
+		const math::Vector3<float> center(std::fmod(value * 0.37f, 6.0f) - 3.0f, std::fmod(value * 0.73f, 6.0f) - 3.0f, std::fmod(value * 1.31f, 50.0f) - 25.0f);
+		const math::Vector3<float> extents(std::fmod(value * 0.11f, 2.0f) + 0.1f, std::fmod(value * 0.17f, 2.0f) + 0.1f, std::fmod(value * 0.07f, 1.0f) + 0.1f);
+
+		mins.push_back(center - extents);
+		maxs.push_back(center + extents);
+		radii.push_back(extents[0]);
+
+		vertices0.push_back(center - extents);
+		vertices1.push_back(center + math::Vector3<float>(extents[0] * 2.0f, -extents[1], extents[2]));
+		vertices2.push_back(center + math::Vector3<float>(-extents[0], extents[1] * 2.0f, -extents[2]));
+
+		normals.push_back(math::Vector3<float>(std::fmod(value * 0.3f, 2.0f) - 1.0f, 1.0f, std::fmod(value * 0.7f, 2.0f) - 1.0f).Normalize());
+		planeDistances.push_back(std::fmod(value * 0.9f, 40.0f) - 20.0f);
+	}
+
+	// Parallel & degenerate shapes
+	normals[7] = math::Vector3<float>(1.0f, 0.0f, 0.01f).Normalize();
+	vertices2[11] = vertices1[11];
+
+	const math::Vector3Stream<float> minStream(mins.data(), count);
+	const math::Vector3Stream<float> maxStream(maxs.data(), count);
+	const math::Vector3Stream<float> centerStream(mins.data(), count);
+	const math::Vector3Stream<float> vertex0Stream(vertices0.data(), count);
+	const math::Vector3Stream<float> vertex1Stream(vertices1.data(), count);
+	const math::Vector3Stream<float> vertex2Stream(vertices2.data(), count);
+	const math::Vector3Stream<float> normalStream(normals.data(), count);
+
+	std::vector<float> expectedBoxes(count);
+	std::vector<float> expectedSpheres(count);
+	std::vector<float> expectedPlanes(count);
+	std::vector<float> expectedTriangles(count);
+	size_t expectedHits[4] = {};
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const bool hits[4] =
+		{
+			ray.Intersect(math::AABB<float>(mins[i], maxs[i]), expectedBoxes[i]),
+			ray.Intersect(math::Sphere<float>(mins[i], radii[i]), expectedSpheres[i]),
+			ray.Intersect(math::Plane<float>(normals[i], planeDistances[i]), expectedPlanes[i]),
+			ray.Intersect(math::Triangle<float>(vertices0[i], vertices1[i], vertices2[i]), expectedTriangles[i])
+		};
+
+		float* expected[4] = { &expectedBoxes[i], &expectedSpheres[i], &expectedPlanes[i], &expectedTriangles[i] };
+
+		for (int shape = 0; shape < 4; ++shape)
+		{
+			if (hits[shape])
+				++expectedHits[shape];
+			else
+				*expected[shape] = infinity;
+		}
+	}
+
+	for (size_t hits : expectedHits)
+	{
+		CHECK(hits > 10);
+		CHECK(hits < count - 10);
+	}
+
+	std::vector<float> distances(count);
+	const math::simd::InstructionSet activeSet = math::simd::ActiveInstructionSet();
+
+	// Every kernel supported by the CPU matches the single shape functions bit-for-bit
+	for (int i = static_cast<int>(math::simd::InstructionSet::Scalar); i <= static_cast<int>(math::simd::InstructionSet::AVX2_FMA); ++i)
+	{
+		if (!math::simd::SetInstructionSet(static_cast<math::simd::InstructionSet>(i)))
+			continue;
+
+		CHECK(ray.IntersectBoxes(minStream, maxStream, distances) == expectedHits[0]);
+		CHECK(distances == expectedBoxes);
+
+		CHECK(ray.IntersectSpheres(centerStream, radii, distances) == expectedHits[1]);
+		CHECK(distances == expectedSpheres);
+
+		CHECK(ray.IntersectPlanes(normalStream, planeDistances, distances) == expectedHits[2]);
+		CHECK(distances == expectedPlanes);
+
+		CHECK(ray.IntersectTriangles(vertex0Stream, vertex1Stream, vertex2Stream, distances) == expectedHits[3]);
+		CHECK(distances == expectedTriangles);
+	}
+
+	math::simd::SetInstructionSet(activeSet);
+
+	// Strided views & doubles use the single shape functions
+	CHECK(ray.IntersectTriangles(math::Vector3StreamView<float>(vertices0.data(), count), math::Vector3StreamView<float>(vertices1.data(), count), math::Vector3StreamView<float>(vertices2.data(), count), distances) == expectedHits[3]);
+	CHECK(distances == expectedTriangles);
+
+	std::vector<math::Vector3<double>> boxMin = { { 0.0, 0.0, 0.0 }, { 0.0, 5.0, 0.0 } };
+	std::vector<math::Vector3<double>> boxMax = { { 1.0, 1.0, 1.0 }, { 1.0, 6.0, 1.0 } };
+	std::vector<double> distancesDouble(boxMin.size());
+
+	const math::Ray<double> rayDouble(math::Vector3<double>(0.5, 0.5, 10.0), math::Vector3<double>(0.0, 0.0, -1.0));
+
+	CHECK(rayDouble.IntersectBoxes(math::Vector3StreamView<double>(boxMin.data(), boxMin.size()), math::Vector3StreamView<double>(boxMax.data(), boxMax.size()), distancesDouble) == 1);
+	CHECK(distancesDouble[0] == 9.0);
+	CHECK(distancesDouble[1] == std::numeric_limits<double>::infinity());
+}
+
+TEST_CASE("BVH", "[.all][geometry]")
+{
+	// Boxes of mixed sizes in clusters, enough primitives for several levels of binned splits
+	constexpr size_t count = 20011;
+
+	std::vector<math::AABB<float>> boxes;
+	std::vector<math::Triangle<float>> triangles;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const float value = static_cast<float>(i);
+		const float cluster = static_cast<float>(i % 7) * 30.0f;
+		const math::Vector3<float> center(std::fmod(value * 0.37f, 40.0f) + cluster, std::fmod(value * 0.73f, 25.0f) - cluster * 0.5f, std::fmod(value * 1.31f, 60.0f) - 30.0f);
+		const math::Vector3<float> extents(std::fmod(value * 0.11f, 1.5f) + 0.05f, std::fmod(value * 0.17f, 0.8f) + 0.05f, std::fmod(value * 0.07f, 2.0f) + 0.05f);
+
+		triangles.emplace_back(center - extents, center + math::Vector3<float>(extents[0], -extents[1], extents[2]), center + math::Vector3<float>(-extents[0], extents[1], -extents[2]));
+
+		math::AABB<float> bounds(triangles.back()[0], triangles.back()[0]);
+		bounds.Extend(triangles.back()[1]).Extend(triangles.back()[2]);
+		boxes.push_back(bounds);
+	}
+
+	math::BVH<float> bvh;
+	bvh.Build(boxes);
+
+	// Every node encloses its children or primitives & every primitive is in exactly one leaf
+	auto checkTree = [&]()
+	{
+		std::span<math::BVH<float>::Node const> nodes = bvh.Nodes();
+		std::span<uint32_t const> primitives = bvh.Primitives();
+		std::vector<int> leafCount(count, 0);
+		bool enclosed = true;
+
+		auto encloses = [](math::BVH<float>::Node const& node, math::Vector3<float> const& min, math::Vector3<float> const& max)
+		{
+			return node.m_min[0] <= min[0] && node.m_min[1] <= min[1] && node.m_min[2] <= min[2] &&
+				node.m_max[0] >= max[0] && node.m_max[1] >= max[1] && node.m_max[2] >= max[2];
+		};
+
+		for (math::BVH<float>::Node const& node : nodes)
+		{
+			if (node.IsLeaf())
+			{
+				CHECK(node.m_count <= math::BVH<float>::MaxLeafSize);
+
+				for (uint32_t i = node.m_offset; i < node.m_offset + node.m_count; ++i)
+				{
+					++leafCount[primitives[i]];
+					enclosed &= encloses(node, boxes[primitives[i]].Min(), boxes[primitives[i]].Max());
+				}
+
+				continue;
+			}
+
+			for (uint32_t child = node.m_offset; child < node.m_offset + 2; ++child)
+			{
+				math::BVH<float>::Node const& childNode = nodes[child];
+
+				enclosed &= encloses(node, math::Vector3<float>(childNode.m_min[0], childNode.m_min[1], childNode.m_min[2]), math::Vector3<float>(childNode.m_max[0], childNode.m_max[1], childNode.m_max[2]));
+			}
+		}
+
+		CHECK(enclosed);
+		CHECK(std::count(leafCount.begin(), leafCount.end(), 1) == static_cast<std::ptrdiff_t>(count));
+	};
+
+	// Closest hit & overlap set against testing every primitive
+	auto checkQueries = [&]()
+	{
+		int hitCount = 0;
+
+		for (int i = 0; i < 64; ++i)
+		{
+			const float value = static_cast<float>(i);
+			const math::Ray<float> ray(math::Vector3<float>(-20.0f, std::fmod(value * 5.3f, 60.0f) - 40.0f, std::fmod(value * 3.7f, 40.0f) - 20.0f), math::Vector3<float>(1.0f, std::fmod(value * 0.13f, 0.4f) - 0.2f, std::fmod(value * 0.29f, 0.6f) - 0.3f));
+
+			float expectedBox = std::numeric_limits<float>::infinity();
+			float expectedTriangle = std::numeric_limits<float>::infinity();
+
+			for (size_t primitive = 0; primitive < count; ++primitive)
+			{
+				float distance;
+
+				if (ray.Intersect(boxes[primitive], distance))
+					expectedBox = std::min(expectedBox, distance);
+
+				if (ray.Intersect(triangles[primitive], distance))
+					expectedTriangle = std::min(expectedTriangle, distance);
+			}
+
+			float distance = std::numeric_limits<float>::infinity();
+			uint32_t primitive = 0;
+
+			CHECK(bvh.Raycast(ray, distance, primitive) == (expectedBox != std::numeric_limits<float>::infinity()));
+			CHECK(distance == expectedBox);
+
+			distance = std::numeric_limits<float>::infinity();
+
+			const bool hitTriangle = bvh.Raycast(ray, distance, primitive, [&](uint32_t index, float& hitDistance)
+			{
+				return ray.Intersect(triangles[index], hitDistance);
+			});
+
+			CHECK(hitTriangle == (expectedTriangle != std::numeric_limits<float>::infinity()));
+			CHECK(distance == expectedTriangle);
+
+			hitCount += hitTriangle ? 1 : 0;
+
+			const math::AABB<float> region = math::AABB<float>::FromCenter(ray.PointAt(30.0f + value), math::Vector3<float>(3.0f, 2.0f, 4.0f));
+			std::vector<uint32_t> expectedOverlaps;
+			std::vector<uint32_t> overlaps;
+
+			for (size_t index = 0; index < count; ++index)
+			{
+				if (boxes[index].Intersects(region))
+					expectedOverlaps.push_back(static_cast<uint32_t>(index));
+			}
+
+			CHECK(bvh.Query(region, [&](uint32_t index) { overlaps.push_back(index); }) == expectedOverlaps.size());
+
+			std::sort(overlaps.begin(), overlaps.end());
+			CHECK(overlaps == expectedOverlaps);
+		}
+
+		CHECK(hitCount > 16);
+	};
+
+	SECTION("Build")
+	{
+		CHECK(bvh.Size() == count);
+		CHECK(bvh.NodeCount() < 2 * count);
+		CHECK(bvh.Depth() > 10);
+		CHECK(bvh.Depth() < math::BVH<float>::StackSize);
+
+		math::AABB<float> bounds = boxes[0];
+
+		for (math::AABB<float> const& box : boxes)
+			bounds.Extend(box);
+
+		CHECK(bvh.Bounds() == bounds);
+
+		checkTree();
+		checkQueries();
+	}
+
+	SECTION("Refit")
+	{
+		// Every primitive moves
+		for (size_t i = 0; i < count; ++i)
+		{
+			const math::Vector3<float> offset(std::fmod(static_cast<float>(i) * 0.91f, 6.0f) - 3.0f, 1.0f, -0.5f);
+
+			boxes[i] = math::AABB<float>(boxes[i].Min() + offset, boxes[i].Max() + offset);
+			triangles[i] = math::Triangle<float>(triangles[i][0] + offset, triangles[i][1] + offset, triangles[i][2] + offset);
+		}
+
+		bvh.Refit(boxes);
+
+		checkTree();
+		checkQueries();
+
+		// A few primitives move, one of them far outside the scene
+		const std::vector<uint32_t> moved = { 3, 4, 1000, 20010 };
+
+		for (uint32_t i : moved)
+		{
+			const math::Vector3<float> offset = (i == 1000) ? math::Vector3<float>(500.0f, 0.0f, 0.0f) : math::Vector3<float>(0.0f, -2.0f, 1.5f);
+
+			boxes[i] = math::AABB<float>(boxes[i].Min() + offset, boxes[i].Max() + offset);
+			triangles[i] = math::Triangle<float>(triangles[i][0] + offset, triangles[i][1] + offset, triangles[i][2] + offset);
+		}
+
+		bvh.Refit(boxes, moved);
+
+		CHECK(bvh.Bounds().Max()[0] == boxes[1000].Max()[0]);
+
+		checkTree();
+		checkQueries();
+	}
+
+	SECTION("Parallel")
+	{
+		// The root bins 29 chunks of 4096 primitives on 8 forced threads (7 ranges of 5 chunks), the same tree as on 1 thread
+		constexpr size_t largeCount = 117003;
+
+		std::vector<math::AABB<float>> largeBoxes;
+
+		for (size_t i = 0; i < largeCount; ++i)
+		{
+			const float value = static_cast<float>(i);
+			const math::Vector3<float> center(std::fmod(value * 0.37f, 400.0f), std::fmod(value * 0.73f, 250.0f), std::fmod(value * 1.31f, 600.0f));
+			const math::Vector3<float> extents(std::fmod(value * 0.11f, 1.5f) + 0.05f, std::fmod(value * 0.17f, 0.8f) + 0.05f, std::fmod(value * 0.07f, 2.0f) + 0.05f);
+
+			largeBoxes.emplace_back(center - extents, center + extents);
+		}
+
+		auto sameTree = [](math::BVH<float> const& lhs, math::BVH<float> const& rhs)
+		{
+			if (lhs.NodeCount() != rhs.NodeCount() || !std::equal(lhs.Primitives().begin(), lhs.Primitives().end(), rhs.Primitives().begin(), rhs.Primitives().end()))
+				return false;
+
+			return std::equal(lhs.Nodes().begin(), lhs.Nodes().end(), rhs.Nodes().begin(), [](math::BVH<float>::Node const& a, math::BVH<float>::Node const& b)
+			{
+				return std::equal(a.m_min, a.m_min + 3, b.m_min) && std::equal(a.m_max, a.m_max + 3, b.m_max) && a.m_offset == b.m_offset && a.m_count == b.m_count;
+			});
+		};
+
+		math::BVH<float> single;
+		math::BVH<float> threaded;
+
+		math::SetParallelThreadCount(1);
+		single.Build(largeBoxes);
+
+		math::SetParallelThreadCount(8);
+		threaded.Build(largeBoxes);
+
+		CHECK(threaded.Size() == largeCount);
+		CHECK(sameTree(single, threaded));
+
+		for (math::AABB<float>& box : largeBoxes)
+			box = math::AABB<float>(box.Min() + math::Vector3<float>(1.0f, -2.0f, 0.5f), box.Max() + math::Vector3<float>(1.5f, -2.0f, 0.5f));
+
+		threaded.Refit(largeBoxes);
+
+		math::SetParallelThreadCount(1);
+		single.Refit(largeBoxes);
+
+		math::SetParallelThreadCount(0);
+
+		CHECK(sameTree(single, threaded));
+	}
+
+	SECTION("Degenerate")
+	{
+		// No primitives
+		math::BVH<float> empty;
+		empty.Build(std::span<math::AABB<float> const>());
+
+		float distance = 0.0f;
+		uint32_t primitive = 0;
+
+		CHECK(empty.NodeCount() == 0);
+		CHECK_FALSE(empty.Raycast(math::Ray<float>(), distance, primitive));
+		CHECK(empty.Query(math::AABB<float>(math::Vector3<float>(-1.0f), math::Vector3<float>(1.0f)), [](uint32_t) {}) == 0);
+
+		// Identical boxes cannot be split by their centroids
+		std::vector<math::AABB<float>> same(100, math::AABB<float>(math::Vector3<float>(0.0f), math::Vector3<float>(1.0f)));
+
+		math::BVH<float> stacked;
+		stacked.Build(same);
+
+		CHECK(stacked.Depth() < 10);
+		CHECK(stacked.Query(same[0], [](uint32_t) {}) == same.size());
+		CHECK(stacked.Raycast(math::Ray<float>(math::Vector3<float>(0.5f, 0.5f, 5.0f), math::Vector3<float>(0.0f, 0.0f, -1.0f)), distance, primitive));
+		CHECK(distance == 4.0f);
+	}
+
+	SECTION("Double")
+	{
+		std::vector<math::AABB<double>> boxesDouble;
+
+		for (int i = 0; i < 50; ++i)
+			boxesDouble.emplace_back(math::Vector3<double>(i * 2.0, 0.0, 0.0), math::Vector3<double>(i * 2.0 + 1.0, 1.0, 1.0));
+
+		math::BVH<double> bvhDouble;
+		bvhDouble.Build(boxesDouble);
+
+		double distance = 0.0;
+		uint32_t primitive = 0;
+
+		CHECK(bvhDouble.Raycast(math::Ray<double>(math::Vector3<double>(200.0, 0.5, 0.5), math::Vector3<double>(-1.0, 0.0, 0.0)), distance, primitive));
+		CHECK(primitive == 49);
+		CHECK(distance == 101.0);
+	}
+}
+
+TEST_CASE("SweepAndPrune", "[.all][geometry]")
+{
+	using Pair = math::SweepAndPrune<float>::Pair;
+
+	constexpr size_t count = 3001;
+
+	std::vector<math::Vector3<float>> mins(count);
+	std::vector<math::Vector3<float>> maxs(count);
+
+	// Boxes spread along z, thinner on x & y
+	auto place = [&](size_t i, float time)
+	{
+		const float value = static_cast<float>(i);
+		const math::Vector3<float> center(std::fmod(value * 0.37f, 20.0f) + std::sin(value + time), std::fmod(value * 0.73f, 10.0f), std::fmod(value * 1.31f, 300.0f) + std::cos(value * 0.5f + time) * 2.0f);
+		const math::Vector3<float> extents(std::fmod(value * 0.11f, 1.0f) + 0.05f, std::fmod(value * 0.17f, 0.8f) + 0.05f, std::fmod(value * 0.07f, 1.5f) + 0.05f);
+
+		mins[i] = center - extents;
+		maxs[i] = center + extents;
+	};
+
+	auto bruteForce = [&](size_t boxCount)
+	{
+		std::vector<std::pair<uint32_t, uint32_t>> result;
+
+		for (size_t i = 0; i < boxCount; ++i)
+		{
+			for (size_t j = i + 1; j < boxCount; ++j)
+			{
+				if (math::AABB<float>(mins[i], maxs[i]).Intersects(math::AABB<float>(mins[j], maxs[j])))
+					result.emplace_back(static_cast<uint32_t>(i), static_cast<uint32_t>(j));
+			}
+		}
+
+		return result;
+	};
+
+	auto sortedPairs = [](std::span<Pair const> pairs)
+	{
+		std::vector<std::pair<uint32_t, uint32_t>> result;
+
+		for (Pair const& pair : pairs)
+		{
+			CHECK(pair.m_first < pair.m_second);
+			result.emplace_back(pair.m_first, pair.m_second);
+		}
+
+		std::sort(result.begin(), result.end());
+		return result;
+	};
+
+	for (size_t i = 0; i < count; ++i)
+		place(i, 0.0f);
+
+	math::SweepAndPrune<float> broadphase;
+	broadphase.Reserve(count);
+
+	std::vector<Pair> pairs(count * 4);
+
+	SECTION("Incremental")
+	{
+		for (int frame = 0; frame < 5; ++frame)
+		{
+			for (size_t i = 0; i < count; ++i)
+				place(i, static_cast<float>(frame) * 0.05f);
+
+			const std::vector<std::pair<uint32_t, uint32_t>> expected = bruteForce(count);
+			const math::Vector3Stream<float> minStream(mins.data(), count);
+			const math::Vector3Stream<float> maxStream(maxs.data(), count);
+
+			const size_t pairCount = broadphase.Update(minStream, maxStream, pairs);
+
+			REQUIRE(pairCount <= pairs.size());
+			CHECK(pairCount == expected.size());
+			CHECK(sortedPairs(std::span<Pair const>(pairs.data(), pairCount)) == expected);
+			CHECK(broadphase.Axis() == 2);
+		}
+
+		CHECK(broadphase.Size() == count);
+	}
+
+	SECTION("Resort")
+	{
+		// Teleported boxes, the insertion sort gives up
+		const math::Vector3StreamView<float> minView(mins.data(), count);
+		const math::Vector3StreamView<float> maxView(maxs.data(), count);
+
+		broadphase.Update(minView, maxView, pairs);
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const math::Vector3<float> offset(0.0f, 0.0f, std::fmod(static_cast<float>(i) * 97.0f, 300.0f));
+
+			mins[i] += offset;
+			maxs[i] += offset;
+		}
+
+		const std::vector<std::pair<uint32_t, uint32_t>> expected = bruteForce(count);
+		const size_t pairCount = broadphase.Update(minView, maxView, pairs);
+
+		CHECK(pairCount == expected.size());
+		CHECK(sortedPairs(std::span<Pair const>(pairs.data(), pairCount)) == expected);
+
+		// Fewer boxes
+		const std::vector<std::pair<uint32_t, uint32_t>> expectedFewer = bruteForce(count / 2);
+		const size_t fewerCount = broadphase.Update(math::Vector3StreamView<float>(mins.data(), count / 2), math::Vector3StreamView<float>(maxs.data(), count / 2), pairs);
+
+		CHECK(broadphase.Size() == count / 2);
+		CHECK(sortedPairs(std::span<Pair const>(pairs.data(), fewerCount)) == expectedFewer);
+	}
+
+	SECTION("Small buffer")
+	{
+		const math::Vector3StreamView<float> minView(mins.data(), count);
+		const math::Vector3StreamView<float> maxView(maxs.data(), count);
+
+		const size_t pairCount = broadphase.Update(minView, maxView, pairs);
+
+		std::vector<Pair> smallPairs(pairCount / 2);
+
+		CHECK(broadphase.Update(minView, maxView, smallPairs) == pairCount);
+		CHECK(sortedPairs(smallPairs).size() == pairCount / 2);
+	}
+
+	SECTION("Instruction sets")
+	{
+		const math::Vector3StreamView<float> minView(mins.data(), count);
+		const math::Vector3StreamView<float> maxView(maxs.data(), count);
+		const math::simd::InstructionSet activeSet = math::simd::ActiveInstructionSet();
+
+		math::simd::SetInstructionSet(math::simd::InstructionSet::Scalar);
+
+		const size_t pairCount = broadphase.Update(minView, maxView, pairs);
+		const std::vector<Pair> expected(pairs.begin(), pairs.begin() + pairCount);
+
+		// Same pairs in the same order
+		for (int i = static_cast<int>(math::simd::InstructionSet::SSE2); i <= static_cast<int>(math::simd::InstructionSet::AVX2_FMA); ++i)
+		{
+			if (!math::simd::SetInstructionSet(static_cast<math::simd::InstructionSet>(i)))
+				continue;
+
+			REQUIRE(broadphase.Update(minView, maxView, pairs) == pairCount);
+
+			for (size_t pair = 0; pair < pairCount; ++pair)
+			{
+				CHECK(pairs[pair].m_first == expected[pair].m_first);
+				CHECK(pairs[pair].m_second == expected[pair].m_second);
+			}
+		}
+
+		math::simd::SetInstructionSet(activeSet);
+	}
+
+	SECTION("Double")
+	{
+		std::vector<math::Vector3<double>> minsDouble = { { 0.0, 0.0, 0.0 }, { 1.0, 1.0, 1.0 }, { 5.0, 0.0, 0.0 }, { 0.5, 2.5, 0.5 } };
+		std::vector<math::Vector3<double>> maxsDouble = { { 1.0, 1.0, 1.0 }, { 2.0, 2.0, 2.0 }, { 6.0, 1.0, 1.0 }, { 1.5, 3.0, 1.5 } };
+
+		math::SweepAndPrune<double> broadphaseDouble;
+		std::vector<math::SweepAndPrune<double>::Pair> pairsDouble(8);
+
+		// Touching boxes overlap
+		REQUIRE(broadphaseDouble.Update(math::Vector3StreamView<double>(minsDouble.data(), 4), math::Vector3StreamView<double>(maxsDouble.data(), 4), pairsDouble) == 1);
+		CHECK(pairsDouble[0].m_first == 0);
+		CHECK(pairsDouble[0].m_second == 1);
+	}
+}
+
+TEST_CASE("Frustum", "[.all][geometry]")
+{
+	// Camera at (0, 0, 5) looking at the origin, 90 degrees field of view
+	glm::mat4 viewGLM = glm::lookAt(glm::vec3(0.0f, 0.0f, 5.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::mat4 projectionGLM = glm::perspective(PI * 0.5f, 1.0f, 0.1f, 100.0f);
+	math::Matrix4<float> view(&viewGLM[0][0]);
+	math::Matrix4<float> projection(&projectionGLM[0][0]);
+
+	const math::Frustum<float> frustum(projection * view);
+
+	SECTION("Planes")
+	{
+		// Ortho box from x in [-2, 2], y in [-1, 1] & z in [-10, -1] in view space
+		const math::Frustum<float> box(math::Matrix4<float>::Ortho(-2.0f, 2.0f, -1.0f, 1.0f, 1.0f, 10.0f));
+
+		CHECK_PLANE(box.GetPlane(math::Frustum<float>::Left), 1.0f, 0.0f, 0.0f, 2.0f);
+		CHECK_PLANE(box.GetPlane(math::Frustum<float>::Right), -1.0f, 0.0f, 0.0f, 2.0f);
+		CHECK_PLANE(box.GetPlane(math::Frustum<float>::Bottom), 0.0f, 1.0f, 0.0f, 1.0f);
+		CHECK_PLANE(box.GetPlane(math::Frustum<float>::Top), 0.0f, -1.0f, 0.0f, 1.0f);
+		CHECK_PLANE(box.GetPlane(math::Frustum<float>::Near), 0.0f, 0.0f, -1.0f, -1.0f);
+		CHECK_PLANE(box.GetPlane(math::Frustum<float>::Far), 0.0f, 0.0f, 1.0f, 10.0f);
+
+		// Side planes of the perspective frustum go through the camera at 45 degrees
+		CHECK_PLANE(frustum.GetPlane(math::Frustum<float>::Right), -0.70710678f, 0.0f, -0.70710678f, 3.5355339f);
+		CHECK_PLANE(frustum.GetPlane(math::Frustum<float>::Far), 0.0f, 0.0f, 1.0f, 95.0f);
+	}
+
+	SECTION("Point")
+	{
+		CHECK(frustum.Contains(math::Vector3<float>(0.0f)));
+		CHECK(frustum.Contains(math::Vector3<float>(4.0f, -4.0f, 0.0f)));
+		CHECK_FALSE(frustum.Contains(math::Vector3<float>(6.0f, 0.0f, 0.0f)));
+		CHECK_FALSE(frustum.Contains(math::Vector3<float>(0.0f, 0.0f, 5.5f)));
+		CHECK_FALSE(frustum.Contains(math::Vector3<float>(0.0f, 0.0f, -96.0f)));
+	}
+
+	SECTION("Sphere & box")
+	{
+		// (6, 0, 0) is 0.707 behind the right plane
+		CHECK_FALSE(frustum.IsSphereVisible(math::Vector3<float>(6.0f, 0.0f, 0.0f), 0.5f));
+		CHECK(frustum.IsSphereVisible(math::Vector3<float>(6.0f, 0.0f, 0.0f), 1.0f));
+		CHECK(frustum.IsSphereVisible(math::Vector3<float>(0.0f, 0.0f, -99.0f), 5.0f));
+		CHECK_FALSE(frustum.IsSphereVisible(math::Vector3<float>(0.0f, 0.0f, 7.0f), 1.0f));
+
+		// Projected half size of the box is 0.707 * (x + z)
+		CHECK_FALSE(frustum.IsBoxVisible(math::Vector3<float>(6.0f, 0.0f, 0.0f), math::Vector3<float>(0.4f)));
+		CHECK(frustum.IsBoxVisible(math::Vector3<float>(6.0f, 0.0f, 0.0f), math::Vector3<float>(0.6f)));
+		CHECK(frustum.IsBoxVisible(math::Vector3<float>(6.0f, 0.0f, 0.0f), math::Vector3<float>(1.1f, 0.0f, 0.0f)));
+		CHECK_FALSE(frustum.IsBoxVisible(math::Vector3<float>(0.0f, 20.0f, 0.0f), math::Vector3<float>(1.0f, 2.0f, 3.0f)));
+	}
+
+	SECTION("Batch")
+	{
+		// Spread around the frustum, 2 full batches + an odd tail
+		constexpr size_t count = 2 * math::Frustum<float>::CullBatchSize + 1003;
+
+		std::vector<math::Vector3<float>> centers;
+		std::vector<math::Vector3<float>> extents;
+		std::vector<float> radii;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const float value = static_cast<float>(i);
+
+			centers.emplace_back(std::fmod(value * 7.31f, 60.0f) - 30.0f, std::fmod(value * 3.17f, 40.0f) - 20.0f, std::fmod(value * 1.93f, 120.0f) - 110.0f);
+			extents.emplace_back(std::fmod(value * 0.37f, 3.0f), std::fmod(value * 0.71f, 2.0f), std::fmod(value * 0.13f, 4.0f));
+			radii.push_back(std::fmod(value * 0.29f, 5.0f));
+		}
+
+		std::vector<uint32_t> expectedSpheres;
+		std::vector<uint32_t> expectedBoxes;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			if (frustum.IsSphereVisible(centers[i], radii[i]))
+				expectedSpheres.push_back(static_cast<uint32_t>(i));
+
+			if (frustum.IsBoxVisible(centers[i], extents[i]))
+				expectedBoxes.push_back(static_cast<uint32_t>(i));
+		}
+
+		CHECK(expectedSpheres.size() > count / 10);
+		CHECK(expectedSpheres.size() < count - count / 10);
+
+		const math::Vector3Stream<float> centerStream(centers.data(), count);
+		const math::Vector3Stream<float> extentStream(extents.data(), count);
+		std::vector<uint32_t> visible(count);
+
+		const math::simd::InstructionSet activeSet = math::simd::ActiveInstructionSet();
+
+		// Every kernel supported by the CPU returns the single object results
+		for (int i = static_cast<int>(math::simd::InstructionSet::Scalar); i <= static_cast<int>(math::simd::InstructionSet::AVX2_FMA); ++i)
+		{
+			if (!math::simd::SetInstructionSet(static_cast<math::simd::InstructionSet>(i)))
+				continue;
+
+			size_t visibleCount = frustum.CullSpheres(centerStream, radii, visible);
+
+			CHECK(visibleCount == expectedSpheres.size());
+			CHECK(std::vector<uint32_t>(visible.begin(), visible.begin() + visibleCount) == expectedSpheres);
+
+			visibleCount = frustum.CullBoxes(centerStream, extentStream, visible);
+
+			CHECK(visibleCount == expectedBoxes.size());
+			CHECK(std::vector<uint32_t>(visible.begin(), visible.begin() + visibleCount) == expectedBoxes);
+		}
+
+		math::simd::SetInstructionSet(activeSet);
+
+		// Strided views over Vector3 arrays use the scalar path
+		const math::Vector3StreamView<float> centerView(centers.data(), count);
+		const size_t visibleCount = frustum.CullSpheres(centerView, radii, visible);
+
+		CHECK(std::vector<uint32_t>(visible.begin(), visible.begin() + visibleCount) == expectedSpheres);
+	}
+
+	SECTION("Parallel")
+	{
+		// 65 batches on 8 forced threads: 4 workers of 17 batches, the last one shorter
+		constexpr size_t count = 64 * math::Frustum<float>::CullBatchSize + 1003;
+
+		std::vector<math::Vector3<float>> centers;
+		std::vector<float> radii;
+		std::vector<uint32_t> expected;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const float value = static_cast<float>(i);
+
+			centers.emplace_back(std::fmod(value * 7.31f, 60.0f) - 30.0f, std::fmod(value * 3.17f, 40.0f) - 20.0f, std::fmod(value * 1.93f, 120.0f) - 110.0f);
+			radii.push_back(std::fmod(value * 0.29f, 5.0f));
+
+			if (frustum.IsSphereVisible(centers[i], radii[i]))
+				expected.push_back(static_cast<uint32_t>(i));
+		}
+
+		const math::Vector3Stream<float> centerStream(centers.data(), count);
+		std::vector<uint32_t> visible(count);
+
+		math::SetParallelThreadCount(8);
+		const size_t visibleCount = frustum.CullSpheres(centerStream, radii, visible);
+		math::SetParallelThreadCount(0);
+
+		CHECK(visibleCount == expected.size());
+		CHECK(std::vector<uint32_t>(visible.begin(), visible.begin() + visibleCount) == expected);
+	}
+
+	SECTION("Double")
+	{
+		const math::Frustum<double> box(math::Matrix4<double>::Ortho(-2.0, 2.0, -1.0, 1.0, 1.0, 10.0));
+
+		std::vector<math::Vector3<double>> centers = { { 0.0, 0.0, -5.0 }, { 3.0, 0.0, -5.0 }, { 2.5, 0.0, -5.0 }, { 0.0, 0.0, 0.0 } };
+		std::vector<double> radii = { 0.1, 0.1, 0.6, 0.5 };
+		std::vector<uint32_t> visible(centers.size());
+
+		const size_t visibleCount = box.CullSpheres(math::Vector3StreamView<double>(centers.data(), centers.size()), radii, visible);
+
+		CHECK(visibleCount == 2);
+		CHECK(visible[0] == 0);
+		CHECK(visible[1] == 2);
+	}
+}
@@ -2,12 +2,25 @@
 
 #include "LibMath/Arithmetic.h"
 #include "LibMath/Matrix.h"
+#include "LibMath/Matrix4Vector4Operation.h"
+#include "LibMath/Parallel.h"
+#include "LibMath/simd/Simd.h"
 
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
 #include <glm/common.hpp>
 #include <glm/glm.hpp>
 #include <glm/gtx/matrix_operation.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #define CHECK_MATRIX2(mat2, mat2Glm)\
 CHECK(mat2.m_matrix[0][0] == mat2Glm[0][0]);\
@@ -275,6 +288,15 @@ TEST_CASE("Matrix3", "[.all][matrix][matrix3]")
 	}
 }
 
+#define CHECK_MATRIX4_BITS(mat4, mat4Glm)\
+for (int column = 0; column < 4; ++column)\
+{\
+	for (int row = 0; row < 4; ++row)\
+	{\
+		CHECK(std::bit_cast<uint32_t>(mat4.m_matrix[column][row]) == std::bit_cast<uint32_t>(mat4Glm[column][row]));\
+	}\
+}
+
 #define VALUES  {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f}
 #define VALUES2 {9.0f, 2.5f, -3.0f, 1.0f, 3.0f, 10.0f, 7.2f, 8.4f, 6.0f, 10.0f, 3.0f, 2.0f, 15.0f, 12.0f, 5.0f, 1.0f}
 #define VALUES3 {1.0f, 2.0f, 0.0f, 0.0f, 2.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 3.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f}
@@ -312,6 +334,19 @@ TEST_CASE("Matrix4", "[.all][matrix][matrix4]")
 
 		// Inverse
 		CHECK_MATRIX4(LibMath::Matrix4<float>(values2).Inverse(), glm::inverse(glm::mat4(VALUES3)));
+
+		double valuesDouble[16] = VALUES2;
+		CHECK_MATRIX4(LibMath::Matrix4<double>(valuesDouble).Inverse(), glm::inverse(glm::dmat4(VALUES2)));
+		CHECK(LibMath::Matrix4<double>(valuesDouble).Determinant() == glm::determinant(glm::dmat4(VALUES2)));
+
+		// TryInverse
+		LibMath::Matrix4<float> singular(values);
+		CHECK_FALSE(singular.TryInverse());
+		CHECK_MATRIX4(singular, glm::mat4(VALUES));
+
+		LibMath::Matrix4<float> invertible(values2);
+		CHECK(invertible.TryInverse());
+		CHECK_MATRIX4(invertible, glm::inverse(glm::mat4(VALUES3)));
 	}
 
 	SECTION("Operator")
@@ -386,4 +421,823 @@ TEST_CASE("Matrix4", "[.all][matrix][matrix4]")
 		CHECK_FALSE(matrix1 != matrix1);
 		CHECK_FALSE(matrix2 != matrix2);
 	}
+
+	SECTION("Vector")
+	{
+		float values[16] = VALUES;
+
+		LibMath::Matrix4<float> matrix(values);
+		LibMath::Vector4<float> vector(1.0f, -2.0f, 3.0f, 0.5f);
+
+		glm::mat4 matrixGLM(VALUES);
+		glm::vec4 vectorGLM(1.0f, -2.0f, 3.0f, 0.5f);
+
+		// Storage is column major, a row major product or a missing w gives a different result
+		LibMath::Vector4<float> product = matrix * vector;
+		glm::vec4 productGLM = matrixGLM * vectorGLM;
+
+		CHECK(product[0] == productGLM[0]);
+		CHECK(product[1] == productGLM[1]);
+		CHECK(product[2] == productGLM[2]);
+		CHECK(product[3] == productGLM[3]);
+
+		// Translation lives in column 3 & a point keeps w = 1
+		LibMath::Matrix4<float> translation;
+		translation.m_matrix[3][0] = 5.0f;
+		translation.m_matrix[3][1] = -6.0f;
+		translation.m_matrix[3][2] = 7.0f;
+
+		LibMath::Vector4<float> point = translation * LibMath::Vector4<float>(1.0f, 2.0f, 3.0f, 1.0f);
+
+		CHECK(point[0] == 6.0f);
+		CHECK(point[1] == -4.0f);
+		CHECK(point[2] == 10.0f);
+		CHECK(point[3] == 1.0f);
+	}
+}
+
+TEST_CASE("Matrix in place operators", "[.all][matrix]")
+{
+	float values[16] =
+	{
+		2.0f, 0.5f, -1.0f, 0.25f,
+		1.0f, 3.0f, 0.75f, -0.5f,
+		-0.5f, 1.25f, 4.0f, 1.0f,
+		0.3f, -2.0f, 1.5f, 5.0f
+	};
+
+	const LibMath::Matrix2<float> matrix2(values[0], values[1], values[2], values[3]);
+	const LibMath::Matrix3<float> matrix3(values);
+	const LibMath::Matrix4<float> matrix4(values);
+
+	SECTION("Self multiply")
+	{
+		// The right hand side is the matrix being written
+		LibMath::Matrix2<float> result2(matrix2);
+		LibMath::Matrix3<float> result3(matrix3);
+		LibMath::Matrix4<float> result4(matrix4);
+
+		result2 *= result2;
+		result3 *= result3;
+		result4 *= result4;
+
+		CHECK(result2 == matrix2 * matrix2);
+		CHECK(result3 == matrix3 * matrix3);
+		CHECK(result4 == matrix4 * matrix4);
+	}
+
+	SECTION("Const chain")
+	{
+		// Operands are left untouched, every product matches the one written step by step
+		const LibMath::Matrix2<float> product2 = matrix2 * matrix2;
+		const LibMath::Matrix3<float> product3 = matrix3 * matrix3;
+		const LibMath::Matrix4<float> product4 = matrix4 * matrix4;
+
+		CHECK((matrix2 * matrix2 * matrix2) == product2 * matrix2);
+		CHECK((matrix3 * matrix3 * matrix3) == product3 * matrix3);
+		CHECK((matrix4 * matrix4 * matrix4) == product4 * matrix4);
+		CHECK(matrix4 == LibMath::Matrix4<float>(values));
+	}
+
+	SECTION("Temporary chain")
+	{
+		// Products after the first one are written to the temporary on their left, same bits as the products written step by step
+		LibMath::Matrix4<double> matrix4Double;
+
+		for (int i = 0; i < 16; ++i)
+			matrix4Double.m_matrix[i / 4][i % 4] = static_cast<double>(values[i]);
+
+		const LibMath::Matrix4<float> product4 = matrix4 * matrix4;
+		const LibMath::Matrix4<double> product4Double = matrix4Double * matrix4Double;
+
+		const LibMath::Matrix4<float> chain4 = matrix4 * matrix4 * matrix4 * matrix4;
+		const LibMath::Matrix4<double> chain4Double = matrix4Double * matrix4Double * matrix4Double * matrix4Double;
+
+		// Every operand of these products is a named matrix
+		const LibMath::Matrix4<float> cube4 = product4 * matrix4;
+		const LibMath::Matrix4<double> cube4Double = product4Double * matrix4Double;
+
+		const LibMath::Matrix4<float> expected4 = cube4 * matrix4;
+		const LibMath::Matrix4<double> expected4Double = cube4Double * matrix4Double;
+
+		// The right hand side may be the temporary itself
+		LibMath::Matrix4<double> square(matrix4Double);
+		square = std::move(square) * square;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				CHECK(chain4.m_matrix[i][j] == expected4.m_matrix[i][j]);
+				CHECK(chain4Double.m_matrix[i][j] == expected4Double.m_matrix[i][j]);
+				CHECK(square.m_matrix[i][j] == product4Double.m_matrix[i][j]);
+			}
+		}
+	}
+
+	SECTION("Minor & cofactor")
+	{
+		LibMath::Matrix4<float> minorMatrix = LibMath::Matrix4<float>(matrix4).Minor();
+		LibMath::Matrix4<float> cofactor = LibMath::Matrix4<float>(matrix4).Cofactor();
+		LibMath::Matrix4<float> adjugate = LibMath::Matrix4<float>(matrix4).Adjugate();
+
+		for (int i = 0; i < 4; ++i)
+		{
+			for (int j = 0; j < 4; ++j)
+			{
+				CHECK(cofactor.m_matrix[i][j] == (((i + j) & 1) ? -minorMatrix.m_matrix[i][j] : minorMatrix.m_matrix[i][j]));
+				CHECK(cofactor.m_matrix[i][j] == adjugate.m_matrix[j][i]);
+			}
+		}
+
+		LibMath::Matrix3<float> cofactor3 = LibMath::Matrix3<float>(matrix3).Cofactor();
+
+		CHECK(cofactor3 == LibMath::Matrix3<float>(matrix3).Adjugate().Transpose());
+	}
+}
+
+TEST_CASE("Matrix4 SIMD", "[.all][matrix][matrix4]")
+{
+	const math::simd::InstructionSet activeSet = math::simd::ActiveInstructionSet();
+
+	float values1[16] = VALUES;
+	float values2[16] = VALUES2;
+	float values3[16] = {0.31f, -1.7f, 2.25f, 0.0f, 4.1f, 0.003f, -7.9f, 1.0f, -0.5f, 9.75f, 3.3f, -2.0f, 12.5f, -0.125f, 6.6f, 1.0f};
+
+	LibMath::Matrix4<float> matrix1(values1);
+	LibMath::Matrix4<float> matrix2(values2);
+	LibMath::Matrix4<float> matrix3(values3);
+
+	glm::mat4 matrix1GLM(VALUES);
+	glm::mat4 matrix2GLM(VALUES2);
+	glm::mat4 matrix3GLM(0.31f, -1.7f, 2.25f, 0.0f, 4.1f, 0.003f, -7.9f, 1.0f, -0.5f, 9.75f, 3.3f, -2.0f, 12.5f, -0.125f, 6.6f, 1.0f);
+
+	glm::mat4 viewGLM = glm::lookAt(glm::vec3(3.0f, 4.5f, -2.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::mat4 projectionGLM = glm::perspective(1.1f, 16.0f / 9.0f, 0.1f, 500.0f);
+	LibMath::Matrix4<float> view(&viewGLM[0][0]);
+	LibMath::Matrix4<float> projection(&projectionGLM[0][0]);
+
+	// Run every kernel supported by the CPU, the non fused kernels must match glm bit-for-bit
+	for (int i = static_cast<int>(math::simd::InstructionSet::Scalar); i <= static_cast<int>(math::simd::InstructionSet::AVX2_FMA); ++i)
+	{
+		const math::simd::InstructionSet instructionSet = static_cast<math::simd::InstructionSet>(i);
+
+		if (!math::simd::SetInstructionSet(instructionSet))
+			continue;
+
+		// Inverse & determinant, every kernel shares the same operation order
+		CHECK_MATRIX4_BITS(LibMath::Matrix4<float>(values2).Inverse(), glm::inverse(matrix2GLM));
+		CHECK_MATRIX4_BITS(LibMath::Matrix4<float>(values3).Inverse(), glm::inverse(matrix3GLM));
+		CHECK_MATRIX4_BITS(LibMath::Matrix4<float>(&viewGLM[0][0]).Inverse(), glm::inverse(viewGLM));
+		CHECK_MATRIX4_BITS(LibMath::Matrix4<float>(&projectionGLM[0][0]).Inverse(), glm::inverse(projectionGLM));
+		CHECK(LibMath::Matrix4<float>(values3).Determinant() == glm::determinant(matrix3GLM));
+		CHECK_FALSE(LibMath::Matrix4<float>(values1).TryInverse());
+
+		// operator* inlines the SSE2 kernel unless LIBMATH_ENABLE_FMA is defined, call the dispatched kernel directly too
+		LibMath::Matrix4<float> product;
+		math::simd::Matrix4Multiply(&product.m_matrix[0][0], &matrix2.m_matrix[0][0], &matrix3.m_matrix[0][0]);
+
+		if (instructionSet != math::simd::InstructionSet::AVX2_FMA)
+		{
+			CHECK_MATRIX4_BITS(product, (matrix2GLM * matrix3GLM));
+			CHECK_MATRIX4_BITS((matrix1 * matrix2), (matrix1GLM * matrix2GLM));
+			CHECK_MATRIX4_BITS((matrix2 * matrix3), (matrix2GLM * matrix3GLM));
+			CHECK_MATRIX4_BITS((matrix3 * matrix3), (matrix3GLM * matrix3GLM));
+			CHECK_MATRIX4_BITS((projection * view), (projectionGLM * viewGLM));
+			CHECK_MATRIX4_BITS((projection * view * matrix3), (projectionGLM * viewGLM * matrix3GLM));
+		}
+		else
+		{
+			// Fused multiply-add rounds once per term, compare with a tolerance
+			LibMath::Matrix4<float> result = projection * view * matrix3;
+			glm::mat4 resultGLM = projectionGLM * viewGLM * matrix3GLM;
+			glm::mat4 productGLM = matrix2GLM * matrix3GLM;
+
+			for (int column = 0; column < 4; ++column)
+			{
+				for (int row = 0; row < 4; ++row)
+				{
+					CHECK(math::AlmostEqual(result.m_matrix[column][row], resultGLM[column][row], 1e-3f));
+					CHECK(math::AlmostEqual(product.m_matrix[column][row], productGLM[column][row], 1e-3f));
+				}
+			}
+		}
+	}
+
+	math::simd::SetInstructionSet(activeSet);
+}
+
+#define CHECK_AFFINE_MATRIX4(affine, mat4Glm)\
+for (int column = 0; column < 4; ++column)\
+{\
+	for (int row = 0; row < 3; ++row)\
+	{\
+		CHECK(affine.m_matrix[column][row] == Catch::Approx(mat4Glm[column][row]).margin(1e-5f));\
+	}\
+	CHECK(mat4Glm[column][3] == Catch::Approx(column == 3 ? 1.0f : 0.0f).margin(1e-5f));\
+}
+
+TEST_CASE("AffineMatrix4", "[.all][matrix][matrix4]")
+{
+	const math::Quaternion<float> rotation = math::Quaternion<float>::AngleAxis(0.7f, math::Vector3<float>(1.0f, 2.0f, 3.0f).Normalize());
+
+	LibMath::AffineMatrix4<float> rigid = LibMath::AffineMatrix4<float>::Transform(rotation);
+	rigid.Translate(1.0f, -2.0f, 3.0f);
+
+	LibMath::AffineMatrix4<float> scale;
+	scale.m_matrix[0][0] = 2.0f;
+	scale.m_matrix[1][1] = 3.0f;
+	scale.m_matrix[2][2] = 0.5f;
+
+	const LibMath::AffineMatrix4<float> scaleRotateTranslate = rigid * scale;
+
+	const glm::mat4 rigidGLM = glm::make_mat4(&rigid.ToMatrix4().m_matrix[0][0]);
+	const glm::mat4 scaleGLM = glm::scale(glm::mat4(1.0f), glm::vec3(2.0f, 3.0f, 0.5f));
+
+	SECTION("Constructor")
+	{
+		CHECK_AFFINE_MATRIX4(LibMath::AffineMatrix4<float>(), glm::mat4(1.0f));
+		CHECK_AFFINE_MATRIX4(LibMath::AffineMatrix4<float>(LibMath::Matrix4<float>(&rigidGLM[0][0])), rigidGLM);
+		CHECK_AFFINE_MATRIX4(LibMath::AffineMatrix4<float>(rigid.Linear(), rigid.Translation()), rigidGLM);
+		CHECK(sizeof(LibMath::AffineMatrix4<float>) == 12 * sizeof(float));
+	}
+
+	SECTION("Functions")
+	{
+		// ToMatrix4
+		CHECK_MATRIX4(rigid.ToMatrix4(), rigidGLM);
+
+		// Determinant
+		CHECK(scaleRotateTranslate.Determinant() == Catch::Approx(glm::determinant(rigidGLM * scaleGLM)));
+
+		// Inverse
+		CHECK_AFFINE_MATRIX4(LibMath::AffineMatrix4<float>(rigid).Inverse(), glm::inverse(rigidGLM));
+		CHECK_AFFINE_MATRIX4(LibMath::AffineMatrix4<float>(scaleRotateTranslate).Inverse(), glm::inverse(rigidGLM * scaleGLM));
+		CHECK_AFFINE_MATRIX4(LibMath::AffineMatrix4<float>(scaleRotateTranslate).InverseOrthogonal(), glm::inverse(rigidGLM * scaleGLM));
+		CHECK_AFFINE_MATRIX4(LibMath::AffineMatrix4<float>(rigid).InverseOrthonormal(), glm::inverse(rigidGLM));
+
+		LibMath::AffineMatrix4<float> singular(LibMath::Matrix4<float>(0.0f));
+		CHECK_FALSE(singular.TryInverse());
+
+		// Matrix4 affine inverse
+		CHECK_AFFINE_MATRIX4(scaleRotateTranslate.ToMatrix4().InverseAffine(), glm::inverse(rigidGLM * scaleGLM));
+
+		// Transform point & direction
+		const LibMath::Vector3<float> point(1.5f, -4.0f, 2.25f);
+		const glm::vec4 pointGLM = rigidGLM * scaleGLM * glm::vec4(1.5f, -4.0f, 2.25f, 1.0f);
+		const glm::vec4 directionGLM = rigidGLM * scaleGLM * glm::vec4(1.5f, -4.0f, 2.25f, 0.0f);
+
+		const LibMath::Vector3<float> transformedPoint = scaleRotateTranslate.TransformPoint(point);
+		const LibMath::Vector3<float> transformedDirection = scaleRotateTranslate.TransformDirection(point);
+
+		for (unsigned int i = 0; i < 3; ++i)
+		{
+			CHECK(transformedPoint[i] == Catch::Approx(pointGLM[i]));
+			CHECK(transformedDirection[i] == Catch::Approx(directionGLM[i]));
+		}
+	}
+
+	SECTION("Operator")
+	{
+		// Operator * matches the full 4x4 product
+		CHECK_AFFINE_MATRIX4(scaleRotateTranslate, (rigidGLM * scaleGLM));
+		CHECK_AFFINE_MATRIX4((scaleRotateTranslate * rigid), (rigidGLM * scaleGLM * rigidGLM));
+
+		// Operator *= multiplies on the left like Matrix4
+		LibMath::AffineMatrix4<float> product(scale);
+		product *= rigid;
+		CHECK(product == scaleRotateTranslate);
+		CHECK_FALSE(product != scaleRotateTranslate);
+		CHECK(product != rigid);
+
+		LibMath::Matrix4<float> productMatrix4 = scale.ToMatrix4();
+		productMatrix4 *= rigid.ToMatrix4();
+		CHECK_AFFINE_MATRIX4(product, glm::make_mat4(&productMatrix4.m_matrix[0][0]));
+
+		// Compounding a translation gives the same result with both types
+		LibMath::AffineMatrix4<float> translation;
+		translation.Translate(1.0f, 0.0f, 0.0f);
+
+		LibMath::AffineMatrix4<float> compound(scale);
+		compound *= translation;
+		compound *= translation;
+
+		LibMath::Matrix4<float> compoundMatrix4 = scale.ToMatrix4();
+		compoundMatrix4 *= translation.ToMatrix4();
+		compoundMatrix4 *= translation.ToMatrix4();
+
+		CHECK(compound.m_matrix[3][0] == 2.0f);
+		CHECK_AFFINE_MATRIX4(compound, glm::make_mat4(&compoundMatrix4.m_matrix[0][0]));
+	}
+}
+
+TEST_CASE("Matrix4 transform vectors", "[.all][matrix][matrix4]")
+{
+	// Odd count so the 2 vector AVX loop also runs its tail
+	constexpr size_t count = 37;
+
+	float values[16];
+
+	for (int i = 0; i < 16; ++i)
+		values[i] = static_cast<float>(i) * 0.3f - 1.7f + static_cast<float>(i % 5) * 0.11f;
+
+	const LibMath::Matrix4<float> matrix(values);
+	const glm::mat4 matrixGlm = glm::make_mat4(values);
+
+	std::vector<LibMath::Vector3<float>> vectors3;
+	std::vector<LibMath::Vector4<float>> vectors4;
+
+	for (size_t i = 0; i < count; ++i)
+	{
+		const float value = static_cast<float>(i);
+
+		vectors3.emplace_back(value * 0.25f, 1.0f - value, 0.5f + value * value * 0.01f);
+		vectors4.emplace_back(value * 0.25f, 1.0f - value, 0.5f + value * value * 0.01f, static_cast<float>(i % 3));
+	}
+
+	SECTION("Multiply")
+	{
+		for (size_t i = 0; i < count; ++i)
+		{
+			const glm::vec4 resultGlm = matrixGlm * glm::vec4(vectors4[i][0], vectors4[i][1], vectors4[i][2], vectors4[i][3]);
+			const LibMath::Vector4<float> result = matrix * vectors4[i];
+
+			for (unsigned int j = 0; j < 4; ++j)
+				CHECK(result[j] == Catch::Approx(resultGlm[j]));
+		}
+	}
+
+	SECTION("Batch")
+	{
+		const LibMath::simd::InstructionSet activeSet = LibMath::simd::ActiveInstructionSet();
+
+		for (int set = 0; set <= static_cast<int>(LibMath::simd::InstructionSet::AVX2_FMA); ++set)
+		{
+			if (!LibMath::simd::SetInstructionSet(static_cast<LibMath::simd::InstructionSet>(set)))
+				continue;
+
+			std::vector<LibMath::Vector3<float>> points(count);
+			std::vector<LibMath::Vector3<float>> directions(vectors3);
+			std::vector<LibMath::Vector4<float>> points4(count);
+			std::vector<LibMath::Vector4<float>> directions4(count);
+
+			LibMath::TransformPoints(matrix, vectors3, points);
+			LibMath::TransformDirections(matrix, directions, directions);
+			LibMath::TransformPoints(matrix, vectors4, points4);
+			LibMath::TransformDirections(matrix, vectors4, directions4);
+
+			// Batches match the single vector product exactly, whichever kernel runs
+			for (size_t i = 0; i < count; ++i)
+			{
+				const LibMath::Vector4<float> point = matrix * LibMath::Vector4<float>(vectors3[i][0], vectors3[i][1], vectors3[i][2], 1.0f);
+				const LibMath::Vector4<float> direction = matrix * LibMath::Vector4<float>(vectors3[i][0], vectors3[i][1], vectors3[i][2], 0.0f);
+				const LibMath::Vector4<float> point4 = matrix * vectors4[i];
+				const LibMath::Vector4<float> direction4 = matrix * LibMath::Vector4<float>(vectors4[i][0], vectors4[i][1], vectors4[i][2], 0.0f);
+
+				for (unsigned int j = 0; j < 3; ++j)
+				{
+					CHECK(points[i][j] == point[j]);
+					CHECK(directions[i][j] == direction[j]);
+				}
+
+				CHECK(points4[i] == point4);
+				CHECK(directions4[i] == direction4);
+			}
+		}
+
+		LibMath::simd::SetInstructionSet(activeSet);
+
+		// Generic path
+		std::vector<LibMath::Vector3<double>> pointsDouble(count, LibMath::Vector3<double>(1.0, 2.0, 3.0));
+		LibMath::Matrix4<double> translation;
+		translation.m_matrix[3][0] = 4.0;
+
+		LibMath::TransformPoints(translation, pointsDouble, pointsDouble);
+
+		CHECK(pointsDouble[count - 1] == LibMath::Vector3<double>(5.0, 2.0, 3.0));
+	}
+
+	SECTION("Parallel")
+	{
+		// Forced thread counts, the batch size is rounded up so some counts fill fewer ranges than threads (e.g. 9 on 8 threads)
+		for (size_t threads : { 2u, 8u, 64u })
+		{
+			LibMath::SetParallelThreadCount(threads);
+
+			for (size_t elements : { 0u, 1u, 9u, 29u, 305u, 1000u })
+			{
+				for (size_t minBatchSize : { 1u, 4u, 16u })
+				{
+					std::vector<std::atomic<int>> visits(elements);
+					std::atomic<size_t> ranges = 0;
+					std::atomic<bool> inBounds = true;
+
+					LibMath::ParallelFor(elements, [&](size_t begin, size_t end)
+					{
+						if (begin > end || end > elements || (begin == end && elements != 0))
+							inBounds = false;
+
+						for (size_t i = begin; i < std::min(end, elements); ++i)
+							++visits[i];
+
+						++ranges;
+					}, minBatchSize);
+
+					CHECK(inBounds);
+					CHECK(ranges <= std::max<size_t>(threads, 1));
+					CHECK(std::all_of(visits.begin(), visits.end(), [](std::atomic<int> const& visit) { return visit == 1; }));
+				}
+			}
+		}
+
+		// Several workers on a batch, the same result as the single vector product
+		const size_t largeCount = 4 * PARALLEL_MIN_BATCH_SIZE + 3;
+
+		std::vector<LibMath::Vector4<float>> points4(largeCount);
+
+		for (size_t i = 0; i < largeCount; ++i)
+			points4[i] = vectors4[i % count];
+
+		LibMath::SetParallelThreadCount(8);
+		LibMath::TransformPoints(matrix, points4, points4);
+		LibMath::SetParallelThreadCount(0);
+
+		size_t mismatches = 0;
+
+		for (size_t i = 0; i < largeCount; ++i)
+		{
+			if (points4[i] != matrix * vectors4[i % count])
+				++mismatches;
+		}
+
+		CHECK(mismatches == 0);
+	}
+}
+
+TEST_CASE("Matrix4 TRS", "[.all][matrix][matrix4]")
+{
+	const LibMath::Vector3<float> translation(1.5f, -2.0f, 4.25f);
+	const LibMath::Quaternion<float> rotation = LibMath::Quaternion<float>::AngleAxis(1.2f, LibMath::Vector3<float>(0.48f, 0.6f, 0.64f));
+	const LibMath::Vector3<float> scale(2.0f, 0.5f, 3.0f);
+
+	const LibMath::Matrix4<float> matrix = LibMath::Matrix4<float>::ComposeTRS(translation, rotation, scale);
+
+	SECTION("Compose")
+	{
+		// Same transform as translation * rotation * scale
+		LibMath::Matrix4<float> translationMatrix;
+		translationMatrix.Translate(translation);
+
+		LibMath::Matrix4<float> scaleMatrix;
+		scaleMatrix.m_matrix[0][0] = scale[0];
+		scaleMatrix.m_matrix[1][1] = scale[1];
+		scaleMatrix.m_matrix[2][2] = scale[2];
+
+		const LibMath::Matrix4<float> product = translationMatrix * LibMath::Matrix4<float>().Transform(rotation) * scaleMatrix;
+
+		for (int column = 0; column < 4; ++column)
+		{
+			for (int row = 0; row < 4; ++row)
+				CHECK(matrix.m_matrix[column][row] == Catch::Approx(product.m_matrix[column][row]).margin(1e-6f));
+		}
+
+		constexpr LibMath::Matrix4<double> composed = LibMath::Matrix4<double>::ComposeTRS(LibMath::Vector3<double>(1.0, 2.0, 3.0), LibMath::Quaternion<double>(0.0, 0.0, 0.0, 1.0), LibMath::Vector3<double>(2.0));
+
+		// Half turn around z
+		STATIC_REQUIRE(composed.m_matrix[0][0] == -2.0);
+		STATIC_REQUIRE(composed.m_matrix[1][1] == -2.0);
+		STATIC_REQUIRE(composed.m_matrix[2][2] == 2.0);
+		STATIC_REQUIRE(composed.m_matrix[3][1] == 2.0);
+	}
+
+	SECTION("Decompose")
+	{
+		LibMath::Vector3<float> decomposedTranslation;
+		LibMath::Quaternion<float> decomposedRotation;
+		LibMath::Vector3<float> decomposedScale;
+
+		CHECK(matrix.Decompose(decomposedTranslation, decomposedRotation, decomposedScale));
+		CHECK(decomposedTranslation == translation);
+
+		for (unsigned int i = 0; i < 3; ++i)
+			CHECK(decomposedScale[i] == Catch::Approx(scale[i]).margin(1e-5f));
+
+		for (unsigned int i = 0; i < 4; ++i)
+			CHECK(decomposedRotation[i] == Catch::Approx(rotation[i]).margin(1e-6f));
+
+		// Every branch of Shepperd's method, w is kept positive
+		const LibMath::Quaternion<float> rotations[] =
+		{
+			LibMath::Quaternion<float>::AngleAxis(0.3f, LibMath::Vector3<float>(0.0f, 0.6f, 0.8f)),
+			LibMath::Quaternion<float>::AngleAxis(3.0f, LibMath::Vector3<float>(1.0f, 0.0f, 0.0f)),
+			LibMath::Quaternion<float>::AngleAxis(3.0f, LibMath::Vector3<float>(0.0f, -1.0f, 0.0f)),
+			LibMath::Quaternion<float>::AngleAxis(3.1f, LibMath::Vector3<float>(0.36f, 0.48f, -0.8f)),
+			LibMath::Quaternion<float>(0.0f, 0.0f, 0.0f, 1.0f)
+		};
+
+		for (LibMath::Quaternion<float> const& expected : rotations)
+		{
+			CHECK(LibMath::Matrix4<float>::ComposeTRS(translation, expected, scale).Decompose(decomposedTranslation, decomposedRotation, decomposedScale));
+
+			for (unsigned int i = 0; i < 4; ++i)
+				CHECK(decomposedRotation[i] == Catch::Approx(expected[0] < 0.0f ? -expected[i] : expected[i]).margin(1e-6f));
+		}
+
+		// A mirror is returned as a negative x scale
+		const LibMath::Matrix4<float> mirrored = LibMath::Matrix4<float>::ComposeTRS(translation, rotation, LibMath::Vector3<float>(2.0f, -0.5f, 3.0f));
+
+		CHECK(mirrored.Decompose(decomposedTranslation, decomposedRotation, decomposedScale));
+		CHECK(decomposedScale[0] == Catch::Approx(-2.0f));
+		CHECK(decomposedScale[1] == Catch::Approx(0.5f));
+
+		const LibMath::Matrix4<float> recomposed = LibMath::Matrix4<float>::ComposeTRS(decomposedTranslation, decomposedRotation, decomposedScale);
+
+		for (int column = 0; column < 4; ++column)
+		{
+			for (int row = 0; row < 4; ++row)
+				CHECK(recomposed.m_matrix[column][row] == Catch::Approx(mirrored.m_matrix[column][row]).margin(1e-5f));
+		}
+
+		// Shear, projection & zero scale are not TRS
+		LibMath::Matrix4<float> sheared(matrix);
+		sheared.m_matrix[1][0] += 0.5f;
+
+		LibMath::Matrix4<float> projective(matrix);
+		projective.m_matrix[0][3] = 0.1f;
+
+		CHECK_FALSE(sheared.Decompose(decomposedTranslation, decomposedRotation, decomposedScale));
+		CHECK_FALSE(projective.Decompose(decomposedTranslation, decomposedRotation, decomposedScale));
+		CHECK_FALSE(LibMath::Matrix4<float>::ComposeTRS(translation, rotation, LibMath::Vector3<float>(2.0f, 0.0f, 3.0f)).Decompose(decomposedTranslation, decomposedRotation, decomposedScale));
+		CHECK(decomposedRotation == LibMath::Quaternion<float>(1.0f, 0.0f, 0.0f, 0.0f));
+		CHECK(decomposedScale[1] == 0.0f);
+
+		// Generic path
+		const LibMath::Quaternion<double> rotationDouble = LibMath::Quaternion<double>::AngleAxis(-2.5, LibMath::Vector3<double>(0.0, 0.6, 0.8));
+
+		LibMath::Vector3<double> translationDouble;
+		LibMath::Quaternion<double> decomposedDouble;
+		LibMath::Vector3<double> scaleDouble;
+
+		CHECK(LibMath::Matrix4<double>::ComposeTRS(LibMath::Vector3<double>(1.0), rotationDouble, LibMath::Vector3<double>(4.0)).Decompose(translationDouble, decomposedDouble, scaleDouble));
+		CHECK(scaleDouble[2] == Catch::Approx(4.0).margin(1e-12));
+
+		for (unsigned int i = 0; i < 4; ++i)
+			CHECK(decomposedDouble[i] == Catch::Approx(rotationDouble[i]).margin(1e-12));
+	}
+
+	SECTION("Batch")
+	{
+		// Odd count so the SIMD kernels also run their tail
+		constexpr size_t count = 37;
+
+		std::vector<LibMath::Vector3<float>> translations;
+		std::vector<LibMath::Quaternion<float>> rotations;
+		std::vector<LibMath::Vector3<float>> scales;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const float value = static_cast<float>(i);
+
+			translations.emplace_back(value * 0.5f, -value, 3.0f - value * 0.25f);
+			rotations.push_back(LibMath::Quaternion<float>::AngleAxis(value * 0.37f - 6.0f, LibMath::Vector3<float>(value * 0.1f - 1.0f, 0.5f, 1.0f).Normalize()));
+			scales.emplace_back(1.0f + value * 0.1f, (i % 3 == 0) ? -0.5f : 2.0f, (i % 11 == 5) ? 0.0f : 0.75f);
+		}
+
+		std::vector<LibMath::Matrix4<float>> matrices(count);
+		LibMath::Matrix4<float>::ComposeTRS(translations, rotations, scales, matrices);
+
+		// Shear & projection in the SIMD part & the scalar tail
+		matrices[6].m_matrix[2][0] += 1.0f;
+		matrices[35].m_matrix[1][3] = 0.5f;
+
+		const LibMath::simd::InstructionSet activeSet = LibMath::simd::ActiveInstructionSet();
+
+		for (int set = 0; set <= static_cast<int>(LibMath::simd::InstructionSet::AVX2_FMA); ++set)
+		{
+			if (!LibMath::simd::SetInstructionSet(static_cast<LibMath::simd::InstructionSet>(set)))
+				continue;
+
+			std::vector<LibMath::Matrix4<float>> composed(count);
+			std::vector<LibMath::Vector3<float>> decomposedTranslations(count);
+			std::vector<LibMath::Quaternion<float>> decomposedRotations(count);
+			std::vector<LibMath::Vector3<float>> decomposedScales(count);
+
+			LibMath::Matrix4<float>::ComposeTRS(translations, rotations, scales, composed);
+
+			// Zero scales (i = 5, 16, 27), shear & projection
+			CHECK(LibMath::Matrix4<float>::Decompose(matrices, decomposedTranslations, decomposedRotations, decomposedScales) == 5);
+
+			// Batches match the single matrix functions exactly, whichever kernel runs
+			for (size_t i = 0; i < count; ++i)
+			{
+				const LibMath::Matrix4<float> single = LibMath::Matrix4<float>::ComposeTRS(translations[i], rotations[i], scales[i]);
+
+				LibMath::Vector3<float> translation;
+				LibMath::Quaternion<float> rotation;
+				LibMath::Vector3<float> scale;
+
+				matrices[i].Decompose(translation, rotation, scale);
+
+				for (int column = 0; column < 4; ++column)
+				{
+					for (int row = 0; row < 4; ++row)
+						CHECK(std::bit_cast<uint32_t>(composed[i].m_matrix[column][row]) == std::bit_cast<uint32_t>(single.m_matrix[column][row]));
+				}
+
+				for (unsigned int j = 0; j < 3; ++j)
+				{
+					CHECK(std::bit_cast<uint32_t>(decomposedTranslations[i][j]) == std::bit_cast<uint32_t>(translation[j]));
+					CHECK(std::bit_cast<uint32_t>(decomposedScales[i][j]) == std::bit_cast<uint32_t>(scale[j]));
+				}
+
+				for (unsigned int j = 0; j < 4; ++j)
+					CHECK(std::bit_cast<uint32_t>(decomposedRotations[i][j]) == std::bit_cast<uint32_t>(rotation[j]));
+			}
+		}
+
+		LibMath::simd::SetInstructionSet(activeSet);
+	}
+}
+
+TEST_CASE("Matrix<R, C>", "[.all][matrix]")
+{
+	float values[16];
+
+	for (int i = 0; i < 16; ++i)
+		values[i] = static_cast<float>(i) * 0.3f - 1.7f + static_cast<float>(i % 5) * 0.11f;
+
+	SECTION("Square")
+	{
+		LibMath::Matrix4<float> matrix4A(values);
+		LibMath::Matrix4<float> matrix4B(values);
+		matrix4B.Transpose();
+		matrix4B *= 0.5f;
+
+		const LibMath::Matrix<4, 4, float> matrixA(matrix4A);
+		const LibMath::Matrix<4, 4, float> matrixB(matrix4B);
+
+		// Same column major layout & summation order as Matrix4
+		CHECK(static_cast<LibMath::Matrix4<float>>(matrixA * matrixB) == matrix4A * matrix4B);
+		CHECK(static_cast<LibMath::Matrix4<float>>(matrixA + matrixB) == matrix4A + matrix4B);
+		CHECK(matrixA.Determinant() == matrix4A.Determinant());
+
+		LibMath::Matrix<4, 4, float> transposed(matrixA);
+		transposed.Transpose();
+
+		CHECK(transposed == matrixA.Transposed());
+		CHECK(transposed.Row(1) == matrixA.Column(1));
+
+		LibMath::Matrix<4, 4, float> product(matrixA);
+		product *= matrixB;
+
+		CHECK(product == matrixA * matrixB);
+
+		const glm::mat4 matrixGlm = glm::make_mat4(values);
+		const glm::vec4 resultGlm = matrixGlm * glm::vec4(1.0f, -2.0f, 0.5f, 3.0f);
+		const LibMath::Vector<4, float> result = matrixA * LibMath::Vector<4, float>(1.0f, -2.0f, 0.5f, 3.0f);
+
+		for (size_t i = 0; i < 4; ++i)
+			CHECK(result[i] == Catch::Approx(resultGlm[static_cast<int>(i)]));
+
+		LibMath::Matrix<3, 3, double> matrix3(LibMath::Matrix3<double>(2.0));
+		matrix3.m_matrix[2][0] = 1.0;
+
+		CHECK(matrix3.Determinant() == 8.0);
+		CHECK(LibMath::Matrix<3, 3, double>(matrix3).Inverse() * matrix3 == LibMath::Matrix<3, 3, double>());
+	}
+
+	SECTION("Affine")
+	{
+		// Columns: x axis, y axis, z axis, translation
+		const LibMath::Matrix3x4<float> transform(
+			LibMath::Vector<3, float>(0.0f, 1.0f, 0.0f),
+			LibMath::Vector<3, float>(-2.0f, 0.0f, 0.0f),
+			LibMath::Vector<3, float>(0.0f, 0.0f, 3.0f),
+			LibMath::Vector<3, float>(5.0f, 6.0f, 7.0f)
+		);
+
+		const LibMath::Vector<3, float> point(1.0f, 2.0f, 3.0f);
+
+		CHECK(transform.TransformPoint(point) == LibMath::Vector<3, float>(1.0f, 7.0f, 16.0f));
+		CHECK(transform.TransformDirection(point) == LibMath::Vector<3, float>(-4.0f, 1.0f, 9.0f));
+		CHECK(transform * LibMath::Vector<4, float>(point, 1.0f) == transform.TransformPoint(point));
+
+		// Same transform applied to a row vector (x, y, z, 1) as a 4x3 skinning matrix
+		const LibMath::Matrix4x3<float> skinning = transform.Transposed();
+
+		CHECK(LibMath::Vector<4, float>(point, 1.0f) * skinning == transform.TransformPoint(point));
+
+		// 3x4 * 4x4 keeps the affine shape
+		LibMath::Matrix4<float> scale;
+		scale.Scale(2.0f);
+
+		const LibMath::Matrix3x4<float> scaled = transform * LibMath::Matrix<4, 4, float>(scale);
+
+		CHECK(scaled.TransformPoint(point) == LibMath::Vector<3, float>(-3.0f, 8.0f, 25.0f));
+	}
+
+	SECTION("Non square product")
+	{
+		// 4 float rows use the SIMD columns, compare with the scalar sum in the same order
+		LibMath::Matrix<4, 3, float> lhs;
+		LibMath::Matrix<3, 2, float> rhs;
+
+		for (size_t i = 0; i < 12; ++i)
+			lhs.m_matrix[i / 4][i % 4] = values[i];
+
+		for (size_t i = 0; i < 6; ++i)
+			rhs.m_matrix[i / 3][i % 3] = values[15 - i];
+
+		const LibMath::Matrix<4, 2, float> product = lhs * rhs;
+
+		for (size_t column = 0; column < 2; ++column)
+		{
+			for (size_t row = 0; row < 4; ++row)
+			{
+				const float expected = lhs.m_matrix[0][row] * rhs.m_matrix[column][0] + lhs.m_matrix[1][row] * rhs.m_matrix[column][1] + lhs.m_matrix[2][row] * rhs.m_matrix[column][2];
+
+				CHECK(product.m_matrix[column][row] == expected);
+			}
+		}
+	}
+
+	SECTION("Wrappers")
+	{
+		// Matrix2, Matrix3 & Matrix4 forward to Matrix<N, N> & keep their own multiply order
+		STATIC_REQUIRE(std::is_base_of_v<LibMath::Matrix<2, 2, float>, LibMath::Matrix2<float>>);
+		STATIC_REQUIRE(std::is_base_of_v<LibMath::Matrix<3, 3, float>, LibMath::Matrix3<float>>);
+		STATIC_REQUIRE(std::is_base_of_v<LibMath::Matrix<4, 4, float>, LibMath::Matrix4<float>>);
+
+		const LibMath::Matrix3<float> matrix3A(values);
+		const LibMath::Matrix3<float> matrix3B(values + 7);
+
+		// Matrix3 reads m_matrix as [row][column], a * b is b * a on the column major base
+		CHECK(LibMath::Matrix<3, 3, float>(matrix3A * matrix3B) == LibMath::Matrix<3, 3, float>(matrix3B) * LibMath::Matrix<3, 3, float>(matrix3A));
+
+		const LibMath::Matrix4<float> matrix4A(values);
+		LibMath::Matrix4<float> matrix4B(values);
+		matrix4B.Transpose();
+
+		// Matrix4 *= multiplies on the left
+		LibMath::Matrix4<float> product(matrix4A);
+		product *= matrix4B;
+
+		CHECK(LibMath::Matrix<4, 4, float>(product) == LibMath::Matrix<4, 4, float>(matrix4B) * LibMath::Matrix<4, 4, float>(matrix4A));
+		CHECK(LibMath::Matrix<4, 4, float>(matrix4A * matrix4B) == LibMath::Matrix<4, 4, float>(matrix4A) * LibMath::Matrix<4, 4, float>(matrix4B));
+	}
+
+	SECTION("Constexpr")
+	{
+		constexpr LibMath::Matrix<2, 3, double> identity;
+		constexpr LibMath::Matrix<2, 2, double> product = LibMath::Matrix<2, 2, double>(3.0) * LibMath::Matrix<2, 2, double>(2.0);
+
+		STATIC_REQUIRE(identity.m_matrix[1][1] == 1.0);
+		STATIC_REQUIRE(identity.m_matrix[2][1] == 0.0);
+		STATIC_REQUIRE(product == LibMath::Matrix<2, 2, double>(6.0));
+	}
+}
+
+TEST_CASE("Matrix constexpr", "[.all][matrix]")
+{
+	SECTION("Matrix2")
+	{
+		STATIC_REQUIRE(LibMath::Matrix2<float>::Identity(3.0f).Determinant() == 9.0f);
+		STATIC_REQUIRE(LibMath::Matrix2<float>::Identity(2.0f) * LibMath::Matrix2<float>::Identity(0.5f) == LibMath::Matrix2<float>::Identity(1.0f));
+	}
+
+	SECTION("Matrix3")
+	{
+		STATIC_REQUIRE(LibMath::Matrix3<float>(2.0f).Determinant() == 8.0f);
+		STATIC_REQUIRE(LibMath::Matrix3<float>(2.0f).Inverse() == LibMath::Matrix3<float>(0.5f));
+	}
+
+	SECTION("Matrix4")
+	{
+		constexpr LibMath::Matrix4<float> transform = []
+		{
+			LibMath::Matrix4<float> matrix;
+			matrix.Scale(2.0f);
+			matrix.Translate(1.0f, 2.0f, 3.0f);
+
+			return matrix;
+		}();
+
+		constexpr LibMath::Matrix4<float> inverse = LibMath::Matrix4<float>(transform).Inverse();
+
+		// Matrix4<float> multiplication & inverse use the SIMD kernels at runtime only
+		STATIC_REQUIRE(LibMath::Matrix4<float>(transform) * inverse == LibMath::Matrix4<float>());
+		STATIC_REQUIRE(LibMath::Matrix4<float>(transform).Determinant() == 8.0f);
+		STATIC_REQUIRE((transform * LibMath::Vector4<float>(1.0f, 1.0f, 1.0f, 1.0f))[2] == 5.0f);
+
+		LibMath::Matrix4<float> runtimeTransform(transform);
+		CHECK(runtimeTransform * inverse == LibMath::Matrix4<float>());
+		CHECK(LibMath::Matrix4<float>(transform).Inverse() == inverse);
+	}
+
+	SECTION("AffineMatrix4")
+	{
+		constexpr LibMath::AffineMatrix4<float> identity = LibMath::AffineMatrix4<float>::Identity();
+
+		STATIC_REQUIRE(identity == LibMath::AffineMatrix4<float>());
+	}
 }
\ No newline at end of file
@@ -0,0 +1,337 @@
+#include "LibMath/Packed.h"
+#include "LibMath/simd/Simd.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace
+{
+	// Runs function once per instruction set the CPU supports, the kernels must give the scalar results
+	template<typename Function>
+	void ForEachInstructionSet(Function&& function)
+	{
+		const LibMath::simd::InstructionSet activeSet = LibMath::simd::ActiveInstructionSet();
+
+		for (int set = 0; set <= static_cast<int>(LibMath::simd::InstructionSet::AVX2_FMA); ++set)
+		{
+			if (LibMath::simd::SetInstructionSet(static_cast<LibMath::simd::InstructionSet>(set)))
+				function();
+		}
+
+		LibMath::simd::SetInstructionSet(activeSet);
+	}
+
+	std::vector<LibMath::Vector3<float>> RandomUnitVectors(size_t count)
+	{
+		std::mt19937 generator(42);
+		std::normal_distribution<float> distribution;
+
+		std::vector<LibMath::Vector3<float>> vectors;
+
+		for (size_t i = 0; i < count; ++i)
+			vectors.push_back(LibMath::Vector3<float>(distribution(generator), distribution(generator), distribution(generator)).Normalize());
+
+		return vectors;
+	}
+
+	std::vector<LibMath::Quaternion<float>> RandomUnitQuaternions(size_t count)
+	{
+		std::mt19937 generator(7);
+		std::normal_distribution<float> distribution;
+
+		std::vector<LibMath::Quaternion<float>> quaternions;
+
+		for (size_t i = 0; i < count; ++i)
+			quaternions.push_back(LibMath::Quaternion<float>(distribution(generator), distribution(generator), distribution(generator), distribution(generator)).Normalize());
+
+		return quaternions;
+	}
+
+	// Rotation angle between 2 unit quaternions from the chord length, acos of the dot product is too coarse in float
+	double AngleBetween(LibMath::Quaternion<float> const& quat1, LibMath::Quaternion<float> const& quat2)
+	{
+		const double sign = (quat1.Dot(quat2) < 0.0f) ? -1.0 : 1.0;
+
+		double chord = 0.0;
+
+		for (unsigned int i = 0; i < 4; ++i)
+			chord += std::pow(static_cast<double>(quat1[i]) - sign * static_cast<double>(quat2[i]), 2.0);
+
+		return 4.0 * std::asin(std::sqrt(chord) * 0.5);
+	}
+}
+
+TEST_CASE("Half", "[.all][packed]")
+{
+	SECTION("Conversion")
+	{
+		CHECK(LibMath::Half(1.0f).Bits() == 0x3c00);
+		CHECK(LibMath::Half(-2.0f).Bits() == 0xc000);
+		CHECK(LibMath::Half(0.1f).Bits() == 0x2e66);
+		CHECK(LibMath::Half(-0.0f).Bits() == 0x8000);
+		CHECK(LibMath::Half(65504.0f).Bits() == 0x7bff);
+		CHECK(LibMath::Half(6.1035156e-5f).Bits() == 0x0400);
+		CHECK(LibMath::Half(5.9604645e-8f).Bits() == 0x0001);
+
+		// Nearest even on ties, overflow to infinity
+		CHECK(LibMath::Half(2049.0f).Bits() == 0x6800);
+		CHECK(LibMath::Half(2051.0f).Bits() == 0x6802);
+		CHECK(LibMath::Half(65519.0f).Bits() == 0x7bff);
+		CHECK(LibMath::Half(65520.0f).Bits() == 0x7c00);
+		CHECK(LibMath::Half(std::numeric_limits<float>::infinity()).Bits() == 0x7c00);
+		CHECK(LibMath::Half(2.0e-8f).Bits() == 0x0000);
+		CHECK(std::isnan(static_cast<float>(LibMath::Half(std::numeric_limits<float>::quiet_NaN()))));
+
+		CHECK(static_cast<float>(LibMath::Half(0.1f)) == 0.0999755859375f);
+		CHECK(static_cast<float>(LibMath::Half::FromBits(0xfc00)) == -std::numeric_limits<float>::infinity());
+	}
+
+	SECTION("Round trip")
+	{
+		// Every half is a float, converting it back gives the same bits
+		for (uint32_t bits = 0; bits <= 0xffff; ++bits)
+		{
+			const LibMath::Half half = LibMath::Half::FromBits(static_cast<uint16_t>(bits));
+			const float value = static_cast<float>(half);
+
+			if (!std::isnan(value))
+				CHECK(LibMath::Half(value) == half);
+		}
+
+		// Normal range relative error
+		std::mt19937 generator(3);
+		std::uniform_real_distribution<float> mantissa(1.0f, 2.0f);
+		std::uniform_int_distribution<int> exponent(-14, 14);
+
+		for (int i = 0; i < 10000; ++i)
+		{
+			const float value = std::ldexp(mantissa(generator), exponent(generator));
+
+			CHECK(std::abs(static_cast<float>(LibMath::Half(value)) - value) <= value * 0.00048828125f);
+		}
+	}
+
+	SECTION("Batch")
+	{
+		// Odd count so the SIMD blocks & the scalar tail both run
+		std::vector<float> values = { 1.0f, -0.0f, 65520.0f, 5.9604645e-8f, 2049.0f, std::numeric_limits<float>::infinity(), 1.0e-6f };
+
+		for (int i = 0; i < 30; ++i)
+			values.push_back(static_cast<float>(i) * 37.3f - 500.0f);
+
+		const std::vector<LibMath::Vector3<float>> vectors = RandomUnitVectors(13);
+
+		ForEachInstructionSet([&]
+		{
+			std::vector<LibMath::Half> halves(values.size());
+			std::vector<float> unpacked(values.size());
+
+			LibMath::Pack(values, halves);
+			LibMath::Unpack(halves, unpacked);
+
+			for (size_t i = 0; i < values.size(); ++i)
+			{
+				CHECK(halves[i] == LibMath::Half(values[i]));
+				CHECK(unpacked[i] == static_cast<float>(LibMath::Half(values[i])));
+			}
+
+			std::vector<LibMath::Half> vectorHalves(vectors.size() * 3);
+			std::vector<LibMath::Vector3<float>> unpackedVectors(vectors.size());
+
+			LibMath::Pack(vectors, vectorHalves);
+			LibMath::Unpack(vectorHalves, unpackedVectors);
+
+			for (size_t i = 0; i < vectors.size(); ++i)
+			{
+				for (unsigned int j = 0; j < 3; ++j)
+					CHECK(unpackedVectors[i][j] == static_cast<float>(LibMath::Half(vectors[i][j])));
+			}
+		});
+	}
+
+	SECTION("Constexpr")
+	{
+		STATIC_REQUIRE(LibMath::Half(1.5f).Bits() == 0x3e00);
+		STATIC_REQUIRE(static_cast<float>(LibMath::Half::FromBits(0x0001)) == 5.9604645e-8f);
+	}
+}
+
+TEST_CASE("Snorm16", "[.all][packed]")
+{
+	SECTION("Conversion")
+	{
+		CHECK(LibMath::Snorm16(1.0f).Bits() == 32767);
+		CHECK(LibMath::Snorm16(-1.0f).Bits() == -32767);
+		CHECK(LibMath::Snorm16(0.0f).Bits() == 0);
+		CHECK(LibMath::Snorm16(2.0f).Bits() == 32767);
+		CHECK(LibMath::Snorm16(-3.0f).Bits() == -32767);
+		CHECK(LibMath::Snorm16(std::numeric_limits<float>::quiet_NaN()).Bits() == -32767);
+
+		CHECK(static_cast<float>(LibMath::Snorm16(1.0f)) == 1.0f);
+		CHECK(static_cast<float>(LibMath::Snorm16(-0.5f)) == Catch::Approx(-0.5f).margin(1.54e-5f));
+		CHECK(static_cast<float>(LibMath::Snorm16::FromBits(-32768)) == -1.0f);
+	}
+
+	SECTION("Error bound")
+	{
+		for (int i = -10000; i <= 10000; ++i)
+		{
+			const float value = static_cast<float>(i) / 10000.0f;
+
+			CHECK(std::abs(static_cast<float>(LibMath::Snorm16(value)) - value) <= 1.54e-5f);
+		}
+	}
+
+	SECTION("Batch")
+	{
+		std::vector<float> values = { 1.0f, -1.0f, 2.0f, -0.0f, std::numeric_limits<float>::quiet_NaN() };
+
+		for (int i = 0; i < 32; ++i)
+			values.push_back(static_cast<float>(i) * 0.0625f - 1.0f);
+
+		const std::vector<LibMath::Vector4<float>> vectors(5, LibMath::Vector4<float>(0.25f, -0.75f, 0.5f, 1.0f));
+
+		ForEachInstructionSet([&]
+		{
+			std::vector<LibMath::Snorm16> snorms(values.size());
+			std::vector<float> unpacked(values.size());
+
+			LibMath::Pack(values, snorms);
+			LibMath::Unpack(snorms, unpacked);
+
+			for (size_t i = 0; i < values.size(); ++i)
+			{
+				CHECK(snorms[i] == LibMath::Snorm16(values[i]));
+				CHECK(unpacked[i] == static_cast<float>(LibMath::Snorm16(values[i])));
+			}
+
+			std::vector<LibMath::Snorm16> vectorSnorms(vectors.size() * 4);
+			std::vector<LibMath::Vector4<float>> unpackedVectors(vectors.size());
+
+			LibMath::Pack(vectors, vectorSnorms);
+			LibMath::Unpack(vectorSnorms, unpackedVectors);
+
+			for (size_t i = 0; i < vectors.size(); ++i)
+			{
+				for (unsigned int j = 0; j < 4; ++j)
+					CHECK(unpackedVectors[i][j] == static_cast<float>(LibMath::Snorm16(vectors[i][j])));
+			}
+		});
+	}
+}
+
+TEST_CASE("Octahedral32", "[.all][packed]")
+{
+	SECTION("Axes")
+	{
+		// Axes sit on the vertices of the octahedron & decode exactly
+		const LibMath::Vector3<float> axes[] =
+		{
+			LibMath::Vector3<float>(1.0f, 0.0f, 0.0f), LibMath::Vector3<float>(-1.0f, 0.0f, 0.0f),
+			LibMath::Vector3<float>(0.0f, 1.0f, 0.0f), LibMath::Vector3<float>(0.0f, -1.0f, 0.0f),
+			LibMath::Vector3<float>(0.0f, 0.0f, 1.0f), LibMath::Vector3<float>(0.0f, 0.0f, -1.0f)
+		};
+
+		for (LibMath::Vector3<float> const& axis : axes)
+			CHECK(static_cast<LibMath::Vector3<float>>(LibMath::Octahedral32(axis)) == axis);
+
+		CHECK(static_cast<LibMath::Vector3<float>>(LibMath::Octahedral32()) == LibMath::Vector3<float>(0.0f, 0.0f, 1.0f));
+	}
+
+	SECTION("Round trip")
+	{
+		for (LibMath::Vector3<float> const& vector : RandomUnitVectors(10000))
+		{
+			const LibMath::Vector3<float> decoded = static_cast<LibMath::Vector3<float>>(LibMath::Octahedral32(vector));
+
+			CHECK(decoded.Magnitude() == Catch::Approx(1.0f).margin(1.0e-6f));
+			CHECK(decoded.Cross(vector).Magnitude() <= 7.0e-5f);
+			CHECK(decoded.Dot(vector) > 0.0f);
+		}
+	}
+
+	SECTION("Batch")
+	{
+		const std::vector<LibMath::Vector3<float>> vectors = RandomUnitVectors(37);
+
+		ForEachInstructionSet([&]
+		{
+			std::vector<LibMath::Octahedral32> encoded(vectors.size());
+			std::vector<LibMath::Vector3<float>> decoded(vectors.size());
+
+			LibMath::Pack(vectors, encoded);
+			LibMath::Unpack(encoded, decoded);
+
+			for (size_t i = 0; i < vectors.size(); ++i)
+			{
+				CHECK(encoded[i] == LibMath::Octahedral32(vectors[i]));
+				CHECK(decoded[i] == static_cast<LibMath::Vector3<float>>(encoded[i]));
+			}
+		});
+	}
+}
+
+TEST_CASE("PackedQuaternion", "[.all][packed]")
+{
+	STATIC_REQUIRE(sizeof(LibMath::Quaternion32) == 4);
+	STATIC_REQUIRE(sizeof(LibMath::Quaternion48) == 6);
+
+	SECTION("Exact values")
+	{
+		// 0 is the middle code, the identity & quarter turns decode exactly
+		const LibMath::Quaternion<float> identity(1.0f, 0.0f, 0.0f, 0.0f);
+		const LibMath::Quaternion<float> halfTurn(0.0f, 0.0f, 1.0f, 0.0f);
+
+		CHECK(static_cast<LibMath::Quaternion<float>>(LibMath::Quaternion32()) == identity);
+		CHECK(static_cast<LibMath::Quaternion<float>>(LibMath::Quaternion48(identity)) == identity);
+		CHECK(static_cast<LibMath::Quaternion<float>>(LibMath::Quaternion32(halfTurn)) == halfTurn);
+
+		// q & -q are the same rotation & the same encoding
+		CHECK(LibMath::Quaternion32(identity * -1.0f) == LibMath::Quaternion32(identity));
+		CHECK(LibMath::Quaternion48::FromBits(LibMath::Quaternion48(halfTurn).Bits()) == LibMath::Quaternion48(halfTurn));
+	}
+
+	SECTION("Round trip")
+	{
+		for (LibMath::Quaternion<float> const& quaternion : RandomUnitQuaternions(10000))
+		{
+			const LibMath::Quaternion<float> decoded32 = static_cast<LibMath::Quaternion<float>>(LibMath::Quaternion32(quaternion));
+			const LibMath::Quaternion<float> decoded48 = static_cast<LibMath::Quaternion<float>>(LibMath::Quaternion48(quaternion));
+
+			CHECK(AngleBetween(decoded32, quaternion) <= 0.005);
+			CHECK(AngleBetween(decoded48, quaternion) <= 1.5e-4);
+			CHECK(decoded48.Magnitude() == Catch::Approx(1.0f).margin(1.0e-6f));
+		}
+	}
+
+	SECTION("Batch")
+	{
+		const std::vector<LibMath::Quaternion<float>> quaternions = RandomUnitQuaternions(37);
+
+		ForEachInstructionSet([&]
+		{
+			std::vector<LibMath::Quaternion32> encoded32(quaternions.size());
+			std::vector<LibMath::Quaternion48> encoded48(quaternions.size());
+			std::vector<LibMath::Quaternion<float>> decoded32(quaternions.size());
+			std::vector<LibMath::Quaternion<float>> decoded48(quaternions.size());
+
+			LibMath::Pack(quaternions, encoded32);
+			LibMath::Pack(quaternions, encoded48);
+			LibMath::Unpack(encoded32, decoded32);
+			LibMath::Unpack(encoded48, decoded48);
+
+			for (size_t i = 0; i < quaternions.size(); ++i)
+			{
+				CHECK(encoded32[i] == LibMath::Quaternion32(quaternions[i]));
+				CHECK(encoded48[i] == LibMath::Quaternion48(quaternions[i]));
+				CHECK(decoded32[i] == static_cast<LibMath::Quaternion<float>>(encoded32[i]));
+				CHECK(decoded48[i] == static_cast<LibMath::Quaternion<float>>(encoded48[i]));
+			}
+		});
+	}
+}
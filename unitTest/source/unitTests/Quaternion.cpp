@@ -1,4 +1,7 @@
+#include "LibMath/Matrix.h"
 #include "LibMath/Quaternion.h"
+#include "LibMath/QuaternionStream.h"
+#include "LibMath/simd/Simd.h"
 
 #define GLM_ENABLE_EXPERIMENTAL
 #define GLM_FORCE_QUAT_DATA_WXYZ
@@ -7,6 +10,11 @@
 #include <glm/common.hpp>
 #include <glm/gtx/quaternion.hpp>
 
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
 #define CHECK_QUAT(quat, quatGlm) CHECK(quat[1] == Catch::Approx(quatGlm.x)); CHECK(quat[2] == Catch::Approx(quatGlm.y)); CHECK(quat[3] == Catch::Approx(quatGlm.z)); CHECK(quat[0] == Catch::Approx(quatGlm.w))
 
 TEST_CASE("Quaternion", "[.all][Quaternion]")
@@ -113,4 +121,624 @@ TEST_CASE("Quaternion", "[.all][Quaternion]")
 		CHECK(quat1 != quat2);
 		CHECK_FALSE(quat1 != quat1);
 	}
-}
\ No newline at end of file
+}
+
+TEST_CASE("Quaternion SIMD", "[.all][Quaternion]")
+{
+	// Quaternion<float> is the SSE2 specialisation, Quaternion<double> uses the generic template
+	const math::Quaternion<float> quat1(1.0f, 2.0f, 3.0f, 4.0f);
+	const math::Quaternion<float> quat2(2.5f, -5.0f, 1.0f, -3.2f);
+	const math::Quaternion<double> quat1Double(1.0, 2.0, 3.0, 4.0);
+	const math::Quaternion<double> quat2Double(2.5, -5.0, 1.0, -3.2);
+
+#define CHECK_QUAT_DOUBLE(quat, quatDouble) for (unsigned int i = 0; i < 4; ++i) CHECK(quat[i] == Catch::Approx(quatDouble[i]))
+
+	SECTION("Layout")
+	{
+		CHECK(sizeof(math::Quaternion<float>) == 4 * sizeof(float));
+#if LIBMATH_SIMD_SSE2
+		// Only the SSE2 specialisation is 16 byte aligned
+		CHECK(alignof(math::Quaternion<float>) >= 4 * sizeof(float));
+#endif
+
+		// Index 0 is w
+		math::Quaternion<float> quat(quat1);
+		quat[0] = 10.0f;
+		quat[3] = -1.0f;
+
+		CHECK(quat[0] == 10.0f);
+		CHECK(quat[1] == 2.0f);
+		CHECK(quat[2] == 3.0f);
+		CHECK(quat[3] == -1.0f);
+		CHECK(math::Quaternion<float>(4.0f, math::Vector3<float>(1.0f, 2.0f, 3.0f)) == math::Quaternion<float>(4.0f, 1.0f, 2.0f, 3.0f));
+	}
+
+	SECTION("Matches generic")
+	{
+		CHECK_QUAT_DOUBLE((quat1 * quat2), (quat1Double * quat2Double));
+		CHECK_QUAT_DOUBLE((quat2 * quat1), (quat2Double * quat1Double));
+		CHECK_QUAT_DOUBLE((quat1 / quat2), (quat1Double / quat2Double));
+		CHECK_QUAT_DOUBLE(quat1.Inverse(), quat1Double.Inverse());
+		CHECK_QUAT_DOUBLE(math::Quaternion<float>(quat1).Conjugate(), math::Quaternion<double>(quat1Double).Conjugate());
+		CHECK_QUAT_DOUBLE(math::Quaternion<float>(quat1).Normalize(), math::Quaternion<double>(quat1Double).Normalize());
+		CHECK_QUAT_DOUBLE(quat1.Rotate(30.0f, math::Vector3<float>(0.0f, 0.0f, 1.0f)), quat1Double.Rotate(30.0, math::Vector3<double>(0.0, 0.0, 1.0)));
+
+		CHECK(quat1.Magnitude() == Catch::Approx(quat1Double.Magnitude()));
+		CHECK(quat1.Dot(quat2) == Catch::Approx(quat1Double.Dot(quat2Double)));
+		CHECK(quat1 != quat2);
+		CHECK_FALSE(quat1.IsPure());
+		CHECK(math::Quaternion<float>(0.0f, 1.0f, 2.0f, 3.0f).IsPure());
+	}
+
+	SECTION("Fast normalize")
+	{
+		// Reciprocal sqrt estimate + 1 Newton-Raphson step, within 5 ulp of the exact result
+		const math::Quaternion<float> fast = math::Quaternion<float>(quat2).Normalize(math::Precision::Fast);
+		const math::Quaternion<float> exact = math::Quaternion<float>(quat2).Normalize();
+
+		for (unsigned int i = 0; i < 4; ++i)
+			CHECK(fast[i] == Catch::Approx(exact[i]).epsilon(1e-6));
+
+		CHECK(quat2.Magnitude(math::Precision::Fast) == Catch::Approx(quat2.Magnitude()).epsilon(1e-6));
+		CHECK_QUAT_DOUBLE(math::Quaternion<double>(quat2Double).Normalize(math::Precision::Fast), math::Quaternion<double>(quat2Double).Normalize());
+	}
+
+#undef CHECK_QUAT_DOUBLE
+}
+
+TEST_CASE("Quaternion constexpr", "[.all][Quaternion]")
+{
+	// Quaternion<float> is the SSE2 specialisation when available, the scalar path runs at compile time
+	constexpr math::Quaternion<float> rotation = math::Quaternion<float>::AngleAxis(PI * 0.5f, math::Vector3<float>(0.0f, 0.0f, 1.0f));
+
+	STATIC_REQUIRE(math::AlmostEqual(rotation.Magnitude(), 1.0f));
+	STATIC_REQUIRE(rotation * rotation.Inverse() == math::Quaternion<float>(1.0f, 0.0f, 0.0f, 0.0f));
+	STATIC_REQUIRE((math::Quaternion<float>(1.0f, 2.0f, 3.0f, 4.0f) * math::Quaternion<float>(5.0f, 6.0f, 7.0f, 8.0f))[0] == -60.0f);
+	STATIC_REQUIRE((math::Quaternion<double>(1.0, 2.0, 3.0, 4.0) * math::Quaternion<double>(5.0, 6.0, 7.0, 8.0))[1] == 12.0);
+	STATIC_REQUIRE(math::Quaternion<float>(0.0f, 1.0f, 2.0f, 3.0f).IsPure());
+
+	math::Quaternion<float> runtimeRotation = math::Quaternion<float>::AngleAxis(PI * 0.5f, math::Vector3<float>(0.0f, 0.0f, 1.0f));
+	CHECK(runtimeRotation == rotation);
+}
+
+TEST_CASE("Quaternion rotate vector", "[.all][Quaternion]")
+{
+	const math::Quaternion<float> rotation = math::Quaternion<float>::AngleAxis(1.3f, math::Vector3<float>(1.0f, -2.0f, 0.5f).Normalize());
+	const glm::quat rotationGlm(rotation[0], rotation[1], rotation[2], rotation[3]);
+
+	SECTION("Single")
+	{
+		for (math::Vector3<float> const& vec3 : { math::Vector3<float>(1.0f, 0.0f, 0.0f), math::Vector3<float>(0.0f, 2.5f, -1.0f), math::Vector3<float>(-3.0f, 4.0f, 7.5f) })
+		{
+			const math::Vector3<float> rotated = rotation.RotateVector(vec3);
+			const glm::vec3 rotatedGlm = rotationGlm * glm::vec3(vec3[0], vec3[1], vec3[2]);
+
+			CHECK(rotated[0] == Catch::Approx(rotatedGlm.x));
+			CHECK(rotated[1] == Catch::Approx(rotatedGlm.y));
+			CHECK(rotated[2] == Catch::Approx(rotatedGlm.z));
+			CHECK(rotated.Magnitude() == Catch::Approx(vec3.Magnitude()));
+		}
+
+		// Quarter turn around z, PI is a float
+		const math::Vector3<double> rotated = math::Quaternion<double>::AngleAxis(PI * 0.5, math::Vector3<double>(0.0, 0.0, 1.0)).RotateVector(math::Vector3<double>(1.0, 0.0, 0.0));
+
+		CHECK(rotated[0] == Catch::Approx(0.0).margin(1e-6));
+		CHECK(rotated[1] == Catch::Approx(1.0));
+		CHECK(rotated[2] == Catch::Approx(0.0).margin(1e-12));
+	}
+
+	SECTION("Batch")
+	{
+		// Odd size covers the 4 vector SIMD blocks & the tail, results match the single vector function
+		std::vector<math::Vector3<float>> vectors;
+
+		for (int i = 0; i < 1003; ++i)
+			vectors.emplace_back(static_cast<float>(i) * 0.1f, std::sin(static_cast<float>(i)), static_cast<float>(500 - i));
+
+		std::vector<math::Vector3<float>> result(vectors.size());
+		rotation.RotateVector(vectors, result);
+
+		for (size_t i = 0; i < vectors.size(); ++i)
+		{
+			const math::Vector3<float> expected = rotation.RotateVector(vectors[i]);
+
+			CHECK(result[i][0] == expected[0]);
+			CHECK(result[i][1] == expected[1]);
+			CHECK(result[i][2] == expected[2]);
+		}
+
+		// In place
+		rotation.RotateVector(vectors, vectors);
+
+		for (size_t i = 0; i < vectors.size(); ++i)
+			CHECK(vectors[i] == result[i]);
+
+		std::vector<math::Vector3<double>> vectorsDouble = { math::Vector3<double>(1.0, 2.0, 3.0), math::Vector3<double>(-4.0, 0.5, 0.0) };
+		std::vector<math::Vector3<double>> resultDouble(vectorsDouble.size());
+
+		const math::Quaternion<double> rotationDouble(rotation[0], rotation[1], rotation[2], rotation[3]);
+		rotationDouble.RotateVector(vectorsDouble, resultDouble);
+
+		CHECK(resultDouble[1][0] == Catch::Approx(rotation.RotateVector(math::Vector3<float>(-4.0f, 0.5f, 0.0f))[0]));
+	}
+
+	SECTION("Constexpr")
+	{
+		constexpr math::Vector3<float> rotated = math::Quaternion<float>(0.0f, 0.0f, 0.0f, 1.0f).RotateVector(math::Vector3<float>(1.0f, 2.0f, 3.0f));
+
+		// Half turn around z
+		STATIC_REQUIRE(rotated == math::Vector3<float>(-1.0f, -2.0f, 3.0f));
+	}
+}
+
+TEST_CASE("Quaternion interpolation", "[.all][Quaternion]")
+{
+	const math::Quaternion<float> from = math::Quaternion<float>::AngleAxis(0.3f, math::Vector3<float>(1.0f, 2.0f, 3.0f).Normalize());
+	const math::Quaternion<float> to = math::Quaternion<float>::AngleAxis(2.1f, math::Vector3<float>(-2.0f, 0.5f, 1.0f).Normalize());
+	const glm::quat fromGlm(from[0], from[1], from[2], from[3]);
+	const glm::quat toGlm(to[0], to[1], to[2], to[3]);
+
+	SECTION("Slerp")
+	{
+		for (float t : { 0.0f, 0.1f, 0.25f, 0.5f, 0.8f, 1.0f })
+		{
+			CHECK_QUAT(math::Slerp(from, to, t), glm::slerp(fromGlm, toGlm, t));
+
+			// Shortest path, -to is the same rotation
+			CHECK_QUAT(math::Slerp(from, to * -1.0f, t), glm::slerp(fromGlm, -toGlm, t));
+		}
+
+		// Parallel quaternions fall back to nlerp
+		CHECK_QUAT(math::Slerp(from, from, 0.5f), fromGlm);
+
+		const math::Quaternion<double> fromDouble(from[0], from[1], from[2], from[3]);
+		const math::Quaternion<double> toDouble(to[0], to[1], to[2], to[3]);
+		const math::Quaternion<double> halfway = math::Slerp(fromDouble, toDouble, 0.5);
+
+		for (unsigned int i = 0; i < 4; ++i)
+			CHECK(math::Slerp(from, to, 0.5f)[i] == Catch::Approx(halfway[i]));
+	}
+
+	SECTION("Nlerp")
+	{
+		for (float t : { 0.0f, 0.3f, 0.5f, 1.0f })
+		{
+			CHECK_QUAT(math::Nlerp(from, to, t), glm::normalize(glm::lerp(fromGlm, toGlm, t)));
+			CHECK_QUAT(math::Nlerp(from, to * -1.0f, t), glm::normalize(glm::lerp(fromGlm, toGlm, t)));
+		}
+	}
+
+	SECTION("Fast slerp")
+	{
+		// Corrected nlerp, within 1e-3 radians of the exact rotation
+		const math::Vector3<float> axis = math::Vector3<float>(0.0f, 1.0f, 0.0f);
+
+		for (float angle = 0.0f; angle < 6.2f; angle += 0.3f)
+		{
+			const math::Quaternion<float> target = math::Quaternion<float>::AngleAxis(angle, axis) * from;
+
+			for (float t = 0.0f; t <= 1.0f; t += 0.125f)
+			{
+				const math::Quaternion<float> exact = math::Slerp(from, target, t);
+				const math::Quaternion<float> fast = math::Slerp(from, target, t, math::Precision::Fast);
+
+				for (unsigned int i = 0; i < 4; ++i)
+					CHECK(fast[i] == Catch::Approx(exact[i]).margin(1e-3));
+
+				CHECK(fast.Magnitude() == Catch::Approx(1.0f).epsilon(1e-6));
+			}
+		}
+	}
+
+	SECTION("Constexpr")
+	{
+		constexpr math::Quaternion<double> fromDouble(1.0, 0.0, 0.0, 0.0);
+		constexpr math::Quaternion<double> toDouble(0.0, 0.0, 0.0, 1.0);
+		constexpr math::Quaternion<double> halfway = math::Slerp(fromDouble, toDouble, 0.5);
+
+		// Halfway to a 180 degree rotation is 90 degrees
+		STATIC_REQUIRE(math::AlmostEqual(halfway[0], halfway[3]));
+		STATIC_REQUIRE(math::AlmostEqual(halfway.Magnitude(), 1.0));
+
+		CHECK(halfway[0] == Catch::Approx(std::sqrt(0.5)));
+	}
+}
+
+TEST_CASE("Quaternion conversions", "[.all][Quaternion]")
+{
+	using math::EulerOrder;
+
+	// Indexed by EulerOrder, the axes in the order the rotations are applied
+	const char* const orderNames[] = { "XYZ", "XZY", "YXZ", "YZX", "ZXY", "ZYX", "XYX", "XZX", "YXY", "YZY", "ZXZ", "ZYZ" };
+	constexpr double pi = 3.14159265358979323846;
+
+	const auto axis = [](char name)
+	{
+		return math::Vector3<double>(name == 'X' ? 1.0 : 0.0, name == 'Y' ? 1.0 : 0.0, name == 'Z' ? 1.0 : 0.0);
+	};
+
+	// q & -q are the same rotation
+	const auto sameRotation = [](auto const& quat1, auto const& quat2, double margin)
+	{
+		return std::abs(std::abs(static_cast<double>(quat1.Dot(quat2))) - 1.0) <= margin;
+	};
+
+	SECTION("Euler")
+	{
+		for (int index = 0; index < 12; ++index)
+		{
+			const EulerOrder order = static_cast<EulerOrder>(index);
+			const char* const name = orderNames[index];
+
+			// Second angle away from gimbal lock, [-pi / 2, pi / 2] or [0, pi]
+			const double secondMin = (name[0] == name[2]) ? 0.25 : -1.5;
+
+			for (double first = -3.0; first <= 3.0; first += 0.75)
+			{
+				for (double second = secondMin; second <= secondMin + 2.9; second += 0.5)
+				{
+					for (double third = -3.0; third <= 3.0; third += 1.5)
+					{
+						const math::Quaternion<double> quat = math::Quaternion<double>::FromEuler(math::Radian<double>(first), math::Radian<double>(second), math::Radian<double>(third), order);
+
+						// Rotations around the fixed axes, the first one applied first
+						const math::Quaternion<double> expected =
+							math::Quaternion<double>::AngleAxis(third, axis(name[2])) *
+							math::Quaternion<double>::AngleAxis(second, axis(name[1])) *
+							math::Quaternion<double>::AngleAxis(first, axis(name[0]));
+
+						for (unsigned int i = 0; i < 4; ++i)
+							CHECK(quat[i] == Catch::Approx(expected[i]).margin(1e-12));
+
+						math::Radian<double> angles[3];
+						quat.ToEuler(angles[0], angles[1], angles[2], order);
+
+						CHECK(angles[0].Value() == Catch::Approx(first).margin(1e-9));
+						CHECK(angles[1].Value() == Catch::Approx(second).margin(1e-9));
+						CHECK(angles[2].Value() == Catch::Approx(third).margin(1e-9));
+					}
+				}
+			}
+		}
+
+		// XYZ turns around x first: y to z, then around y: z to x
+		const math::Vector3<float> rotated = math::Quaternion<float>::FromEuler(math::Radian<float>(PI * 0.5f), math::Radian<float>(PI * 0.5f), math::Radian<float>(0.0f)).RotateVector(math::Vector3<float>(0.0f, 1.0f, 0.0f));
+
+		CHECK(rotated[0] == Catch::Approx(1.0f));
+		CHECK(rotated[1] == Catch::Approx(0.0f).margin(1e-6f));
+		CHECK(rotated[2] == Catch::Approx(0.0f).margin(1e-6f));
+
+		// Degrees
+		const math::Quaternion<float> degrees = math::Quaternion<float>::FromEuler(math::Degree<float>(30.0f), math::Degree<float>(-45.0f), math::Degree<float>(120.0f), EulerOrder::ZXY);
+		const math::Quaternion<float> radians = math::Quaternion<float>::FromEuler(math::Radian<float>(30.0f * DEG2RAD), math::Radian<float>(-45.0f * DEG2RAD), math::Radian<float>(120.0f * DEG2RAD), EulerOrder::ZXY);
+
+		for (unsigned int i = 0; i < 4; ++i)
+			CHECK(degrees[i] == Catch::Approx(radians[i]).margin(1e-6f));
+
+		math::Degree<float> degreeAngles[3];
+		degrees.ToEuler(degreeAngles[0], degreeAngles[1], degreeAngles[2], EulerOrder::ZXY);
+
+		CHECK(degreeAngles[0].Value() == Catch::Approx(30.0f).margin(1e-3f));
+		CHECK(degreeAngles[1].Value() == Catch::Approx(-45.0f).margin(1e-3f));
+		CHECK(degreeAngles[2].Value() == Catch::Approx(120.0f).margin(1e-3f));
+	}
+
+	SECTION("Gimbal lock")
+	{
+		for (int index = 0; index < 12; ++index)
+		{
+			const EulerOrder order = static_cast<EulerOrder>(index);
+			const bool proper = orderNames[index][0] == orderNames[index][2];
+
+			const double locks[] = { proper ? 0.0 : -pi * 0.5, proper ? pi : pi * 0.5 };
+
+			for (double lock : locks)
+			{
+				// At & next to the lock, only the first + third (or first - third) angle is defined
+				for (double second : { lock, lock + ((lock > 0.0) ? -1e-10 : 1e-10) })
+				{
+					const math::Quaternion<double> quat = math::Quaternion<double>::FromEuler(math::Radian<double>(0.7), math::Radian<double>(second), math::Radian<double>(-1.9), order);
+
+					math::Radian<double> angles[3];
+					quat.ToEuler(angles[0], angles[1], angles[2], order);
+
+					CHECK(angles[2].Value() == 0.0);
+					CHECK(angles[1].Value() == Catch::Approx(lock).margin(1e-9));
+					CHECK(std::abs(angles[0].Value()) <= pi);
+					CHECK(sameRotation(math::Quaternion<double>::FromEuler(angles[0], angles[1], angles[2], order), quat, 1e-12));
+				}
+			}
+		}
+
+		// Any rotation survives the round trip in float
+		for (int i = 0; i < 200; ++i)
+		{
+			const float value = static_cast<float>(i);
+			const math::Quaternion<float> quat = math::Quaternion<float>::AngleAxis(value * 0.31f, math::Vector3<float>(std::sin(value), std::cos(value * 1.7f), 0.5f).Normalize());
+			const EulerOrder order = static_cast<EulerOrder>(i % 12);
+
+			math::Radian<float> angles[3];
+			quat.ToEuler(angles[0], angles[1], angles[2], order);
+
+			CHECK(sameRotation(math::Quaternion<float>::FromEuler(angles[0], angles[1], angles[2], order), quat, 1e-6));
+		}
+	}
+
+	SECTION("Matrix")
+	{
+		const math::Vector3<float> translation(1.5f, -2.0f, 4.25f);
+
+		const math::Quaternion<float> rotations[] =
+		{
+			math::Quaternion<float>::AngleAxis(0.3f, math::Vector3<float>(0.0f, 0.6f, 0.8f)),
+			math::Quaternion<float>::AngleAxis(3.0f, math::Vector3<float>(1.0f, 0.0f, 0.0f)),
+			math::Quaternion<float>::AngleAxis(-3.0f, math::Vector3<float>(0.0f, 1.0f, 0.0f)),
+			math::Quaternion<float>::AngleAxis(3.1f, math::Vector3<float>(0.36f, 0.48f, -0.8f)),
+			math::Quaternion<float>(0.0f, 0.0f, 0.0f, 1.0f)
+		};
+
+		for (math::Quaternion<float> const& rotation : rotations)
+		{
+			// Scaled & mirrored matrices give the rotation of Decompose
+			for (math::Vector3<float> const& scale : { math::Vector3<float>(1.0f), math::Vector3<float>(2.0f, 0.5f, 3.0f), math::Vector3<float>(-2.0f, 0.5f, 3.0f) })
+			{
+				const math::Matrix4<float> matrix = math::Matrix4<float>::ComposeTRS(translation, rotation, scale);
+
+				math::Matrix3<float> matrix3;
+				matrix3.GetMatrix3(matrix, 3, 3);
+
+				math::Vector3<float> decomposedTranslation;
+				math::Quaternion<float> decomposedRotation;
+				math::Vector3<float> decomposedScale;
+
+				matrix.Decompose(decomposedTranslation, decomposedRotation, decomposedScale);
+
+				const math::Quaternion<float> fromMatrix4 = math::Quaternion<float>::FromMatrix4(matrix);
+				const math::Quaternion<float> fromMatrix3 = math::Quaternion<float>::FromMatrix3(matrix3);
+
+				for (unsigned int i = 0; i < 4; ++i)
+				{
+					CHECK(std::bit_cast<uint32_t>(fromMatrix4[i]) == std::bit_cast<uint32_t>(decomposedRotation[i]));
+					CHECK(std::bit_cast<uint32_t>(fromMatrix3[i]) == std::bit_cast<uint32_t>(fromMatrix4[i]));
+				}
+
+				if (scale[0] > 0.0f)
+					CHECK(sameRotation(fromMatrix4, rotation, 1e-6));
+			}
+
+			// Inverse of Matrix4::Transform
+			CHECK(sameRotation(math::Quaternion<float>::FromMatrix4(math::Matrix4<float>().Transform(rotation)), rotation, 1e-6));
+		}
+
+		// Zero scale
+		CHECK(math::Quaternion<float>::FromMatrix4(math::Matrix4<float>::ComposeTRS(translation, rotations[0], math::Vector3<float>(1.0f, 0.0f, 1.0f))) == math::Quaternion<float>(1.0f, 0.0f, 0.0f, 0.0f));
+
+		// Generic path
+		const math::Quaternion<double> rotationDouble = math::Quaternion<double>::AngleAxis(-2.5, math::Vector3<double>(0.0, 0.6, 0.8));
+		const math::Quaternion<double> fromMatrixDouble = math::Quaternion<double>::FromMatrix4(math::Matrix4<double>::ComposeTRS(math::Vector3<double>(1.0), rotationDouble, math::Vector3<double>(4.0)));
+
+		for (unsigned int i = 0; i < 4; ++i)
+			CHECK(fromMatrixDouble[i] == Catch::Approx(rotationDouble[i]).margin(1e-12));
+	}
+
+	SECTION("Batch")
+	{
+		// Odd count so the SIMD kernels also run their tail
+		constexpr size_t count = 37;
+
+		std::vector<math::Matrix4<float>> matrices;
+		std::vector<math::Matrix3<float>> matrices3(count);
+		std::vector<math::Vector3<float>> angles;
+		std::vector<math::Quaternion<float>> quaternions;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const float value = static_cast<float>(i);
+			const math::Quaternion<float> rotation = math::Quaternion<float>::AngleAxis(value * 0.37f - 6.0f, math::Vector3<float>(value * 0.1f - 1.0f, 0.5f, 1.0f).Normalize());
+			const math::Vector3<float> scale(1.0f + value * 0.1f, (i % 3 == 0) ? -0.5f : 2.0f, (i % 11 == 5) ? 0.0f : 0.75f);
+
+			matrices.push_back(math::Matrix4<float>::ComposeTRS(math::Vector3<float>(value), rotation, scale));
+			matrices3[i].GetMatrix3(matrices[i], 3, 3);
+			angles.emplace_back(value * 0.17f - 3.0f, value * 0.08f - 1.5f, 3.0f - value * 0.13f);
+			quaternions.push_back(rotation);
+		}
+
+		const math::simd::InstructionSet activeSet = math::simd::ActiveInstructionSet();
+
+		for (int set = 0; set <= static_cast<int>(math::simd::InstructionSet::AVX2_FMA); ++set)
+		{
+			if (!math::simd::SetInstructionSet(static_cast<math::simd::InstructionSet>(set)))
+				continue;
+
+			std::vector<math::Quaternion<float>> fromMatrix4(count);
+			std::vector<math::Quaternion<float>> fromMatrix3(count);
+			std::vector<math::Vector3<float>> toEuler(count);
+
+			math::Quaternion<float>::FromMatrix4(matrices, fromMatrix4);
+			math::Quaternion<float>::FromMatrix3(matrices3, fromMatrix3);
+			math::Quaternion<float>::ToEuler(quaternions, toEuler, EulerOrder::YXZ);
+
+			// Batches match the single functions exactly, whichever kernel runs
+			for (size_t i = 0; i < count; ++i)
+			{
+				const math::Quaternion<float> single4 = math::Quaternion<float>::FromMatrix4(matrices[i]);
+				const math::Quaternion<float> single3 = math::Quaternion<float>::FromMatrix3(matrices3[i]);
+
+				math::Radian<float> single[3];
+				quaternions[i].ToEuler(single[0], single[1], single[2], EulerOrder::YXZ);
+
+				for (unsigned int j = 0; j < 4; ++j)
+				{
+					CHECK(std::bit_cast<uint32_t>(fromMatrix4[i][j]) == std::bit_cast<uint32_t>(single4[j]));
+					CHECK(std::bit_cast<uint32_t>(fromMatrix3[i][j]) == std::bit_cast<uint32_t>(single3[j]));
+				}
+
+				for (unsigned int j = 0; j < 3; ++j)
+					CHECK(std::bit_cast<uint32_t>(toEuler[i][j]) == std::bit_cast<uint32_t>(single[j].Value()));
+			}
+
+			for (math::Precision precision : { math::Precision::Exact, math::Precision::Medium, math::Precision::Fast })
+			{
+				std::vector<math::Quaternion<float>> fromEuler(count);
+				math::Quaternion<float>::FromEuler(angles, fromEuler, EulerOrder::ZYZ, precision);
+
+				for (size_t i = 0; i < count; ++i)
+				{
+					const math::Quaternion<float> single = math::Quaternion<float>::FromEuler(math::Radian<float>(angles[i][0]), math::Radian<float>(angles[i][1]), math::Radian<float>(angles[i][2]), EulerOrder::ZYZ, precision);
+
+					for (unsigned int j = 0; j < 4; ++j)
+						CHECK(std::bit_cast<uint32_t>(fromEuler[i][j]) == std::bit_cast<uint32_t>(single[j]));
+				}
+			}
+		}
+
+		math::simd::SetInstructionSet(activeSet);
+
+		// Generic path
+		std::vector<math::Vector3<double>> anglesDouble = { math::Vector3<double>(0.1, 0.2, 0.3), math::Vector3<double>(-2.0, 1.0, 3.0) };
+		std::vector<math::Quaternion<double>> quaternionsDouble(anglesDouble.size());
+		std::vector<math::Vector3<double>> roundTrip(anglesDouble.size());
+
+		math::Quaternion<double>::FromEuler(anglesDouble, quaternionsDouble, EulerOrder::XZY);
+		math::Quaternion<double>::ToEuler(quaternionsDouble, roundTrip, EulerOrder::XZY);
+
+		for (size_t i = 0; i < anglesDouble.size(); ++i)
+		{
+			for (unsigned int j = 0; j < 3; ++j)
+				CHECK(roundTrip[i][j] == Catch::Approx(anglesDouble[i][j]).margin(1e-12));
+		}
+	}
+
+	SECTION("Constexpr")
+	{
+		constexpr math::Quaternion<double> fromMatrix = math::Quaternion<double>::FromMatrix3(math::Matrix3<double>(2.0));
+
+		constexpr double yaw = []
+		{
+			math::Radian<double> angles[3];
+			math::Quaternion<double>(0.0, 0.0, 0.0, 1.0).ToEuler(angles[0], angles[1], angles[2]);
+
+			return angles[2].Value();
+		}();
+
+		STATIC_REQUIRE(fromMatrix == math::Quaternion<double>(1.0, 0.0, 0.0, 0.0));
+
+		// Half turn around z
+		STATIC_REQUIRE(math::Abs(yaw - pi) < 1e-12);
+	}
+}
+
+TEST_CASE("QuaternionStream", "[.all][Quaternion]")
+{
+	// Odd size covers the SIMD blocks & the scalar tail
+	constexpr size_t size = 1003;
+
+	std::vector<math::Quaternion<float>> keyframes;
+	std::vector<math::Quaternion<float>> targets;
+	std::vector<float> weights;
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		const float value = static_cast<float>(i);
+		const math::Vector3<float> axis = math::Vector3<float>(std::sin(value), std::cos(value * 0.7f), 0.5f).Normalize();
+
+		keyframes.push_back(math::Quaternion<float>::AngleAxis(value * 0.01f, axis));
+		targets.push_back(math::Quaternion<float>::AngleAxis(value * 0.37f, axis.Cross(math::Vector3<float>(0.0f, 1.0f, 0.0f)).Normalize()));
+		weights.push_back(static_cast<float>(i % 17) / 16.0f);
+	}
+
+	// Some targets on the far hemisphere
+	for (size_t i = 0; i < size; i += 3)
+		targets[i] *= -1.0f;
+
+	const math::QuaternionStream<float> from(keyframes.data(), size);
+	const math::QuaternionStream<float> to(targets.data(), size);
+	math::QuaternionStream<float> result(size);
+
+#define CHECK_STREAM(stream, index, quat) for (unsigned int component = 0; component < 4; ++component) CHECK(stream.Get(index)[component] == quat[component])
+
+	SECTION("Layout")
+	{
+		CHECK(from.Size() == size);
+		CHECK(reinterpret_cast<std::uintptr_t>(from.W()) % math::QuaternionStream<float>::Alignment == 0);
+		CHECK(reinterpret_cast<std::uintptr_t>(from.Z()) % math::QuaternionStream<float>::Alignment == 0);
+
+		std::vector<math::Quaternion<float>> stored(size);
+		from.Store(stored.data());
+
+		for (size_t i = 0; i < size; ++i)
+			CHECK(stored[i] == keyframes[i]);
+
+		math::QuaternionStream<float> copy(from);
+		math::QuaternionStream<float> moved(std::move(copy));
+
+		CHECK(copy.Size() == 0);
+		CHECK_STREAM(moved, 500, keyframes[500]);
+	}
+
+	SECTION("Dot & normalize")
+	{
+		std::vector<float> dot(size);
+		from.Dot(to, dot.data());
+
+		math::QuaternionStream<float> scaled(to);
+		scaled.View().Normalize();
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			CHECK(dot[i] == keyframes[i].Dot(targets[i]));
+			CHECK_STREAM(scaled, i, math::Quaternion<float>(targets[i]).Normalize());
+		}
+	}
+
+	SECTION("Blend")
+	{
+		// Batch results are identical to the single quaternion functions
+		for (math::Precision precision : { math::Precision::Exact, math::Precision::Fast })
+		{
+			math::Nlerp<float>(from, to, weights, result, precision);
+
+			for (size_t i = 0; i < size; ++i)
+				CHECK_STREAM(result, i, math::Nlerp(keyframes[i], targets[i], weights[i], precision));
+
+			math::Slerp<float>(from, to, weights, result, precision);
+
+			for (size_t i = 0; i < size; ++i)
+				CHECK_STREAM(result, i, math::Slerp(keyframes[i], targets[i], weights[i], precision));
+		}
+
+		// In place, the result may be the input
+		math::QuaternionStream<float> blended(from);
+		math::Slerp<float>(blended, to, weights, blended, math::Precision::Fast);
+
+		CHECK_STREAM(blended, 7, math::Slerp(keyframes[7], targets[7], weights[7], math::Precision::Fast));
+	}
+
+	SECTION("Double")
+	{
+		std::vector<math::Quaternion<double>> keyframesDouble;
+		std::vector<math::Quaternion<double>> targetsDouble;
+		std::vector<double> weightsDouble(weights.begin(), weights.end());
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			keyframesDouble.emplace_back(keyframes[i][0], keyframes[i][1], keyframes[i][2], keyframes[i][3]);
+			targetsDouble.emplace_back(targets[i][0], targets[i][1], targets[i][2], targets[i][3]);
+		}
+
+		const math::QuaternionStream<double> fromDouble(keyframesDouble.data(), size);
+		const math::QuaternionStream<double> toDouble(targetsDouble.data(), size);
+		math::QuaternionStream<double> resultDouble(size);
+
+		math::Slerp<double>(fromDouble, toDouble, weightsDouble, resultDouble);
+		math::Slerp<float>(from, to, weights, result);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			for (unsigned int component = 0; component < 4; ++component)
+				CHECK(result.Get(i)[component] == Catch::Approx(resultDouble.Get(i)[component]).margin(1e-6));
+		}
+	}
+
+#undef CHECK_STREAM
+}
@@ -0,0 +1,195 @@
+#include "LibMath/TransformHierarchy.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <vector>
+
+namespace
+{
+	// Reference world matrices, every node recomputed in index order
+	template<typename T>
+	std::vector<math::Matrix4<T>> NaiveWorldMatrices(math::TransformHierarchy<T> const& hierarchy)
+	{
+		std::vector<math::Matrix4<T>> world(hierarchy.Size());
+
+		for (size_t i = 0; i < hierarchy.Size(); ++i)
+		{
+			const size_t parent = hierarchy.Parent(i);
+
+			if (parent == math::TransformHierarchy<T>::NoParent)
+				world[i] = hierarchy.LocalMatrix(i);
+			else
+				world[i] = world[parent] * hierarchy.LocalMatrix(i);
+		}
+
+		return world;
+	}
+
+	template<typename T>
+	bool SameMatrix(math::Matrix4<T> const& lhs, math::Matrix4<T> const& rhs)
+	{
+		for (int column = 0; column < 4; ++column)
+		{
+			for (int row = 0; row < 4; ++row)
+			{
+				if (lhs.m_matrix[column][row] != rhs.m_matrix[column][row])
+					return false;
+			}
+		}
+
+		return true;
+	}
+
+	template<typename T>
+	void BuildHierarchy(math::TransformHierarchy<T>& hierarchy, size_t nodeCount, size_t childCount)
+	{
+		for (size_t i = 0; i < nodeCount; ++i)
+		{
+			const size_t parent = (i == 0) ? math::TransformHierarchy<T>::NoParent : (i - 1) / childCount;
+			const T value = static_cast<T>(i % 7) * static_cast<T>(0.1);
+
+			hierarchy.AddNode(
+				parent,
+				math::Vector3<T>(value, static_cast<T>(1), -value),
+				math::Quaternion<T>::AngleAxis(value, math::Vector3<T>(static_cast<T>(0), static_cast<T>(0.6), static_cast<T>(0.8))),
+				math::Vector3<T>(static_cast<T>(1) + value)
+			);
+		}
+	}
+}
+
+TEST_CASE("TransformHierarchy", "[.all][TransformHierarchy]")
+{
+	SECTION("Local matrix")
+	{
+		// Scale, then rotate 90 degrees around z, then translate
+		math::TransformHierarchy<float> hierarchy;
+		const size_t node = hierarchy.AddNode(
+			math::TransformHierarchy<float>::NoParent,
+			math::Vector3<float>(1.0f, 2.0f, 3.0f),
+			math::Quaternion<float>::AngleAxis(PI * 0.5f, math::Vector3<float>(0.0f, 0.0f, 1.0f)),
+			math::Vector3<float>(2.0f, 3.0f, 4.0f)
+		);
+
+		const math::Matrix4<float> local = hierarchy.LocalMatrix(node);
+		const float expected[4][4] =
+		{
+			{ 0.0f, 2.0f, 0.0f, 0.0f },
+			{ -3.0f, 0.0f, 0.0f, 0.0f },
+			{ 0.0f, 0.0f, 4.0f, 0.0f },
+			{ 1.0f, 2.0f, 3.0f, 1.0f }
+		};
+
+		for (int column = 0; column < 4; ++column)
+		{
+			for (int row = 0; row < 4; ++row)
+				CHECK(local.m_matrix[column][row] == Catch::Approx(expected[column][row]).margin(1e-6));
+		}
+
+		CHECK(hierarchy.Update() == 1);
+		CHECK(SameMatrix(hierarchy.WorldMatrix(node), local));
+	}
+
+	SECTION("Parent chain")
+	{
+		// Translations accumulate through the chain, rotation & scale of the parents apply to the children
+		math::TransformHierarchy<float> hierarchy;
+		const size_t root = hierarchy.AddNode(math::TransformHierarchy<float>::NoParent, math::Vector3<float>(1.0f, 0.0f, 0.0f));
+		const size_t child = hierarchy.AddNode(root, math::Vector3<float>(0.0f, 2.0f, 0.0f), math::Quaternion<float>(1.0f, 0.0f, 0.0f, 0.0f), math::Vector3<float>(2.0f));
+		const size_t grandChild = hierarchy.AddNode(child, math::Vector3<float>(0.0f, 0.0f, 3.0f));
+
+		CHECK(hierarchy.Parent(grandChild) == child);
+		CHECK(hierarchy.Depth(root) == 0);
+		CHECK(hierarchy.Depth(grandChild) == 2);
+
+		hierarchy.Update();
+
+		CHECK(hierarchy.WorldMatrix(grandChild).m_matrix[3][0] == 1.0f);
+		CHECK(hierarchy.WorldMatrix(grandChild).m_matrix[3][1] == 2.0f);
+		CHECK(hierarchy.WorldMatrix(grandChild).m_matrix[3][2] == 6.0f);
+		CHECK(hierarchy.WorldMatrix(grandChild).m_matrix[0][0] == 2.0f);
+	}
+
+	SECTION("Dirty subtrees")
+	{
+		// 3 children per node, depth 6
+		math::TransformHierarchy<float> hierarchy;
+		BuildHierarchy(hierarchy, 1000, 3);
+
+		CHECK(hierarchy.Update() == hierarchy.Size());
+		CHECK(hierarchy.Update() == 0);
+
+		for (size_t i = 0; i < hierarchy.Size(); ++i)
+			CHECK_FALSE(hierarchy.IsDirty(i));
+
+		std::vector<math::Matrix4<float>> expected = NaiveWorldMatrices(hierarchy);
+
+		for (size_t i = 0; i < hierarchy.Size(); ++i)
+			CHECK(SameMatrix(hierarchy.WorldMatrix(i), expected[i]));
+
+		// Node 2 owns nodes 7 to 9, 22 to 30, 67 to 93, 202 to 282 & 607 to 849
+		hierarchy.SetRotation(2, math::Quaternion<float>::AngleAxis(1.2f, math::Vector3<float>(1.0f, 0.0f, 0.0f)));
+		hierarchy.SetTranslation(500, math::Vector3<float>(-4.0f, 0.5f, 2.0f));
+
+		const std::vector<math::Matrix4<float>> before(hierarchy.WorldMatrices().begin(), hierarchy.WorldMatrices().end());
+
+		CHECK(hierarchy.Update() == 1 + 3 + 9 + 27 + 81 + 243 + 1);
+
+		expected = NaiveWorldMatrices(hierarchy);
+
+		for (size_t i = 0; i < hierarchy.Size(); ++i)
+			CHECK(SameMatrix(hierarchy.WorldMatrix(i), expected[i]));
+
+		// Nodes outside the subtrees keep their matrix
+		CHECK(SameMatrix(hierarchy.WorldMatrix(1), before[1]));
+		CHECK(SameMatrix(hierarchy.WorldMatrix(499), before[499]));
+		CHECK_FALSE(SameMatrix(hierarchy.WorldMatrix(849), before[849]));
+
+		hierarchy.SetScale(0, math::Vector3<float>(0.5f));
+		CHECK(hierarchy.IsDirty(0));
+		CHECK(hierarchy.Update() == hierarchy.Size());
+	}
+
+	SECTION("Parallel levels")
+	{
+		// Wide levels split across threads, same result as the sequential reference
+		math::SetParallelThreadCount(8);
+
+		math::TransformHierarchy<float> hierarchy;
+		BuildHierarchy(hierarchy, 50000, 64);
+
+		hierarchy.Update();
+
+		std::vector<math::Matrix4<float>> expected = NaiveWorldMatrices(hierarchy);
+
+		for (size_t i = 0; i < hierarchy.Size(); ++i)
+			CHECK(SameMatrix(hierarchy.WorldMatrix(i), expected[i]));
+
+		hierarchy.SetLocal(1, math::Vector3<float>(3.0f), math::Quaternion<float>(1.0f, 0.0f, 0.0f, 0.0f), math::Vector3<float>(2.0f));
+		hierarchy.MarkDirty(700);
+		hierarchy.Update();
+
+		expected = NaiveWorldMatrices(hierarchy);
+
+		for (size_t i = 0; i < hierarchy.Size(); ++i)
+			CHECK(SameMatrix(hierarchy.WorldMatrix(i), expected[i]));
+
+		math::SetParallelThreadCount(0);
+	}
+
+	SECTION("Double")
+	{
+		math::TransformHierarchy<double> hierarchy;
+		BuildHierarchy(hierarchy, 200, 2);
+
+		hierarchy.Update();
+		hierarchy.SetScale(5, math::Vector3<double>(3.0));
+		hierarchy.Update();
+
+		const std::vector<math::Matrix4<double>> expected = NaiveWorldMatrices(hierarchy);
+
+		for (size_t i = 0; i < hierarchy.Size(); ++i)
+			CHECK(SameMatrix(hierarchy.WorldMatrix(i), expected[i]));
+	}
+}
@@ -0,0 +1,224 @@
+#include "LibMath/Trigonometry.h"
+#include "LibMath/Vector.h"
+#include "LibMath/Quaternion.h"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+TEST_CASE("SinCos", "[.all][angle][trigonometry]")
+{
+	SECTION("Exact")
+	{
+		// The exact tier is <cmath> (math::deterministic in deterministic builds)
+		for (float angle = -10.0f; angle <= 10.0f; angle += 0.37f)
+		{
+			float sin;
+			float cos;
+			math::SinCos(angle, sin, cos);
+
+#ifdef LIBMATH_DETERMINISTIC
+			CHECK(sin == static_cast<float>(math::deterministic::Sin(angle)));
+			CHECK(cos == static_cast<float>(math::deterministic::Cos(angle)));
+#else
+			CHECK(sin == std::sin(angle));
+			CHECK(cos == std::cos(angle));
+#endif
+		}
+
+		double sin;
+		double cos;
+		math::SinCos(math::Degree<double>(30.0), sin, cos);
+
+		CHECK(sin == Catch::Approx(0.5).epsilon(1e-15));
+		CHECK(cos == Catch::Approx(std::sqrt(3.0) * 0.5).epsilon(1e-15));
+	}
+
+	SECTION("Medium")
+	{
+		for (float angle = -8000.0f; angle <= 8000.0f; angle += 0.731f)
+		{
+			float sin;
+			float cos;
+			math::SinCos(angle, sin, cos, math::Precision::Medium);
+
+			CHECK(std::abs(sin - std::sin(static_cast<double>(angle))) < 1e-7);
+			CHECK(std::abs(cos - std::cos(static_cast<double>(angle))) < 1e-7);
+		}
+
+		for (double angle = -1000.0; angle <= 1000.0; angle += 0.731)
+		{
+			double sin;
+			double cos;
+			math::SinCos(angle, sin, cos, math::Precision::Medium);
+
+			CHECK(std::abs(sin - std::sin(angle)) < 4e-16);
+			CHECK(std::abs(cos - std::cos(angle)) < 4e-16);
+		}
+	}
+
+	SECTION("Fast")
+	{
+		for (float angle = -8000.0f; angle <= 8000.0f; angle += 0.731f)
+		{
+			float sin;
+			float cos;
+			math::SinCos(math::Radian<float>(angle), sin, cos, math::Precision::Fast);
+
+			CHECK(std::abs(sin - std::sin(static_cast<double>(angle))) < 4e-5);
+			CHECK(std::abs(cos - std::cos(static_cast<double>(angle))) < 4e-5);
+		}
+	}
+
+	SECTION("Edge cases")
+	{
+		float sin;
+		float cos;
+
+		// Quadrant boundaries keep the sign of the exact result
+		math::SinCos(0.0f, sin, cos, math::Precision::Medium);
+		CHECK(sin == 0.0f);
+		CHECK(cos == 1.0f);
+
+		math::SinCos(math::Degree<float>(90.0f), sin, cos, math::Precision::Medium);
+		CHECK(sin == 1.0f);
+		CHECK(std::abs(cos) < 1e-7f);
+
+		math::SinCos(math::Degree<float>(-180.0f), sin, cos, math::Precision::Fast);
+		CHECK(std::abs(sin) < 4e-5f);
+		CHECK(cos == Catch::Approx(-1.0f));
+
+		// Outside the polynomial range the exact path is used
+		math::SinCos(1e6f, sin, cos, math::Precision::Fast);
+		CHECK(sin == std::sin(1e6f));
+		CHECK(cos == std::cos(1e6f));
+
+		math::SinCos(std::numeric_limits<float>::quiet_NaN(), sin, cos, math::Precision::Medium);
+		CHECK(sin != sin);
+		CHECK(cos != cos);
+	}
+
+	SECTION("Batch")
+	{
+		// Odd size with a few out of range angles, covers the SIMD blocks, the fallback & the tail
+		std::vector<math::Radian<float>> radians;
+		std::vector<math::Degree<float>> degrees;
+
+		for (int i = 0; i < 1003; ++i)
+		{
+			radians.emplace_back(static_cast<float>(i - 500) * 0.173f);
+			degrees.emplace_back(static_cast<float>(i - 500) * 7.31f);
+		}
+
+		radians[17] = math::Radian<float>(1e5f);
+		degrees[402] = math::Degree<float>(std::numeric_limits<float>::infinity());
+
+		std::vector<float> sin(radians.size());
+		std::vector<float> cos(radians.size());
+
+		for (math::Precision precision : { math::Precision::Exact, math::Precision::Medium, math::Precision::Fast })
+		{
+			math::SinCos<float>(radians, sin, cos, precision);
+
+			for (size_t i = 0; i < radians.size(); ++i)
+			{
+				float expectedSin;
+				float expectedCos;
+				math::SinCos(radians[i], expectedSin, expectedCos, precision);
+
+				CHECK(sin[i] == expectedSin);
+				CHECK(cos[i] == expectedCos);
+			}
+
+			math::SinCos<float>(degrees, sin, cos, precision);
+
+			for (size_t i = 0; i < degrees.size(); ++i)
+			{
+				float expectedSin;
+				float expectedCos;
+				math::SinCos(degrees[i], expectedSin, expectedCos, precision);
+
+				if (i == 402)
+				{
+					CHECK(sin[i] != sin[i]);
+					continue;
+				}
+
+				CHECK(sin[i] == expectedSin);
+				CHECK(cos[i] == expectedCos);
+			}
+		}
+
+		// Double batches loop over the single angle function
+		std::vector<math::Radian<double>> radiansDouble;
+
+		for (int i = 0; i < 1002; ++i)
+			radiansDouble.emplace_back(static_cast<double>(i - 500) * 0.173);
+
+		std::vector<double> sinDouble(radiansDouble.size());
+		std::vector<double> cosDouble(radiansDouble.size());
+
+		math::SinCos<double>(radiansDouble, sinDouble, cosDouble, math::Precision::Medium);
+
+		for (size_t i = 0; i < radiansDouble.size(); ++i)
+		{
+			double expectedSin;
+			double expectedCos;
+			math::SinCos(radiansDouble[i], expectedSin, expectedCos, math::Precision::Medium);
+
+			CHECK(sinDouble[i] == expectedSin);
+			CHECK(cosDouble[i] == expectedCos);
+		}
+	}
+
+	SECTION("Rotation")
+	{
+		// Rotations evaluate sin & cos once, the fast tier stays close to the exact result
+		const math::Vector3<float> axis = math::Vector3<float>(1.0f, 2.0f, 3.0f).Normalize();
+
+		const math::Quaternion<float> exact = math::Quaternion<float>::AngleAxis(0.7f, axis);
+		const math::Quaternion<float> fast = math::Quaternion<float>::AngleAxis(0.7f, axis, math::Precision::Fast);
+		const math::Quaternion<double> exactDouble = math::Quaternion<double>::AngleAxis(0.7, math::Vector3<double>(1.0, 2.0, 3.0).Normalize());
+
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			CHECK(fast[i] == Catch::Approx(exact[i]).margin(4e-5));
+			CHECK(exact[i] == Catch::Approx(exactDouble[i]));
+		}
+
+		math::Vector3<float> rotated(1.0f, 0.0f, 0.0f);
+		rotated.Rotate(90.0f, math::Vector3<float>(0.0f, 0.0f, 1.0f), math::Precision::Medium);
+
+		CHECK(rotated[0] == Catch::Approx(0.0f).margin(1e-6));
+		CHECK(rotated[1] == Catch::Approx(1.0f));
+
+		math::Vector2<double> rotated2(1.0, 0.0);
+		rotated2.Rotate(PI * 0.5, math::Precision::Fast);
+
+		CHECK(rotated2[0] == Catch::Approx(0.0).margin(4e-5));
+		CHECK(rotated2[1] == Catch::Approx(1.0).margin(4e-5));
+	}
+
+	SECTION("Constexpr")
+	{
+		// The polynomial tiers are plain arithmetic, compile time & runtime results are identical
+		constexpr float sinMedium = []() { float sin = 0.0f; float cos = 0.0f; math::SinCos(2.5f, sin, cos, math::Precision::Medium); return sin; }();
+		constexpr float cosFast = []() { float sin = 0.0f; float cos = 0.0f; math::SinCos(2.5f, sin, cos, math::Precision::Fast); return cos; }();
+
+		STATIC_REQUIRE(math::AlmostEqual(sinMedium, 0.598472144f, 1e-7f));
+		STATIC_REQUIRE(math::AlmostEqual(cosFast, -0.801143616f, 4e-5f));
+
+		float sin;
+		float cos;
+		float runtimeAngle = 2.5f;
+
+		math::SinCos(runtimeAngle, sin, cos, math::Precision::Medium);
+		CHECK(sin == sinMedium);
+
+		math::SinCos(runtimeAngle, sin, cos, math::Precision::Fast);
+		CHECK(cos == cosFast);
+	}
+}
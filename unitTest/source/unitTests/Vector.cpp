@@ -13,6 +13,9 @@
 #include <glm/gtx/transform.hpp>
 #include <glm/gtx/vector_angle.hpp>
 
+#include <cstdint>
+#include <vector>
+
 //using namespace LibMath::Literal;
 
 #define CHECK_VECTOR2(vector, vectorGlm) CHECK(vector[0] == Catch::Approx(vectorGlm.x)); CHECK(vector[1] == Catch::Approx(vectorGlm.y))
@@ -1119,4 +1122,312 @@ TEST_CASE("Vector4", "[.all][vector][Vector4]")
 			CHECK_VECTOR4(vectorB, glm::normalize(vectorBGlm));
 		}
 	}
+}
+
+TEST_CASE("Vector3Stream", "[.all][vector][Vector3]")
+{
+	// Odd size so both the SIMD blocks & the scalar tail are covered
+	constexpr size_t size = 13;
+
+	std::vector<LibMath::Vector3<float>> vectorsA;
+	std::vector<LibMath::Vector3<float>> vectorsB;
+
+	for (size_t i = 0; i < size; ++i)
+	{
+		const float value = static_cast<float>(i);
+
+		vectorsA.emplace_back(value * 0.3f + 1.0f, value - 2.0f, value * 0.7f);
+		vectorsB.emplace_back(3.0f - value, value * 1.1f, 2.0f);
+	}
+
+	LibMath::Vector3Stream<float> streamA(vectorsA.data(), size);
+	LibMath::Vector3Stream<float> streamB(vectorsB.data(), size);
+
+	SECTION("Constructor")
+	{
+		LibMath::Vector3Stream<float> empty;
+		LibMath::Vector3Stream<float> zero(size);
+		LibMath::Vector3StreamView<float> view(vectorsA.data(), size);
+
+		CHECK(empty.Size() == 0);
+		CHECK(zero.Size() == size);
+		CHECK(zero.Get(size - 1) == LibMath::Vector3<float>::Zero());
+
+		// Owned lanes are aligned, the view reads the Vector3 array in place
+		CHECK(reinterpret_cast<std::uintptr_t>(streamA.X()) % LibMath::Vector3Stream<float>::Alignment == 0);
+		CHECK(reinterpret_cast<std::uintptr_t>(streamA.Y()) % LibMath::Vector3Stream<float>::Alignment == 0);
+		CHECK(reinterpret_cast<std::uintptr_t>(streamA.Z()) % LibMath::Vector3Stream<float>::Alignment == 0);
+		CHECK(streamA.IsContiguous());
+		CHECK(view.Stride() == 3);
+		CHECK(view.Y() == &vectorsA[0][1]);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			CHECK(streamA.Get(i) == vectorsA[i]);
+			CHECK(view.Get(i) == vectorsA[i]);
+		}
+
+		// Copy & move
+		LibMath::Vector3Stream<float> copy(streamA);
+		LibMath::Vector3Stream<float> moved(std::move(streamA));
+
+		CHECK(streamA.Size() == 0);
+		CHECK(copy.X() != moved.X());
+
+		// Store
+		std::vector<LibMath::Vector3<float>> copyStored(size);
+		std::vector<LibMath::Vector3<float>> movedStored(size);
+
+		copy.Store(copyStored.data());
+		moved.Store(movedStored.data());
+
+		CHECK(copyStored == vectorsA);
+		CHECK(movedStored == vectorsA);
+	}
+
+	SECTION("Functions")
+	{
+		std::vector<LibMath::Vector3<float>> arrayA(vectorsA);
+		std::vector<LibMath::Vector3<float>> arrayB(vectorsB);
+
+		LibMath::Vector3StreamView<float> viewA(arrayA.data(), size);
+		LibMath::Vector3StreamView<float> viewB(arrayB.data(), size);
+
+		// Dot & magnitude
+		float dot[size];
+		float dotView[size];
+		float magnitude[size];
+
+		streamA.Dot(streamB, dot);
+		viewA.Dot(viewB, dotView);
+		streamA.Magnitude(magnitude);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			const glm::vec3 vectorAGlm(vectorsA[i][0], vectorsA[i][1], vectorsA[i][2]);
+			const glm::vec3 vectorBGlm(vectorsB[i][0], vectorsB[i][1], vectorsB[i][2]);
+
+			CHECK(dot[i] == vectorsA[i].Dot(vectorsB[i]));
+			CHECK(dotView[i] == vectorsA[i].Dot(vectorsB[i]));
+			CHECK(magnitude[i] == vectorsA[i].Magnitude());
+			CHECK(dot[i] == Catch::Approx(glm::dot(vectorAGlm, vectorBGlm)));
+		}
+
+		// Cross, the view result aliases its input
+		LibMath::Vector3Stream<float> cross(size);
+
+		streamA.Cross(streamB, cross);
+		viewA.Cross(viewB, viewA);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			CHECK(cross.Get(i) == vectorsA[i].Cross(vectorsB[i]));
+			CHECK(arrayA[i] == vectorsA[i].Cross(vectorsB[i]));
+		}
+
+		// Normalize
+		LibMath::Vector3Stream<float> fastB(vectorsB.data(), size);
+
+		streamB.Normalize();
+		viewB.Normalize();
+		fastB.Normalize(LibMath::Precision::Fast);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			LibMath::Vector3<float> normalized(vectorsB[i]);
+			LibMath::Vector3<float> fast(vectorsB[i]);
+			normalized.Normalize();
+			fast.Normalize(LibMath::Precision::Fast);
+
+			CHECK(streamB.Get(i) == normalized);
+			CHECK(arrayB[i] == normalized);
+			CHECK(fastB.Get(i) == fast);
+		}
+
+		// Scale & translate
+		const LibMath::Vector3<float> scale(2.0f, -3.0f, 0.5f);
+		const LibMath::Vector3<float> translation(1.0f, 4.0f, -2.0f);
+
+		streamA.Scale(scale).Translate(translation);
+		cross.Scale(0.5f);
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			LibMath::Vector3<float> expected(vectorsA[i]);
+			expected.Scale(scale).Translate(translation);
+
+			CHECK(streamA.Get(i) == expected);
+			CHECK(cross.Get(i) == vectorsA[i].Cross(vectorsB[i]) * 0.5f);
+		}
+	}
+}
+
+TEST_CASE("Vector4 SIMD", "[.all][vector][Vector4]")
+{
+	// Vector4<float> forwards to Vector<4, float> which packs the 4 lanes in one __m128, Vector4<double> uses the scalar loops
+	const LibMath::Vector4<float> vectorA(1.5f, -2.0f, 3.25f, 0.75f);
+	const LibMath::Vector4<float> vectorB(-0.25f, 4.0f, 0.5f, -2.0f);
+	const LibMath::Vector4<double> vectorADouble(1.5, -2.0, 3.25, 0.75);
+	const LibMath::Vector4<double> vectorBDouble(-0.25, 4.0, 0.5, -2.0);
+
+	SECTION("Layout")
+	{
+		CHECK(sizeof(LibMath::Vector4<float>) == 4 * sizeof(float));
+#if LIBMATH_SIMD_SSE2
+		// Only the packed Vector<4, float> is 16 byte aligned
+		CHECK(alignof(LibMath::Vector4<float>) >= 4 * sizeof(float));
+#endif
+
+		LibMath::Vector4<float> vector(vectorA);
+		vector[2] = 9.0f;
+
+		CHECK(vector[0] == 1.5f);
+		CHECK(vector[2] == 9.0f);
+		CHECK(reinterpret_cast<float const*>(&vector)[2] == 9.0f);
+	}
+
+	SECTION("Matches generic")
+	{
+		// Reductions add lanes in the scalar order, the float results are exact
+		CHECK(vectorA.Dot(vectorB) == static_cast<float>(vectorADouble.Dot(vectorBDouble)));
+		CHECK(vectorA.Magnitude() == Catch::Approx(vectorADouble.Magnitude()));
+
+		LibMath::Vector4<float> normalized(vectorA);
+		LibMath::Vector4<double> normalizedDouble(vectorADouble);
+		normalized.Normalize();
+		normalizedDouble.Normalize();
+
+		LibMath::Vector4<float> negated(vectorA);
+		LibMath::Vector4<double> negatedDouble(vectorADouble);
+		-negated;
+		-negatedDouble;
+
+		for (unsigned int i = 0; i < 4; ++i)
+		{
+			CHECK((vectorA + vectorB)[i] == Catch::Approx((vectorADouble + vectorBDouble)[i]));
+			CHECK((vectorA - vectorB)[i] == Catch::Approx((vectorADouble - vectorBDouble)[i]));
+			CHECK((vectorA * vectorB)[i] == Catch::Approx((vectorADouble * vectorBDouble)[i]));
+			CHECK((vectorA / vectorB)[i] == Catch::Approx((vectorADouble / vectorBDouble)[i]));
+			CHECK((vectorA * 3.0f)[i] == Catch::Approx((vectorADouble * 3.0)[i]));
+			CHECK((vectorA / 3.0f)[i] == Catch::Approx((vectorADouble / 3.0)[i]));
+			CHECK(normalized[i] == Catch::Approx(normalizedDouble[i]));
+			CHECK(negated[i] == static_cast<float>(negatedDouble[i]));
+		}
+
+		CHECK(vectorA == LibMath::Vector4<float>(1.5f, -2.0f, 3.25f, 0.75f));
+		CHECK(vectorA != vectorB);
+		CHECK(vectorA.IsShorterThan(vectorB));
+	}
+
+	SECTION("Fast normalize")
+	{
+		// Reciprocal sqrt estimate + 1 Newton-Raphson step, within 5 ulp of the exact result
+		LibMath::Vector4<float> fast(vectorA);
+		LibMath::Vector4<float> exact(vectorA);
+		fast.Normalize(LibMath::Precision::Fast);
+		exact.Normalize();
+
+		LibMath::Vector3<float> fast3(1.5f, -2.0f, 3.25f);
+		LibMath::Vector3<float> exact3(fast3);
+		fast3.Normalize(LibMath::Precision::Fast);
+		exact3.Normalize();
+
+		for (unsigned int i = 0; i < 4; ++i)
+			CHECK(fast[i] == Catch::Approx(exact[i]).epsilon(1e-6));
+
+		for (unsigned int i = 0; i < 3; ++i)
+			CHECK(fast3[i] == Catch::Approx(exact3[i]).epsilon(1e-6));
+
+		CHECK(vectorA.Magnitude(LibMath::Precision::Fast) == Catch::Approx(vectorA.Magnitude()).epsilon(1e-6));
+		CHECK(LibMath::Vector4<float>().Magnitude(LibMath::Precision::Fast) == 0.0f);
+		CHECK(LibMath::Vector2<float>(3.0f, 4.0f).Normalize(LibMath::Precision::Fast) == LibMath::Vector2<float>(0.6f, 0.8f));
+	}
+}
+
+TEST_CASE("Vector<N>", "[.all][vector]")
+{
+	SECTION("Match fixed size vectors")
+	{
+		const LibMath::Vector3<float> vec3A(1.5f, -2.25f, 3.1f);
+		const LibMath::Vector3<float> vec3B(0.3f, 7.0f, -0.7f);
+		const LibMath::Vector4<float> vec4A(1.5f, -2.25f, 3.1f, 0.9f);
+		const LibMath::Vector4<float> vec4B(0.3f, 7.0f, -0.7f, 4.0f);
+
+		const LibMath::Vector<3, float> vecA(vec3A);
+		const LibMath::Vector<3, float> vecB(vec3B);
+		const LibMath::Vector<4, float> vecC(vec4A);
+		const LibMath::Vector<4, float> vecD(vec4B);
+
+		CHECK(static_cast<LibMath::Vector3<float>>(vecA + vecB * 0.5f) == vec3A + vec3B * 0.5f);
+		CHECK(static_cast<LibMath::Vector3<float>>(vecA.Cross(vecB)) == vec3A.Cross(vec3B));
+		CHECK(vecA.Dot(vecB) == vec3A.Dot(vec3B));
+		CHECK(static_cast<LibMath::Vector4<float>>(vecC - vecD / 2.0f) == vec4A - vec4B / 2.0f);
+		CHECK(vecC.Dot(vecD) == vec4A.Dot(vec4B));
+		CHECK(vecC.Magnitude() == Catch::Approx(vec4A.Magnitude()));
+	}
+
+	SECTION("Other sizes")
+	{
+		LibMath::Vector<5, double> vec(1.0, 2.0, 3.0, 4.0, 5.0);
+
+		CHECK(vec.Dot(LibMath::Vector<5, double>(1.0)) == 15.0);
+		CHECK(LibMath::Vector<5, double>(LibMath::Vector<4, double>(0.0, 3.0, 0.0, 0.0), 4.0).Magnitude() == 5.0);
+		CHECK((2.0 * vec)[4] == 10.0);
+		CHECK(-vec + vec == LibMath::Vector<5, double>::Zero());
+
+		vec.Normalize();
+		CHECK(vec.Magnitude() == Catch::Approx(1.0));
+	}
+
+	SECTION("Constexpr")
+	{
+		constexpr LibMath::Vector<3, float> right(1.0f, 0.0f, 0.0f);
+		constexpr LibMath::Vector<3, float> up(0.0f, 1.0f, 0.0f);
+
+		STATIC_REQUIRE(right.Cross(up) == LibMath::Vector<3, float>(0.0f, 0.0f, 1.0f));
+		STATIC_REQUIRE((right * 2.0f + up).MagnitudeSquared() == 5.0f);
+		STATIC_REQUIRE(alignof(LibMath::Vector<4, float>) == 16);
+	}
+}
+
+TEST_CASE("Vector constexpr", "[.all][vector]")
+{
+	SECTION("Vector2")
+	{
+		constexpr LibMath::Vector2<float> vector(3.0f, 4.0f);
+
+		STATIC_REQUIRE(vector.Magnitude() == 5.0f);
+		STATIC_REQUIRE(vector.Dot(LibMath::Vector2<float>::Up()) == 4.0f);
+		STATIC_REQUIRE(vector.Cross(LibMath::Vector2<float>::Right()) == -4.0f);
+		STATIC_REQUIRE(LibMath::Vector2<float>(vector).Normalize() == LibMath::Vector2<float>(0.6f, 0.8f));
+	}
+
+	SECTION("Vector3")
+	{
+		constexpr LibMath::Vector3<float> right = LibMath::Vector3<float>::Right();
+		constexpr LibMath::Vector3<float> up = LibMath::Vector3<float>::Up();
+
+		STATIC_REQUIRE(LibMath::Vector3<float>(2.0f, 3.0f, 6.0f).Magnitude() == 7.0f);
+		STATIC_REQUIRE(right.Cross(up) == LibMath::Vector3<float>(right[0] * 0.0f, 0.0f, right[0] * up[1]));
+		STATIC_REQUIRE((right + up)[0] == 1.0f);
+		STATIC_REQUIRE((right * 2.0f - up).MagnitudeSquared() == 5.0f);
+		STATIC_REQUIRE(LibMath::Vector3<float>(0.0f, 0.0f, 5.0f).Normalize().IsUnit());
+		STATIC_REQUIRE(math::AlmostEqual(right.AngleFrom(up), PI * 0.5f));
+	}
+
+	SECTION("Vector4")
+	{
+		// Vector<4, float> uses SSE2 when available, the scalar path runs at compile time
+		constexpr LibMath::Vector4<float> vector(1.0f, 2.0f, 3.0f, 4.0f);
+
+		STATIC_REQUIRE(vector.Dot(LibMath::Vector4<float>(1.0f)) == 10.0f);
+		STATIC_REQUIRE((vector * 2.0f)[3] == 8.0f);
+		STATIC_REQUIRE((vector - vector) == LibMath::Vector4<float>::Zero());
+		STATIC_REQUIRE(LibMath::Vector4<float>(0.0f, 3.0f, 0.0f, 4.0f).Magnitude() == 5.0f);
+		STATIC_REQUIRE(LibMath::Vector4<double>(0.0, 3.0, 0.0, 4.0).Magnitude() == 5.0);
+
+		// Same result at runtime
+		LibMath::Vector4<float> runtimeVector(1.0f, 2.0f, 3.0f, 4.0f);
+		CHECK(runtimeVector.Dot(LibMath::Vector4<float>(1.0f)) == vector.Dot(LibMath::Vector4<float>(1.0f)));
+	}
 }
\ No newline at end of file